@@ -3,21 +3,51 @@
 #include "AudioManager/AudioManager.h"
 #include "Kismet/GameplayStatics.h"
 #include "Engine/Engine.h"
+#include "GameFramework/WorldSettings.h"
+#include "GameFramework/PlayerController.h"
+#include "Sound/SoundAttenuation.h"
+#include "UObject/UObjectArray.h"
+#include "Containers/Ticker.h"
 
-// ̬ʵ
+// 静态实例定义
 template<>
 UAudioManager* TSingleton<UAudioManager>::SingletonInstance = nullptr;
 
 UAudioManager::UAudioManager()
     : AudioDataTable(nullptr)
     , CurrentBGMComponent(nullptr)
+    , SFXRequestCount(0)
+    , SFXMergedCount(0)
+    , MaxQueuedPlaysPerSound(4)
+    , SoundCacheHits(0)
+    , SoundCacheMisses(0)
 {
+    bBatchSFX = true;
+    SFXMergeDistance = 100.0f;
+    SFXMergeWindow = 0.05f;
+    SFXMergeVolumeStep = 0.2f;
+    SFXMaxMergedVolumeScale = 1.5f;
+
+    bUseAudioComponentPool = true;
+    AudioPoolInitialSize = 16;
+    AudioPoolMaxSize = 64;
+    AudioPoolOverflowPolicy = EAudioPoolOverflowPolicy::CreateTransient;
+
+    MaxGlobalVoices = 64;
+    VirtualVoiceUpdateInterval = 0.25f;
+    VirtualizeDistanceMargin = 1.1f;
+    CategoryVoiceLimits.Add(EAudioCategory::BGM, 2);
+    CategoryVoiceLimits.Add(EAudioCategory::SFX, 32);
+    CategoryVoiceLimits.Add(EAudioCategory::Ambient, 16);
+    CategoryVoiceLimits.Add(EAudioCategory::Voice, 4);
+    CategoryVoiceLimits.Add(EAudioCategory::UI, 8);
 }
 
-UAudioManager::~UAudioManager()
+void UAudioManager::BeginDestroy()
 {
-    // Ƶ
-    StopAllSounds();
+    // 销毁期间只停止并清理，不广播事件
+    ReleaseAllSounds();
+    Super::BeginDestroy();
 }
 
 void UAudioManager::InitializeSingleton()
@@ -30,7 +60,7 @@ void UAudioManager::InitializeAudioManager()
 {
     UE_LOG(LogTemp, Log, TEXT("Audio Manager Initialized"));
 
-    // ʼĬ
+    // 初始化默认音量
     CategoryVolumes.Add(EAudioCategory::BGM, 0.8f);
     CategoryVolumes.Add(EAudioCategory::SFX, 0.8f);
     CategoryVolumes.Add(EAudioCategory::Ambient, 0.8f);
@@ -63,7 +93,7 @@ UAudioComponent* UAudioManager::PlaySound(
 {
     if (Delay > 0.0f)
     {
-        // ӳٲŴ
+        // 延迟播放处理
         FTimerDelegate TimerDel;
         FTimerHandle TimerHandle;
 
@@ -92,31 +122,127 @@ UAudioComponent* UAudioManager::PlaySound(
     UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::LogAndReturnNull);
     if (!World) return nullptr;
 
-    USoundBase* SoundAsset = Config->SoundAsset.LoadSynchronous();
-    if (!SoundAsset)
+    USoundBase* SoundAsset = FindResidentSound(SoundID, *Config);
+    if (SoundAsset)
     {
-        UE_LOG(LogTemp, Error, TEXT("Failed to load sound: %s"), *SoundID.ToString());
+        SoundCacheHits++;
+        return PlayLoadedSound(World, SoundID, *Config, SoundAsset, AttachActor, Location, FadeInTime, PitchMultiplier);
+    }
+
+    // 资源不在内存中：不在游戏线程同步加载，按配置排队或丢弃
+    SoundCacheMisses++;
+    RequestSoundLoad(SoundID, *Config);
+
+    if (Config->LoadPolicy == EAudioLoadPolicy::QueueUntilLoaded)
+    {
+        TArray<FQueuedSoundPlay>& Queue = QueuedPlays.FindOrAdd(SoundID);
+        if (Queue.Num() < MaxQueuedPlaysPerSound)
+        {
+            FQueuedSoundPlay& Play = Queue.AddDefaulted_GetRef();
+            Play.WorldContextObject = WorldContextObject;
+            Play.AttachActor = AttachActor;
+            Play.bHasAttachActor = AttachActor != nullptr;
+            Play.Location = Location;
+            Play.FadeInTime = FadeInTime;
+            Play.PitchMultiplier = PitchMultiplier;
+            Play.RequestTime = FPlatformTime::Seconds();
+        }
+    }
+
+    return nullptr;
+}
+
+UAudioComponent* UAudioManager::PlayLoadedSound(UWorld* World, FName SoundID, const FAudioConfig& Config, USoundBase* SoundAsset,
+    AActor* AttachActor, FVector Location, float FadeInTime, float PitchMultiplier, float StartOffset)
+{
+    const bool bLooping = Config.bLooping || SoundAsset->IsLooping();
+    const float AudibleDistance = GetAudibleDistance(Config, SoundAsset);
+    const FVector EmitterLocation = AttachActor ? AttachActor->GetActorLocation() : Location;
+
+    // 虚拟发声记录，超出范围或没有发声配额时使用
+    FVirtualSound Virtual;
+    Virtual.SoundID = SoundID;
+    Virtual.Category = Config.Category;
+    Virtual.World = World;
+    Virtual.AttachActor = AttachActor;
+    Virtual.bHasAttachActor = AttachActor != nullptr;
+    Virtual.Location = Location;
+    Virtual.PitchMultiplier = PitchMultiplier;
+    Virtual.AudibleDistance = AudibleDistance;
+    Virtual.Duration = SoundAsset->GetDuration();
+    Virtual.bLooping = bLooping;
+    Virtual.StartTime = World->GetAudioTimeSeconds() - StartOffset;
+
+    // 听者处的响度估计，用于抢占比较
+    float Audibility = Config.DefaultVolume * GetCategoryVolume(Config.Category);
+    FVector ListenerLocation;
+    if (AudibleDistance > 0.0f && GetListenerLocation(World, ListenerLocation))
+    {
+        const float Distance = FVector::Dist(ListenerLocation, EmitterLocation);
+
+        // 超出衰减范围：不创建组件，只推进播放时间
+        if (Distance > AudibleDistance)
+        {
+            if (bLooping || Virtual.Duration > StartOffset)
+            {
+                AddVirtualSound(Virtual);
+                if (StartOffset <= 0.0f)
+                {
+                    OnSoundStarted.Broadcast(SoundID);
+                }
+            }
+            return nullptr;
+        }
+
+        Audibility *= 1.0f - FMath::Clamp(Distance / AudibleDistance, 0.0f, 1.0f);
+    }
+
+    UAudioComponent* VoiceVictim = nullptr;
+    if (!AcquireVoice(World, Config, Audibility, VoiceVictim))
+    {
+        // 循环音频保留为虚拟发声，等有空位再恢复；一次性音频直接丢弃
+        if (bLooping)
+        {
+            AddVirtualSound(Virtual);
+        }
+        else
+        {
+            UE_LOG(LogTemp, Verbose, TEXT("Voice limit reached, sound dropped: %s"), *SoundID.ToString());
+        }
+        return nullptr;
+    }
+
+    // 获取音频组件（池化组件已注册并绑定完成回调），拿到组件后才抢占，池按Drop策略耗尽时不影响已有发声
+    bool bPooled = false;
+    UAudioComponent* AudioComponent = AcquireAudioComponent(World, AttachActor, bPooled);
+    if (!AudioComponent)
+    {
+        if (bLooping)
+        {
+            AddVirtualSound(Virtual);
+        }
         return nullptr;
     }
 
-    // Ƶ
-    UAudioComponent* AudioComponent = NewObject<UAudioComponent>(AttachActor ? AttachActor : World->GetWorldSettings());
-    if (!AudioComponent) return nullptr;
+    if (VoiceVictim)
+    {
+        StealVoice(VoiceVictim);
+    }
 
-    // Ƶ
+    // 配置音频组件
     AudioComponent->SetSound(SoundAsset);
 
-    // 
-    float FinalPitchMultiplier = PitchMultiplier * Config->PitchMultiplier;
+    // 设置音调
+    float FinalPitchMultiplier = PitchMultiplier * Config.PitchMultiplier;
     AudioComponent->SetPitchMultiplier(FinalPitchMultiplier);
 
-    // 
-    float VolumeMultiplier = Config->DefaultVolume * CategoryVolumes[Config->Category];
+    // 设置音量
+    float VolumeMultiplier = Config.DefaultVolume * CategoryVolumes[Config.Category];
     AudioComponent->SetVolumeMultiplier(VolumeMultiplier);
 
-    // ռ仯
+    // 空间化设置
     bool bAllowSpatialization = true;
-    switch (Config->Category)
+    switch (Config.Category)
     {
     case EAudioCategory::BGM:
     case EAudioCategory::UI:
@@ -130,7 +256,7 @@ UAudioComponent* UAudioManager::PlaySound(
     }
 
     AudioComponent->bAllowSpatialization = bAllowSpatialization;
-    AudioComponent->AttenuationSettings = Config->AttenuationSettings.Get();
+    AudioComponent->AttenuationSettings = Config.AttenuationSettings.Get();
 
     if (AttachActor && AttachActor->GetRootComponent())
     {
@@ -144,170 +270,384 @@ UAudioComponent* UAudioManager::PlaySound(
         AudioComponent->SetWorldLocation(Location);
     }
 
-    // עʼ
-    AudioComponent->RegisterComponent();
-    AudioComponent->OnAudioFinished.AddDynamic(this, &UAudioManager::HandleAudioFinished);
-
-    // ¼Ծ
-    ActiveComponents.Add(AudioComponent, SoundID);
+    // 临时组件需要注册并绑定回调
+    if (!bPooled)
+    {
+        AudioComponent->RegisterComponent();
+        AudioComponent->OnAudioFinishedNative.AddUObject(this, &UAudioManager::HandleAudioFinished);
+    }
 
-    // ֱӲ
+    // 记录活跃组件
+    FActiveSoundInfo Info;
+    Info.SoundID = SoundID;
+    Info.Category = Config.Category;
+    Info.Priority = Config.Priority;
+    Info.bLooping = bLooping;
+    Info.AudibleDistance = AudibleDistance;
+    Info.PitchMultiplier = PitchMultiplier;
+    Info.StartTime = Virtual.StartTime;
+    AddActiveSound(AudioComponent, Info);
+
+    // 淡入或直接播放
     if (FadeInTime > 0.0f)
     {
-        AudioComponent->FadeIn(FadeInTime, VolumeMultiplier);
+        AudioComponent->FadeIn(FadeInTime, VolumeMultiplier, StartOffset);
     }
     else
     {
-        AudioComponent->Play();
+        AudioComponent->Play(StartOffset);
+    }
+
+    // 有衰减范围的循环音频需要定期检查是否降级为虚拟发声
+    if (bLooping && AudibleDistance > 0.0f)
+    {
+        EnsureVirtualVoiceTimer(World);
     }
 
-    // ¼
-    OnSoundStarted.Broadcast(SoundID);
+    // 触发事件，从虚拟发声恢复时不重复广播
+    if (StartOffset <= 0.0f)
+    {
+        OnSoundStarted.Broadcast(SoundID);
+    }
 
     UE_LOG(LogTemp, Log, TEXT("Playing sound: %s, Category: %s"),
         *SoundID.ToString(),
-        *UEnum::GetValueAsString(Config->Category));
+        *UEnum::GetValueAsString(Config.Category));
 
     return AudioComponent;
 }
 
-void UAudioManager::HandleAudioFinished()
+void UAudioManager::HandleAudioFinished(UAudioComponent* AudioComponent)
+{
+    // 回调携带组件本身，手动停止的组件已先移出活跃表
+    FActiveSoundInfo Info;
+    if (!RemoveActiveSound(AudioComponent, &Info))
+    {
+        return;
+    }
+
+    OnSoundFinished.Broadcast(Info.SoundID);
+    ReleaseAudioComponent(AudioComponent);
+}
+
+void UAudioManager::AddActiveSound(UAudioComponent* AudioComponent, const FActiveSoundInfo& Info)
 {
-    // ɵƵ
-    TArray<UAudioComponent*> CompletedComponents;
+    ActiveComponents.Add(AudioComponent, Info);
+    ComponentsBySoundID.FindOrAdd(Info.SoundID).Add(AudioComponent);
+    ComponentsByCategory.FindOrAdd(Info.Category).Add(AudioComponent);
+}
 
-    for (auto& Pair : ActiveComponents)
+bool UAudioManager::RemoveActiveSound(UAudioComponent* AudioComponent, FActiveSoundInfo* OutInfo)
+{
+    FActiveSoundInfo Info;
+    if (!ActiveComponents.RemoveAndCopyValue(AudioComponent, Info))
     {
-        UAudioComponent* Comp = Pair.Key;
-        if (IsValid(Comp) && !Comp->IsPlaying())
-        {
-            CompletedComponents.Add(Comp);
-        }
+        return false;
     }
 
-    for (UAudioComponent* Comp : CompletedComponents)
+    // 索引数组保留容量，同一SoundID反复播放时不重新分配
+    if (TArray<UAudioComponent*>* ByID = ComponentsBySoundID.Find(Info.SoundID))
+    {
+        ByID->RemoveSingleSwap(AudioComponent, EAllowShrinking::No);
+    }
+    if (TArray<UAudioComponent*>* ByCategory = ComponentsByCategory.Find(Info.Category))
     {
-        const FName SoundID = ActiveComponents[Comp];
-        OnSoundFinished.Broadcast(SoundID);
-        ActiveComponents.Remove(Comp);
+        ByCategory->RemoveSingleSwap(AudioComponent, EAllowShrinking::No);
+    }
 
-        if (Comp->IsValidLowLevel())
-        {
-            Comp->DestroyComponent();
-        }
+    // 池化组件会被复用，不能再通过BGM引用访问
+    if (CurrentBGMComponent == AudioComponent)
+    {
+        CurrentBGMComponent = nullptr;
     }
+
+    if (OutInfo)
+    {
+        *OutInfo = Info;
+    }
+    return true;
 }
 
-void UAudioManager::StopSound(FName SoundID)
+void UAudioManager::StopActiveComponents(TArray<UAudioComponent*> Components)
 {
-    TArray<UAudioComponent*> ComponentsToStop;
-
-    for (auto& Pair : ActiveComponents)
+    // 参数按值传入，停止过程中索引数组会被修改
+    for (UAudioComponent* Component : Components)
     {
-        if (Pair.Value == SoundID)
+        FActiveSoundInfo Info;
+        if (!RemoveActiveSound(Component, &Info))
         {
-            ComponentsToStop.Add(Pair.Key);
+            continue;
         }
-    }
-
-    for (UAudioComponent* Component : ComponentsToStop)
-    {
-        Component->Stop();
-        ActiveComponents.Remove(Component);
 
-        if (Component->IsValidLowLevel())
+        if (IsValid(Component))
         {
-            Component->DestroyComponent();
+            Component->Stop();
+            ReleaseAudioComponent(Component);
         }
+        OnSoundFinished.Broadcast(Info.SoundID);
     }
 }
 
-void UAudioManager::StopAllSounds()
+int32 UAudioManager::GetCategoryVoiceCount(EAudioCategory Category) const
+{
+    const TArray<UAudioComponent*>* Components = ComponentsByCategory.Find(Category);
+    return Components ? Components->Num() : 0;
+}
+
+void UAudioManager::StopSound(FName SoundID)
 {
-    for (auto& Pair : ActiveComponents)
+    CancelQueuedPlays([SoundID](FName QueuedID) { return QueuedID == SoundID; });
+    RemoveVirtualSounds([SoundID](const FVirtualSound& Virtual) { return Virtual.SoundID == SoundID; });
+    PendingSFXRequests.RemoveAll([SoundID](const FPendingSFXRequest& Request) { return Request.SoundID == SoundID; });
+
+    if (const TArray<UAudioComponent*>* Components = ComponentsBySoundID.Find(SoundID))
     {
-        if (Pair.Key && Pair.Key->IsValidLowLevel())
-        {
-            Pair.Key->Stop();
-            Pair.Key->DestroyComponent();
-        }
+        StopActiveComponents(*Components);
     }
-    ActiveComponents.Empty();
+}
 
-    // ͬʱյǰBGM
+void UAudioManager::StopAllSounds()
+{
+    // 与StopSound及按类别停止一致，每个被停止的发声都广播OnSoundFinished；排队和虚拟发声未真正发声，不广播
+    QueuedPlays.Empty();
+    VirtualSounds.Empty();
+    PendingSFXRequests.Reset();
+    RecentSFX.Reset();
+    ClearSFXFlush();
+    StopVirtualVoiceTimer();
+
+    TArray<UAudioComponent*> Components;
+    ActiveComponents.GenerateKeyArray(Components);
+    StopActiveComponents(Components);
+
+    // 同时清空当前BGM引用
     CurrentBGMComponent = nullptr;
 }
 
-void UAudioManager::StopAllSoundsByCategory(EAudioCategory Category)
+void UAudioManager::ReleaseAllSounds()
 {
-    TArray<UAudioComponent*> ComponentsToStop;
+    // 先清空映射，Stop触发的完成回调不会再处理这些组件
+    TArray<UAudioComponent*> Components;
+    ActiveComponents.GenerateKeyArray(Components);
+    ActiveComponents.Empty();
+    ComponentsBySoundID.Empty();
+    ComponentsByCategory.Empty();
 
-    for (auto& Pair : ActiveComponents)
+    for (UAudioComponent* Component : Components)
     {
-        const FAudioConfig* Config = GetAudioConfig(Pair.Value);
-        if (Config && Config->Category == Category)
+        if (IsValid(Component))
         {
-            ComponentsToStop.Add(Pair.Key);
+            Component->Stop();
         }
     }
 
-    for (UAudioComponent* Component : ComponentsToStop)
+    QueuedPlays.Empty();
+    VirtualSounds.Empty();
+    PendingSFXRequests.Reset();
+    RecentSFX.Reset();
+    ClearSFXFlush();
+    StopVirtualVoiceTimer();
+    CurrentBGMComponent = nullptr;
+}
+
+void UAudioManager::StopAllSoundsByCategory(EAudioCategory Category)
+{
+    CancelQueuedPlaysInCategory(Category);
+    RemoveVirtualSounds([Category](const FVirtualSound& Virtual) { return Virtual.Category == Category; });
+    if (Category == EAudioCategory::SFX)
     {
-        Component->Stop();
-        ActiveComponents.Remove(Component);
+        PendingSFXRequests.Reset();
+    }
 
-        if (Component->IsValidLowLevel())
-        {
-            Component->DestroyComponent();
-        }
+    if (const TArray<UAudioComponent*>* Components = ComponentsByCategory.Find(Category))
+    {
+        StopActiveComponents(*Components);
     }
 
-    // BGM𣬻ҪյǰBGM
+    // 如果是BGM类别，还需要清空当前BGM引用
     if (Category == EAudioCategory::BGM)
     {
         CurrentBGMComponent = nullptr;
     }
 }
 
-// ========== SFX Чʵ ==========
+// ========== SFX 音效管理实现 ==========
 
 void UAudioManager::PlaySFX(UObject* WorldContextObject, FName SoundID, AActor* AttachActor, FVector Location, float PitchMultiplier)
 {
+    UWorld* World = bBatchSFX ? GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull) : nullptr;
+    if (World)
+    {
+        SFXRequestCount++;
+
+        // 同一帧内的多次命中、拾取等请求合并为一次播放
+        if (MergeSFXRequest(World, SoundID, AttachActor, Location))
+        {
+            SFXMergedCount++;
+            return;
+        }
+
+        FPendingSFXRequest& Request = PendingSFXRequests.AddDefaulted_GetRef();
+        Request.SoundID = SoundID;
+        Request.WorldContextObject = WorldContextObject;
+        Request.AttachActor = AttachActor;
+        Request.Location = Location;
+        Request.PitchMultiplier = PitchMultiplier;
+
+        ScheduleSFXFlush(World);
+        return;
+    }
+
     PlaySound(
         WorldContextObject,
         SoundID,
         AttachActor,
         Location,
-        0.0f,  // ޵
-        0.0f,  // ӳ
+        0.0f,  // 无淡入
+        0.0f,  // 无延迟
         PitchMultiplier
     );
 }
 
 void UAudioManager::StopSFX(FName SoundID)
 {
-    TArray<UAudioComponent*> ComponentsToStop;
+    StopSoundInCategory(SoundID, EAudioCategory::SFX);
+}
+
+void UAudioManager::ScheduleSFXFlush(UWorld* World)
+{
+    // 调度所在的World可能已随切换关卡销毁，此时计时器永远不会触发
+    UWorld* TimerWorld = SFXFlushTimerWorld.Get();
+    if (TimerWorld && TimerWorld->GetTimerManager().TimerExists(SFXFlushTimerHandle))
+    {
+        return;
+    }
+
+    SFXFlushTimerHandle = World->GetTimerManager().SetTimerForNextTick(this, &UAudioManager::FlushSFXBatch);
+    SFXFlushTimerWorld = World;
+}
+
+void UAudioManager::ClearSFXFlush()
+{
+    if (UWorld* TimerWorld = SFXFlushTimerWorld.Get())
+    {
+        TimerWorld->GetTimerManager().ClearTimer(SFXFlushTimerHandle);
+    }
+    SFXFlushTimerHandle.Invalidate();
+    SFXFlushTimerWorld.Reset();
+}
+
+void UAudioManager::FlushSFXBatch()
+{
+    SFXFlushTimerHandle.Invalidate();
+    SFXFlushTimerWorld.Reset();
+    if (PendingSFXRequests.Num() == 0)
+    {
+        return;
+    }
 
-    for (auto& Pair : ActiveComponents)
+    TArray<FPendingSFXRequest> Requests = MoveTemp(PendingSFXRequests);
+    PendingSFXRequests.Reset();
+
+    for (const FPendingSFXRequest& Request : Requests)
     {
-        if (Pair.Value == SoundID)
+        UObject* WorldContextObject = Request.WorldContextObject.Get();
+        UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+        if (!World)
+        {
+            continue;
+        }
+
+        AActor* AttachActor = Request.AttachActor.Get();
+        UAudioComponent* AudioComponent = PlaySound(WorldContextObject, Request.SoundID, AttachActor, Request.Location, 0.0f, 0.0f, Request.PitchMultiplier);
+        if (!AudioComponent)
+        {
+            // 排队等待加载或被丢弃的播放不参与合并，后续请求照常播放
+            continue;
+        }
+
+        if (Request.VolumeScale != 1.0f)
+        {
+            AudioComponent->SetVolumeMultiplier(AudioComponent->VolumeMultiplier * Request.VolumeScale);
+        }
+
+        FRecentSFX& Recent = RecentSFX.AddDefaulted_GetRef();
+        Recent.SoundID = Request.SoundID;
+        Recent.Component = AudioComponent;
+        Recent.AttachActor = AttachActor;
+        Recent.Location = Request.Location;
+        Recent.VolumeScale = Request.VolumeScale;
+        Recent.PlayTime = World->GetAudioTimeSeconds();
+    }
+}
+
+void UAudioManager::GetSFXBatchStats(int32& OutRequests, int32& OutMerged) const
+{
+    OutRequests = SFXRequestCount;
+    OutMerged = SFXMergedCount;
+}
+
+bool UAudioManager::MergeSFXRequest(UWorld* World, FName SoundID, AActor* AttachActor, const FVector& Location)
+{
+    const float MergeDistanceSq = FMath::Square(SFXMergeDistance);
+    auto IsNearby = [&](const TWeakObjectPtr<AActor>& OtherActor, const FVector& OtherLocation)
         {
-            const FAudioConfig* Config = GetAudioConfig(SoundID);
-            if (Config && Config->Category == EAudioCategory::SFX)
+            // 挂载在同一Actor上视为同一位置
+            if (AttachActor || OtherActor.IsValid())
             {
-                ComponentsToStop.Add(Pair.Key);
+                return OtherActor.Get() == AttachActor;
             }
+            return FVector::DistSquared(OtherLocation, Location) <= MergeDistanceSq;
+        };
+
+    for (FPendingSFXRequest& Request : PendingSFXRequests)
+    {
+        if (Request.SoundID == SoundID && IsNearby(Request.AttachActor, Request.Location))
+        {
+            Request.MergedCount++;
+            Request.VolumeScale = FMath::Min(Request.VolumeScale + SFXMergeVolumeStep, SFXMaxMergedVolumeScale);
+            return true;
         }
     }
 
-    for (UAudioComponent* Component : ComponentsToStop)
+    // 合并窗口外的记录先清理
+    const double Now = World->GetAudioTimeSeconds();
+    RecentSFX.RemoveAllSwap([Now, this](const FRecentSFX& Recent) { return Now - Recent.PlayTime > SFXMergeWindow; });
+
+    for (FRecentSFX& Recent : RecentSFX)
     {
-        Component->Stop();
-        ActiveComponents.Remove(Component);
-        if (Component->IsValidLowLevel())
+        if (Recent.SoundID != SoundID || !IsNearby(Recent.AttachActor, Recent.Location))
         {
-            Component->DestroyComponent();
+            continue;
         }
+
+        // 只并入仍在播放的发声，否则请求会被吞掉
+        UAudioComponent* AudioComponent = Recent.Component.Get();
+        if (!AudioComponent || !AudioComponent->IsPlaying())
+        {
+            continue;
+        }
+
+        // 刚开始播放的同一音效直接提高音量，不再叠加新发声
+        if (SFXMergeVolumeStep > 0.0f)
+        {
+            const float NewScale = FMath::Min(Recent.VolumeScale + SFXMergeVolumeStep, SFXMaxMergedVolumeScale);
+            AudioComponent->SetVolumeMultiplier(AudioComponent->VolumeMultiplier * NewScale / Recent.VolumeScale);
+            Recent.VolumeScale = NewScale;
+        }
+        return true;
+    }
+
+    return false;
+}
+
+void UAudioManager::StopSoundInCategory(FName SoundID, EAudioCategory Category)
+{
+    // SoundID的类别由配置决定，只需检查一次
+    const FAudioConfig* Config = GetAudioConfig(SoundID);
+    if (Config && Config->Category == Category)
+    {
+        StopSound(SoundID);
     }
 }
 
@@ -316,10 +656,13 @@ void UAudioManager::StopAllSFX()
     StopAllSoundsByCategory(EAudioCategory::SFX);
 }
 
-// ========== BGM ʵ ==========
+// ========== BGM 管理实现 ==========
 
 void UAudioManager::PlayBGM(UObject* WorldContextObject, FName SoundID, float FadeTime)
 {
+    // 还在等待加载的上一首BGM不再播放，否则加载完成后会与新BGM同时响起
+    CancelQueuedPlaysInCategory(EAudioCategory::BGM);
+
     if (CurrentBGMComponent && CurrentBGMComponent->IsPlaying())
     {
         StopBGM(FadeTime);
@@ -336,6 +679,9 @@ void UAudioManager::PlayBGM(UObject* WorldContextObject, FName SoundID, float Fa
 
 void UAudioManager::StopBGM(float FadeTime)
 {
+    // 还在等待加载的BGM也不再播放
+    CancelQueuedPlaysInCategory(EAudioCategory::BGM);
+
     if (CurrentBGMComponent)
     {
         if (FadeTime > 0.0f)
@@ -344,12 +690,7 @@ void UAudioManager::StopBGM(float FadeTime)
         }
         else
         {
-            CurrentBGMComponent->Stop();
-            ActiveComponents.Remove(CurrentBGMComponent);
-            if (CurrentBGMComponent->IsValidLowLevel())
-            {
-                CurrentBGMComponent->DestroyComponent();
-            }
+            StopActiveComponents({ CurrentBGMComponent });
         }
         CurrentBGMComponent = nullptr;
     }
@@ -371,7 +712,7 @@ void UAudioManager::ResumeBGM()
     }
 }
 
-// ========== ʵ ==========
+// ========== 环境音管理实现 ==========
 
 void UAudioManager::PlayAmbient(UObject* WorldContextObject, FName SoundID, AActor* AttachActor, float FadeTime)
 {
@@ -386,35 +727,23 @@ void UAudioManager::PlayAmbient(UObject* WorldContextObject, FName SoundID, AAct
 
 void UAudioManager::StopAmbient(FName SoundID, float FadeTime)
 {
-    TArray<UAudioComponent*> ComponentsToStop;
-
-    for (auto& Pair : ActiveComponents)
+    const FAudioConfig* Config = GetAudioConfig(SoundID);
+    if (!Config || Config->Category != EAudioCategory::Ambient)
     {
-        if (Pair.Value == SoundID)
-        {
-            const FAudioConfig* Config = GetAudioConfig(SoundID);
-            if (Config && Config->Category == EAudioCategory::Ambient)
-            {
-                ComponentsToStop.Add(Pair.Key);
-            }
-        }
+        return;
     }
 
-    for (UAudioComponent* Component : ComponentsToStop)
+    const TArray<UAudioComponent*>* Components = ComponentsBySoundID.Find(SoundID);
+    if (FadeTime > 0.0f && Components)
     {
-        if (FadeTime > 0.0f)
+        for (UAudioComponent* Component : TArray<UAudioComponent*>(*Components))
         {
             FadeOutAudioComponent(Component, FadeTime);
         }
-        else
-        {
-            Component->Stop();
-            ActiveComponents.Remove(Component);
-            if (Component->IsValidLowLevel())
-            {
-                Component->DestroyComponent();
-            }
-        }
+    }
+    else
+    {
+        StopSound(SoundID);
     }
 }
 
@@ -423,7 +752,7 @@ void UAudioManager::StopAllAmbient(float FadeTime)
     StopAllSoundsByCategory(EAudioCategory::Ambient);
 }
 
-// ========== ʵ ==========
+// ========== 语音管理实现 ==========
 
 void UAudioManager::PlayVoice(UObject* WorldContextObject, FName SoundID, AActor* AttachActor)
 {
@@ -436,29 +765,7 @@ void UAudioManager::PlayVoice(UObject* WorldContextObject, FName SoundID, AActor
 
 void UAudioManager::StopVoice(FName SoundID)
 {
-    TArray<UAudioComponent*> ComponentsToStop;
-
-    for (auto& Pair : ActiveComponents)
-    {
-        if (Pair.Value == SoundID)
-        {
-            const FAudioConfig* Config = GetAudioConfig(SoundID);
-            if (Config && Config->Category == EAudioCategory::Voice)
-            {
-                ComponentsToStop.Add(Pair.Key);
-            }
-        }
-    }
-
-    for (UAudioComponent* Component : ComponentsToStop)
-    {
-        Component->Stop();
-        ActiveComponents.Remove(Component);
-        if (Component->IsValidLowLevel())
-        {
-            Component->DestroyComponent();
-        }
-    }
+    StopSoundInCategory(SoundID, EAudioCategory::Voice);
 }
 
 void UAudioManager::StopAllVoice()
@@ -466,7 +773,7 @@ void UAudioManager::StopAllVoice()
     StopAllSoundsByCategory(EAudioCategory::Voice);
 }
 
-// ========== UIЧʵ ==========
+// ========== UI音效管理实现 ==========
 
 void UAudioManager::PlayUISound(UObject* WorldContextObject, FName SoundID)
 {
@@ -483,47 +790,26 @@ void UAudioManager::PlayUISound(UObject* WorldContextObject, FName SoundID)
 
 void UAudioManager::StopUISound(FName SoundID)
 {
-    TArray<UAudioComponent*> ComponentsToStop;
-
-    for (auto& Pair : ActiveComponents)
-    {
-        if (Pair.Value == SoundID)
-        {
-            const FAudioConfig* Config = GetAudioConfig(SoundID);
-            if (Config && Config->Category == EAudioCategory::UI)
-            {
-                ComponentsToStop.Add(Pair.Key);
-            }
-        }
-    }
-
-    for (UAudioComponent* Component : ComponentsToStop)
-    {
-        Component->Stop();
-        ActiveComponents.Remove(Component);
-        if (Component->IsValidLowLevel())
-        {
-            Component->DestroyComponent();
-        }
-    }
+    StopSoundInCategory(SoundID, EAudioCategory::UI);
 }
 
-// ========== ʵ ==========
+// ========== 音量控制实现 ==========
 
 void UAudioManager::SetCategoryVolume(EAudioCategory Category, float NewVolume)
 {
     float ClampedVolume = FMath::Clamp(NewVolume, 0.0f, 1.0f);
     CategoryVolumes.Add(Category, ClampedVolume);
 
-    // лԾƵ
-    for (auto& Pair : ActiveComponents)
+    // 更新该类别活跃音频的音量
+    if (const TArray<UAudioComponent*>* Components = ComponentsByCategory.Find(Category))
     {
-        UAudioComponent* Component = Pair.Key;
-        const FAudioConfig* Config = GetAudioConfig(Pair.Value);
-
-        if (Component && Config && Config->Category == Category)
+        for (UAudioComponent* Component : *Components)
         {
-            Component->SetVolumeMultiplier(Config->DefaultVolume * ClampedVolume);
+            const FAudioConfig* Config = GetAudioConfig(ActiveComponents[Component].SoundID);
+            if (Config && IsValid(Component))
+            {
+                Component->SetVolumeMultiplier(Config->DefaultVolume * ClampedVolume);
+            }
         }
     }
 
@@ -550,108 +836,789 @@ void UAudioManager::ResetAllVolumes()
     SetAllVolumes(0.8f, 0.8f, 0.8f, 0.8f, 0.8f);
 }
 
-// ========== Ƶ״̬ѯʵ ==========
+// ========== 音频预加载实现 ==========
 
-bool UAudioManager::IsSoundPlaying(FName SoundID) const
+bool UAudioManager::PreloadSound(FName SoundID)
 {
-    for (auto& Pair : ActiveComponents)
+    if (PreloadedSounds.Contains(SoundID))
     {
-        if (Pair.Value == SoundID && Pair.Key && Pair.Key->IsPlaying())
-        {
-            return true;
-        }
+        return true;
     }
-    return false;
-}
 
-int32 UAudioManager::GetActiveSoundCount() const
-{
-    return ActiveComponents.Num();
+    const FAudioConfig* Config = GetAudioConfig(SoundID);
+    if (!Config || Config->SoundAsset.IsNull())
+    {
+        UE_LOG(LogTemp, Warning, TEXT("PreloadSound - SoundID %s not found or invalid"), *SoundID.ToString());
+        return false;
+    }
+
+    // 已在内存中的资源直接常驻，否则异步加载，完成后在HandleSoundLoaded中常驻
+    if (USoundBase* SoundAsset = FindResidentSound(SoundID, *Config))
+    {
+        PreloadedSounds.Add(SoundID, SoundAsset);
+        return true;
+    }
+
+    RequestSoundLoad(SoundID, *Config, true);
+    return true;
 }
 
-int32 UAudioManager::GetActiveSoundCountByCategory(EAudioCategory Category) const
+void UAudioManager::PreloadSounds(const TArray<FName>& SoundIDs)
 {
-    int32 Count = 0;
-    for (auto& Pair : ActiveComponents)
+    for (const FName& SoundID : SoundIDs)
     {
-        const FAudioConfig* Config = GetAudioConfig(Pair.Value);
-        if (Config && Config->Category == Category)
-        {
-            Count++;
-        }
+        PreloadSound(SoundID);
     }
-    return Count;
 }
 
-// ========== Թʵ ==========
-
-void UAudioManager::PrintAudioSystemStatus()
+bool UAudioManager::IsSoundPreloaded(FName SoundID) const
 {
-    UE_LOG(LogTemp, Log, TEXT("=== Audio System Status ==="));
-    UE_LOG(LogTemp, Log, TEXT("Total Active Sounds: %d"), ActiveComponents.Num());
-
-    // ͳ
-    TMap<EAudioCategory, int32> CategoryCounts;
+    return PreloadedSounds.Contains(SoundID);
+}
 
-    // ֶƵе
-    TArray<EAudioCategory> AllCategories = {
-        EAudioCategory::BGM,
-        EAudioCategory::SFX,
-        EAudioCategory::Ambient,
-        EAudioCategory::Voice,
-        EAudioCategory::UI
-    };
+void UAudioManager::ReleasePreloadedSounds()
+{
+    PreloadedSounds.Empty();
+    PinnedSoundLoads.Empty();
+}
 
-    for (EAudioCategory Category : AllCategories)
+void UAudioManager::PrewarmCategory(EAudioCategory Category)
+{
+    if (!AudioDataTable)
     {
-        CategoryCounts.Add(Category, 0);
+        UE_LOG(LogTemp, Warning, TEXT("PrewarmCategory - AudioDataTable not set"));
+        return;
     }
 
-    for (auto& Pair : ActiveComponents)
+    TArray<FName> SoundIDs;
+    for (const auto& RowPair : AudioDataTable->GetRowMap())
     {
-        const FAudioConfig* Config = GetAudioConfig(Pair.Value);
-        if (Config)
+        const FAudioConfig* Config = reinterpret_cast<const FAudioConfig*>(RowPair.Value);
+        if (Config && Config->Category == Category)
         {
-            CategoryCounts[Config->Category]++;
+            SoundIDs.Add(RowPair.Key);
         }
     }
 
-    for (EAudioCategory Category : AllCategories)
-    {
-        UE_LOG(LogTemp, Log, TEXT("  %s: %d"), *UEnum::GetValueAsString(Category), CategoryCounts[Category]);
-    }
-
-    UE_LOG(LogTemp, Log, TEXT("Current BGM: %s"), CurrentBGMComponent ? TEXT("Playing") : TEXT("None"));
-    UE_LOG(LogTemp, Log, TEXT("=== End Status ==="));
+    PrewarmSounds(SoundIDs);
 }
 
-void UAudioManager::PrintCategoryStatus(EAudioCategory Category)
+void UAudioManager::PrewarmSounds(const TArray<FName>& SoundIDs)
 {
-    UE_LOG(LogTemp, Log, TEXT("=== %s Audio Status ==="), *UEnum::GetValueAsString(Category));
-
-    int32 Count = 0;
-    for (auto& Pair : ActiveComponents)
+    int32 RequestedCount = 0;
+    for (const FName& SoundID : SoundIDs)
     {
-        const FAudioConfig* Config = GetAudioConfig(Pair.Value);
-        if (Config && Config->Category == Category)
+        const FAudioConfig* Config = GetAudioConfig(SoundID);
+        if (!Config || Config->SoundAsset.IsNull() || PreloadedSounds.Contains(SoundID))
         {
-            UE_LOG(LogTemp, Log, TEXT("  - %s"), *Pair.Value.ToString());
-            Count++;
+            continue;
         }
+
+        RequestSoundLoad(SoundID, *Config, true);
+        RequestedCount++;
     }
 
-    UE_LOG(LogTemp, Log, TEXT("Total: %d sounds"), Count);
-    UE_LOG(LogTemp, Log, TEXT("=== End %s Status ==="), *UEnum::GetValueAsString(Category));
+    UE_LOG(LogTemp, Log, TEXT("PrewarmSounds - streaming %d/%d sounds"), RequestedCount, SoundIDs.Num());
 }
 
-// ========== ڲ ==========
+bool UAudioManager::IsSoundLoading(FName SoundID) const
+{
+    return PendingSoundLoads.Contains(SoundID);
+}
 
-UWorld* UAudioManager::GetWorld() const
+void UAudioManager::GetSoundCacheStats(int32& OutHits, int32& OutMisses) const
 {
-    if (GEngine)
-    {
-        for (const FWorldContext& Context : GEngine->GetWorldContexts())
-        {
+    OutHits = SoundCacheHits;
+    OutMisses = SoundCacheMisses;
+}
+
+void UAudioManager::ResetSoundCacheStats()
+{
+    SoundCacheHits = 0;
+    SoundCacheMisses = 0;
+}
+
+// ========== 音频组件池实现 ==========
+
+void UAudioManager::WarmupAudioPool(UObject* WorldContextObject, int32 Count)
+{
+    UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::LogAndReturnNull);
+    FAudioComponentPool* Pool = FindOrCreateAudioPool(World);
+    if (!Pool) return;
+
+    const int32 TargetCount = FMath::Min(Count, AudioPoolMaxSize);
+    while (Pool->Components.Num() < TargetCount)
+    {
+        UAudioComponent* Component = CreatePooledAudioComponent(*Pool);
+        if (!Component) break;
+        Pool->FreeComponents.Add(Component);
+    }
+}
+
+void UAudioManager::ClearAudioPools()
+{
+    for (FAudioComponentPool& Pool : AudioPools)
+    {
+        for (UAudioComponent* Component : Pool.Components)
+        {
+            RemoveActiveSound(Component);
+            if (IsValid(Component))
+            {
+                Component->DestroyComponent();
+            }
+        }
+    }
+
+    AudioPools.Empty();
+    PooledComponentSet.Empty();
+}
+
+UAudioComponent* UAudioManager::AcquireAudioComponent(UWorld* World, AActor* AttachActor, bool& bOutPooled)
+{
+    bOutPooled = false;
+
+    FAudioComponentPool* Pool = bUseAudioComponentPool ? FindOrCreateAudioPool(World) : nullptr;
+    if (Pool)
+    {
+        UAudioComponent* Component = nullptr;
+
+        // 跳过被外部销毁的组件
+        while (!Component && Pool->FreeComponents.Num() > 0)
+        {
+            UAudioComponent* Candidate = Pool->FreeComponents.Pop(EAllowShrinking::No);
+            if (IsValid(Candidate))
+            {
+                Component = Candidate;
+            }
+            else
+            {
+                Pool->Components.Remove(Candidate);
+                PooledComponentSet.Remove(Candidate);
+            }
+        }
+
+        if (!Component && Pool->Components.Num() < AudioPoolMaxSize)
+        {
+            Component = CreatePooledAudioComponent(*Pool);
+        }
+
+        // 抢占最早开始播放的组件
+        if (!Component && AudioPoolOverflowPolicy == EAudioPoolOverflowPolicy::StealOldest && Pool->InUseComponents.Num() > 0)
+        {
+            UAudioComponent* Oldest = Pool->InUseComponents[0];
+
+            FActiveSoundInfo StolenInfo;
+            if (RemoveActiveSound(Oldest, &StolenInfo))
+            {
+                OnSoundFinished.Broadcast(StolenInfo.SoundID);
+            }
+
+            ReleaseAudioComponent(Oldest);
+            if (Pool->FreeComponents.Num() > 0)
+            {
+                Component = Pool->FreeComponents.Pop(EAllowShrinking::No);
+            }
+        }
+
+        if (Component)
+        {
+            Pool->InUseComponents.Add(Component);
+            bOutPooled = true;
+            return Component;
+        }
+
+        if (AudioPoolOverflowPolicy == EAudioPoolOverflowPolicy::Drop)
+        {
+            UE_LOG(LogTemp, Verbose, TEXT("Audio pool exhausted, sound dropped"));
+            return nullptr;
+        }
+    }
+
+    // 未启用池或池溢出时创建临时组件，播放结束后销毁
+    return NewObject<UAudioComponent>(AttachActor ? AttachActor : World->GetWorldSettings());
+}
+
+void UAudioManager::ReleaseAudioComponent(UAudioComponent* AudioComponent)
+{
+    if (!IsValid(AudioComponent)) return;
+
+    if (!PooledComponentSet.Contains(AudioComponent))
+    {
+        AudioComponent->DestroyComponent();
+        return;
+    }
+
+    for (FAudioComponentPool& Pool : AudioPools)
+    {
+        if (Pool.InUseComponents.RemoveSingle(AudioComponent) > 0)
+        {
+            // 重置到空闲状态，保留注册和完成回调
+            AudioComponent->Stop();
+            AudioComponent->SetPaused(false);
+            AudioComponent->DetachFromComponent(FDetachmentTransformRules::KeepWorldTransform);
+            AudioComponent->SetSound(nullptr);
+            Pool.FreeComponents.Add(AudioComponent);
+            return;
+        }
+    }
+}
+
+FAudioComponentPool* UAudioManager::FindOrCreateAudioPool(UWorld* World)
+{
+    if (!World || !World->GetWorldSettings()) return nullptr;
+
+    for (int32 i = AudioPools.Num() - 1; i >= 0; --i)
+    {
+        if (AudioPools[i].World == World)
+        {
+            return &AudioPools[i];
+        }
+
+        // World已销毁，组件随WorldSettings一起回收
+        if (!AudioPools[i].World.IsValid())
+        {
+            for (UAudioComponent* Component : AudioPools[i].Components)
+            {
+                PooledComponentSet.Remove(Component);
+            }
+            AudioPools.RemoveAt(i);
+        }
+    }
+
+    FAudioComponentPool& NewPool = AudioPools.AddDefaulted_GetRef();
+    NewPool.World = World;
+
+    const int32 InitialCount = FMath::Min(AudioPoolInitialSize, AudioPoolMaxSize);
+    for (int32 i = 0; i < InitialCount; i++)
+    {
+        if (UAudioComponent* Component = CreatePooledAudioComponent(NewPool))
+        {
+            NewPool.FreeComponents.Add(Component);
+        }
+    }
+
+    return &NewPool;
+}
+
+UAudioComponent* UAudioManager::CreatePooledAudioComponent(FAudioComponentPool& Pool)
+{
+    UWorld* World = Pool.World.Get();
+    if (!World || !World->GetWorldSettings()) return nullptr;
+
+    UAudioComponent* Component = NewObject<UAudioComponent>(World->GetWorldSettings());
+    Component->bAutoActivate = false;
+    Component->bAutoDestroy = false;
+    Component->RegisterComponent();
+    Component->OnAudioFinishedNative.AddUObject(this, &UAudioManager::HandleAudioFinished);
+
+    Pool.Components.Add(Component);
+    PooledComponentSet.Add(Component);
+    return Component;
+}
+
+// ========== 发声数限制与虚拟化实现 ==========
+
+bool UAudioManager::HasFreeVoice(EAudioCategory Category) const
+{
+    if (MaxGlobalVoices > 0 && ActiveComponents.Num() >= MaxGlobalVoices)
+    {
+        return false;
+    }
+
+    const int32* CategoryLimit = CategoryVoiceLimits.Find(Category);
+    return !CategoryLimit || *CategoryLimit <= 0 || GetCategoryVoiceCount(Category) < *CategoryLimit;
+}
+
+bool UAudioManager::AcquireVoice(UWorld* World, const FAudioConfig& Config, float Audibility, UAudioComponent*& OutVictim)
+{
+    OutVictim = nullptr;
+    if (HasFreeVoice(Config.Category))
+    {
+        return true;
+    }
+
+    // 类别已满只在本类别内抢占，否则在全部发声中抢占
+    const int32* CategoryLimit = CategoryVoiceLimits.Find(Config.Category);
+    const bool bCategoryFull = CategoryLimit && *CategoryLimit > 0 && GetCategoryVoiceCount(Config.Category) >= *CategoryLimit;
+
+    FVector ListenerLocation;
+    const bool bHasListener = GetListenerLocation(World, ListenerLocation);
+
+    // 选出优先级最低、在听者处最安静的发声
+    UAudioComponent* Victim = nullptr;
+    int32 VictimPriority = MAX_int32;
+    float VictimAudibility = MAX_flt;
+    auto ConsiderVictim = [&](UAudioComponent* Component, const FActiveSoundInfo& Info)
+        {
+            if (!IsValid(Component) || Component == CurrentBGMComponent)
+            {
+                return;
+            }
+
+            const float ComponentAudibility = GetComponentAudibility(Component, Info, bHasListener ? &ListenerLocation : nullptr);
+            if (Info.Priority < VictimPriority || (Info.Priority == VictimPriority && ComponentAudibility < VictimAudibility))
+            {
+                Victim = Component;
+                VictimPriority = Info.Priority;
+                VictimAudibility = ComponentAudibility;
+            }
+        };
+
+    if (bCategoryFull)
+    {
+        for (UAudioComponent* Component : ComponentsByCategory[Config.Category])
+        {
+            ConsiderVictim(Component, ActiveComponents[Component]);
+        }
+    }
+    else
+    {
+        for (const auto& Pair : ActiveComponents)
+        {
+            ConsiderVictim(Pair.Key, Pair.Value);
+        }
+    }
+
+    // 新发声必须优先级更高，或同优先级下更响
+    if (!Victim || VictimPriority > Config.Priority || (VictimPriority == Config.Priority && VictimAudibility >= Audibility))
+    {
+        return false;
+    }
+
+    OutVictim = Victim;
+    return true;
+}
+
+void UAudioManager::StealVoice(UAudioComponent* AudioComponent)
+{
+    FActiveSoundInfo Info;
+    if (!RemoveActiveSound(AudioComponent, &Info))
+    {
+        return;
+    }
+
+    // 循环音频转为虚拟发声，之后有空位再恢复；一次性音频直接结束
+    if (Info.bLooping)
+    {
+        VirtualizeActiveSound(AudioComponent, Info);
+    }
+    else
+    {
+        OnSoundFinished.Broadcast(Info.SoundID);
+    }
+
+    ReleaseAudioComponent(AudioComponent);
+}
+
+bool UAudioManager::GetListenerLocation(UWorld* World, FVector& OutLocation) const
+{
+    APlayerController* PlayerController = World ? World->GetFirstPlayerController() : nullptr;
+    if (!PlayerController) return false;
+
+    FVector FrontDir;
+    FVector RightDir;
+    PlayerController->GetAudioListenerPosition(OutLocation, FrontDir, RightDir);
+    return true;
+}
+
+float UAudioManager::GetAudibleDistance(const FAudioConfig& Config, const USoundBase* SoundAsset) const
+{
+    // BGM和UI不做空间化，始终可闻
+    if (Config.Category == EAudioCategory::BGM || Config.Category == EAudioCategory::UI)
+    {
+        return 0.0f;
+    }
+
+    const USoundAttenuation* Attenuation = Config.AttenuationSettings.Get();
+    if (!Attenuation && SoundAsset)
+    {
+        Attenuation = SoundAsset->AttenuationSettings;
+    }
+
+    if (!Attenuation || !Attenuation->Attenuation.bAttenuate)
+    {
+        return 0.0f;
+    }
+
+    return Attenuation->Attenuation.GetMaxDimension();
+}
+
+float UAudioManager::GetComponentAudibility(const UAudioComponent* AudioComponent, const FActiveSoundInfo& Info, const FVector* ListenerLocation) const
+{
+    float Audibility = AudioComponent->VolumeMultiplier;
+
+    if (ListenerLocation && Info.AudibleDistance > 0.0f)
+    {
+        const float Distance = FVector::Dist(*ListenerLocation, AudioComponent->GetComponentLocation());
+        Audibility *= 1.0f - FMath::Clamp(Distance / Info.AudibleDistance, 0.0f, 1.0f);
+    }
+
+    return Audibility;
+}
+
+void UAudioManager::AddVirtualSound(const FVirtualSound& VirtualSound)
+{
+    VirtualSounds.Add(VirtualSound);
+    EnsureVirtualVoiceTimer(VirtualSound.World.Get());
+}
+
+void UAudioManager::EnsureVirtualVoiceTimer(UWorld* World)
+{
+    if (!World || (VirtualVoiceTimerWorld == World && World->GetTimerManager().IsTimerActive(VirtualVoiceTimerHandle)))
+    {
+        return;
+    }
+
+    // 旧World的定时器随World一起销毁
+    VirtualVoiceTimerWorld = World;
+    World->GetTimerManager().SetTimer(VirtualVoiceTimerHandle, FTimerDelegate::CreateUObject(this, &UAudioManager::UpdateVirtualVoices),
+        VirtualVoiceUpdateInterval, true);
+}
+
+void UAudioManager::StopVirtualVoiceTimer()
+{
+    if (UWorld* World = VirtualVoiceTimerWorld.Get())
+    {
+        World->GetTimerManager().ClearTimer(VirtualVoiceTimerHandle);
+    }
+    VirtualVoiceTimerHandle.Invalidate();
+    VirtualVoiceTimerWorld.Reset();
+}
+
+void UAudioManager::VirtualizeActiveSound(UAudioComponent* AudioComponent, const FActiveSoundInfo& Info)
+{
+    FVirtualSound Virtual;
+    Virtual.SoundID = Info.SoundID;
+    Virtual.Category = Info.Category;
+    Virtual.World = AudioComponent->GetWorld();
+    Virtual.Location = AudioComponent->GetComponentLocation();
+    Virtual.PitchMultiplier = Info.PitchMultiplier;
+    Virtual.AudibleDistance = Info.AudibleDistance;
+    Virtual.Duration = AudioComponent->Sound ? AudioComponent->Sound->GetDuration() : 0.0f;
+    Virtual.bLooping = Info.bLooping;
+    Virtual.StartTime = Info.StartTime;
+
+    if (USceneComponent* AttachParent = AudioComponent->GetAttachParent())
+    {
+        Virtual.AttachActor = AttachParent->GetOwner();
+        Virtual.bHasAttachActor = Virtual.AttachActor.IsValid();
+    }
+
+    AddVirtualSound(Virtual);
+}
+
+void UAudioManager::UpdateVirtualVoices()
+{
+    // 超出可闻范围的循环发声降级为虚拟发声，释放组件
+    TArray<UAudioComponent*> ComponentsToVirtualize;
+    bool bHasVirtualizableVoices = false;
+    for (const auto& Pair : ActiveComponents)
+    {
+        const FActiveSoundInfo& Info = Pair.Value;
+        if (!Info.bLooping || Info.AudibleDistance <= 0.0f || !IsValid(Pair.Key))
+        {
+            continue;
+        }
+
+        FVector ListenerLocation;
+        if (GetListenerLocation(Pair.Key->GetWorld(), ListenerLocation)
+            && FVector::Dist(ListenerLocation, Pair.Key->GetComponentLocation()) > Info.AudibleDistance * VirtualizeDistanceMargin)
+        {
+            ComponentsToVirtualize.Add(Pair.Key);
+        }
+        else
+        {
+            bHasVirtualizableVoices = true;
+        }
+    }
+
+    for (UAudioComponent* Component : ComponentsToVirtualize)
+    {
+        FActiveSoundInfo Info;
+        RemoveActiveSound(Component, &Info);
+        VirtualizeActiveSound(Component, Info);
+        ReleaseAudioComponent(Component);
+    }
+
+    // 推进虚拟发声：结束的移除，重新可闻且有空位的恢复为真实发声
+    for (int32 i = VirtualSounds.Num() - 1; i >= 0; --i)
+    {
+        const FVirtualSound Virtual = VirtualSounds[i];
+        UWorld* World = Virtual.World.Get();
+        AActor* AttachActor = Virtual.AttachActor.Get();
+        const FAudioConfig* Config = GetAudioConfig(Virtual.SoundID);
+        if (!World || !Config || (Virtual.bHasAttachActor && !AttachActor))
+        {
+            VirtualSounds.RemoveAtSwap(i);
+            continue;
+        }
+
+        const double Elapsed = World->GetAudioTimeSeconds() - Virtual.StartTime;
+        if (!Virtual.bLooping && Elapsed >= Virtual.Duration)
+        {
+            VirtualSounds.RemoveAtSwap(i);
+            OnSoundFinished.Broadcast(Virtual.SoundID);
+            continue;
+        }
+
+        const FVector EmitterLocation = AttachActor ? AttachActor->GetActorLocation() : Virtual.Location;
+        FVector ListenerLocation;
+        if (Virtual.AudibleDistance > 0.0f && GetListenerLocation(World, ListenerLocation)
+            && FVector::Dist(ListenerLocation, EmitterLocation) > Virtual.AudibleDistance)
+        {
+            continue;
+        }
+
+        // 恢复时不抢占其他发声
+        USoundBase* SoundAsset = FindResidentSound(Virtual.SoundID, *Config);
+        if (!SoundAsset || !HasFreeVoice(Virtual.Category))
+        {
+            continue;
+        }
+
+        VirtualSounds.RemoveAtSwap(i);
+        const float StartOffset = (Virtual.bLooping && Virtual.Duration > 0.0f && Virtual.Duration < INDEFINITELY_LOOPING_DURATION)
+            ? FMath::Fmod((float)Elapsed, Virtual.Duration)
+            : (float)Elapsed;
+        PlayLoadedSound(World, Virtual.SoundID, *Config, SoundAsset, AttachActor, Virtual.Location, 0.0f, Virtual.PitchMultiplier, StartOffset);
+    }
+
+    // 没有虚拟发声也没有可能降级的发声时停止轮询，之后播放或降级时重新启动
+    if (VirtualSounds.Num() == 0 && !bHasVirtualizableVoices)
+    {
+        StopVirtualVoiceTimer();
+    }
+}
+
+void UAudioManager::RemoveVirtualSounds(TFunctionRef<bool(const FVirtualSound&)> Predicate)
+{
+    VirtualSounds.RemoveAllSwap([&Predicate](const FVirtualSound& Virtual) { return Predicate(Virtual); });
+}
+
+// ========== 音频状态查询实现 ==========
+
+bool UAudioManager::IsSoundPlaying(FName SoundID) const
+{
+    // 虚拟发声仍在推进播放时间，视为播放中
+    for (const FVirtualSound& Virtual : VirtualSounds)
+    {
+        if (Virtual.SoundID == SoundID)
+        {
+            return true;
+        }
+    }
+
+    if (const TArray<UAudioComponent*>* Components = ComponentsBySoundID.Find(SoundID))
+    {
+        for (const UAudioComponent* Component : *Components)
+        {
+            if (Component && Component->IsPlaying())
+            {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+int32 UAudioManager::GetActiveSoundCount() const
+{
+    return ActiveComponents.Num();
+}
+
+int32 UAudioManager::GetActiveSoundCountByCategory(EAudioCategory Category) const
+{
+    return GetCategoryVoiceCount(Category);
+}
+
+// ========== 调试工具实现 ==========
+
+void UAudioManager::PrintAudioSystemStatus()
+{
+    UE_LOG(LogTemp, Log, TEXT("=== Audio System Status ==="));
+    UE_LOG(LogTemp, Log, TEXT("Total Active Sounds: %d"), ActiveComponents.Num());
+
+    // 按类别统计
+    for (EAudioCategory Category : TEnumRange<EAudioCategory>())
+    {
+        UE_LOG(LogTemp, Log, TEXT("  %s: %d"), *UEnum::GetValueAsString(Category), GetCategoryVoiceCount(Category));
+    }
+
+    UE_LOG(LogTemp, Log, TEXT("Current BGM: %s"), CurrentBGMComponent ? TEXT("Playing") : TEXT("None"));
+    for (const FAudioComponentPool& Pool : AudioPools)
+    {
+        UE_LOG(LogTemp, Log, TEXT("Audio Pool [%s]: %d total, %d free, %d in use"),
+            Pool.World.IsValid() ? *Pool.World->GetName() : TEXT("Invalid"),
+            Pool.Components.Num(), Pool.FreeComponents.Num(), Pool.InUseComponents.Num());
+    }
+    UE_LOG(LogTemp, Log, TEXT("Virtual Sounds: %d"), VirtualSounds.Num());
+    UE_LOG(LogTemp, Log, TEXT("SFX Batch: %d requests, %d merged, %d pending"), SFXRequestCount, SFXMergedCount, PendingSFXRequests.Num());
+    UE_LOG(LogTemp, Log, TEXT("Sound Cache: %d hits, %d misses, %d loading, %d resident"),
+        SoundCacheHits, SoundCacheMisses, PendingSoundLoads.Num(), PreloadedSounds.Num());
+    UE_LOG(LogTemp, Log, TEXT("=== End Status ==="));
+}
+
+void UAudioManager::PrintCategoryStatus(EAudioCategory Category)
+{
+    UE_LOG(LogTemp, Log, TEXT("=== %s Audio Status ==="), *UEnum::GetValueAsString(Category));
+
+    if (const TArray<UAudioComponent*>* Components = ComponentsByCategory.Find(Category))
+    {
+        for (UAudioComponent* Component : *Components)
+        {
+            UE_LOG(LogTemp, Log, TEXT("  - %s"), *ActiveComponents[Component].SoundID.ToString());
+        }
+    }
+
+    UE_LOG(LogTemp, Log, TEXT("Total: %d sounds"), GetCategoryVoiceCount(Category));
+    UE_LOG(LogTemp, Log, TEXT("=== End %s Status ==="), *UEnum::GetValueAsString(Category));
+}
+
+void UAudioManager::BenchmarkAudioPool(UObject* WorldContextObject, FName SoundID, int32 PlayCount)
+{
+    UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::LogAndReturnNull);
+    if (!World || !PreloadSound(SoundID))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("BenchmarkAudioPool - invalid world or sound: %s"), *SoundID.ToString());
+        return;
+    }
+
+    if (!IsSoundPreloaded(SoundID))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("BenchmarkAudioPool - %s is still loading, run again once loaded"), *SoundID.ToString());
+        return;
+    }
+
+    const bool bPreviousUsePool = bUseAudioComponentPool;
+
+    UE_LOG(LogTemp, Log, TEXT("=== Audio Pool Benchmark ==="));
+    UE_LOG(LogTemp, Log, TEXT("Sound: %s, Plays: %d"), *SoundID.ToString(), PlayCount);
+
+    for (const bool bPooled : { false, true })
+    {
+        bUseAudioComponentPool = bPooled;
+        if (bPooled)
+        {
+            WarmupAudioPool(WorldContextObject, AudioPoolInitialSize);
+        }
+
+        const int32 ObjectsBefore = GUObjectArray.GetObjectArrayNumMinusAvailable();
+        const double StartTime = FPlatformTime::Seconds();
+
+        // 一次性音效：播放后立即结束，完整走一遍获取和回收流程
+        for (int32 i = 0; i < PlayCount; i++)
+        {
+            PlaySound(WorldContextObject, SoundID, nullptr, FVector((i % 100) * 10.0f, 0.0f, 0.0f));
+            StopSound(SoundID);
+        }
+
+        const double ElapsedMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+        const int32 ObjectsCreated = GUObjectArray.GetObjectArrayNumMinusAvailable() - ObjectsBefore;
+        const double PerPlayUs = PlayCount > 0 ? ElapsedMs * 1000.0 / PlayCount : 0.0;
+
+        // 按每秒1000次、60帧换算单帧开销
+        UE_LOG(LogTemp, Log, TEXT("  %-9s Total: %8.2f ms  Per play: %7.2f us  Per frame @1000/s: %6.3f ms  UObjects created: %d"),
+            bPooled ? TEXT("Pooled") : TEXT("NewObject"), ElapsedMs, PerPlayUs, PerPlayUs * 1000.0 / 60.0 / 1000.0, ObjectsCreated);
+    }
+
+    bUseAudioComponentPool = bPreviousUsePool;
+    UE_LOG(LogTemp, Log, TEXT("=== End Audio Pool Benchmark ==="));
+}
+
+void UAudioManager::StressTestVoices(UObject* WorldContextObject, FName SoundID, int32 SoundCount, float Radius, float Duration)
+{
+    UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::LogAndReturnNull);
+    if (!World || !PreloadSound(SoundID))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("StressTestVoices - invalid world or sound: %s"), *SoundID.ToString());
+        return;
+    }
+
+    if (!IsSoundPreloaded(SoundID))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("StressTestVoices - %s is still loading, run again once loaded"), *SoundID.ToString());
+        return;
+    }
+
+    FVector ListenerLocation = FVector::ZeroVector;
+    GetListenerLocation(World, ListenerLocation);
+
+    UE_LOG(LogTemp, Log, TEXT("=== Voice Stress Test ==="));
+    UE_LOG(LogTemp, Log, TEXT("Sound: %s, Count: %d, Radius: %.0f, Duration: %.1fs"), *SoundID.ToString(), SoundCount, Radius, Duration);
+
+    // 逐帧把请求数补足到SoundCount，并每帧执行一次虚拟发声更新（实际按VirtualVoiceUpdateInterval执行，此处为上限）
+    struct FStressStats
+    {
+        int32 Frames = 0;
+        int32 Plays = 0;
+        int32 RealVoices = 0;
+        int32 VirtualVoices = 0;
+        double PlayMs = 0.0;
+        double UpdateMs = 0.0;
+        double MaxFrameMs = 0.0;
+    };
+    TSharedRef<FStressStats> Stats = MakeShared<FStressStats>();
+    TWeakObjectPtr<UObject> WeakContext = WorldContextObject;
+    const double EndTime = FPlatformTime::Seconds() + FMath::Max(Duration, 0.0f);
+
+    FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateWeakLambda(this,
+        [this, Stats, WeakContext, SoundID, SoundCount, Radius, ListenerLocation, EndTime](float DeltaTime)
+        {
+            UObject* Context = WeakContext.Get();
+            const bool bFinished = !Context || FPlatformTime::Seconds() >= EndTime;
+            if (!bFinished)
+            {
+                int32 Missing = SoundCount;
+                for (const auto& Pair : ActiveComponents)
+                {
+                    Missing -= Pair.Value.SoundID == SoundID ? 1 : 0;
+                }
+                for (const FVirtualSound& Virtual : VirtualSounds)
+                {
+                    Missing -= Virtual.SoundID == SoundID ? 1 : 0;
+                }
+
+                const double PlayStart = FPlatformTime::Seconds();
+                for (int32 i = 0; i < Missing; i++)
+                {
+                    PlaySound(Context, SoundID, nullptr, ListenerLocation + FMath::VRand() * FMath::FRandRange(0.0f, Radius));
+                }
+                const double UpdateStart = FPlatformTime::Seconds();
+                UpdateVirtualVoices();
+                const double FrameEnd = FPlatformTime::Seconds();
+
+                Stats->Frames++;
+                Stats->Plays += FMath::Max(Missing, 0);
+                Stats->RealVoices += ActiveComponents.Num();
+                Stats->VirtualVoices += VirtualSounds.Num();
+                Stats->PlayMs += (UpdateStart - PlayStart) * 1000.0;
+                Stats->UpdateMs += (FrameEnd - UpdateStart) * 1000.0;
+                Stats->MaxFrameMs = FMath::Max(Stats->MaxFrameMs, (FrameEnd - PlayStart) * 1000.0);
+                return true;
+            }
+
+            const int32 Frames = FMath::Max(Stats->Frames, 1);
+            UE_LOG(LogTemp, Log, TEXT("  Frames: %d  Plays: %d (%.2f us/play)"),
+                Stats->Frames, Stats->Plays, Stats->Plays > 0 ? Stats->PlayMs * 1000.0 / Stats->Plays : 0.0);
+            UE_LOG(LogTemp, Log, TEXT("  Per frame: play %.3f ms  virtual update %.3f ms  max %.3f ms"),
+                Stats->PlayMs / Frames, Stats->UpdateMs / Frames, Stats->MaxFrameMs);
+            UE_LOG(LogTemp, Log, TEXT("  Avg real voices: %.1f (limit %d)  Avg virtual: %.1f"),
+                (float)Stats->RealVoices / Frames, MaxGlobalVoices, (float)Stats->VirtualVoices / Frames);
+            UE_LOG(LogTemp, Log, TEXT("=== End Voice Stress Test ==="));
+
+            StopSound(SoundID);
+            return false;
+        }));
+}
+
+// ========== 内部辅助方法 ==========
+
+UWorld* UAudioManager::GetWorld() const
+{
+    if (GEngine)
+    {
+        for (const FWorldContext& Context : GEngine->GetWorldContexts())
+        {
             if (Context.WorldType == EWorldType::Game || Context.WorldType == EWorldType::PIE)
             {
                 return Context.World();
@@ -661,6 +1628,138 @@ UWorld* UAudioManager::GetWorld() const
     return nullptr;
 }
 
+USoundBase* UAudioManager::FindResidentSound(FName SoundID, const FAudioConfig& Config) const
+{
+    if (USoundBase* const* PreloadedSound = PreloadedSounds.Find(SoundID))
+    {
+        return *PreloadedSound;
+    }
+
+    // 已被其他引用加载的资源直接使用
+    return Config.SoundAsset.Get();
+}
+
+void UAudioManager::RequestSoundLoad(FName SoundID, const FAudioConfig& Config, bool bPinWhenLoaded)
+{
+    // 播放触发的加载进行中时再预加载，完成后同样常驻
+    if (bPinWhenLoaded)
+    {
+        PinnedSoundLoads.Add(SoundID);
+    }
+
+    if (PendingSoundLoads.Contains(SoundID))
+    {
+        return;
+    }
+
+    // 衰减设置与音频一起加载，播放时不再同步加载
+    TArray<FSoftObjectPath> AssetPaths;
+    AssetPaths.Add(Config.SoundAsset.ToSoftObjectPath());
+    if (!Config.AttenuationSettings.IsNull())
+    {
+        AssetPaths.Add(Config.AttenuationSettings.ToSoftObjectPath());
+    }
+
+    // 先占位，资源已在内存时回调可能在请求返回前执行
+    PendingSoundLoads.Add(SoundID);
+
+    TSharedPtr<FStreamableHandle> Handle = StreamableManager.RequestAsyncLoad(
+        AssetPaths,
+        FStreamableDelegate::CreateWeakLambda(this, [this, SoundID]() {
+            HandleSoundLoaded(SoundID);
+            }),
+        FStreamableManager::AsyncLoadHighPriority
+    );
+
+    if (TSharedPtr<FStreamableHandle>* Pending = PendingSoundLoads.Find(SoundID))
+    {
+        if (Handle.IsValid())
+        {
+            *Pending = Handle;
+        }
+        else
+        {
+            PendingSoundLoads.Remove(SoundID);
+            PinnedSoundLoads.Remove(SoundID);
+            QueuedPlays.Remove(SoundID);
+            UE_LOG(LogTemp, Error, TEXT("Failed to request sound load: %s"), *SoundID.ToString());
+        }
+    }
+}
+
+void UAudioManager::HandleSoundLoaded(FName SoundID)
+{
+    PendingSoundLoads.Remove(SoundID);
+    const bool bPin = PinnedSoundLoads.Remove(SoundID) > 0;
+
+    TArray<FQueuedSoundPlay> Plays;
+    QueuedPlays.RemoveAndCopyValue(SoundID, Plays);
+
+    const FAudioConfig* Config = GetAudioConfig(SoundID);
+    USoundBase* SoundAsset = Config ? Config->SoundAsset.Get() : nullptr;
+    if (!SoundAsset)
+    {
+        UE_LOG(LogTemp, Error, TEXT("Failed to load sound: %s"), *SoundID.ToString());
+        return;
+    }
+
+    // 只有预加载和预热请求的音频常驻；播放触发的加载在句柄释放后由正在播放的组件持有，停止后可被回收
+    if (bPin)
+    {
+        PreloadedSounds.Add(SoundID, SoundAsset);
+    }
+
+    const double Now = FPlatformTime::Seconds();
+    for (const FQueuedSoundPlay& Play : Plays)
+    {
+        // 超时或上下文已失效的请求丢弃
+        if (Config->MaxQueueDelay > 0.0f && Now - Play.RequestTime > Config->MaxQueueDelay)
+        {
+            continue;
+        }
+
+        AActor* AttachActor = Play.AttachActor.Get();
+        if (Play.bHasAttachActor && !AttachActor)
+        {
+            continue;
+        }
+
+        UWorld* World = Play.WorldContextObject.IsValid()
+            ? GEngine->GetWorldFromContextObject(Play.WorldContextObject.Get(), EGetWorldErrorMode::ReturnNull)
+            : nullptr;
+        if (!World)
+        {
+            continue;
+        }
+
+        UAudioComponent* AudioComponent = PlayLoadedSound(World, SoundID, *Config, SoundAsset, AttachActor, Play.Location, Play.FadeInTime, Play.PitchMultiplier);
+        if (AudioComponent && Config->Category == EAudioCategory::BGM)
+        {
+            CurrentBGMComponent = AudioComponent;
+        }
+    }
+}
+
+void UAudioManager::CancelQueuedPlays(TFunctionRef<bool(FName SoundID)> Predicate)
+{
+    for (auto It = QueuedPlays.CreateIterator(); It; ++It)
+    {
+        if (Predicate(It.Key()))
+        {
+            It.RemoveCurrent();
+        }
+    }
+}
+
+void UAudioManager::CancelQueuedPlaysInCategory(EAudioCategory Category)
+{
+    CancelQueuedPlays([this, Category](FName QueuedID)
+        {
+            const FAudioConfig* Config = GetAudioConfig(QueuedID);
+            return Config && Config->Category == Category;
+        });
+}
+
 void UAudioManager::FadeOutAudioComponent(UAudioComponent* AudioComponent, float FadeTime)
 {
     if (!AudioComponent) return;
@@ -670,12 +1769,14 @@ void UAudioManager::FadeOutAudioComponent(UAudioComponent* AudioComponent, float
     FTimerHandle TimerHandle;
     if (UWorld* World = GetWorld())
     {
-        World->GetTimerManager().SetTimer(TimerHandle, [this, AudioComponent]()
+        TWeakObjectPtr<UAudioComponent> WeakComponent = AudioComponent;
+        World->GetTimerManager().SetTimer(TimerHandle, [this, WeakComponent]()
             {
-                if (AudioComponent && AudioComponent->IsValidLowLevel())
+                // 池化组件可能已被回收并重新播放其他音频，仍在播放时不处理
+                UAudioComponent* Component = WeakComponent.Get();
+                if (Component && !Component->IsPlaying() && RemoveActiveSound(Component))
                 {
-                    ActiveComponents.Remove(AudioComponent);
-                    AudioComponent->DestroyComponent();
+                    ReleaseAudioComponent(Component);
                 }
             }, FadeTime, false);
     }
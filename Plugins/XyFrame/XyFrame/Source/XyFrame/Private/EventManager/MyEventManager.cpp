@@ -3,18 +3,18 @@
 #include "EventManager/MyEventManager.h"
 #include "Engine/Engine.h"
 
-// ̬ʵ
+// 静态实例定义
 template<>
 UMyEventManager* TSingleton<UMyEventManager>::SingletonInstance = nullptr;
 
 UMyEventManager::UMyEventManager()
 {
-    // 캯
+    // 构造函数
 }
 
 UMyEventManager::~UMyEventManager()
 {
-    // ¼
+    // 清理所有事件
     RemoveAllEvents();
     RemoveAllCppEvents();
 }
@@ -30,7 +30,7 @@ void UMyEventManager::InitializeEventManager()
     UE_LOG(LogTemp, Log, TEXT("Event Manager Initialized"));
 }
 
-// ========== ͳһ¼ӿʵ ==========
+// ========== 统一事件接口实现 ==========
 
 void UMyEventManager::TriggerGameEvent(EGameEventType EventType, const FGameEventData& EventData)
 {
@@ -59,7 +59,7 @@ void UMyEventManager::TriggerSimpleGameEvent(EGameEventType EventType, const FSt
     InternalTriggerGameEvent(EventType, EventData);
 }
 
-// ========== ͼC++¼ӿʵ ==========
+// ========== 蓝图调用C++事件接口实现 ==========
 
 void UMyEventManager::TriggerCppEvent_NoParam(FName EventName)
 {
@@ -88,10 +88,10 @@ void UMyEventManager::TriggerCppEvent_Float(FName EventName, float FloatParam)
 
 void UMyEventManager::InternalTriggerGameEvent(EGameEventType EventType, const FGameEventData& EventData)
 {
-    // ͼɷί
+    // 触发蓝图可分配委托
     OnGameEvent.Broadcast(EventType, EventData);
 
-    // ¼־
+    // 记录日志
     FString LogMessage = FString::Printf(TEXT("Triggered Game Event: %s"), *UEnum::GetValueAsString(EventType));
 
     if (EventData.Texts.Num() > 0)
@@ -112,15 +112,15 @@ void UMyEventManager::InternalTriggerGameEvent(EGameEventType EventType, const F
     UE_LOG(LogTemp, Log, TEXT("%s"), *LogMessage);
 }
 
-// ========== ¼ӿʵ ==========
+// ========== 事件管理接口实现 ==========
 
 void UMyEventManager::RemoveBlueprintEventByEventname(FName EventName, UObject* object)
 {
     if (object)
     {
-        // ֻƳضָķ
+        // 我们只能移除特定对象的指定方法名的方法
         OnGameEvent.Remove(object, EventName);
-        UE_LOG(LogTemp, Warning, TEXT("δƳָ飬ǷΪָ"));
+        UE_LOG(LogTemp, Warning, TEXT("若未移除指定方法，检查，给定名字是否为指定方法名"));
     }
 }
 
@@ -135,10 +135,10 @@ void UMyEventManager::RemoveAllBlueprintBindingsForObject(UObject* Object)
 
 void UMyEventManager::RemoveAllEvents()
 {
-    // Ƴͼ¼
+    // 移除所有蓝图事件
     RemoveAllBlueprintBindings();
 
-    // ƳC++¼
+    // 移除所有C++事件
     RemoveAllCppEvents();
 
     UE_LOG(LogTemp, Log, TEXT("Removed all events"));
@@ -152,7 +152,7 @@ void UMyEventManager::RemoveAllBlueprintBindings()
 
 bool UMyEventManager::HasEventListeners(FName EventName) const
 {
-    // C++¼
+    // 检查C++事件
     bool bHasCppListeners = HasCppEventListeners(EventName);
 
     return bHasCppListeners;
@@ -168,7 +168,7 @@ int32 UMyEventManager::GetEventListenerCount(FName EventName) const
 {
     int32 Count = 0;
 
-    // C++¼
+    // C++事件数量
     Count += GetCppEventListenerCount(EventName);
 
     return Count;
@@ -184,7 +184,7 @@ void UMyEventManager::PrintAllEvents() const
 {
     UE_LOG(LogTemp, Log, TEXT("=== Registered Events ==="));
 
-    // C++¼
+    // C++事件
     UE_LOG(LogTemp, Log, TEXT("C++ Events (%d):"), CppEvents.Num());
     for (const auto& Pair : CppEvents)
     {
@@ -194,7 +194,7 @@ void UMyEventManager::PrintAllEvents() const
     UE_LOG(LogTemp, Log, TEXT("=== End Events ==="));
 }
 
-// ========== C++¼ʵ ==========
+// ========== C++事件实现 ==========
 
 void UMyEventManager::RemoveCppEvent(FName EventName)
 {
@@ -222,8 +222,8 @@ int32 UMyEventManager::GetCppEventListenerCount(FName EventName) const
     const TSharedPtr<void>* DelegatePtr = CppEvents.Find(EventName);
     if (DelegatePtr && DelegatePtr->IsValid())
     {
-        // 򻯴ʵʹʱҪݾίͻȡ
-        return 1; // ռλֵ
+        // 这里简化处理，实际使用时需要根据具体委托类型获取数量
+        return 1; // 占位返回值
     }
     return 0;
 }
\ No newline at end of file
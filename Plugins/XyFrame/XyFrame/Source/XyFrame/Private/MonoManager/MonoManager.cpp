@@ -1,21 +1,41 @@
 // Fill out your copyright notice in the Description page of Project Settings.
 
 #include "MonoManager/MonoManager.h"
+#include "MonoManager/MonoTask.h"
 #include "Engine/Engine.h"
+#include "Math/RandomStream.h"
 
-// ̬ʵ
+// 静态实例定义
 template<>
 UMonoManager* TSingleton<UMonoManager>::SingletonInstance = nullptr;
 
 UMonoManager::UMonoManager()
-    : bIsUpdateTimerActive(false)
+    : NextScheduleSerial(0)
+    , bIsUpdating(false)
+    , FixedTimeAccumulator(0.0f)
+    , FixedStepsThisFrame(0)
+    , LastFixedStepFrame(0)
+    , bIsTickingPhases(false)
+    , NextTaskId(0)
 {
+    FixedTimeStep = 0.02f;
+    MaxFixedStepsPerFrame = 5;
 }
 
 UMonoManager::~UMonoManager()
 {
-    StopUpdateTimer();
+    FWorldDelegates::OnWorldInitializedActors.Remove(WorldInitializedHandle);
+    FWorldDelegates::OnWorldCleanup.Remove(WorldCleanupHandle);
+    FCoreUObjectDelegates::GetPostGarbageCollect().Remove(PostGarbageCollectHandle);
+
+    CancelAllTasks();
+    FrameWaits.Empty();
     ClearAllTimers();
+    if (TimerTickFunction.IsValid())
+    {
+        TimerTickFunction->UnRegisterTickFunction();
+    }
+    UnregisterAllPhaseTickFunctions();
 }
 
 void UMonoManager::InitializeSingleton()
@@ -26,159 +46,476 @@ void UMonoManager::InitializeSingleton()
 
 void UMonoManager::InitializeMonoManager()
 {
+    if (!WorldInitializedHandle.IsValid())
+    {
+        WorldInitializedHandle = FWorldDelegates::OnWorldInitializedActors.AddUObject(this, &UMonoManager::HandleWorldInitializedActors);
+        WorldCleanupHandle = FWorldDelegates::OnWorldCleanup.AddUObject(this, &UMonoManager::HandleWorldCleanup);
+        PostGarbageCollectHandle = FCoreUObjectDelegates::GetPostGarbageCollect().AddUObject(this, &UMonoManager::HandlePostGarbageCollect);
+    }
+
     UE_LOG(LogTemp, Log, TEXT("Mono Manager Initialized"));
 }
 
-// ========== ¼ʱϵͳ ==========
+void UMonoManager::HandleWorldInitializedActors(const FActorsInitializedParams& Params)
+{
+    if (Params.World && Params.World == GetWorld())
+    {
+        // 新世界开始运行，计时器与阶段更新挂接到新世界
+        RegisterAllPhaseTickFunctions();
+        ScheduleNextUpdate();
+    }
+}
+
+void UMonoManager::HandleWorldCleanup(UWorld* World, bool bSessionEnded, bool bCleanupResources)
+{
+    if (World && World == PhaseTickWorld.Get())
+    {
+        UnregisterAllPhaseTickFunctions();
+    }
+    if (World && World == TimerTickWorld.Get() && TimerTickFunction.IsValid())
+    {
+        TimerTickFunction->UnRegisterTickFunction();
+        TimerTickWorld.Reset();
+    }
+}
+
+// ========== 更新计时器系统 ==========
+
+void FMonoTimerTickFunction::ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent)
+{
+    if (Manager)
+    {
+        Manager->UpdateTimers();
+    }
+}
+
+FString FMonoTimerTickFunction::DiagnosticMessage()
+{
+    return TEXT("MonoManager timer tick");
+}
 
-void UMonoManager::StartUpdateTimer()
+void UMonoManager::ScheduleNextUpdate()
 {
-    if (!bIsUpdateTimerActive && GetWorld())
+    // 更新过程中统一在结束时重新调度
+    if (bIsUpdating)
+    {
+        return;
+    }
+
+    const int32 TimerCount = TimerSlots.Num() - FreeTimerSlots.Num();
+    bool bHasTickingTimers = false;
+    bool bNeedsPerFrameUpdate = false;
+
+    for (int32 DomainIndex = 0; DomainIndex < TimerDomains.Num(); ++DomainIndex)
+    {
+        FTimerDomainClock& Clock = TimerDomains[DomainIndex];
+        if (Clock.Heap.Num() > TimerCount * 2 + 64)
+        {
+            CompactTimerHeap(Clock);
+        }
+
+        // 剔除堆顶的失效条目，保证堆顶就是最早到期的计时器
+        while (Clock.Heap.Num() > 0 && IsHeapEntryStale(Clock.Heap.HeapTop()))
+        {
+            Clock.Heap.HeapPopDiscard(EAllowShrinking::No);
+        }
+
+        // 暂停或缩放为0的时间域不会有计时器到期
+        if (Clock.Heap.Num() > 0 && !Clock.bPaused && Clock.TimeScale > 0.0f)
+        {
+            bHasTickingTimers = true;
+            bNeedsPerFrameUpdate |= DomainIndex != (int32)ETimerDomain::Game;
+        }
+    }
+
+    bNeedsPerFrameUpdate |= FrameWaits.Num() > 0;
+    bNeedsPerFrameUpdate |= ProgressTimers.ContainsByPredicate([this](FMonoTimerHandle Handle)
+        {
+            const FMonoTimerSlot* Slot = FindSlot(Handle);
+            return Slot && Slot->Timer.bIsActive;
+        });
+
+    UWorld* World = GetWorld();
+    if (!World || !World->PersistentLevel || (!bHasTickingTimers && !bNeedsPerFrameUpdate))
+    {
+        StopUpdateTimer();
+        return;
+    }
+
+    if (!TimerTickFunction.IsValid())
+    {
+        TimerTickFunction = MakeUnique<FMonoTimerTickFunction>();
+        TimerTickFunction->Manager = this;
+        TimerTickFunction->TickGroup = TG_PrePhysics;
+        TimerTickFunction->bCanEverTick = true;
+        TimerTickFunction->bStartWithTickEnabled = true;
+        TimerTickFunction->bTickEvenWhenPaused = true;
+    }
+
+    // 世界切换后挂接到新世界
+    if (TimerTickWorld.Get() != World || !TimerTickFunction->IsTickFunctionRegistered())
+    {
+        if (TimerTickFunction->IsTickFunctionRegistered())
+        {
+            TimerTickFunction->UnRegisterTickFunction();
+        }
+        TimerTickFunction->RegisterTickFunction(World->PersistentLevel);
+        TimerTickWorld = World;
+    }
+
+    // 只有游戏域计时器时休眠到最早的到期时间（Tick间隔与游戏时间同样受时间膨胀影响）
+    float TickInterval = 0.0f;
+    if (!bNeedsPerFrameUpdate)
     {
-        GetWorld()->GetTimerManager().SetTimer(UpdateTimerHandle, this, &UMonoManager::UpdateTimers, 0.016f, true); // ~60fps
-        bIsUpdateTimerActive = true;
-        UE_LOG(LogTemp, Log, TEXT("Started MonoManager update timer"));
+        const FTimerDomainClock& GameClock = GetDomainClock(ETimerDomain::Game);
+        const double Delay = (GameClock.Heap.HeapTop().FireTime - GetSchedulerTime(ETimerDomain::Game)) / GameClock.TimeScale;
+        TickInterval = FMath::Max(0.0f, (float)Delay);
     }
+
+    TimerTickFunction->UpdateTickIntervalAndCoolDown(TickInterval);
+    TimerTickFunction->SetTickFunctionEnable(true);
 }
 
 void UMonoManager::StopUpdateTimer()
 {
-    if (bIsUpdateTimerActive && GetWorld())
+    if (TimerTickFunction.IsValid() && TimerTickFunction->IsTickFunctionRegistered() && TimerTickFunction->IsTickFunctionEnabled())
     {
-        GetWorld()->GetTimerManager().ClearTimer(UpdateTimerHandle);
-        bIsUpdateTimerActive = false;
-        UE_LOG(LogTemp, Log, TEXT("Stopped MonoManager update timer"));
+        TimerTickFunction->SetTickFunctionEnable(false);
+        UE_LOG(LogTemp, Verbose, TEXT("Stopped MonoManager update timer"));
     }
 }
 
 void UMonoManager::UpdateTimers()
 {
-    float DeltaTime = GetWorld() ? GetWorld()->GetDeltaSeconds() : 0.016f;
+    bIsUpdating = true;
+
+    // 各时间域按各自时间源实际经过的时间推进
+    for (int32 DomainIndex = 0; DomainIndex < TimerDomains.Num(); ++DomainIndex)
+    {
+        SyncSchedulerClock((ETimerDomain)DomainIndex);
+    }
+
+    // 只有注册了进度回调的计时器需要逐帧更新，回调中可能增删计时器，遍历副本
+    if (ProgressTimers.Num() > 0)
+    {
+        TArray<FMonoTimerHandle> ProgressHandles = ProgressTimers;
+        for (FMonoTimerHandle Handle : ProgressHandles)
+        {
+            const FMonoTimerSlot* Slot = FindSlot(Handle);
+            if (Slot && Slot->Timer.bIsActive && Slot->UpdateCallback.IsBound())
+            {
+                FTimerUpdateCallbackDelegate UpdateCallback = Slot->UpdateCallback;
+                UpdateCallback.Execute(Slot->Timer.TimerId, GetTimerProgress(Handle));
+            }
+        }
+    }
+
+    // 每个时间域处理一遍到期堆
+    for (int32 DomainIndex = 0; DomainIndex < TimerDomains.Num(); ++DomainIndex)
+    {
+        const FTimerDomainClock& Clock = TimerDomains[DomainIndex];
+        if (!Clock.bPaused)
+        {
+            ProcessExpiredTimers((ETimerDomain)DomainIndex, Clock.Time);
+        }
+    }
+
+    // 帧等待只比较堆顶的目标帧，回调中新加入的等待至少延迟到下一帧
+    while (FrameWaits.Num() > 0 && FrameWaits.HeapTop().TargetFrame <= GFrameCounter)
+    {
+        FFrameWaitEntry Entry;
+        FrameWaits.HeapPop(Entry, EAllowShrinking::No);
+        Entry.Callback();
+    }
+
+    bIsUpdating = false;
+    ScheduleNextUpdate();
+}
 
-    TArray<FString> TimersToRemove;
+int32 UMonoManager::ProcessExpiredTimers(ETimerDomain Domain, double Now)
+{
+    TArray<FTimerHeapEntry>& Heap = GetDomainClock(Domain).Heap;
+    int32 FiredCount = 0;
 
-    for (auto& TimerPair : Timers)
+    while (Heap.Num() > 0 && Heap.HeapTop().FireTime <= Now)
     {
-        FTimerInfo& Timer = TimerPair.Value;
+        FTimerHeapEntry Entry;
+        Heap.HeapPop(Entry, EAllowShrinking::No);
+
+        if (IsHeapEntryStale(Entry))
+        {
+            continue;
+        }
 
-        if (!Timer.bIsActive)
+        // 绑定的对象已销毁，计时器随之清除
+        const FTimerInfo& Timer = TimerSlots[Entry.SlotIndex].Timer;
+        if (!Timer.CallbackObject.IsExplicitlyNull() && !Timer.CallbackObject.IsValid())
+        {
+            ReleaseSlot(Entry.SlotIndex);
             continue;
+        }
 
-        Timer.ElapsedTime += DeltaTime;
+        const FMonoTimerHandle Handle = MakeHandle(Entry.SlotIndex);
+        ExecuteTimerCallback(Entry.SlotIndex);
+        FiredCount++;
 
-        // ִи»ص
-        FTimerUpdateCallbackDelegate* UpdateCallback = UpdateCallbacks.Find(Timer.TimerId);
-        if (UpdateCallback && UpdateCallback->IsBound())
+        // 回调中可能清除、暂停、重启或切换了时间域
+        FMonoTimerSlot* Slot = FindSlot(Handle);
+        if (!Slot || Slot->Timer.ScheduleSerial != Entry.ScheduleSerial)
         {
-            float Progress = GetTimerProgress(Timer.TimerId);
-            UpdateCallback->Execute(Timer.TimerId, Progress);
+            continue;
         }
 
-        // ʱǷ
-        if (Timer.ElapsedTime >= Timer.Duration)
+        bool bFinished = false;
+        switch (Slot->Timer.TimerType)
         {
-            UE_LOG(LogTemp, Log, TEXT("Timer completed: %s"), *Timer.TimerId);
-            ExecuteTimerCallback(Timer.TimerId);
+        case ETimerType::OneShot:
+            bFinished = true;
+            break;
 
-            switch (Timer.TimerType)
-            {
-            case ETimerType::OneShot:
-                TimersToRemove.Add(Timer.TimerId);
-                break;
-
-            case ETimerType::Interval:
-                Timer.ElapsedTime = 0.0f;
-                break;
-
-            case ETimerType::Countdown:
-                Timer.CurrentLoop++;
-                if (Timer.LoopCount > 0 && Timer.CurrentLoop >= Timer.LoopCount)
-                {
-                    TimersToRemove.Add(Timer.TimerId);
-                }
-                else
-                {
-                    Timer.ElapsedTime = 0.0f;
-                }
-                break;
-            }
+        case ETimerType::Interval:
+            break;
+
+        case ETimerType::Countdown:
+            Slot->Timer.CurrentLoop++;
+            bFinished = Slot->Timer.LoopCount > 0 && Slot->Timer.CurrentLoop >= Slot->Timer.LoopCount;
+            break;
+        }
+
+        if (bFinished)
+        {
+            ReleaseSlot(Entry.SlotIndex);
+            continue;
+        }
+
+        // 从上次到期时间累加避免漂移，落后太多时不补发
+        double NextFireTime = Entry.FireTime + Slot->Timer.Duration;
+        if (NextFireTime <= Now)
+        {
+            NextFireTime = Now + Slot->Timer.Duration;
         }
+        ScheduleTimer(Slot->Timer, Entry.SlotIndex, NextFireTime);
+    }
+
+    return FiredCount;
+}
+
+double UMonoManager::GetDomainSourceTime(ETimerDomain Domain, const UWorld* World) const
+{
+    switch (Domain)
+    {
+    case ETimerDomain::Game:
+        return World ? World->GetTimeSeconds() : 0.0;
+
+    case ETimerDomain::Unscaled:
+        return World ? World->GetRealTimeSeconds() : 0.0;
+
+    case ETimerDomain::Real:
+    default:
+        return FPlatformTime::Seconds();
     }
+}
 
-    for (const FString& TimerId : TimersToRemove)
+double UMonoManager::GetSchedulerTime(ETimerDomain Domain) const
+{
+    const FTimerDomainClock& Clock = GetDomainClock(Domain);
+    if (Clock.bPaused || !Clock.bHasSource)
     {
-        ClearTimer(TimerId);
+        return Clock.Time;
     }
 
-    // ûлʱֹͣ¼ʱ
-    if (GetActiveTimerCount() == 0)
+    // 世界时间源在切换世界后重新计起
+    UWorld* World = GetWorld();
+    if (Domain != ETimerDomain::Real && (!World || World != Clock.SourceWorld.Get()))
     {
-        StopUpdateTimer();
+        return Clock.Time;
     }
+
+    return Clock.Time + (GetDomainSourceTime(Domain, World) - Clock.LastSourceTime) * Clock.TimeScale;
 }
 
-// ========== ڲʱ ==========
+void UMonoManager::SyncSchedulerClock(ETimerDomain Domain)
+{
+    UWorld* World = GetWorld();
+    FTimerDomainClock& Clock = GetDomainClock(Domain);
+    Clock.Time = GetSchedulerTime(Domain);
+    Clock.SourceWorld = World;
+    Clock.LastSourceTime = GetDomainSourceTime(Domain, World);
+    Clock.bHasSource = Domain == ETimerDomain::Real || World != nullptr;
+}
 
-bool UMonoManager::CreateTimerInternal(const FString& TimerId, ETimerType TimerType, float Duration, int32 LoopCount,
-    const FTimerCallbackDelegate& CompleteCallback,
-    const FTimerUpdateCallbackDelegate& UpdateCallback,
-    const FTimerSimpleDelegate& SimpleCallback)
+FMonoTimerHandle UMonoManager::RegisterTimer(FMonoTimerSlot&& NewSlot, double StartTime)
 {
-    if (Duration <= 0.0f)
+    // 优先复用空闲槽位，代数保留以使旧句柄失效
+    const int32 SlotIndex = FreeTimerSlots.Num() > 0 ? FreeTimerSlots.Pop(EAllowShrinking::No) : TimerSlots.AddDefaulted();
+    FMonoTimerSlot& Slot = TimerSlots[SlotIndex];
+    const int32 Generation = Slot.Generation;
+    Slot = MoveTemp(NewSlot);
+    Slot.Generation = Generation;
+    Slot.bInUse = true;
+
+    const FMonoTimerHandle Handle = MakeHandle(SlotIndex);
+    if (!Slot.Timer.TimerId.IsEmpty())
     {
-        UE_LOG(LogTemp, Warning, TEXT("Cannot create timer with duration <= 0"));
-        return false;
+        NamedTimers.Add(Slot.Timer.TimerId, Handle);
     }
 
-    if (Timers.Contains(TimerId))
+    ScheduleTimer(Slot.Timer, SlotIndex, StartTime + Slot.Timer.Duration);
+
+    if (Slot.UpdateCallback.IsBound())
     {
-        UE_LOG(LogTemp, Warning, TEXT("TimerId already exists: %s"), *TimerId);
-        return false;
+        ProgressTimers.Add(Handle);
     }
 
-    // ǷЧĻص
-    if (!CompleteCallback.IsBound() && !SimpleCallback.IsBound())
+    ScheduleNextUpdate();
+    return Handle;
+}
+
+void UMonoManager::ScheduleTimer(FTimerInfo& Timer, int32 SlotIndex, double FireTime)
+{
+    Timer.FireTime = FireTime;
+    Timer.ScheduleSerial = ++NextScheduleSerial;
+
+    FTimerHeapEntry Entry;
+    Entry.FireTime = FireTime;
+    Entry.SlotIndex = SlotIndex;
+    Entry.ScheduleSerial = Timer.ScheduleSerial;
+    GetDomainClock(Timer.Domain).Heap.HeapPush(Entry);
+}
+
+bool UMonoManager::IsHeapEntryStale(const FTimerHeapEntry& Entry) const
+{
+    if (!TimerSlots.IsValidIndex(Entry.SlotIndex))
     {
-        UE_LOG(LogTemp, Warning, TEXT("No valid callback bound for timer"));
-        return false;
+        return true;
+    }
+
+    const FMonoTimerSlot& Slot = TimerSlots[Entry.SlotIndex];
+    return !Slot.bInUse || !Slot.Timer.bIsActive || Slot.Timer.ScheduleSerial != Entry.ScheduleSerial;
+}
+
+void UMonoManager::CompactTimerHeap(FTimerDomainClock& Clock)
+{
+    Clock.Heap.RemoveAllSwap([this](const FTimerHeapEntry& Entry) { return IsHeapEntryStale(Entry); }, EAllowShrinking::No);
+    Clock.Heap.Heapify();
+}
+
+float UMonoManager::GetTimerElapsed(const FTimerInfo& Timer) const
+{
+    if (!Timer.bIsActive)
+    {
+        return Timer.ElapsedTime;
     }
+    return FMath::Max(0.0f, Timer.Duration - (float)(Timer.FireTime - GetSchedulerTime(Timer.Domain)));
+}
+
+// ========== 槽位管理 ==========
 
-    // 洢ص
-    if (CompleteCallback.IsBound())
+FMonoTimerSlot* UMonoManager::FindSlot(FMonoTimerHandle Handle)
+{
+    if (TimerSlots.IsValidIndex(Handle.Index))
     {
-        TimerCallbacks.Add(TimerId, CompleteCallback);
+        FMonoTimerSlot& Slot = TimerSlots[Handle.Index];
+        if (Slot.bInUse && Slot.Generation == Handle.Generation)
+        {
+            return &Slot;
+        }
     }
+    return nullptr;
+}
 
-    if (SimpleCallback.IsBound())
+const FMonoTimerSlot* UMonoManager::FindSlot(FMonoTimerHandle Handle) const
+{
+    return const_cast<UMonoManager*>(this)->FindSlot(Handle);
+}
+
+FMonoTimerHandle UMonoManager::MakeHandle(int32 SlotIndex) const
+{
+    FMonoTimerHandle Handle;
+    Handle.Index = SlotIndex;
+    Handle.Generation = TimerSlots[SlotIndex].Generation;
+    return Handle;
+}
+
+void UMonoManager::ReleaseSlot(int32 SlotIndex)
+{
+    FMonoTimerSlot& Slot = TimerSlots[SlotIndex];
+    if (!Slot.bInUse)
+    {
+        return;
+    }
+
+    const FMonoTimerHandle Handle = MakeHandle(SlotIndex);
+    if (!Slot.Timer.TimerId.IsEmpty())
+    {
+        NamedTimers.Remove(Slot.Timer.TimerId);
+    }
+    if (Slot.UpdateCallback.IsBound())
+    {
+        ProgressTimers.Remove(Handle);
+    }
+
+    UE_LOG(LogTemp, Verbose, TEXT("Cleared timer: %s (#%d)"), *Slot.Timer.TimerId, SlotIndex);
+
+    // 堆中的条目在到期或压缩时剔除
+    const int32 NextGeneration = Slot.Generation + 1;
+    Slot = FMonoTimerSlot();
+    Slot.Generation = NextGeneration;
+    FreeTimerSlots.Add(SlotIndex);
+}
+
+// ========== 内部计时器创建方法 ==========
+
+FMonoTimerHandle UMonoManager::CreateTimerInternal(const FString& TimerId, ETimerType TimerType, float Duration, int32 LoopCount,
+    const FTimerCallbackDelegate& CompleteCallback,
+    const FTimerUpdateCallbackDelegate& UpdateCallback,
+    const FTimerSimpleDelegate& SimpleCallback,
+    TFunction<void()>&& StaticCallback,
+    UObject* CallbackObject)
+{
+    if (Duration <= 0.0f)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("Cannot create timer with duration <= 0"));
+        return FMonoTimerHandle();
+    }
+
+    if (!TimerId.IsEmpty() && NamedTimers.Contains(TimerId))
     {
-        SimpleCallbacks.Add(TimerId, SimpleCallback);
+        UE_LOG(LogTemp, Warning, TEXT("TimerId already exists: %s"), *TimerId);
+        return FMonoTimerHandle();
     }
 
-    if (UpdateCallback.IsBound())
+    // 检查是否有有效的回调
+    if (!CompleteCallback.IsBound() && !SimpleCallback.IsBound() && !StaticCallback)
     {
-        UpdateCallbacks.Add(TimerId, UpdateCallback);
+        UE_LOG(LogTemp, Warning, TEXT("No valid callback bound for timer"));
+        return FMonoTimerHandle();
     }
 
-    // ʱϢ
-    FTimerInfo TimerInfo(TimerId, TimerType, Duration);
-    TimerInfo.LoopCount = LoopCount;
-    Timers.Add(TimerId, TimerInfo);
+    FMonoTimerSlot NewSlot;
+    NewSlot.Timer = FTimerInfo(TimerId, TimerType, Duration);
+    NewSlot.Timer.LoopCount = LoopCount;
+    NewSlot.Timer.CallbackObject = CallbackObject;
+    NewSlot.Timer.StaticCallback = MoveTemp(StaticCallback);
+    NewSlot.CompleteCallback = CompleteCallback;
+    NewSlot.SimpleCallback = SimpleCallback;
+    NewSlot.UpdateCallback = UpdateCallback;
 
-    // ¼ʱ
-    StartUpdateTimer();
+    SyncSchedulerClock(ETimerDomain::Game);
+    const FMonoTimerHandle Handle = RegisterTimer(MoveTemp(NewSlot), GetDomainClock(ETimerDomain::Game).Time);
 
-    UE_LOG(LogTemp, Log, TEXT("Created timer: %s, Type: %s, Duration: %.2f, Loops: %d"),
-        *TimerId, *UEnum::GetValueAsString(TimerType), Duration, LoopCount);
+    UE_LOG(LogTemp, Verbose, TEXT("Created timer: %s (#%d), Type: %s, Duration: %.2f, Loops: %d"),
+        *TimerId, Handle.Index, *UEnum::GetValueAsString(TimerType), Duration, LoopCount);
 
-    return true;
+    return Handle;
 }
 
-// ========== ʱϵͳ (ԶTimerId) ==========
+// ========== 计时器系统 (自动生成TimerId) ==========
 
 FString UMonoManager::SetTimeout(float Delay, const FTimerCallbackDelegate& CompleteCallback)
 {
     FString TimerId = GenerateTimerId();
-    if (CreateTimerInternal(TimerId, ETimerType::OneShot, Delay, 1, CompleteCallback))
+    if (CreateTimerInternal(TimerId, ETimerType::OneShot, Delay, 1, CompleteCallback).IsValid())
     {
         return TimerId;
     }
@@ -188,7 +525,7 @@ FString UMonoManager::SetTimeout(float Delay, const FTimerCallbackDelegate& Comp
 FString UMonoManager::SetTimeoutSimple(float Delay, const FTimerSimpleDelegate& CompleteCallback)
 {
     FString TimerId = GenerateTimerId();
-    if (CreateTimerInternal(TimerId, ETimerType::OneShot, Delay, 1, FTimerCallbackDelegate(), FTimerUpdateCallbackDelegate(), CompleteCallback))
+    if (CreateTimerInternal(TimerId, ETimerType::OneShot, Delay, 1, FTimerCallbackDelegate(), FTimerUpdateCallbackDelegate(), CompleteCallback).IsValid())
     {
         return TimerId;
     }
@@ -198,7 +535,7 @@ FString UMonoManager::SetTimeoutSimple(float Delay, const FTimerSimpleDelegate&
 FString UMonoManager::SetInterval(float Interval, const FTimerCallbackDelegate& CompleteCallback)
 {
     FString TimerId = GenerateTimerId();
-    if (CreateTimerInternal(TimerId, ETimerType::Interval, Interval, 0, CompleteCallback))
+    if (CreateTimerInternal(TimerId, ETimerType::Interval, Interval, 0, CompleteCallback).IsValid())
     {
         return TimerId;
     }
@@ -208,7 +545,7 @@ FString UMonoManager::SetInterval(float Interval, const FTimerCallbackDelegate&
 FString UMonoManager::SetIntervalSimple(float Interval, const FTimerSimpleDelegate& CompleteCallback)
 {
     FString TimerId = GenerateTimerId();
-    if (CreateTimerInternal(TimerId, ETimerType::Interval, Interval, 0, FTimerCallbackDelegate(), FTimerUpdateCallbackDelegate(), CompleteCallback))
+    if (CreateTimerInternal(TimerId, ETimerType::Interval, Interval, 0, FTimerCallbackDelegate(), FTimerUpdateCallbackDelegate(), CompleteCallback).IsValid())
     {
         return TimerId;
     }
@@ -218,7 +555,7 @@ FString UMonoManager::SetIntervalSimple(float Interval, const FTimerSimpleDelega
 FString UMonoManager::SetIntervalWithUpdate(float Interval, const FTimerCallbackDelegate& CompleteCallback, const FTimerUpdateCallbackDelegate& UpdateCallback)
 {
     FString TimerId = GenerateTimerId();
-    if (CreateTimerInternal(TimerId, ETimerType::Interval, Interval, 0, CompleteCallback, UpdateCallback))
+    if (CreateTimerInternal(TimerId, ETimerType::Interval, Interval, 0, CompleteCallback, UpdateCallback).IsValid())
     {
         return TimerId;
     }
@@ -228,7 +565,7 @@ FString UMonoManager::SetIntervalWithUpdate(float Interval, const FTimerCallback
 FString UMonoManager::SetCountdown(float Interval, int32 Count, const FTimerCallbackDelegate& CompleteCallback)
 {
     FString TimerId = GenerateTimerId();
-    if (CreateTimerInternal(TimerId, ETimerType::Countdown, Interval, Count, CompleteCallback))
+    if (CreateTimerInternal(TimerId, ETimerType::Countdown, Interval, Count, CompleteCallback).IsValid())
     {
         return TimerId;
     }
@@ -238,236 +575,942 @@ FString UMonoManager::SetCountdown(float Interval, int32 Count, const FTimerCall
 FString UMonoManager::SetCountdownSimple(float Interval, int32 Count, const FTimerSimpleDelegate& CompleteCallback)
 {
     FString TimerId = GenerateTimerId();
-    if (CreateTimerInternal(TimerId, ETimerType::Countdown, Interval, Count, FTimerCallbackDelegate(), FTimerUpdateCallbackDelegate(), CompleteCallback))
+    if (CreateTimerInternal(TimerId, ETimerType::Countdown, Interval, Count, FTimerCallbackDelegate(), FTimerUpdateCallbackDelegate(), CompleteCallback).IsValid())
     {
         return TimerId;
     }
     return FString();
 }
 
-// ========== ʱϵͳ (ԶTimerId) ==========
+// ========== 计时器系统 (自定义TimerId) ==========
 
 bool UMonoManager::SetTimeoutWithId(float Delay, const FString& TimerId, const FTimerCallbackDelegate& CompleteCallback)
 {
-    return CreateTimerInternal(TimerId, ETimerType::OneShot, Delay, 1, CompleteCallback);
+    return CreateTimerInternal(TimerId, ETimerType::OneShot, Delay, 1, CompleteCallback).IsValid();
 }
 
 bool UMonoManager::SetTimeoutSimpleWithId(float Delay, const FString& TimerId, const FTimerSimpleDelegate& CompleteCallback)
 {
-    return CreateTimerInternal(TimerId, ETimerType::OneShot, Delay, 1, FTimerCallbackDelegate(), FTimerUpdateCallbackDelegate(), CompleteCallback);
+    return CreateTimerInternal(TimerId, ETimerType::OneShot, Delay, 1, FTimerCallbackDelegate(), FTimerUpdateCallbackDelegate(), CompleteCallback).IsValid();
 }
 
 bool UMonoManager::SetIntervalWithId(float Interval, const FString& TimerId, const FTimerCallbackDelegate& CompleteCallback)
 {
-    return CreateTimerInternal(TimerId, ETimerType::Interval, Interval, 0, CompleteCallback);
+    return CreateTimerInternal(TimerId, ETimerType::Interval, Interval, 0, CompleteCallback).IsValid();
 }
 
 bool UMonoManager::SetIntervalSimpleWithId(float Interval, const FString& TimerId, const FTimerSimpleDelegate& CompleteCallback)
 {
-    return CreateTimerInternal(TimerId, ETimerType::Interval, Interval, 0, FTimerCallbackDelegate(), FTimerUpdateCallbackDelegate(), CompleteCallback);
+    return CreateTimerInternal(TimerId, ETimerType::Interval, Interval, 0, FTimerCallbackDelegate(), FTimerUpdateCallbackDelegate(), CompleteCallback).IsValid();
 }
 
 bool UMonoManager::SetCountdownWithId(float Interval, int32 Count, const FString& TimerId, const FTimerCallbackDelegate& CompleteCallback)
 {
-    return CreateTimerInternal(TimerId, ETimerType::Countdown, Interval, Count, CompleteCallback);
+    return CreateTimerInternal(TimerId, ETimerType::Countdown, Interval, Count, CompleteCallback).IsValid();
 }
 
 bool UMonoManager::SetCountdownSimpleWithId(float Interval, int32 Count, const FString& TimerId, const FTimerSimpleDelegate& CompleteCallback)
 {
-    return CreateTimerInternal(TimerId, ETimerType::Countdown, Interval, Count, FTimerCallbackDelegate(), FTimerUpdateCallbackDelegate(), CompleteCallback);
+    return CreateTimerInternal(TimerId, ETimerType::Countdown, Interval, Count, FTimerCallbackDelegate(), FTimerUpdateCallbackDelegate(), CompleteCallback).IsValid();
 }
 
-// ========== ʱ ==========
+// ========== C++句柄接口 ==========
 
-void UMonoManager::PauseTimer(const FString& TimerId)
+FMonoTimerHandle UMonoManager::SetTimer(ETimerType TimerType, float Duration, int32 LoopCount, TFunction<void()> Callback, UObject* Owner, ETimerDomain Domain)
 {
-    FTimerInfo* TimerInfo = Timers.Find(TimerId);
-    if (TimerInfo)
+    const FMonoTimerHandle Handle = CreateTimerInternal(FString(), TimerType, Duration, LoopCount,
+        FTimerCallbackDelegate(), FTimerUpdateCallbackDelegate(), FTimerSimpleDelegate(), MoveTemp(Callback), Owner);
+    if (Domain != ETimerDomain::Game)
     {
-        TimerInfo->bIsActive = false;
-        UE_LOG(LogTemp, Log, TEXT("Paused timer: %s"), *TimerId);
+        SetTimerDomain(Handle, Domain);
     }
+    return Handle;
 }
 
-void UMonoManager::ResumeTimer(const FString& TimerId)
+void UMonoManager::PauseTimer(FMonoTimerHandle Handle)
 {
-    FTimerInfo* TimerInfo = Timers.Find(TimerId);
-    if (TimerInfo)
+    FMonoTimerSlot* Slot = FindSlot(Handle);
+    if (Slot && Slot->Timer.bIsActive)
     {
-        TimerInfo->bIsActive = true;
-        UE_LOG(LogTemp, Log, TEXT("Resumed timer: %s"), *TimerId);
-    }
-}
-
-void UMonoManager::ClearTimer(const FString& TimerId)
-{
-    Timers.Remove(TimerId);
-    TimerCallbacks.Remove(TimerId);
-    SimpleCallbacks.Remove(TimerId);
-    UpdateCallbacks.Remove(TimerId);
+        // 记录已经过的时间，堆中的条目随序号变化失效
+        Slot->Timer.ElapsedTime = GetTimerElapsed(Slot->Timer);
+        Slot->Timer.bIsActive = false;
+        Slot->Timer.ScheduleSerial = ++NextScheduleSerial;
+        UE_LOG(LogTemp, Log, TEXT("Paused timer: %s (#%d)"), *Slot->Timer.TimerId, Handle.Index);
 
-    UE_LOG(LogTemp, Log, TEXT("Cleared timer: %s"), *TimerId);
-
-    // ûлʱֹͣ¼ʱ
-    if (GetActiveTimerCount() == 0)
-    {
-        StopUpdateTimer();
+        ScheduleNextUpdate();
     }
 }
 
-void UMonoManager::RestartTimer(const FString& TimerId)
+void UMonoManager::ResumeTimer(FMonoTimerHandle Handle)
 {
-    FTimerInfo* TimerInfo = Timers.Find(TimerId);
-    if (TimerInfo)
+    FMonoTimerSlot* Slot = FindSlot(Handle);
+    if (Slot && !Slot->Timer.bIsActive)
     {
-        TimerInfo->ElapsedTime = 0.0f;
-        TimerInfo->CurrentLoop = 0;
-        TimerInfo->bIsActive = true;
-        UE_LOG(LogTemp, Log, TEXT("Restarted timer: %s"), *TimerId);
+        SyncSchedulerClock(Slot->Timer.Domain);
+        Slot->Timer.bIsActive = true;
+        ScheduleTimer(Slot->Timer, Handle.Index, GetDomainClock(Slot->Timer.Domain).Time + Slot->Timer.Duration - Slot->Timer.ElapsedTime);
+        UE_LOG(LogTemp, Log, TEXT("Resumed timer: %s (#%d)"), *Slot->Timer.TimerId, Handle.Index);
+
+        ScheduleNextUpdate();
     }
 }
 
-void UMonoManager::PauseAllTimers()
+void UMonoManager::RestartTimer(FMonoTimerHandle Handle)
 {
-    for (auto& TimerPair : Timers)
+    FMonoTimerSlot* Slot = FindSlot(Handle);
+    if (Slot)
     {
-        TimerPair.Value.bIsActive = false;
+        SyncSchedulerClock(Slot->Timer.Domain);
+        Slot->Timer.ElapsedTime = 0.0f;
+        Slot->Timer.CurrentLoop = 0;
+        Slot->Timer.bIsActive = true;
+        ScheduleTimer(Slot->Timer, Handle.Index, GetDomainClock(Slot->Timer.Domain).Time + Slot->Timer.Duration);
+        UE_LOG(LogTemp, Log, TEXT("Restarted timer: %s (#%d)"), *Slot->Timer.TimerId, Handle.Index);
+
+        ScheduleNextUpdate();
     }
-    UE_LOG(LogTemp, Log, TEXT("Paused all %d timers"), Timers.Num());
 }
 
-void UMonoManager::ResumeAllTimers()
+void UMonoManager::ClearTimer(FMonoTimerHandle& Handle)
 {
-    for (auto& TimerPair : Timers)
+    if (FindSlot(Handle))
     {
-        TimerPair.Value.bIsActive = true;
+        ReleaseSlot(Handle.Index);
+        ScheduleNextUpdate();
     }
-    UE_LOG(LogTemp, Log, TEXT("Resumed all %d timers"), Timers.Num());
+    Handle.Invalidate();
 }
 
-void UMonoManager::ClearAllTimers()
+bool UMonoManager::IsTimerValid(FMonoTimerHandle Handle) const
 {
-    int32 Count = Timers.Num();
-    Timers.Empty();
-    TimerCallbacks.Empty();
-    SimpleCallbacks.Empty();
-    UpdateCallbacks.Empty();
-
-    StopUpdateTimer();
-
-    UE_LOG(LogTemp, Log, TEXT("Cleared all %d timers"), Count);
+    return FindSlot(Handle) != nullptr;
 }
 
-// ========== ѯ ==========
-
-bool UMonoManager::IsTimerActive(const FString& TimerId) const
+bool UMonoManager::IsTimerActive(FMonoTimerHandle Handle) const
 {
-    const FTimerInfo* TimerInfo = Timers.Find(TimerId);
-    return TimerInfo && TimerInfo->bIsActive;
+    const FMonoTimerSlot* Slot = FindSlot(Handle);
+    return Slot && Slot->Timer.bIsActive;
 }
 
-float UMonoManager::GetTimerRemainingTime(const FString& TimerId) const
+float UMonoManager::GetTimerRemainingTime(FMonoTimerHandle Handle) const
 {
-    const FTimerInfo* TimerInfo = Timers.Find(TimerId);
-    if (TimerInfo)
+    const FMonoTimerSlot* Slot = FindSlot(Handle);
+    if (Slot)
     {
-        return FMath::Max(0.0f, TimerInfo->Duration - TimerInfo->ElapsedTime);
+        return FMath::Max(0.0f, Slot->Timer.Duration - GetTimerElapsed(Slot->Timer));
     }
     return 0.0f;
 }
 
-float UMonoManager::GetTimerProgress(const FString& TimerId) const
+float UMonoManager::GetTimerProgress(FMonoTimerHandle Handle) const
 {
-    const FTimerInfo* TimerInfo = Timers.Find(TimerId);
-    if (TimerInfo && TimerInfo->Duration > 0.0f)
+    const FMonoTimerSlot* Slot = FindSlot(Handle);
+    if (Slot && Slot->Timer.Duration > 0.0f)
     {
-        return FMath::Clamp(TimerInfo->ElapsedTime / TimerInfo->Duration, 0.0f, 1.0f);
+        return FMath::Clamp(GetTimerElapsed(Slot->Timer) / Slot->Timer.Duration, 0.0f, 1.0f);
     }
     return 0.0f;
 }
 
-int32 UMonoManager::GetActiveTimerCount() const
+FMonoTimerHandle UMonoManager::FindTimer(const FString& TimerId) const
 {
-    int32 Count = 0;
-    for (const auto& TimerPair : Timers)
+    const FMonoTimerHandle* Handle = NamedTimers.Find(TimerId);
+    return Handle ? *Handle : FMonoTimerHandle();
+}
+
+void UMonoManager::SetTimerDomain(FMonoTimerHandle Handle, ETimerDomain Domain)
+{
+    FMonoTimerSlot* Slot = FindSlot(Handle);
+    if (!Slot || Slot->Timer.Domain == Domain)
     {
-        if (TimerPair.Value.bIsActive)
-        {
-            Count++;
-        }
+        return;
     }
-    return Count;
+
+    if (!Slot->Timer.bIsActive)
+    {
+        Slot->Timer.Domain = Domain;
+        return;
+    }
+
+    // 按剩余时间在新时间域中重新调度，旧堆中的条目随序号变化失效
+    const double Remaining = Slot->Timer.FireTime - GetSchedulerTime(Slot->Timer.Domain);
+    Slot->Timer.Domain = Domain;
+    SyncSchedulerClock(Domain);
+    ScheduleTimer(Slot->Timer, Handle.Index, GetDomainClock(Domain).Time + Remaining);
+
+    ScheduleNextUpdate();
 }
 
-// ========== Թ ==========
+// ========== 时间域 ==========
 
-void UMonoManager::PrintAllTimers()
+void UMonoManager::SetTimerDomain(const FString& TimerId, ETimerDomain Domain)
 {
-    UE_LOG(LogTemp, Log, TEXT("=== Active Timers (%d) ==="), Timers.Num());
+    SetTimerDomain(FindTimer(TimerId), Domain);
+}
 
-    for (const auto& TimerPair : Timers)
-    {
-        const FTimerInfo& Timer = TimerPair.Value;
-        FString TypeString = UEnum::GetValueAsString(Timer.TimerType);
-        FString Status = Timer.bIsActive ? TEXT("Active") : TEXT("Paused");
-        FString LoopInfo = Timer.LoopCount == 0 ?
-            TEXT("Infinite") :
-            FString::Printf(TEXT("%d/%d"), Timer.CurrentLoop, Timer.LoopCount);
+void UMonoManager::SetTimerDomainScale(ETimerDomain Domain, float TimeScale)
+{
+    // 先按旧缩放结算已经过的时间
+    SyncSchedulerClock(Domain);
+    GetDomainClock(Domain).TimeScale = FMath::Max(0.0f, TimeScale);
 
-        UE_LOG(LogTemp, Log, TEXT("  %s: %s [%s] %.2f/%.2f Loops: %s"),
-            *Timer.TimerId, *TypeString, *Status, Timer.ElapsedTime, Timer.Duration, *LoopInfo);
-    }
+    ScheduleNextUpdate();
+}
 
-    UE_LOG(LogTemp, Log, TEXT("=== End Timers ==="));
+float UMonoManager::GetTimerDomainScale(ETimerDomain Domain) const
+{
+    return GetDomainClock(Domain).TimeScale;
 }
 
-// ========== ڲʵ ==========
+void UMonoManager::SetTimerDomainPaused(ETimerDomain Domain, bool bPaused)
+{
+    SyncSchedulerClock(Domain);
+    GetDomainClock(Domain).bPaused = bPaused;
+
+    UE_LOG(LogTemp, Log, TEXT("Timer domain %s %s"), *UEnum::GetValueAsString(Domain), bPaused ? TEXT("paused") : TEXT("resumed"));
 
-FString UMonoManager::GenerateTimerId() const
+    ScheduleNextUpdate();
+}
+
+bool UMonoManager::IsTimerDomainPaused(ETimerDomain Domain) const
 {
-    return FGuid::NewGuid().ToString();
+    return GetDomainClock(Domain).bPaused;
+}
+
+float UMonoManager::GetTimerDomainTime(ETimerDomain Domain) const
+{
+    return (float)GetSchedulerTime(Domain);
+}
+
+// ========== 协程任务 ==========
+
+void UMonoManager::RegisterTask(const TSharedRef<FMonoTaskState>& State)
+{
+    State->TaskId = ++NextTaskId;
+    ActiveTasks.Add(State->TaskId, State);
+}
+
+void UMonoManager::UnregisterTask(uint32 TaskId)
+{
+    ActiveTasks.Remove(TaskId);
 }
 
-void UMonoManager::ExecuteTimerCallback(const FString& TimerId)
+void UMonoManager::DelayFrames(int32 FrameCount, TFunction<void()> Callback)
 {
-    UE_LOG(LogTemp, Log, TEXT("Executing timer callback: %s"), *TimerId);
+    FFrameWaitEntry Entry;
+    Entry.TargetFrame = GFrameCounter + FMath::Max(1, FrameCount);
+    Entry.Callback = MoveTemp(Callback);
+    FrameWaits.HeapPush(MoveTemp(Entry));
+
+    ScheduleNextUpdate();
+}
 
-    // ִдTimerIdĻص
-    FTimerCallbackDelegate* TimerCallback = TimerCallbacks.Find(TimerId);
-    if (TimerCallback && TimerCallback->IsBound())
+void UMonoManager::CancelTasksForOwner(UObject* Owner)
+{
+    // 取消时任务会从ActiveTasks中移除，先取出副本
+    TArray<TSharedPtr<FMonoTaskState>> Tasks;
+    for (const TPair<uint32, TSharedPtr<FMonoTaskState>>& Pair : ActiveTasks)
     {
-        UE_LOG(LogTemp, Log, TEXT("Executing TimerCallback for: %s"), *TimerId);
-        TimerCallback->Execute(TimerId);
+        if (Pair.Value->bHasOwner && Pair.Value->Owner.Get() == Owner)
+        {
+            Tasks.Add(Pair.Value);
+        }
     }
 
-    // ִм޲λص
-    FTimerSimpleDelegate* SimpleCallback = SimpleCallbacks.Find(TimerId);
-    if (SimpleCallback && SimpleCallback->IsBound())
+    for (const TSharedPtr<FMonoTaskState>& Task : Tasks)
     {
-        UE_LOG(LogTemp, Log, TEXT("Executing SimpleCallback for: %s"), *TimerId);
-        SimpleCallback->Execute();
+        Task->Cancel();
     }
+}
+
+void UMonoManager::CancelAllTasks()
+{
+    TArray<TSharedPtr<FMonoTaskState>> Tasks;
+    ActiveTasks.GenerateValueArray(Tasks);
 
-    // ִгԱص - ʹLambda
-    FTimerInfo* TimerInfo = Timers.Find(TimerId);
-    if (TimerInfo && TimerInfo->StaticCallback)
+    for (const TSharedPtr<FMonoTaskState>& Task : Tasks)
     {
-        UE_LOG(LogTemp, Log, TEXT("Executing member function for: %s"), *TimerId);
-        TimerInfo->StaticCallback();
+        Task->Cancel();
     }
 }
 
-UWorld* UMonoManager::GetWorld() const
+int32 UMonoManager::GetActiveTaskCount() const
 {
-    if (GEngine)
+    return ActiveTasks.Num();
+}
+
+void UMonoManager::HandlePostGarbageCollect()
+{
+    TArray<TSharedPtr<FMonoTaskState>> DeadTasks;
+    for (const TPair<uint32, TSharedPtr<FMonoTaskState>>& Pair : ActiveTasks)
     {
-        for (const FWorldContext& Context : GEngine->GetWorldContexts())
+        if (!Pair.Value->IsOwnerAlive())
         {
-            if (Context.WorldType == EWorldType::Game || Context.WorldType == EWorldType::PIE)
-            {
-                return Context.World();
-            }
+            DeadTasks.Add(Pair.Value);
         }
     }
-    return nullptr;
-}
\ No newline at end of file
+
+    for (const TSharedPtr<FMonoTaskState>& Task : DeadTasks)
+    {
+        Task->Cancel();
+    }
+
+    if (DeadTasks.Num() > 0)
+    {
+        UE_LOG(LogTemp, Verbose, TEXT("Cancelled %d tasks whose owner was destroyed"), DeadTasks.Num());
+    }
+}
+
+// ========== 计时器控制 ==========
+
+void UMonoManager::PauseTimer(const FString& TimerId)
+{
+    PauseTimer(FindTimer(TimerId));
+}
+
+void UMonoManager::ResumeTimer(const FString& TimerId)
+{
+    ResumeTimer(FindTimer(TimerId));
+}
+
+void UMonoManager::ClearTimer(const FString& TimerId)
+{
+    FMonoTimerHandle Handle = FindTimer(TimerId);
+    ClearTimer(Handle);
+}
+
+void UMonoManager::RestartTimer(const FString& TimerId)
+{
+    RestartTimer(FindTimer(TimerId));
+}
+
+void UMonoManager::PauseAllTimers()
+{
+    int32 Count = 0;
+    for (FMonoTimerSlot& Slot : TimerSlots)
+    {
+        if (Slot.bInUse && Slot.Timer.bIsActive)
+        {
+            Slot.Timer.ElapsedTime = GetTimerElapsed(Slot.Timer);
+            Slot.Timer.bIsActive = false;
+            Count++;
+        }
+    }
+
+    // 所有条目都已失效
+    for (FTimerDomainClock& Clock : TimerDomains)
+    {
+        Clock.Heap.Reset();
+    }
+
+    // 帧等待不受计时器暂停影响，仍需继续更新
+    ScheduleNextUpdate();
+
+    UE_LOG(LogTemp, Log, TEXT("Paused all %d timers"), Count);
+}
+
+void UMonoManager::ResumeAllTimers()
+{
+    for (int32 DomainIndex = 0; DomainIndex < TimerDomains.Num(); ++DomainIndex)
+    {
+        SyncSchedulerClock((ETimerDomain)DomainIndex);
+    }
+
+    int32 Count = 0;
+    for (int32 SlotIndex = 0; SlotIndex < TimerSlots.Num(); ++SlotIndex)
+    {
+        FMonoTimerSlot& Slot = TimerSlots[SlotIndex];
+        if (Slot.bInUse && !Slot.Timer.bIsActive)
+        {
+            Slot.Timer.bIsActive = true;
+            ScheduleTimer(Slot.Timer, SlotIndex, GetDomainClock(Slot.Timer.Domain).Time + Slot.Timer.Duration - Slot.Timer.ElapsedTime);
+            Count++;
+        }
+    }
+
+    ScheduleNextUpdate();
+
+    UE_LOG(LogTemp, Log, TEXT("Resumed all %d timers"), Count);
+}
+
+void UMonoManager::ClearAllTimers()
+{
+    // 协程任务正在等待的计时器保留，否则任务永远不会被唤醒
+    TSet<int32> TaskTimerSlots;
+    for (const auto& Pair : ActiveTasks)
+    {
+        if (Pair.Value.IsValid() && FindSlot(Pair.Value->WaitTimer))
+        {
+            TaskTimerSlots.Add(Pair.Value->WaitTimer.Index);
+        }
+    }
+
+    // 逐个释放槽位以递增代数，已发出的句柄全部失效
+    int32 Count = 0;
+    for (int32 SlotIndex = 0; SlotIndex < TimerSlots.Num(); ++SlotIndex)
+    {
+        if (TimerSlots[SlotIndex].bInUse && !TaskTimerSlots.Contains(SlotIndex))
+        {
+            ReleaseSlot(SlotIndex);
+            Count++;
+        }
+    }
+
+    NamedTimers.Empty();
+    ProgressTimers.Empty();
+
+    // 有保留的计时器时，已释放槽位的堆条目按失效条目在调度时剔除
+    if (TaskTimerSlots.Num() == 0)
+    {
+        for (FTimerDomainClock& Clock : TimerDomains)
+        {
+            Clock.Heap.Empty();
+        }
+    }
+
+    ScheduleNextUpdate();
+
+    UE_LOG(LogTemp, Log, TEXT("Cleared all %d timers"), Count);
+}
+
+// ========== 查询方法 ==========
+
+bool UMonoManager::IsTimerActive(const FString& TimerId) const
+{
+    return IsTimerActive(FindTimer(TimerId));
+}
+
+float UMonoManager::GetTimerRemainingTime(const FString& TimerId) const
+{
+    return GetTimerRemainingTime(FindTimer(TimerId));
+}
+
+float UMonoManager::GetTimerProgress(const FString& TimerId) const
+{
+    return GetTimerProgress(FindTimer(TimerId));
+}
+
+int32 UMonoManager::GetActiveTimerCount() const
+{
+    int32 Count = 0;
+    for (const FMonoTimerSlot& Slot : TimerSlots)
+    {
+        if (Slot.bInUse && Slot.Timer.bIsActive)
+        {
+            Count++;
+        }
+    }
+    return Count;
+}
+
+// ========== 帧阶段更新 ==========
+
+void FMonoPhaseTickFunction::ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent)
+{
+    if (Manager && TickType != LEVELTICK_ViewportsOnly)
+    {
+        Manager->TickPhaseGroup(GroupIndex, DeltaTime);
+    }
+}
+
+FString FMonoPhaseTickFunction::DiagnosticMessage()
+{
+    return FString::Printf(TEXT("MonoManager phase tick [%d]"), GroupIndex);
+}
+
+FMonoUpdateHandle UMonoManager::RegisterUpdate(EUpdatePhase Phase, const FMonoUpdateDelegate& Callback, TEnumAsByte<ETickingGroup> TickGroup)
+{
+    if (!Callback.IsBound())
+    {
+        UE_LOG(LogTemp, Warning, TEXT("No valid callback bound for phase update"));
+        return FMonoUpdateHandle();
+    }
+
+    return RegisterUpdateCallback(Phase, [Callback](float DeltaTime)
+        {
+            Callback.ExecuteIfBound(DeltaTime);
+        }, Callback.GetUObject(), TickGroup);
+}
+
+FMonoUpdateHandle UMonoManager::RegisterUpdateCallback(EUpdatePhase Phase, TFunction<void(float)> Callback, UObject* Owner, ETickingGroup TickGroup)
+{
+    if (!Callback)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("No valid callback bound for phase update"));
+        return FMonoUpdateHandle();
+    }
+
+    if (TickGroup == TG_MAX)
+    {
+        TickGroup = Phase == EUpdatePhase::LateUpdate ? TG_PostUpdateWork : TG_PrePhysics;
+    }
+
+    const int32 SlotIndex = FreeUpdaterSlots.Num() > 0 ? FreeUpdaterSlots.Pop(EAllowShrinking::No) : UpdaterSlots.AddDefaulted();
+    FPhaseUpdaterSlot& Slot = UpdaterSlots[SlotIndex];
+    Slot.GroupIndex = FindOrAddPhaseGroup(TickGroup);
+    Slot.Phase = Phase;
+    Slot.Position = INDEX_NONE;
+    Slot.bInUse = true;
+
+    FMonoUpdateHandle Handle;
+    Handle.Index = SlotIndex;
+    Handle.Generation = Slot.Generation;
+
+    FPhaseUpdater Updater;
+    Updater.Callback = MoveTemp(Callback);
+    Updater.Owner = Owner;
+    Updater.bHasOwner = Owner != nullptr;
+    Updater.SlotIndex = SlotIndex;
+
+    // 执行阶段中不能改动正在遍历的列表
+    if (bIsTickingPhases)
+    {
+        FPendingPhaseUpdater& Pending = PendingUpdaters.AddDefaulted_GetRef();
+        Pending.Handle = Handle;
+        Pending.Updater = MoveTemp(Updater);
+    }
+    else
+    {
+        AddUpdaterToGroup(Handle, MoveTemp(Updater));
+    }
+
+    RegisterPhaseTickFunction(*PhaseGroups[Slot.GroupIndex]);
+    return Handle;
+}
+
+void UMonoManager::UnregisterUpdate(FMonoUpdateHandle& Handle)
+{
+    if (UpdaterSlots.IsValidIndex(Handle.Index))
+    {
+        const FPhaseUpdaterSlot& Slot = UpdaterSlots[Handle.Index];
+        if (Slot.bInUse && Slot.Generation == Handle.Generation)
+        {
+            ReleaseUpdaterSlot(Handle.Index);
+        }
+    }
+    Handle.Invalidate();
+}
+
+int32 UMonoManager::GetUpdaterCount() const
+{
+    return UpdaterSlots.Num() - FreeUpdaterSlots.Num();
+}
+
+float UMonoManager::GetFixedUpdateAlpha() const
+{
+    return FixedTimeStep > 0.0f ? FMath::Clamp(FixedTimeAccumulator / FixedTimeStep, 0.0f, 1.0f) : 0.0f;
+}
+
+void UMonoManager::TickPhaseGroup(int32 GroupIndex, float DeltaTime)
+{
+    if (!PhaseGroups.IsValidIndex(GroupIndex))
+    {
+        return;
+    }
+
+    // 固定步数每帧只计算一次，所有Tick组共用
+    if (LastFixedStepFrame != GFrameCounter)
+    {
+        LastFixedStepFrame = GFrameCounter;
+        FixedStepsThisFrame = 0;
+
+        const float Step = FMath::Max(FixedTimeStep, 0.001f);
+        FixedTimeAccumulator += DeltaTime;
+        while (FixedTimeAccumulator >= Step && FixedStepsThisFrame < MaxFixedStepsPerFrame)
+        {
+            FixedTimeAccumulator -= Step;
+            FixedStepsThisFrame++;
+        }
+
+        // 达到上限时丢弃积压的时间
+        if (FixedStepsThisFrame >= MaxFixedStepsPerFrame)
+        {
+            FixedTimeAccumulator = FMath::Min(FixedTimeAccumulator, Step);
+        }
+    }
+
+    FPhaseTickGroup& Group = *PhaseGroups[GroupIndex];
+
+    bIsTickingPhases = true;
+    for (int32 Step = 0; Step < FixedStepsThisFrame; ++Step)
+    {
+        RunPhase(Group, EUpdatePhase::FixedUpdate, FixedTimeStep);
+    }
+    RunPhase(Group, EUpdatePhase::Update, DeltaTime);
+    RunPhase(Group, EUpdatePhase::LateUpdate, DeltaTime);
+    bIsTickingPhases = false;
+
+    FlushPhaseChanges();
+
+    // 组内没有条目时停用Tick函数
+    const bool bHasUpdaters = Group.Updaters[0].Num() + Group.Updaters[1].Num() + Group.Updaters[2].Num() > 0;
+    if (!bHasUpdaters && Group.TickFunction.IsValid())
+    {
+        Group.TickFunction->SetTickFunctionEnable(false);
+    }
+}
+
+void UMonoManager::RunPhase(FPhaseTickGroup& Group, EUpdatePhase Phase, float DeltaTime)
+{
+    // 执行期间新增条目进入待加入列表，注销只做标记，列表不会重新分配
+    TArray<FPhaseUpdater>& Updaters = Group.Updaters[(int32)Phase];
+    for (int32 Index = 0; Index < Updaters.Num(); ++Index)
+    {
+        FPhaseUpdater& Updater = Updaters[Index];
+        if (!Updater.bAlive)
+        {
+            continue;
+        }
+
+        if (Updater.bHasOwner && !Updater.Owner.IsValid())
+        {
+            ReleaseUpdaterSlot(Updater.SlotIndex);
+            continue;
+        }
+
+        Updater.Callback(DeltaTime);
+    }
+}
+
+void UMonoManager::FlushPhaseChanges()
+{
+    for (TUniquePtr<FPhaseTickGroup>& Group : PhaseGroups)
+    {
+        if (Group->bNeedsCompaction)
+        {
+            CompactPhaseGroup(*Group);
+        }
+    }
+
+    if (PendingUpdaters.Num() > 0)
+    {
+        TArray<FPendingPhaseUpdater> Pending = MoveTemp(PendingUpdaters);
+        PendingUpdaters.Reset();
+
+        for (FPendingPhaseUpdater& Entry : Pending)
+        {
+            // 加入前已被注销的条目直接丢弃
+            const FPhaseUpdaterSlot& Slot = UpdaterSlots[Entry.Handle.Index];
+            if (Slot.bInUse && Slot.Generation == Entry.Handle.Generation)
+            {
+                AddUpdaterToGroup(Entry.Handle, MoveTemp(Entry.Updater));
+            }
+        }
+    }
+}
+
+void UMonoManager::CompactPhaseGroup(FPhaseTickGroup& Group)
+{
+    for (TArray<FPhaseUpdater>& Updaters : Group.Updaters)
+    {
+        Updaters.RemoveAll([](const FPhaseUpdater& Updater) { return !Updater.bAlive; });
+        for (int32 Position = 0; Position < Updaters.Num(); ++Position)
+        {
+            UpdaterSlots[Updaters[Position].SlotIndex].Position = Position;
+        }
+    }
+    Group.bNeedsCompaction = false;
+}
+
+void UMonoManager::AddUpdaterToGroup(FMonoUpdateHandle Handle, FPhaseUpdater&& Updater)
+{
+    FPhaseUpdaterSlot& Slot = UpdaterSlots[Handle.Index];
+    TArray<FPhaseUpdater>& Updaters = PhaseGroups[Slot.GroupIndex]->Updaters[(int32)Slot.Phase];
+    Slot.Position = Updaters.Add(MoveTemp(Updater));
+}
+
+void UMonoManager::ReleaseUpdaterSlot(int32 SlotIndex)
+{
+    FPhaseUpdaterSlot& Slot = UpdaterSlots[SlotIndex];
+    if (!Slot.bInUse)
+    {
+        return;
+    }
+
+    if (Slot.Position != INDEX_NONE)
+    {
+        FPhaseTickGroup& Group = *PhaseGroups[Slot.GroupIndex];
+        TArray<FPhaseUpdater>& Updaters = Group.Updaters[(int32)Slot.Phase];
+
+        if (bIsTickingPhases)
+        {
+            // 执行中只做标记，本组执行完后统一压缩
+            Updaters[Slot.Position].bAlive = false;
+            Group.bNeedsCompaction = true;
+        }
+        else
+        {
+            // 与末尾条目交换后移除，保持列表连续
+            const int32 Position = Slot.Position;
+            Updaters.RemoveAtSwap(Position, 1, EAllowShrinking::No);
+            if (Updaters.IsValidIndex(Position))
+            {
+                UpdaterSlots[Updaters[Position].SlotIndex].Position = Position;
+            }
+        }
+    }
+
+    Slot.Generation++;
+    Slot.GroupIndex = INDEX_NONE;
+    Slot.Position = INDEX_NONE;
+    Slot.bInUse = false;
+    FreeUpdaterSlots.Add(SlotIndex);
+}
+
+int32 UMonoManager::FindOrAddPhaseGroup(ETickingGroup TickGroup)
+{
+    const int32 ExistingIndex = PhaseGroups.IndexOfByPredicate([TickGroup](const TUniquePtr<FPhaseTickGroup>& Group)
+        {
+            return Group->TickGroup == TickGroup;
+        });
+    if (ExistingIndex != INDEX_NONE)
+    {
+        return ExistingIndex;
+    }
+
+    const int32 GroupIndex = PhaseGroups.Add(MakeUnique<FPhaseTickGroup>());
+    FPhaseTickGroup& Group = *PhaseGroups[GroupIndex];
+    Group.TickGroup = TickGroup;
+    Group.TickFunction = MakeUnique<FMonoPhaseTickFunction>();
+    Group.TickFunction->Manager = this;
+    Group.TickFunction->GroupIndex = GroupIndex;
+    Group.TickFunction->TickGroup = TickGroup;
+    Group.TickFunction->bCanEverTick = true;
+    Group.TickFunction->bStartWithTickEnabled = true;
+    return GroupIndex;
+}
+
+void UMonoManager::RegisterPhaseTickFunction(FPhaseTickGroup& Group)
+{
+    UWorld* World = GetWorld();
+    if (!World || !World->PersistentLevel)
+    {
+        return;
+    }
+
+    // 世界切换后先从旧世界注销
+    if (PhaseTickWorld.Get() != World)
+    {
+        UnregisterAllPhaseTickFunctions();
+        PhaseTickWorld = World;
+    }
+
+    if (!Group.TickFunction->IsTickFunctionRegistered())
+    {
+        Group.TickFunction->RegisterTickFunction(World->PersistentLevel);
+    }
+    Group.TickFunction->SetTickFunctionEnable(true);
+}
+
+void UMonoManager::RegisterAllPhaseTickFunctions()
+{
+    for (TUniquePtr<FPhaseTickGroup>& Group : PhaseGroups)
+    {
+        if (Group->Updaters[0].Num() + Group->Updaters[1].Num() + Group->Updaters[2].Num() > 0)
+        {
+            RegisterPhaseTickFunction(*Group);
+        }
+    }
+}
+
+void UMonoManager::UnregisterAllPhaseTickFunctions()
+{
+    for (TUniquePtr<FPhaseTickGroup>& Group : PhaseGroups)
+    {
+        if (Group->TickFunction.IsValid() && Group->TickFunction->IsTickFunctionRegistered())
+        {
+            Group->TickFunction->UnRegisterTickFunction();
+        }
+    }
+    PhaseTickWorld.Reset();
+    FixedTimeAccumulator = 0.0f;
+}
+
+// ========== 调试工具 ==========
+
+void UMonoManager::PrintAllTimers()
+{
+    UE_LOG(LogTemp, Log, TEXT("=== Active Timers (%d) ==="), TimerSlots.Num() - FreeTimerSlots.Num());
+
+    for (int32 SlotIndex = 0; SlotIndex < TimerSlots.Num(); ++SlotIndex)
+    {
+        const FMonoTimerSlot& Slot = TimerSlots[SlotIndex];
+        if (!Slot.bInUse)
+        {
+            continue;
+        }
+
+        const FTimerInfo& Timer = Slot.Timer;
+        FString Name = Timer.TimerId.IsEmpty() ? FString::Printf(TEXT("#%d"), SlotIndex) : Timer.TimerId;
+        FString TypeString = UEnum::GetValueAsString(Timer.TimerType);
+        FString Status = Timer.bIsActive ? TEXT("Active") : TEXT("Paused");
+        FString LoopInfo = Timer.LoopCount == 0 ?
+            TEXT("Infinite") :
+            FString::Printf(TEXT("%d/%d"), Timer.CurrentLoop, Timer.LoopCount);
+
+        UE_LOG(LogTemp, Log, TEXT("  %s: %s [%s] %.2f/%.2f Loops: %s"),
+            *Name, *TypeString, *Status, GetTimerElapsed(Timer), Timer.Duration, *LoopInfo);
+    }
+
+    for (int32 DomainIndex = 0; DomainIndex < TimerDomains.Num(); ++DomainIndex)
+    {
+        const FTimerDomainClock& Clock = TimerDomains[DomainIndex];
+        UE_LOG(LogTemp, Log, TEXT("  Domain %s: Time %.2f, Scale %.2f%s"), *UEnum::GetValueAsString((ETimerDomain)DomainIndex),
+            GetSchedulerTime((ETimerDomain)DomainIndex), Clock.TimeScale, Clock.bPaused ? TEXT(", Paused") : TEXT(""));
+    }
+
+    UE_LOG(LogTemp, Log, TEXT("  Tasks: %d, Frame Waits: %d"), ActiveTasks.Num(), FrameWaits.Num());
+
+    UE_LOG(LogTemp, Log, TEXT("=== End Timers ==="));
+}
+
+void UMonoManager::BenchmarkTimers(int32 TimerCount, float SimulatedSeconds)
+{
+    TimerCount = FMath::Max(1, TimerCount);
+    SimulatedSeconds = FMath::Max(0.1f, SimulatedSeconds);
+
+    // 暂存现有计时器，基准测试使用独立的模拟时钟
+    TArray<FMonoTimerSlot> SavedSlots = MoveTemp(TimerSlots);
+    TArray<int32> SavedFreeSlots = MoveTemp(FreeTimerSlots);
+    TMap<FString, FMonoTimerHandle> SavedNamedTimers = MoveTemp(NamedTimers);
+    TArray<FMonoTimerHandle> SavedProgressTimers = MoveTemp(ProgressTimers);
+    TStaticArray<FTimerDomainClock, 3> SavedDomains;
+    for (int32 DomainIndex = 0; DomainIndex < TimerDomains.Num(); ++DomainIndex)
+    {
+        SavedDomains[DomainIndex] = MoveTemp(TimerDomains[DomainIndex]);
+        TimerDomains[DomainIndex] = FTimerDomainClock();
+    }
+    TimerSlots.Reset();
+    FreeTimerSlots.Reset();
+    NamedTimers.Reset();
+    ProgressTimers.Reset();
+    bIsUpdating = true;
+
+    int32 CallbackCount = 0;
+    FRandomStream Random(12345);
+
+    const double CreateStart = FPlatformTime::Seconds();
+    for (int32 Index = 0; Index < TimerCount; ++Index)
+    {
+        // 四分之一为间隔计时器，其余为一次性
+        FMonoTimerSlot NewSlot;
+        NewSlot.Timer = FTimerInfo(FString(), (Index % 4 == 0) ? ETimerType::Interval : ETimerType::OneShot, Random.FRandRange(0.05f, SimulatedSeconds));
+        NewSlot.Timer.StaticCallback = [&CallbackCount]() { CallbackCount++; };
+        RegisterTimer(MoveTemp(NewSlot), 0.0);
+    }
+    const double CreateTime = FPlatformTime::Seconds() - CreateStart;
+
+    const double FrameTime = 1.0 / 60.0;
+    const int32 FrameCount = FMath::CeilToInt(SimulatedSeconds / FrameTime);
+
+    // 轮询对照：每帧遍历全部计时器并检查进度回调，不推进也不执行回调
+    int32 PollTouched = 0;
+    const double PollStart = FPlatformTime::Seconds();
+    for (int32 Frame = 1; Frame <= FrameCount; ++Frame)
+    {
+        for (const FMonoTimerSlot& Slot : TimerSlots)
+        {
+            if (Slot.bInUse && Slot.Timer.bIsActive && !Slot.UpdateCallback.IsBound())
+            {
+                PollTouched++;
+            }
+        }
+    }
+    const double PollTime = FPlatformTime::Seconds() - PollStart;
+
+    // 最小堆：每帧只处理到期的计时器
+    int32 FiredCount = 0;
+    double MaxFrameTime = 0.0;
+    const double HeapStart = FPlatformTime::Seconds();
+    for (int32 Frame = 1; Frame <= FrameCount; ++Frame)
+    {
+        const double FrameStart = FPlatformTime::Seconds();
+        FiredCount += ProcessExpiredTimers(ETimerDomain::Game, Frame * FrameTime);
+        MaxFrameTime = FMath::Max(MaxFrameTime, FPlatformTime::Seconds() - FrameStart);
+    }
+    const double HeapTime = FPlatformTime::Seconds() - HeapStart;
+
+    UE_LOG(LogTemp, Log, TEXT("=== Timer Benchmark (%d timers, %d frames) ==="), TimerCount, FrameCount);
+    UE_LOG(LogTemp, Log, TEXT("Create: %.3f ms"), CreateTime * 1000.0);
+    UE_LOG(LogTemp, Log, TEXT("Heap: %.3f ms total, %.4f ms/frame avg, %.4f ms/frame max, %d fired, %d callbacks"),
+        HeapTime * 1000.0, HeapTime * 1000.0 / FrameCount, MaxFrameTime * 1000.0, FiredCount, CallbackCount);
+    UE_LOG(LogTemp, Log, TEXT("Polling: %.3f ms total, %.4f ms/frame avg, %d visits"),
+        PollTime * 1000.0, PollTime * 1000.0 / FrameCount, PollTouched);
+    UE_LOG(LogTemp, Log, TEXT("=== End Timer Benchmark ==="));
+
+    // 恢复现有计时器
+    TimerSlots = MoveTemp(SavedSlots);
+    FreeTimerSlots = MoveTemp(SavedFreeSlots);
+    NamedTimers = MoveTemp(SavedNamedTimers);
+    ProgressTimers = MoveTemp(SavedProgressTimers);
+    for (int32 DomainIndex = 0; DomainIndex < TimerDomains.Num(); ++DomainIndex)
+    {
+        TimerDomains[DomainIndex] = MoveTemp(SavedDomains[DomainIndex]);
+    }
+    bIsUpdating = false;
+
+    ScheduleNextUpdate();
+}
+
+// ========== 内部实现 ==========
+
+FString UMonoManager::GenerateTimerId() const
+{
+    return FGuid::NewGuid().ToString();
+}
+
+void UMonoManager::ExecuteTimerCallback(int32 SlotIndex)
+{
+    // 回调中可能增删计时器导致数组重新分配，先把回调取出
+    FMonoTimerSlot& Slot = TimerSlots[SlotIndex];
+    const FMonoTimerHandle Handle = MakeHandle(SlotIndex);
+    const FString TimerId = Slot.Timer.TimerId;
+    FTimerCallbackDelegate TimerCallback = Slot.CompleteCallback;
+    FTimerSimpleDelegate SimpleCallback = Slot.SimpleCallback;
+    TFunction<void()> StaticCallback = MoveTemp(Slot.Timer.StaticCallback);
+
+    UE_LOG(LogTemp, Verbose, TEXT("Executing timer callback: %s (#%d)"), *TimerId, SlotIndex);
+
+    // 执行带TimerId的回调
+    if (TimerCallback.IsBound())
+    {
+        TimerCallback.Execute(TimerId);
+    }
+
+    // 执行简单无参回调
+    if (SimpleCallback.IsBound())
+    {
+        SimpleCallback.Execute();
+    }
+
+    // 执行成员函数或Lambda回调
+    if (StaticCallback)
+    {
+        StaticCallback();
+    }
+
+    // 计时器仍然存在时放回回调
+    if (FMonoTimerSlot* CurrentSlot = FindSlot(Handle))
+    {
+        if (!CurrentSlot->Timer.StaticCallback)
+        {
+            CurrentSlot->Timer.StaticCallback = MoveTemp(StaticCallback);
+        }
+    }
+}
+
+UWorld* UMonoManager::GetWorld() const
+{
+    if (GEngine)
+    {
+        for (const FWorldContext& Context : GEngine->GetWorldContexts())
+        {
+            if (Context.WorldType == EWorldType::Game || Context.WorldType == EWorldType::PIE)
+            {
+                return Context.World();
+            }
+        }
+    }
+    return nullptr;
+}
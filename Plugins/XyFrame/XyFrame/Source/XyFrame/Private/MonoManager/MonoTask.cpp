@@ -0,0 +1,335 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "MonoManager/MonoTask.h"
+#include "ResourceManager/ResourceManager.h"
+#include "SceneManager/LoadSceneManager.h"
+
+// ========== FMonoTaskState ==========
+
+bool FMonoTaskState::Suspend(TFunctionRef<void(uint32 Serial)> StartWait)
+{
+    bRunning = false;
+
+    // 执行中请求了取消，挂起后在下一帧销毁协程帧
+    if (bCancelPending)
+    {
+        TWeakPtr<FMonoTaskState> WeakThis = AsShared();
+        UMonoManager::GetMonoManager()->DelayFrames(1, [WeakThis]()
+            {
+                if (TSharedPtr<FMonoTaskState> Pinned = WeakThis.Pin())
+                {
+                    Pinned->Cancel();
+                }
+            });
+        return true;
+    }
+
+    ++WaitSerial;
+    bSuspending = true;
+    bWokenInline = false;
+    StartWait(WaitSerial);
+    bSuspending = false;
+
+    // 等待在挂起前就已完成（例如加载失败立即回调），直接继续执行
+    if (bWokenInline)
+    {
+        ReleaseWait();
+        bRunning = true;
+        return false;
+    }
+
+    return true;
+}
+
+void FMonoTaskState::Wake(uint32 Serial)
+{
+    if (!IsWaiting(Serial))
+    {
+        return;
+    }
+
+    if (bSuspending)
+    {
+        bWokenInline = true;
+        return;
+    }
+
+    Resume();
+}
+
+void FMonoTaskState::Resume()
+{
+    if (!Handle || bRunning)
+    {
+        return;
+    }
+
+    ReleaseWait();
+
+    if (!IsOwnerAlive())
+    {
+        Cancel();
+        return;
+    }
+
+    // 协程结束时promise释放自己的引用，恢复期间保持状态有效
+    TSharedRef<FMonoTaskState> KeepAlive = AsShared();
+    bRunning = true;
+    Handle.resume();
+}
+
+void FMonoTaskState::Cancel()
+{
+    if (!Handle)
+    {
+        return;
+    }
+
+    if (bRunning)
+    {
+        bCancelPending = true;
+        return;
+    }
+
+    ReleaseWait();
+
+    std::coroutine_handle<> Frame = Handle;
+    Handle = nullptr;
+
+    if (UMonoManager::IsInstanceValid())
+    {
+        UMonoManager::GetMonoManager()->UnregisterTask(TaskId);
+    }
+
+    // 销毁协程帧会释放promise持有的状态引用，之后不能再访问this
+    Frame.destroy();
+}
+
+void FMonoTaskState::ReleaseWait()
+{
+    if (ReleaseWaitCallback)
+    {
+        TFunction<void()> Callback = MoveTemp(ReleaseWaitCallback);
+        ReleaseWaitCallback.Reset();
+        Callback();
+    }
+
+    if (WaitTimer.IsValid())
+    {
+        if (UMonoManager::IsInstanceValid())
+        {
+            UMonoManager::GetMonoManager()->ClearTimer(WaitTimer);
+        }
+        WaitTimer.Invalidate();
+    }
+}
+
+// ========== FMonoTask ==========
+
+bool FMonoTask::IsRunning() const
+{
+    TSharedPtr<FMonoTaskState> Pinned = State.Pin();
+    return Pinned && Pinned->IsAlive();
+}
+
+void FMonoTask::Cancel()
+{
+    if (TSharedPtr<FMonoTaskState> Pinned = State.Pin())
+    {
+        Pinned->Cancel();
+    }
+}
+
+FMonoWaitSeconds FMonoTask::WaitSeconds(float Seconds, ETimerDomain Domain)
+{
+    return FMonoWaitSeconds{ Seconds, Domain };
+}
+
+FMonoWaitFrames FMonoTask::WaitFrames(int32 FrameCount)
+{
+    return FMonoWaitFrames{ FrameCount };
+}
+
+FMonoWaitForResource FMonoTask::WaitForResource(const FString& ResourcePath)
+{
+    return FMonoWaitForResource{ ResourcePath };
+}
+
+FMonoWaitForSceneLoaded FMonoTask::WaitForSceneLoaded(const FString& RequestId)
+{
+    return FMonoWaitForSceneLoaded{ RequestId };
+}
+
+// ========== FMonoTaskPromise ==========
+
+FMonoTask FMonoTaskPromise::get_return_object()
+{
+    State->Handle = std::coroutine_handle<FMonoTaskPromise>::from_promise(*this);
+    return FMonoTask(State);
+}
+
+std::suspend_never FMonoTaskPromise::initial_suspend() noexcept
+{
+    if (UMonoManager* MonoManager = UMonoManager::GetMonoManager())
+    {
+        MonoManager->RegisterTask(State);
+    }
+    State->bRunning = true;
+    return {};
+}
+
+std::suspend_never FMonoTaskPromise::final_suspend() noexcept
+{
+    State->Handle = nullptr;
+    State->bRunning = false;
+
+    if (UMonoManager::IsInstanceValid())
+    {
+        UMonoManager::GetMonoManager()->UnregisterTask(State->TaskId);
+    }
+    return {};
+}
+
+void FMonoTaskPromise::SetOwner(const UObject* InOwner)
+{
+    State->Owner = const_cast<UObject*>(InOwner);
+    State->bHasOwner = InOwner != nullptr;
+}
+
+// ========== 等待对象 ==========
+
+bool FMonoWaitSeconds::await_suspend(std::coroutine_handle<FMonoTaskPromise> Handle)
+{
+    UMonoManager* MonoManager = UMonoManager::GetMonoManager();
+    if (!MonoManager)
+    {
+        return false;
+    }
+
+    const TSharedRef<FMonoTaskState>& State = Handle.promise().State;
+    return State->Suspend([&](uint32 Serial)
+        {
+            TWeakPtr<FMonoTaskState> WeakState = State;
+            State->WaitTimer = MonoManager->SetTimer(ETimerType::OneShot, Seconds, 0, [WeakState, Serial]()
+                {
+                    if (TSharedPtr<FMonoTaskState> Pinned = WeakState.Pin())
+                    {
+                        // 单次计时器触发后自行释放
+                        if (Pinned->IsWaiting(Serial))
+                        {
+                            Pinned->WaitTimer.Invalidate();
+                        }
+                        Pinned->Wake(Serial);
+                    }
+                }, nullptr, Domain);
+        });
+}
+
+bool FMonoWaitFrames::await_suspend(std::coroutine_handle<FMonoTaskPromise> Handle)
+{
+    UMonoManager* MonoManager = UMonoManager::GetMonoManager();
+    if (!MonoManager)
+    {
+        return false;
+    }
+
+    const TSharedRef<FMonoTaskState>& State = Handle.promise().State;
+    return State->Suspend([&](uint32 Serial)
+        {
+            TWeakPtr<FMonoTaskState> WeakState = State;
+            MonoManager->DelayFrames(FrameCount, [WeakState, Serial]()
+                {
+                    if (TSharedPtr<FMonoTaskState> Pinned = WeakState.Pin())
+                    {
+                        Pinned->Wake(Serial);
+                    }
+                });
+        });
+}
+
+bool FMonoWaitForResource::await_ready()
+{
+    UResourceManager* ResourceManager = UResourceManager::GetResourceManager();
+    Result = ResourceManager ? ResourceManager->GetFromCache(ResourcePath) : nullptr;
+    return Result != nullptr;
+}
+
+bool FMonoWaitForResource::await_suspend(std::coroutine_handle<FMonoTaskPromise> Handle)
+{
+    UResourceManager* ResourceManager = UResourceManager::GetResourceManager();
+    if (!ResourceManager)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("WaitForResource: ResourceManager not available, %s"), *ResourcePath);
+        return false;
+    }
+
+    const TSharedRef<FMonoTaskState>& State = Handle.promise().State;
+    return State->Suspend([&](uint32 Serial)
+        {
+            // 等待对象位于协程帧中，只有任务仍在等待本次加载时才写入结果
+            TWeakPtr<FMonoTaskState> WeakState = State;
+            ResourceManager->LoadResourceAsyncWithCallback(ResourcePath, FOnResourceLoadedStaticDelegate::CreateLambda(
+                [this, WeakState, Serial](UObject* LoadedResource)
+                {
+                    TSharedPtr<FMonoTaskState> Pinned = WeakState.Pin();
+                    if (Pinned && Pinned->IsWaiting(Serial))
+                    {
+                        Result = LoadedResource;
+                        Pinned->Wake(Serial);
+                    }
+                }));
+        });
+}
+
+bool FMonoWaitForSceneLoaded::await_ready()
+{
+    ULoadSceneManager* SceneManager = ULoadSceneManager::GetSceneManager();
+    if (!SceneManager)
+    {
+        return true;
+    }
+
+    const ESceneLoadState LoadState = SceneManager->GetAsyncRequestState(RequestId);
+    bSuccess = LoadState == ESceneLoadState::Loaded;
+    return LoadState != ESceneLoadState::Loading;
+}
+
+bool FMonoWaitForSceneLoaded::await_suspend(std::coroutine_handle<FMonoTaskPromise> Handle)
+{
+    ULoadSceneManager* SceneManager = ULoadSceneManager::GetSceneManager();
+    if (!SceneManager)
+    {
+        return false;
+    }
+
+    const TSharedRef<FMonoTaskState>& State = Handle.promise().State;
+    return State->Suspend([&](uint32 Serial)
+        {
+            TWeakPtr<FMonoTaskState> WeakState = State;
+            const FDelegateHandle DelegateHandle = SceneManager->OnSceneRequestFinishedNative.AddLambda(
+                [this, WeakState, Serial, WaitRequestId = RequestId](const FString& FinishedRequestId, bool bFinishedSuccess)
+                {
+                    if (FinishedRequestId != WaitRequestId)
+                    {
+                        return;
+                    }
+
+                    TSharedPtr<FMonoTaskState> Pinned = WeakState.Pin();
+                    if (Pinned && Pinned->IsWaiting(Serial))
+                    {
+                        bSuccess = bFinishedSuccess;
+                        Pinned->Wake(Serial);
+                    }
+                });
+
+            // 唤醒或取消时解除绑定
+            TWeakObjectPtr<ULoadSceneManager> WeakSceneManager(SceneManager);
+            State->ReleaseWaitCallback = [WeakSceneManager, DelegateHandle]()
+                {
+                    if (ULoadSceneManager* CurrentSceneManager = WeakSceneManager.Get())
+                    {
+                        CurrentSceneManager->OnSceneRequestFinishedNative.Remove(DelegateHandle);
+                    }
+                };
+        });
+}
@@ -5,11 +5,11 @@
 #include "Engine/Engine.h"
 #include "TimerManager.h"
 
-// ̬ʵ
+// 静态实例定义
 template<>
 UObjectPoolManager* TSingleton<UObjectPoolManager>::SingletonInstance = nullptr;
 
-// ========== UObjectPool ʵ ==========
+// ========== UObjectPool 实现 ==========
 
 void UObjectPool::Initialize(TSubclassOf<AActor> InActorClass, int32 InCapacity)
 {
@@ -29,30 +29,30 @@ AActor* UObjectPool::Spawn(UWorld* World, const FVector& Location, const FRotato
 
     AActor* Actor = nullptr;
 
-    // δʹблȡ
+    // 从未使用列表中获取对象
     if (UnusedActors.Num() > 0)
     {
         Actor = UnusedActors[0];
         UnusedActors.RemoveAt(0);
 
-        // λúת
+        // 设置位置和旋转
         Actor->SetActorLocationAndRotation(Location, Rotation);
 
-        // OwnerInstigator
+        // 设置Owner和Instigator
         Actor->SetOwner(Owner);
         if (APawn* PawnActor = Cast<APawn>(Actor))
         {
             PawnActor->SetInstigator(Instigator);
         }
 
-        // 
+        // 激活对象
         Actor->SetActorHiddenInGame(false);
         Actor->SetActorEnableCollision(true);
         Actor->SetActorTickEnabled(true);
     }
     else
     {
-        // ¶
+        // 创建新对象
         FActorSpawnParameters SpawnParams;
         SpawnParams.Owner = Owner;
         SpawnParams.Instigator = Instigator;
@@ -65,20 +65,20 @@ AActor* UObjectPool::Spawn(UWorld* World, const FVector& Location, const FRotato
     {
         UsedActors.Add(Actor);
 
-        // OnSpawnص - ޸ӿڵ÷ʽ
+        // 调用OnSpawn回调 - 修复接口调用方式
         if (Actor->GetClass()->ImplementsInterface(UObjectPoolInterface::StaticClass()))
         {
             IObjectPoolInterface::Execute_OnSpawn(Actor);
         }
 
-        // Եͼ¼
+        // 尝试调用蓝图事件
         UFunction* OnSpawnFunc = Actor->FindFunction(FName("OnSpawn"));
         if (OnSpawnFunc)
         {
             Actor->ProcessEvent(OnSpawnFunc, nullptr);
         }
 
-        // ԵͼʵֵĽӿڷ
+        // 尝试调用蓝图实现的接口方法
         UFunction* OnSpawnInterfaceFunc = Actor->FindFunction(FName("Execute_OnSpawn"));
         if (OnSpawnInterfaceFunc)
         {
@@ -98,7 +98,7 @@ void UObjectPool::Despawn(AActor* Actor, float DelayTime)
 
     if (DelayTime > 0.0f)
     {
-        // ʹöʱӳٻ
+        // 使用定时器延迟回收
         if (UWorld* World = Actor->GetWorld())
         {
             FTimerHandle TimerHandle;
@@ -109,7 +109,7 @@ void UObjectPool::Despawn(AActor* Actor, float DelayTime)
     }
     else
     {
-        // 
+        // 立即回收
         DespawnImmediate(Actor);
     }
 }
@@ -126,10 +126,10 @@ void UObjectPool::DespawnImmediate(AActor* Actor)
         return;
     }
 
-    // 
+    // 检查容量限制
     if (Capacity >= 0 && UnusedActors.Num() >= Capacity)
     {
-        // ϵĶ
+        // 超过容量，销毁最老的对象
         if (UnusedActors.Num() > 0)
         {
             AActor* OldActor = UnusedActors[0];
@@ -141,32 +141,32 @@ void UObjectPool::DespawnImmediate(AActor* Actor)
         }
     }
 
-    // ͣö
+    // 停用对象
     Actor->SetActorHiddenInGame(true);
     Actor->SetActorEnableCollision(false);
     Actor->SetActorTickEnabled(false);
 
-    // λõԶ볡ĵط
+    // 重置位置到远离场景的地方
     Actor->SetActorLocation(FVector(0, 0, -10000));
 
-    // ƶδʹб
+    // 移动到未使用列表
     UnusedActors.Add(Actor);
     UsedActors.Remove(Actor);
 
-    // OnDespawnص - ޸ӿڵ÷ʽ
+    // 调用OnDespawn回调 - 修复接口调用方式
     if (Actor->GetClass()->ImplementsInterface(UObjectPoolInterface::StaticClass()))
     {
         IObjectPoolInterface::Execute_OnDespawn(Actor);
     }
 
-    // Եͼ¼
+    // 尝试调用蓝图事件
     UFunction* OnDespawnFunc = Actor->FindFunction(FName("OnDespawn"));
     if (OnDespawnFunc)
     {
         Actor->ProcessEvent(OnDespawnFunc, nullptr);
     }
 
-    // ԵͼʵֵĽӿڷ
+    // 尝试调用蓝图实现的接口方法
     UFunction* OnDespawnInterfaceFunc = Actor->FindFunction(FName("Execute_OnDespawn"));
     if (OnDespawnInterfaceFunc)
     {
@@ -198,7 +198,7 @@ void UObjectPool::Preload(UWorld* World, int32 Amount)
         AActor* Actor = World->SpawnActor<AActor>(ActorClass, FVector::ZeroVector, FRotator::ZeroRotator, SpawnParams);
         if (Actor)
         {
-            // ͣòδʹб
+            // 立即停用并放入未使用列表
             Actor->SetActorHiddenInGame(true);
             Actor->SetActorEnableCollision(false);
             Actor->SetActorTickEnabled(false);
@@ -216,7 +216,7 @@ FObjectPoolInfo UObjectPool::GetPoolInfo() const
     Info.Capacity = Capacity;
     Info.UsedCount = UsedActors.Num();
     Info.UnusedCount = UnusedActors.Num();
-    Info.PreloadCount = UnusedActors.Num(); // Ԥڵǰδʹ
+    Info.PreloadCount = UnusedActors.Num(); // 预加载数量等于当前未使用数量
     Info.PoolName = ActorClass ? ActorClass->GetName() : TEXT("Invalid");
 
     return Info;
@@ -226,7 +226,7 @@ void UObjectPool::SetCapacity(int32 NewCapacity)
 {
     Capacity = NewCapacity;
 
-    // СڵǰδʹöҪٶ
+    // 如果新容量小于当前未使用对象数量，需要销毁多余对象
     if (Capacity >= 0 && UnusedActors.Num() > Capacity)
     {
         int32 ExcessCount = UnusedActors.Num() - Capacity;
@@ -247,7 +247,7 @@ void UObjectPool::SetCapacity(int32 NewCapacity)
 
 void UObjectPool::ClearPool()
 {
-    // ж
+    // 销毁所有对象
     for (AActor* Actor : UsedActors)
     {
         if (Actor)
@@ -268,7 +268,7 @@ void UObjectPool::ClearPool()
     UnusedActors.Empty();
 }
 
-// ========== UObjectPoolManager ʵ ==========
+// ========== UObjectPoolManager 实现 ==========
 
 UObjectPoolManager::UObjectPoolManager()
 {
@@ -277,7 +277,7 @@ UObjectPoolManager::UObjectPoolManager()
 
 UObjectPoolManager::~UObjectPoolManager()
 {
-    // ж
+    // 清理所有对象池
     for (auto& PoolPair : PoolsMap)
     {
         if (PoolPair.Value)
@@ -299,7 +299,7 @@ void UObjectPoolManager::InitializeObjectPoolManager()
 {
     UE_LOG(LogTemp, Log, TEXT("ObjectPool Manager Initialized"));
 
-    // ظ
+    // 创建对象池父对象
     PoolsParent = NewObject<UObject>(this);
     PoolsParent->SetFlags(RF_Standalone);
 }
@@ -329,7 +329,7 @@ AActor* UObjectPoolManager::Spawn(TSubclassOf<AActor> ActorClass, const FVector&
     AActor* Actor = Pool->Spawn(World, Location, Rotation, Owner, Instigator);
     if (Actor)
     {
-        // ¼󵽳صӳ
+        // 记录对象到池的映射
         ActorToPoolMap.Add(Actor, Pool);
     }
 
@@ -347,7 +347,7 @@ void UObjectPoolManager::Despawn(AActor* Actor, float DelayTime)
     if (Pool)
     {
         Pool->Despawn(Actor, DelayTime);
-        // ע⣺ӳƳΪܻʹ
+        // 注意：不在立即从映射中移除，因为对象可能还在使用中
     }
     else
     {
@@ -484,7 +484,7 @@ UObjectPool* UObjectPoolManager::FindOrCreatePool(TSubclassOf<AActor> ActorClass
         return *PoolPtr;
     }
 
-    // ¶
+    // 创建新对象池
     UObjectPool* NewPool = NewObject<UObjectPool>(PoolsParent);
     NewPool->Initialize(ActorClass);
     PoolsMap.Add(ActorClass, NewPool);
@@ -6,18 +6,18 @@
 #include "Misc/PackageName.h"
 #include "TimerManager.h"
 
-// ̬ʵ
+// 静态实例定义
 template<>
 UResourceManager* TSingleton<UResourceManager>::SingletonInstance = nullptr;
 
 UResourceManager::UResourceManager()
 {
-    // 캯
+    // 构造函数
 }
 
 UResourceManager::~UResourceManager()
 {
-    // 첽ؾ
+    // 清理所有异步加载句柄
     for (auto& HandlePair : AsyncHandles)
     {
         if (HandlePair.Value.IsValid())
@@ -27,13 +27,13 @@ UResourceManager::~UResourceManager()
     }
     AsyncHandles.Empty();
 
-    // ջصӳ
+    // 清空回调映射
     SingleResourceCallbacks.Empty();
     MultiResourceCallbacks.Empty();
     SingleResourceStaticCallbacks.Empty();
     MultiResourceStaticCallbacks.Empty();
 
-    // ջ棨жԴUEմ
+    // 清空缓存（但不卸载资源，由UE垃圾回收处理）
     ResourceCache.Empty();
 }
 
@@ -56,7 +56,7 @@ void UResourceManager::InitializeResourceManager()
     UE_LOG(LogTemp, Log, TEXT("Resource Manager Initialized"));
 }
 
-// ========== Դ ==========
+// ========== 基础资源操作 ==========
 
 UObject* UResourceManager::LoadResourceSync(const FString& ResourcePath)
 {
@@ -88,22 +88,22 @@ TArray<UObject*> UResourceManager::LoadResourcesInFolderSyncByClass(const FStrin
     return InternalLoadResourcesInFolderSync(FolderPath, ResourceClass);
 }
 
-// ========== 첽ԴʹID ==========
+// ========== 异步资源操作（使用请求ID） ==========
 
 FString UResourceManager::LoadResourceAsync(const FString& ResourcePath)
 {
     FString RequestId = GenerateRequestId();
     FString SanitizedPath = SanitizeResourcePath(ResourcePath);
 
-    // 黺
+    // 检查缓存
     if (UObject* CachedResource = GetFromCache(SanitizedPath))
     {
-        // 
+        // 立即完成
         SingleResourceResults.Add(RequestId, CachedResource);
         AsyncRequests.Add(RequestId, FAsyncLoadRequest(RequestId, SanitizedPath));
         AsyncRequests[RequestId].LoadState = EResourceLoadState::Loaded;
 
-        // һ֡ί
+        // 下一帧触发委托
         if (UWorld* World = GetWorld())
         {
             FTimerHandle TimerHandle;
@@ -115,7 +115,7 @@ FString UResourceManager::LoadResourceAsync(const FString& ResourcePath)
         return RequestId;
     }
 
-    // ʹlambdaRequestIdίв
+    // 使用lambda捕获RequestId，避免委托参数问题
     TSharedPtr<FStreamableHandle> Handle = StreamableManager.RequestAsyncLoad(
         FSoftObjectPath(SanitizedPath),
         FStreamableDelegate::CreateWeakLambda(this, [this, RequestId]() {
@@ -137,7 +137,7 @@ FString UResourceManager::LoadResourceAsync(const FString& ResourcePath)
 
 FString UResourceManager::LoadResourceAsyncByClass(const FString& ResourcePath, TSubclassOf<UObject> ResourceClass)
 {
-    // ΪֱӼأͼڼغ
+    // 简化为直接加载，类型检查在加载后处理
     return LoadResourceAsync(ResourcePath);
 }
 
@@ -146,17 +146,17 @@ FString UResourceManager::LoadResourcesInFolderAsync(const FString& FolderPath)
     FString RequestId = GenerateRequestId();
     FString SanitizedPath = SanitizeResourcePath(FolderPath);
 
-    // ȡļԴ·
+    // 获取文件夹下所有资源路径
     TArray<FString> ResourcePaths = GetResourcePathsInFolder(SanitizedPath);
 
     if (ResourcePaths.Num() == 0)
     {
-        // 
+        // 立即完成
         MultiResourceResults.Add(RequestId, TArray<UObject*>());
         AsyncRequests.Add(RequestId, FAsyncLoadRequest(RequestId, SanitizedPath));
         AsyncRequests[RequestId].LoadState = EResourceLoadState::Loaded;
 
-        // һ֡ί
+        // 下一帧触发委托
         if (UWorld* World = GetWorld())
         {
             FTimerHandle TimerHandle;
@@ -168,14 +168,14 @@ FString UResourceManager::LoadResourcesInFolderAsync(const FString& FolderPath)
         return RequestId;
     }
 
-    // ·
+    // 创建软对象路径数组
     TArray<FSoftObjectPath> SoftObjectPaths;
     for (const FString& Path : ResourcePaths)
     {
         SoftObjectPaths.Add(FSoftObjectPath(Path));
     }
 
-    // ʹlambdaRequestId
+    // 使用lambda捕获RequestId
     TSharedPtr<FStreamableHandle> Handle = StreamableManager.RequestAsyncLoad(
         SoftObjectPaths,
         FStreamableDelegate::CreateWeakLambda(this, [this, RequestId]() {
@@ -200,17 +200,17 @@ FString UResourceManager::LoadResourcesInFolderAsyncByClass(const FString& Folde
     FString RequestId = GenerateRequestId();
     FString SanitizedPath = SanitizeResourcePath(FolderPath);
 
-    // ȡļָ͵Դ·
+    // 获取文件夹下指定类型的所有资源路径
     TArray<FString> ResourcePaths = GetResourcePathsInFolderByClass(SanitizedPath, ResourceClass);
 
     if (ResourcePaths.Num() == 0)
     {
-        // 
+        // 立即完成
         MultiResourceResults.Add(RequestId, TArray<UObject*>());
         AsyncRequests.Add(RequestId, FAsyncLoadRequest(RequestId, SanitizedPath));
         AsyncRequests[RequestId].LoadState = EResourceLoadState::Loaded;
 
-        // һ֡ί
+        // 下一帧触发委托
         if (UWorld* World = GetWorld())
         {
             FTimerHandle TimerHandle;
@@ -222,14 +222,14 @@ FString UResourceManager::LoadResourcesInFolderAsyncByClass(const FString& Folde
         return RequestId;
     }
 
-    // ·
+    // 创建软对象路径数组
     TArray<FSoftObjectPath> SoftObjectPaths;
     for (const FString& Path : ResourcePaths)
     {
         SoftObjectPaths.Add(FSoftObjectPath(Path));
     }
 
-    // ʹlambdaRequestId
+    // 使用lambda捕获RequestId
     TSharedPtr<FStreamableHandle> Handle = StreamableManager.RequestAsyncLoad(
         SoftObjectPaths,
         FStreamableDelegate::CreateWeakLambda(this, [this, RequestId]() {
@@ -249,17 +249,17 @@ FString UResourceManager::LoadResourcesInFolderAsyncByClass(const FString& Folde
     return FString();
 }
 
-// ========== 򻯵첽ԴֱӰ󶨻ص ==========
+// ========== 简化的异步资源操作（直接绑定回调） ==========
 
 void UResourceManager::LoadResourceAsyncWithCallback(const FString& ResourcePath, const FOnResourceLoadedCallback& Callback)
 {
     FString RequestId = GenerateRequestId();
     FString SanitizedPath = SanitizeResourcePath(ResourcePath);
 
-    // 黺
+    // 检查缓存
     if (UObject* CachedResource = GetFromCache(SanitizedPath))
     {
-        // ִлص
+        // 立即执行回调
         if (Callback.IsBound())
         {
             Callback.Execute(CachedResource);
@@ -267,10 +267,10 @@ void UResourceManager::LoadResourceAsyncWithCallback(const FString& ResourcePath
         return;
     }
 
-    // 洢ص
+    // 存储回调
     SingleResourceCallbacks.Add(RequestId, Callback);
 
-    // ʹlambdaRequestId
+    // 使用lambda捕获RequestId
     TSharedPtr<FStreamableHandle> Handle = StreamableManager.RequestAsyncLoad(
         FSoftObjectPath(SanitizedPath),
         FStreamableDelegate::CreateWeakLambda(this, [this, RequestId]() {
@@ -286,7 +286,7 @@ void UResourceManager::LoadResourceAsyncWithCallback(const FString& ResourcePath
     }
     else
     {
-        // ʧܣִлصnullptr
+        // 加载失败，执行回调（传递nullptr）
         if (Callback.IsBound())
         {
             Callback.Execute(nullptr);
@@ -297,7 +297,7 @@ void UResourceManager::LoadResourceAsyncWithCallback(const FString& ResourcePath
 
 void UResourceManager::LoadResourceAsyncByClassWithCallback(const FString& ResourcePath, TSubclassOf<UObject> ResourceClass, const FOnResourceLoadedCallback& Callback)
 {
-    // ΪֱӼأͼڼغ
+    // 简化为直接加载，类型检查在加载后处理
     LoadResourceAsyncWithCallback(ResourcePath, Callback);
 }
 
@@ -320,7 +320,7 @@ void UResourceManager::LoadResourceByIDWithCallback(const FName& ResourceID, con
     }
     else
     {
-        // ִлصʾʧ
+        // 立即执行回调表示失败
         if (Callback.IsBound())
         {
             Callback.Execute(nullptr);
@@ -344,8 +344,8 @@ void UResourceManager::LoadResourcesByCategory(EResourceCategory Category, const
 
     if (ResourcePaths.Num() > 0)
     {
-        // ʹеļм߼Ҫ
-        // 򻯴ʵӦôһµڲ
+        // 使用现有的文件夹加载逻辑（需要稍作调整）
+        // 这里简化处理，实际应该创建一个新的内部方法
         FString RequestId = GenerateRequestId();
 
         TArray<FSoftObjectPath> SoftObjectPaths;
@@ -363,7 +363,7 @@ void UResourceManager::LoadResourcesByCategory(EResourceCategory Category, const
                     TArray<UObject*> LoadedResources;
                     (*HandlePtr)->GetLoadedAssets(LoadedResources);
 
-                    // ӵ
+                    // 添加到缓存
                     for (UObject* Resource : LoadedResources)
                     {
                         if (Resource)
@@ -372,13 +372,13 @@ void UResourceManager::LoadResourcesByCategory(EResourceCategory Category, const
                         }
                     }
 
-                    // ִлص
+                    // 执行回调
                     if (Callback.IsBound())
                     {
                         Callback.Execute(LoadedResources);
                     }
 
-                    // 
+                    // 清理
                     AsyncHandles.Remove(RequestId);
                 }
                 })
@@ -391,7 +391,7 @@ void UResourceManager::LoadResourcesByCategory(EResourceCategory Category, const
     }
     else
     {
-        // ִпջص
+        // 立即执行空回调
         if (Callback.IsBound())
         {
             Callback.Execute(TArray<UObject*>());
@@ -404,12 +404,12 @@ void UResourceManager::LoadResourcesInFolderAsyncWithCallback(const FString& Fol
     FString RequestId = GenerateRequestId();
     FString SanitizedPath = SanitizeResourcePath(FolderPath);
 
-    // ȡļԴ·
+    // 获取文件夹下所有资源路径
     TArray<FString> ResourcePaths = GetResourcePathsInFolder(SanitizedPath);
 
     if (ResourcePaths.Num() == 0)
     {
-        // ִлص
+        // 立即执行回调
         if (Callback.IsBound())
         {
             Callback.Execute(TArray<UObject*>());
@@ -417,17 +417,17 @@ void UResourceManager::LoadResourcesInFolderAsyncWithCallback(const FString& Fol
         return;
     }
 
-    // 洢ص
+    // 存储回调
     MultiResourceCallbacks.Add(RequestId, Callback);
 
-    // ·
+    // 创建软对象路径数组
     TArray<FSoftObjectPath> SoftObjectPaths;
     for (const FString& Path : ResourcePaths)
     {
         SoftObjectPaths.Add(FSoftObjectPath(Path));
     }
 
-    // ʹlambdaRequestId
+    // 使用lambda捕获RequestId
     TSharedPtr<FStreamableHandle> Handle = StreamableManager.RequestAsyncLoad(
         SoftObjectPaths,
         FStreamableDelegate::CreateWeakLambda(this, [this, RequestId]() {
@@ -443,7 +443,7 @@ void UResourceManager::LoadResourcesInFolderAsyncWithCallback(const FString& Fol
     }
     else
     {
-        // ʧܣִлصݿ飩
+        // 加载失败，执行回调（传递空数组）
         if (Callback.IsBound())
         {
             Callback.Execute(TArray<UObject*>());
@@ -457,12 +457,12 @@ void UResourceManager::LoadResourcesInFolderAsyncByClassWithCallback(const FStri
     FString RequestId = GenerateRequestId();
     FString SanitizedPath = SanitizeResourcePath(FolderPath);
 
-    // ȡļָ͵Դ·
+    // 获取文件夹下指定类型的所有资源路径
     TArray<FString> ResourcePaths = GetResourcePathsInFolderByClass(SanitizedPath, ResourceClass);
 
     if (ResourcePaths.Num() == 0)
     {
-        // ִлص
+        // 立即执行回调
         if (Callback.IsBound())
         {
             Callback.Execute(TArray<UObject*>());
@@ -470,17 +470,17 @@ void UResourceManager::LoadResourcesInFolderAsyncByClassWithCallback(const FStri
         return;
     }
 
-    // 洢ص
+    // 存储回调
     MultiResourceCallbacks.Add(RequestId, Callback);
 
-    // ·
+    // 创建软对象路径数组
     TArray<FSoftObjectPath> SoftObjectPaths;
     for (const FString& Path : ResourcePaths)
     {
         SoftObjectPaths.Add(FSoftObjectPath(Path));
     }
 
-    // ʹlambdaRequestId
+    // 使用lambda捕获RequestId
     TSharedPtr<FStreamableHandle> Handle = StreamableManager.RequestAsyncLoad(
         SoftObjectPaths,
         FStreamableDelegate::CreateWeakLambda(this, [this, RequestId]() {
@@ -496,7 +496,7 @@ void UResourceManager::LoadResourcesInFolderAsyncByClassWithCallback(const FStri
     }
     else
     {
-        // ʧܣִлصݿ飩
+        // 加载失败，执行回调（传递空数组）
         if (Callback.IsBound())
         {
             Callback.Execute(TArray<UObject*>());
@@ -505,25 +505,25 @@ void UResourceManager::LoadResourcesInFolderAsyncByClassWithCallback(const FStri
     }
 }
 
-// ========== ڲ̬ص ==========
+// ========== 内部静态回调方法 ==========
 
 void UResourceManager::InternalLoadResourceAsyncWithStaticCallback(const FString& ResourcePath, const FOnResourceLoadedStaticDelegate& Callback)
 {
     FString RequestId = GenerateRequestId();
     FString SanitizedPath = SanitizeResourcePath(ResourcePath);
 
-    // 黺
+    // 检查缓存
     if (UObject* CachedResource = GetFromCache(SanitizedPath))
     {
-        // ִлص
+        // 立即执行回调
         Callback.ExecuteIfBound(CachedResource);
         return;
     }
 
-    // 洢̬ص
+    // 存储静态回调
     SingleResourceStaticCallbacks.Add(RequestId, Callback);
 
-    // ʹlambdaRequestId
+    // 使用lambda捕获RequestId
     TSharedPtr<FStreamableHandle> Handle = StreamableManager.RequestAsyncLoad(
         FSoftObjectPath(SanitizedPath),
         FStreamableDelegate::CreateWeakLambda(this, [this, RequestId]() {
@@ -539,7 +539,7 @@ void UResourceManager::InternalLoadResourceAsyncWithStaticCallback(const FString
     }
     else
     {
-        // ʧܣִлصnullptr
+        // 加载失败，执行回调（传递nullptr）
         Callback.ExecuteIfBound(nullptr);
         SingleResourceStaticCallbacks.Remove(RequestId);
     }
@@ -547,7 +547,7 @@ void UResourceManager::InternalLoadResourceAsyncWithStaticCallback(const FString
 
 void UResourceManager::InternalLoadResourceAsyncByClassWithStaticCallback(const FString& ResourcePath, TSubclassOf<UObject> ResourceClass, const FOnResourceLoadedStaticDelegate& Callback)
 {
-    // ΪֱӼأͼڼغ
+    // 简化为直接加载，类型检查在加载后处理
     InternalLoadResourceAsyncWithStaticCallback(ResourcePath, Callback);
 }
 
@@ -556,27 +556,27 @@ void UResourceManager::InternalLoadResourcesInFolderAsyncWithStaticCallback(cons
     FString RequestId = GenerateRequestId();
     FString SanitizedPath = SanitizeResourcePath(FolderPath);
 
-    // ȡļԴ·
+    // 获取文件夹下所有资源路径
     TArray<FString> ResourcePaths = GetResourcePathsInFolder(SanitizedPath);
 
     if (ResourcePaths.Num() == 0)
     {
-        // ִлص
+        // 立即执行回调
         Callback.ExecuteIfBound(TArray<UObject*>());
         return;
     }
 
-    // 洢̬ص
+    // 存储静态回调
     MultiResourceStaticCallbacks.Add(RequestId, Callback);
 
-    // ·
+    // 创建软对象路径数组
     TArray<FSoftObjectPath> SoftObjectPaths;
     for (const FString& Path : ResourcePaths)
     {
         SoftObjectPaths.Add(FSoftObjectPath(Path));
     }
 
-    // ʹlambdaRequestId
+    // 使用lambda捕获RequestId
     TSharedPtr<FStreamableHandle> Handle = StreamableManager.RequestAsyncLoad(
         SoftObjectPaths,
         FStreamableDelegate::CreateWeakLambda(this, [this, RequestId]() {
@@ -592,7 +592,7 @@ void UResourceManager::InternalLoadResourcesInFolderAsyncWithStaticCallback(cons
     }
     else
     {
-        // ʧܣִлصݿ飩
+        // 加载失败，执行回调（传递空数组）
         Callback.ExecuteIfBound(TArray<UObject*>());
         MultiResourceStaticCallbacks.Remove(RequestId);
     }
@@ -603,27 +603,27 @@ void UResourceManager::InternalLoadResourcesInFolderAsyncByClassWithStaticCallba
     FString RequestId = GenerateRequestId();
     FString SanitizedPath = SanitizeResourcePath(FolderPath);
 
-    // ȡļָ͵Դ·
+    // 获取文件夹下指定类型的所有资源路径
     TArray<FString> ResourcePaths = GetResourcePathsInFolderByClass(SanitizedPath, ResourceClass);
 
     if (ResourcePaths.Num() == 0)
     {
-        // ִлص
+        // 立即执行回调
         Callback.ExecuteIfBound(TArray<UObject*>());
         return;
     }
 
-    // 洢̬ص
+    // 存储静态回调
     MultiResourceStaticCallbacks.Add(RequestId, Callback);
 
-    // ·
+    // 创建软对象路径数组
     TArray<FSoftObjectPath> SoftObjectPaths;
     for (const FString& Path : ResourcePaths)
     {
         SoftObjectPaths.Add(FSoftObjectPath(Path));
     }
 
-    // ʹlambdaRequestId
+    // 使用lambda捕获RequestId
     TSharedPtr<FStreamableHandle> Handle = StreamableManager.RequestAsyncLoad(
         SoftObjectPaths,
         FStreamableDelegate::CreateWeakLambda(this, [this, RequestId]() {
@@ -639,13 +639,13 @@ void UResourceManager::InternalLoadResourcesInFolderAsyncByClassWithStaticCallba
     }
     else
     {
-        // ʧܣִлصݿ飩
+        // 加载失败，执行回调（传递空数组）
         Callback.ExecuteIfBound(TArray<UObject*>());
         MultiResourceStaticCallbacks.Remove(RequestId);
     }
 }
 
-// ========== 첽 ==========
+// ========== 异步请求管理 ==========
 
 EResourceLoadState UResourceManager::GetAsyncRequestState(const FString& RequestId) const
 {
@@ -683,7 +683,7 @@ void UResourceManager::CancelAsyncRequest(const FString& RequestId)
     MultiResourceStaticCallbacks.Remove(RequestId);
 }
 
-// ========== Դ ==========
+// ========== 资源缓存管理 ==========
 
 void UResourceManager::PreloadMarkedResources()
 {
@@ -693,7 +693,7 @@ void UResourceManager::PreloadMarkedResources()
     TArray<FResourceTableRow*> AllRows;
     ResourceDataTable->GetAllRows<FResourceTableRow>(TEXT("ResourceManager"), AllRows);
 
-    // ȼ
+    // 按优先级排序
     AllRows.Sort([](const FResourceTableRow& A, const FResourceTableRow& B) {
         return A.LoadPriority < B.LoadPriority;
         });
@@ -749,7 +749,7 @@ int32 UResourceManager::GetCacheSize() const
     return ResourceCache.Num();
 }
 
-// ========== ԴϢѯ ==========
+// ========== 资源信息查询 ==========
 
 FResourceInfo UResourceManager::GetResourceInfo(const FString& ResourcePath)
 {
@@ -760,7 +760,7 @@ FResourceInfo UResourceManager::GetResourceInfo(const FString& ResourcePath)
     Info.LoadedResource = GetFromCache(SanitizedPath);
     Info.LoadState = Info.LoadedResource ? EResourceLoadState::Loaded : EResourceLoadState::NotLoaded;
 
-    // ȡԴ
+    // 提取资源名
     FString CleanPath = SanitizedPath;
     int32 LastSlash = 0;
     if (CleanPath.FindLastChar('/', LastSlash))
@@ -799,18 +799,18 @@ TArray<FString> UResourceManager::GetResourcePathsInFolder(const FString& Folder
     FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
     IAssetRegistry& AssetRegistry = AssetRegistryModule.Get();
 
-    // ȷʲעѾɨ
+    // 确保资产注册表已经完成扫描
     if (!AssetRegistry.IsLoadingAssets())
     {
         TArray<FAssetData> AssetDataList;
         FString SanitizedPath = SanitizeResourcePath(FolderPath);
 
-        // ݹļ
+        // 递归搜索文件夹
         AssetRegistry.GetAssetsByPath(FName(*SanitizedPath), AssetDataList, true);
 
         for (const FAssetData& AssetData : AssetDataList)
         {
-            // ʹµAPIõObjectPath
+            // 使用新的API替代已弃用的ObjectPath
             ResourcePaths.Add(AssetData.GetObjectPathString());
         }
     }
@@ -835,7 +835,7 @@ TArray<FString> UResourceManager::GetResourcePathsInFolderByClass(const FString&
         TArray<FAssetData> AssetDataList;
         FString SanitizedPath = SanitizeResourcePath(FolderPath);
 
-        //  - ʹµAPI
+        // 根据类名过滤 - 使用新的API
         FTopLevelAssetPath ClassName = ResourceClass->GetClassPathName();
         AssetRegistry.GetAssetsByClass(ClassName, AssetDataList);
 
@@ -864,16 +864,16 @@ FString UResourceManager::GetResourcePathByID(const FName& ResourceID) const
     return Path ? *Path : FString();
 }
 
-// ========== Դжع ==========
+// ========== 资源卸载管理 ==========
 
 void UResourceManager::UnloadResource(const FString& ResourcePath)
 {
     FString SanitizedPath = SanitizeResourcePath(ResourcePath);
 
-    // ӻƳ
+    // 从缓存移除
     RemoveFromCache(SanitizedPath);
 
-    // ȡ첽
+    // 取消异步加载
     for (auto& HandlePair : AsyncHandles)
     {
         if (HandlePair.Value.IsValid() && AsyncRequests[HandlePair.Key].ResourcePath == SanitizedPath)
@@ -889,7 +889,7 @@ void UResourceManager::UnloadResourcesInFolder(const FString& FolderPath)
 {
     FString SanitizedPath = SanitizeResourcePath(FolderPath);
 
-    // ȡļԴ·
+    // 获取文件夹下所有资源路径
     TArray<FString> ResourcePaths = GetResourcePathsInFolder(SanitizedPath);
 
     for (const FString& ResourcePath : ResourcePaths)
@@ -906,7 +906,7 @@ void UResourceManager::ForceGarbageCollection()
     }
 }
 
-// ========== Թ ==========
+// ========== 调试工具 ==========
 
 void UResourceManager::PrintCacheInfo()
 {
@@ -953,25 +953,25 @@ void UResourceManager::PrintAsyncRequests()
     UE_LOG(LogTemp, Log, TEXT("=== End Async Requests ==="));
 }
 
-// ========== ڲʵ ==========
+// ========== 内部实现 ==========
 
 UObject* UResourceManager::InternalLoadResourceSync(const FString& ResourcePath, TSubclassOf<UObject> ResourceClass)
 {
     FString SanitizedPath = SanitizeResourcePath(ResourcePath);
 
-    // 黺
+    // 检查缓存
     if (UObject* CachedResource = GetFromCache(SanitizedPath))
     {
         return CachedResource;
     }
 
-    // ͬԴ
+    // 同步加载资源
     FSoftObjectPath SoftObjectPath(SanitizedPath);
     UObject* LoadedResource = StreamableManager.LoadSynchronous(SoftObjectPath);
 
     if (LoadedResource)
     {
-        // ӵ
+        // 添加到缓存
         AddToCache(SanitizedPath, LoadedResource);
     }
 
@@ -983,12 +983,12 @@ TArray<UObject*> UResourceManager::InternalLoadResourcesInFolderSync(const FStri
     TArray<UObject*> LoadedResources;
     FString SanitizedPath = SanitizeResourcePath(FolderPath);
 
-    // ȡԴ·
+    // 获取资源路径
     TArray<FString> ResourcePaths = ResourceClass ?
         GetResourcePathsInFolderByClass(SanitizedPath, ResourceClass) :
         GetResourcePathsInFolder(SanitizedPath);
 
-    // ͬԴ
+    // 同步加载所有资源
     for (const FString& ResourcePath : ResourcePaths)
     {
         UObject* LoadedResource = InternalLoadResourceSync(ResourcePath, ResourceClass);
@@ -1001,7 +1001,7 @@ TArray<UObject*> UResourceManager::InternalLoadResourcesInFolderSync(const FStri
     return LoadedResources;
 }
 
-// Ļصʵ
+// 修正的回调函数实现
 void UResourceManager::HandleSingleResourceLoaded(FString RequestId)
 {
     TSharedPtr<FStreamableHandle>* HandlePtr = AsyncHandles.Find(RequestId);
@@ -1011,15 +1011,15 @@ void UResourceManager::HandleSingleResourceLoaded(FString RequestId)
 
         if (LoadedResource)
         {
-            // ӵ
+            // 添加到缓存
             FString ResourcePath = AsyncRequests[RequestId].ResourcePath;
             AddToCache(ResourcePath, LoadedResource);
 
-            // 洢
+            // 存储结果
             SingleResourceResults.Add(RequestId, LoadedResource);
             AsyncRequests[RequestId].LoadState = EResourceLoadState::Loaded;
 
-            // 㲥ί
+            // 广播委托
             OnResourceFinishLoaded.Broadcast(RequestId);
         }
         else
@@ -1027,7 +1027,7 @@ void UResourceManager::HandleSingleResourceLoaded(FString RequestId)
             AsyncRequests[RequestId].LoadState = EResourceLoadState::Failed;
         }
 
-        // 
+        // 清理句柄
         AsyncHandles.Remove(RequestId);
     }
 }
@@ -1040,7 +1040,7 @@ void UResourceManager::HandleFolderResourcesLoaded(FString RequestId)
         TArray<UObject*> LoadedResources;
         (*HandlePtr)->GetLoadedAssets(LoadedResources);
 
-        // ӵ
+        // 添加到缓存
         for (UObject* Resource : LoadedResources)
         {
             if (Resource)
@@ -1049,19 +1049,19 @@ void UResourceManager::HandleFolderResourcesLoaded(FString RequestId)
             }
         }
 
-        // 洢
+        // 存储结果
         MultiResourceResults.Add(RequestId, LoadedResources);
         AsyncRequests[RequestId].LoadState = EResourceLoadState::Loaded;
 
-        // 㲥ί
+        // 广播委托
         OnResourcesFinishLoaded.Broadcast(RequestId);
 
-        // 
+        // 清理句柄
         AsyncHandles.Remove(RequestId);
     }
 }
 
-// 򻯻ص
+// 简化回调处理
 void UResourceManager::HandleSingleResourceWithCallback(FString RequestId)
 {
     TSharedPtr<FStreamableHandle>* HandlePtr = AsyncHandles.Find(RequestId);
@@ -1071,19 +1071,19 @@ void UResourceManager::HandleSingleResourceWithCallback(FString RequestId)
 
         if (LoadedResource)
         {
-            // ӵ
+            // 添加到缓存
             FString ResourcePath = AsyncRequests[RequestId].ResourcePath;
             AddToCache(ResourcePath, LoadedResource);
         }
 
-        // ִлص
+        // 执行回调
         FOnResourceLoadedCallback* Callback = SingleResourceCallbacks.Find(RequestId);
         if (Callback && Callback->IsBound())
         {
             Callback->Execute(LoadedResource);
         }
 
-        // 
+        // 清理
         SingleResourceCallbacks.Remove(RequestId);
         AsyncHandles.Remove(RequestId);
         AsyncRequests.Remove(RequestId);
@@ -1098,7 +1098,7 @@ void UResourceManager::HandleFolderResourcesWithCallback(FString RequestId)
         TArray<UObject*> LoadedResources;
         (*HandlePtr)->GetLoadedAssets(LoadedResources);
 
-        // ӵ
+        // 添加到缓存
         for (UObject* Resource : LoadedResources)
         {
             if (Resource)
@@ -1107,21 +1107,21 @@ void UResourceManager::HandleFolderResourcesWithCallback(FString RequestId)
             }
         }
 
-        // ִлص
+        // 执行回调
         FOnResourcesLoadedCallback* Callback = MultiResourceCallbacks.Find(RequestId);
         if (Callback && Callback->IsBound())
         {
             Callback->Execute(LoadedResources);
         }
 
-        // 
+        // 清理
         MultiResourceCallbacks.Remove(RequestId);
         AsyncHandles.Remove(RequestId);
         AsyncRequests.Remove(RequestId);
     }
 }
 
-// ̬ص
+// 静态回调处理
 void UResourceManager::HandleSingleResourceWithStaticCallback(FString RequestId)
 {
     TSharedPtr<FStreamableHandle>* HandlePtr = AsyncHandles.Find(RequestId);
@@ -1131,19 +1131,19 @@ void UResourceManager::HandleSingleResourceWithStaticCallback(FString RequestId)
 
         if (LoadedResource)
         {
-            // ӵ
+            // 添加到缓存
             FString ResourcePath = AsyncRequests[RequestId].ResourcePath;
             AddToCache(ResourcePath, LoadedResource);
         }
 
-        // ִо̬ص
+        // 执行静态回调
         FOnResourceLoadedStaticDelegate* Callback = SingleResourceStaticCallbacks.Find(RequestId);
         if (Callback && Callback->IsBound())
         {
             Callback->Execute(LoadedResource);
         }
 
-        // 
+        // 清理
         SingleResourceStaticCallbacks.Remove(RequestId);
         AsyncHandles.Remove(RequestId);
         AsyncRequests.Remove(RequestId);
@@ -1158,7 +1158,7 @@ void UResourceManager::HandleFolderResourcesWithStaticCallback(FString RequestId
         TArray<UObject*> LoadedResources;
         (*HandlePtr)->GetLoadedAssets(LoadedResources);
 
-        // ӵ
+        // 添加到缓存
         for (UObject* Resource : LoadedResources)
         {
             if (Resource)
@@ -1167,14 +1167,14 @@ void UResourceManager::HandleFolderResourcesWithStaticCallback(FString RequestId
             }
         }
 
-        // ִо̬ص
+        // 执行静态回调
         FOnResourcesLoadedStaticDelegate* Callback = MultiResourceStaticCallbacks.Find(RequestId);
         if (Callback && Callback->IsBound())
         {
             Callback->Execute(LoadedResources);
         }
 
-        // 
+        // 清理
         MultiResourceStaticCallbacks.Remove(RequestId);
         AsyncHandles.Remove(RequestId);
         AsyncRequests.Remove(RequestId);
@@ -1185,11 +1185,11 @@ FString UResourceManager::SanitizeResourcePath(const FString& ResourcePath) cons
 {
     FString SanitizedPath = ResourcePath;
 
-    // Ƴǰ׺ͺ׺
+    // 移除多余的前缀和后缀
     SanitizedPath.RemoveFromStart(TEXT("/Game/"));
     SanitizedPath.RemoveFromEnd(TEXT("."));
 
-    // ȷ·ϷݸĿ¼ʼ
+    // 确保路径以游戏内容根目录开始
     if (!SanitizedPath.StartsWith(TEXT("/Game/")))
     {
         SanitizedPath = TEXT("/Game/") + SanitizedPath;
@@ -1219,7 +1219,7 @@ void UResourceManager::BuildLookupTables()
         return;
     }
 
-    // ұ
+    // 构建查找表
     TArray<FResourceTableRow*> AllRows;
     ResourceDataTable->GetAllRows<FResourceTableRow>(TEXT("ResourceManager"), AllRows);
 
@@ -1227,10 +1227,10 @@ void UResourceManager::BuildLookupTables()
     {
         if (Row && !Row->ResourceID.IsNone() && !Row->ResourcePath.IsEmpty())
         {
-            // ӵID·ӳ
+            // 添加到ID到路径的映射
             ResourceIDToPathMap.Add(Row->ResourceID, Row->ResourcePath);
 
-            // ӵӳ
+            // 添加到分类映射
             if (!CategoryToResourceIDsMap.Contains(Row->Category))
             {
                 CategoryToResourceIDsMap.Add(Row->Category, TArray<FName>());
@@ -0,0 +1,292 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "SaveManager/SaveBundle.h"
+#include "Async/MappedFileHandle.h"
+#include "HAL/PlatformFileManager.h"
+#include "Misc/Compression.h"
+#include "Misc/Crc.h"
+#include "Misc/FileHelper.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+// 存档包格式标识与版本（2：分段CRC32，文件末尾附带文件头与分段表的CRC32）
+static const uint32 SaveBundleMagic = 0x42535958; // 'XYSB'
+static const int32 SaveBundleVersion = 2;
+
+// 文件头：标识 + 版本 + 分段表偏移
+static const int32 SaveBundleHeaderSize = sizeof(uint32) + sizeof(int32) + sizeof(int64);
+
+// 分段表条目的最小序列化大小：类型 + 空名称 + 偏移/大小/原始大小 + 空格式名
+static const int32 MinSectionEntrySize = sizeof(uint8) + sizeof(int32) + 3 * sizeof(int64) + sizeof(int32);
+
+// 文件头与分段表的校验和
+static uint32 ComputeTableCrc(TArrayView<const uint8> FileView, int64 TableOffset, int64 TableEnd)
+{
+    const uint32 HeaderCrc = FCrc::MemCrc32(FileView.GetData(), SaveBundleHeaderSize);
+    return FCrc::MemCrc32(FileView.GetData() + TableOffset, (int32)(TableEnd - TableOffset), HeaderCrc);
+}
+
+// ========== 分段表条目 ==========
+
+void FSaveSectionEntry::Serialize(FArchive& Ar, int32 Version)
+{
+    uint8 TypeValue = static_cast<uint8>(Type);
+    FString FormatName = CompressionFormat.ToString();
+
+    Ar << TypeValue;
+    Ar << Name;
+    Ar << Offset;
+    Ar << Size;
+    Ar << UncompressedSize;
+    Ar << FormatName;
+    if (Version >= 2)
+    {
+        Ar << Crc;
+    }
+
+    if (Ar.IsLoading())
+    {
+        Type = static_cast<ESaveSectionType>(TypeValue);
+        CompressionFormat = FName(*FormatName);
+    }
+}
+
+// ========== 写入 ==========
+
+void FSaveBundleWriter::AddSection(ESaveSectionType Type, const FString& Name, const TArray<uint8>& Body, FName CompressionFormat)
+{
+    // 预留文件头，分段表写完后回填
+    if (Data.Num() == 0)
+    {
+        Data.AddZeroed(SaveBundleHeaderSize);
+    }
+
+    FSaveSectionEntry& Entry = Sections.AddDefaulted_GetRef();
+    Entry.Type = Type;
+    Entry.Name = Name;
+    Entry.Offset = Data.Num();
+    Entry.UncompressedSize = Body.Num();
+
+    // 直接压缩到文件缓冲区末尾，压缩失败或没有收益时按原样存储
+    bool bCompressed = false;
+    if (!CompressionFormat.IsNone() && Body.Num() > 0)
+    {
+        int32 CompressedSize = FCompression::CompressMemoryBound(CompressionFormat, Body.Num());
+        Data.AddUninitialized(CompressedSize);
+
+        if (FCompression::CompressMemory(CompressionFormat, Data.GetData() + Entry.Offset, CompressedSize, Body.GetData(), Body.Num())
+            && CompressedSize < Body.Num())
+        {
+            Data.SetNum(Entry.Offset + CompressedSize, EAllowShrinking::No);
+            Entry.CompressionFormat = CompressionFormat;
+            bCompressed = true;
+        }
+        else
+        {
+            Data.SetNum(Entry.Offset, EAllowShrinking::No);
+        }
+    }
+
+    if (!bCompressed)
+    {
+        Data.Append(Body);
+    }
+
+    Entry.Size = Data.Num() - Entry.Offset;
+    Entry.Crc = FCrc::MemCrc32(Data.GetData() + Entry.Offset, (int32)Entry.Size);
+}
+
+void FSaveBundleWriter::Finish(TArray<uint8>& OutData)
+{
+    if (Data.Num() == 0)
+    {
+        Data.AddZeroed(SaveBundleHeaderSize);
+    }
+
+    int64 TableOffset = Data.Num();
+
+    // 分段表追加在数据之后
+    FMemoryWriter TableWriter(Data, false, true);
+    int32 SectionCount = Sections.Num();
+    TableWriter << SectionCount;
+    for (FSaveSectionEntry& Entry : Sections)
+    {
+        Entry.Serialize(TableWriter, SaveBundleVersion);
+    }
+
+    // 回填文件头
+    FMemoryWriter HeaderWriter(Data);
+    uint32 Magic = SaveBundleMagic;
+    int32 Version = SaveBundleVersion;
+    HeaderWriter << Magic;
+    HeaderWriter << Version;
+    HeaderWriter << TableOffset;
+
+    // 文件头回填后再计算校验和，追加在分段表之后
+    uint32 TableCrc = ComputeTableCrc(Data, TableOffset, Data.Num());
+    TableWriter << TableCrc;
+
+    OutData = MoveTemp(Data);
+    Sections.Reset();
+}
+
+// ========== 读取 ==========
+
+FSaveBundleReader::~FSaveBundleReader()
+{
+    // 先释放映射区域再关闭句柄
+    MappedRegion.Reset();
+    MappedHandle.Reset();
+}
+
+TSharedPtr<FSaveBundleReader> FSaveBundleReader::Open(const FString& FilePath)
+{
+    TSharedPtr<FSaveBundleReader> Reader = MakeShared<FSaveBundleReader>();
+
+    IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+
+    // 分段偏移按int32切片，超过2GB的文件无法寻址
+    const int64 FileSize = PlatformFile.FileSize(*FilePath);
+    if (FileSize < 0)
+    {
+        return nullptr;
+    }
+    if (FileSize > MAX_int32)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("Save bundle too large (%lld bytes): %s"), FileSize, *FilePath);
+        return nullptr;
+    }
+
+    FOpenMappedResult MappedResult = PlatformFile.OpenMappedEx(*FilePath);
+    if (MappedResult.HasValue())
+    {
+        Reader->MappedHandle = MappedResult.StealValue();
+        Reader->MappedRegion.Reset(Reader->MappedHandle->MapRegion());
+    }
+
+    // 检查大小后文件可能被替换，映射区域同样需要在int32范围内
+    if (Reader->MappedRegion.IsValid() && Reader->MappedRegion->GetMappedSize() <= MAX_int32)
+    {
+        Reader->FileView = MakeArrayView(Reader->MappedRegion->GetMappedPtr(), (int32)Reader->MappedRegion->GetMappedSize());
+    }
+    else
+    {
+        Reader->MappedRegion.Reset();
+        Reader->MappedHandle.Reset();
+        if (!FFileHelper::LoadFileToArray(Reader->FileData, *FilePath, FILEREAD_Silent))
+        {
+            return nullptr;
+        }
+        Reader->FileView = Reader->FileData;
+    }
+
+    if (!Reader->ParseSectionTable())
+    {
+        UE_LOG(LogTemp, Warning, TEXT("Invalid save bundle: %s"), *FilePath);
+        return nullptr;
+    }
+
+    return Reader;
+}
+
+bool FSaveBundleReader::ParseSectionTable()
+{
+    if (FileView.Num() < SaveBundleHeaderSize)
+    {
+        return false;
+    }
+
+    FMemoryReaderView Reader(FileView);
+
+    uint32 Magic = 0;
+    int64 TableOffset = 0;
+    Reader << Magic;
+    Reader << Version;
+    Reader << TableOffset;
+
+    if (Magic != SaveBundleMagic || Version < 1 || Version > SaveBundleVersion || TableOffset < SaveBundleHeaderSize || TableOffset > FileView.Num())
+    {
+        return false;
+    }
+
+    // 版本2起文件头与分段表带校验和，表内数值可信后再按其分配
+    int64 TableEnd = FileView.Num();
+    if (Version >= 2)
+    {
+        TableEnd -= sizeof(uint32);
+        if (TableEnd < TableOffset)
+        {
+            return false;
+        }
+
+        uint32 TableCrc = 0;
+        Reader.Seek(TableEnd);
+        Reader << TableCrc;
+        if (Reader.IsError() || TableCrc != ComputeTableCrc(FileView, TableOffset, TableEnd))
+        {
+            UE_LOG(LogTemp, Warning, TEXT("Save bundle section table checksum mismatch"));
+            return false;
+        }
+    }
+
+    Reader.Seek(TableOffset);
+
+    int32 SectionCount = 0;
+    Reader << SectionCount;
+    if (Reader.IsError() || SectionCount < 0 || SectionCount > (TableEnd - Reader.Tell()) / MinSectionEntrySize)
+    {
+        return false;
+    }
+
+    Sections.SetNum(SectionCount);
+    for (FSaveSectionEntry& Entry : Sections)
+    {
+        Entry.Serialize(Reader, Version);
+
+        // 分段必须完整落在数据区内
+        if (Reader.IsError() || Reader.Tell() > TableEnd || Entry.Offset < SaveBundleHeaderSize || Entry.Size < 0 || Entry.Offset + Entry.Size > TableOffset
+            || Entry.UncompressedSize < 0 || Entry.UncompressedSize > MAX_int32)
+        {
+            Sections.Empty();
+            return false;
+        }
+    }
+
+    return true;
+}
+
+const FSaveSectionEntry* FSaveBundleReader::FindSection(ESaveSectionType Type, const FString& Name) const
+{
+    return Sections.FindByPredicate([Type, &Name](const FSaveSectionEntry& Entry)
+        {
+            return Entry.Type == Type && Entry.Name == Name;
+        });
+}
+
+bool FSaveBundleReader::ReadSection(const FSaveSectionEntry& Section, TArray<uint8>& Scratch, TArrayView<const uint8>& OutBody) const
+{
+    const TArrayView<const uint8> Stored = FileView.Slice((int32)Section.Offset, (int32)Section.Size);
+
+    if (Version >= 2 && FCrc::MemCrc32(Stored.GetData(), Stored.Num()) != Section.Crc)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("Save bundle section checksum mismatch: %s"), *Section.Name);
+        return false;
+    }
+
+    // 未压缩的分段直接引用映射内存，不做拷贝
+    if (Section.CompressionFormat.IsNone())
+    {
+        OutBody = Stored;
+        return true;
+    }
+
+    Scratch.SetNumUninitialized((int32)Section.UncompressedSize);
+    if (!FCompression::UncompressMemory(Section.CompressionFormat, Scratch.GetData(), Scratch.Num(), Stored.GetData(), Stored.Num()))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("Failed to decompress save bundle section: %s"), *Section.Name);
+        return false;
+    }
+
+    OutBody = Scratch;
+    return true;
+}
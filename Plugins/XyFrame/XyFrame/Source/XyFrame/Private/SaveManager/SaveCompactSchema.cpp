@@ -0,0 +1,376 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "SaveManager/SaveCompactSchema.h"
+#include "Serialization/MemoryWriter.h"
+
+// ========== 字符串表 ==========
+
+int32 FSaveStringTable::Intern(const FString& Str)
+{
+    // 从磁盘读出的表没有建立反查索引，首次追加时补建
+    if (Indices.Num() != Strings.Num())
+    {
+        Indices.Empty(Strings.Num());
+        for (int32 i = 0; i < Strings.Num(); i++)
+        {
+            Indices.Add(Strings[i], i);
+        }
+    }
+
+    if (const int32* Found = Indices.Find(Str))
+    {
+        return *Found;
+    }
+
+    const int32 Index = Strings.Add(Str);
+    Indices.Add(Str, Index);
+    return Index;
+}
+
+void FSaveStringTable::Serialize(FArchive& Ar)
+{
+    Ar << Strings;
+
+    if (Ar.IsLoading())
+    {
+        Indices.Reset();
+    }
+}
+
+// ========== 列写入 ==========
+
+template<typename ValueType>
+static void WriteKeyedColumn(FArchive& Ar, FSaveStringTable& Strings, const TMap<FString, ValueType>& Map)
+{
+    TArray<int32> Keys;
+    TArray<ValueType> Values;
+    Keys.Reserve(Map.Num());
+    Values.Reserve(Map.Num());
+
+    for (const auto& Pair : Map)
+    {
+        Keys.Add(Strings.Intern(Pair.Key));
+        Values.Add(Pair.Value);
+    }
+
+    Keys.BulkSerialize(Ar);
+    Ar << Values;
+}
+
+static void WriteBoolColumn(FArchive& Ar, FSaveStringTable& Strings, const TMap<FString, bool>& Map)
+{
+    TArray<int32> Keys;
+    TBitArray<> Values;
+    Keys.Reserve(Map.Num());
+    Values.Reserve(Map.Num());
+
+    for (const auto& Pair : Map)
+    {
+        Keys.Add(Strings.Intern(Pair.Key));
+        Values.Add(Pair.Value);
+    }
+
+    Keys.BulkSerialize(Ar);
+    Ar << Values;
+}
+
+static void WriteStringColumn(FArchive& Ar, FSaveStringTable& Strings, const TMap<FString, FString>& Map)
+{
+    // 值同样进字符串表，状态值（如"Idle"）大量重复
+    TArray<int32> Keys;
+    TArray<int32> Values;
+    Keys.Reserve(Map.Num());
+    Values.Reserve(Map.Num());
+
+    for (const auto& Pair : Map)
+    {
+        Keys.Add(Strings.Intern(Pair.Key));
+        Values.Add(Strings.Intern(Pair.Value));
+    }
+
+    Keys.BulkSerialize(Ar);
+    Values.BulkSerialize(Ar);
+}
+
+static void WriteTransformColumn(FArchive& Ar, FSaveStringTable& Strings, const TMap<FString, FTransform>& Map)
+{
+    TArray<int32> Keys;
+    TArray<FVector> Translations;
+    TArray<FQuat> Rotations;
+    TArray<FVector> Scales;
+    Keys.Reserve(Map.Num());
+    Translations.Reserve(Map.Num());
+    Rotations.Reserve(Map.Num());
+    Scales.Reserve(Map.Num());
+
+    for (const auto& Pair : Map)
+    {
+        Keys.Add(Strings.Intern(Pair.Key));
+        Translations.Add(Pair.Value.GetTranslation());
+        Rotations.Add(Pair.Value.GetRotation());
+        Scales.Add(Pair.Value.GetScale3D());
+    }
+
+    Keys.BulkSerialize(Ar);
+    Ar << Translations;
+    Ar << Rotations;
+    Ar << Scales;
+}
+
+static void WriteIndexList(FArchive& Ar, FSaveStringTable& Strings, const TArray<FString>& List)
+{
+    TArray<int32> Indices;
+    Indices.Reserve(List.Num());
+
+    for (const FString& Str : List)
+    {
+        Indices.Add(Strings.Intern(Str));
+    }
+
+    Indices.BulkSerialize(Ar);
+}
+
+// ========== 列读取 ==========
+
+static bool ReadKeys(FArchive& Ar, const FSaveStringTable& Strings, TArray<int32>& OutKeys)
+{
+    OutKeys.BulkSerialize(Ar);
+    if (Ar.IsError())
+    {
+        return false;
+    }
+
+    for (const int32 Key : OutKeys)
+    {
+        if (!Strings.IsValidIndex(Key))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+template<typename ValueType>
+static bool ReadKeyedColumn(FArchive& Ar, const FSaveStringTable& Strings, TMap<FString, ValueType>& OutMap)
+{
+    TArray<int32> Keys;
+    TArray<ValueType> Values;
+    if (!ReadKeys(Ar, Strings, Keys))
+    {
+        return false;
+    }
+
+    Ar << Values;
+    if (Ar.IsError() || Values.Num() != Keys.Num())
+    {
+        return false;
+    }
+
+    OutMap.Empty(Keys.Num());
+    for (int32 i = 0; i < Keys.Num(); i++)
+    {
+        OutMap.Add(Strings.Get(Keys[i]), MoveTemp(Values[i]));
+    }
+    return true;
+}
+
+static bool ReadBoolColumn(FArchive& Ar, const FSaveStringTable& Strings, TMap<FString, bool>& OutMap)
+{
+    TArray<int32> Keys;
+    TBitArray<> Values;
+    if (!ReadKeys(Ar, Strings, Keys))
+    {
+        return false;
+    }
+
+    Ar << Values;
+    if (Ar.IsError() || Values.Num() != Keys.Num())
+    {
+        return false;
+    }
+
+    OutMap.Empty(Keys.Num());
+    for (int32 i = 0; i < Keys.Num(); i++)
+    {
+        OutMap.Add(Strings.Get(Keys[i]), Values[i]);
+    }
+    return true;
+}
+
+static bool ReadStringColumn(FArchive& Ar, const FSaveStringTable& Strings, TMap<FString, FString>& OutMap)
+{
+    TArray<int32> Keys;
+    TArray<int32> Values;
+    if (!ReadKeys(Ar, Strings, Keys) || !ReadKeys(Ar, Strings, Values) || Values.Num() != Keys.Num())
+    {
+        return false;
+    }
+
+    OutMap.Empty(Keys.Num());
+    for (int32 i = 0; i < Keys.Num(); i++)
+    {
+        OutMap.Add(Strings.Get(Keys[i]), Strings.Get(Values[i]));
+    }
+    return true;
+}
+
+static bool ReadTransformColumn(FArchive& Ar, const FSaveStringTable& Strings, TMap<FString, FTransform>& OutMap)
+{
+    TArray<int32> Keys;
+    TArray<FVector> Translations;
+    TArray<FQuat> Rotations;
+    TArray<FVector> Scales;
+    if (!ReadKeys(Ar, Strings, Keys))
+    {
+        return false;
+    }
+
+    Ar << Translations;
+    Ar << Rotations;
+    Ar << Scales;
+    if (Ar.IsError() || Translations.Num() != Keys.Num() || Rotations.Num() != Keys.Num() || Scales.Num() != Keys.Num())
+    {
+        return false;
+    }
+
+    OutMap.Empty(Keys.Num());
+    for (int32 i = 0; i < Keys.Num(); i++)
+    {
+        OutMap.Add(Strings.Get(Keys[i]), FTransform(Rotations[i], Translations[i], Scales[i]));
+    }
+    return true;
+}
+
+static bool ReadIndexList(FArchive& Ar, const FSaveStringTable& Strings, TArray<FString>& OutList)
+{
+    TArray<int32> Indices;
+    if (!ReadKeys(Ar, Strings, Indices))
+    {
+        return false;
+    }
+
+    OutList.Empty(Indices.Num());
+    for (const int32 Index : Indices)
+    {
+        OutList.Add(Strings.Get(Index));
+    }
+    return true;
+}
+
+// 列数据先写到缓冲区，字符串表收集完整后写在列数据前面，读取时一次即可建立索引
+static void WriteTableAndColumns(FArchive& Ar, FSaveStringTable& Strings, TArray<uint8>& Columns)
+{
+    Strings.Serialize(Ar);
+    Ar << Columns;
+}
+
+// 读取列数据的长度前缀，长度超出剩余数据时直接失败
+static bool BeginColumnBlock(FArchive& Ar, int32& OutColumnBytes, int64& OutColumnStart)
+{
+    Ar << OutColumnBytes;
+    OutColumnStart = Ar.Tell();
+    return !Ar.IsError() && OutColumnBytes >= 0 && OutColumnBytes <= Ar.TotalSize() - OutColumnStart;
+}
+
+// 列解码消耗的字节数必须与长度前缀一致，否则说明数据与结构不匹配
+static bool EndColumnBlock(FArchive& Ar, int32 ColumnBytes, int64 ColumnStart)
+{
+    if (Ar.IsError() || Ar.Tell() - ColumnStart != ColumnBytes)
+    {
+        Ar.SetError();
+        return false;
+    }
+    return true;
+}
+
+// ========== 世界数据 ==========
+
+void FSaveCompactSchema::WriteWorldData(FArchive& Ar, const FWorldSaveData& WorldData)
+{
+    FSaveStringTable Strings;
+    TArray<uint8> Columns;
+    FMemoryWriter ColumnWriter(Columns);
+
+    WriteBoolColumn(ColumnWriter, Strings, WorldData.ActivatedTriggers);
+    WriteKeyedColumn(ColumnWriter, Strings, WorldData.MovedActors);
+    WriteBoolColumn(ColumnWriter, Strings, WorldData.DestroyedActors);
+    WriteTransformColumn(ColumnWriter, Strings, WorldData.ActorTransforms);
+    WriteStringColumn(ColumnWriter, Strings, WorldData.WorldStateData);
+    WriteBoolColumn(ColumnWriter, Strings, WorldData.CompletedQuests);
+    WriteKeyedColumn(ColumnWriter, Strings, WorldData.QuestProgress);
+    WriteBoolColumn(ColumnWriter, Strings, WorldData.DiscoveredLocations);
+
+    WriteTableAndColumns(Ar, Strings, Columns);
+}
+
+bool FSaveCompactSchema::ReadWorldData(FArchive& Ar, FWorldSaveData& OutWorldData)
+{
+    FSaveStringTable Strings;
+    Strings.Serialize(Ar);
+
+    // 列数据紧跟在长度前缀之后，直接从原归档读取
+    int32 ColumnBytes = 0;
+    int64 ColumnStart = 0;
+
+    return BeginColumnBlock(Ar, ColumnBytes, ColumnStart)
+        && ReadBoolColumn(Ar, Strings, OutWorldData.ActivatedTriggers)
+        && ReadKeyedColumn(Ar, Strings, OutWorldData.MovedActors)
+        && ReadBoolColumn(Ar, Strings, OutWorldData.DestroyedActors)
+        && ReadTransformColumn(Ar, Strings, OutWorldData.ActorTransforms)
+        && ReadStringColumn(Ar, Strings, OutWorldData.WorldStateData)
+        && ReadBoolColumn(Ar, Strings, OutWorldData.CompletedQuests)
+        && ReadKeyedColumn(Ar, Strings, OutWorldData.QuestProgress)
+        && ReadBoolColumn(Ar, Strings, OutWorldData.DiscoveredLocations)
+        && EndColumnBlock(Ar, ColumnBytes, ColumnStart);
+}
+
+// ========== 进度数据 ==========
+
+void FSaveCompactSchema::WriteProgressData(FArchive& Ar, const FProgressData& ProgressData)
+{
+    FSaveStringTable Strings;
+    TArray<uint8> Columns;
+    FMemoryWriter ColumnWriter(Columns);
+
+    int32 TotalPlayTimeSeconds = ProgressData.TotalPlayTimeSeconds;
+    int32 TotalDeaths = ProgressData.TotalDeaths;
+    int32 TotalKills = ProgressData.TotalKills;
+    ColumnWriter << TotalPlayTimeSeconds;
+    ColumnWriter << TotalDeaths;
+    ColumnWriter << TotalKills;
+
+    WriteIndexList(ColumnWriter, Strings, ProgressData.CompletedLevels);
+    WriteBoolColumn(ColumnWriter, Strings, ProgressData.UnlockedAchievements);
+    WriteKeyedColumn(ColumnWriter, Strings, ProgressData.LevelScores);
+    WriteKeyedColumn(ColumnWriter, Strings, ProgressData.LevelCompletionTimes);
+    WriteKeyedColumn(ColumnWriter, Strings, ProgressData.CollectiblesFound);
+    WriteKeyedColumn(ColumnWriter, Strings, ProgressData.AchievementUnlockTimes);
+
+    WriteTableAndColumns(Ar, Strings, Columns);
+}
+
+bool FSaveCompactSchema::ReadProgressData(FArchive& Ar, FProgressData& OutProgressData)
+{
+    FSaveStringTable Strings;
+    Strings.Serialize(Ar);
+
+    int32 ColumnBytes = 0;
+    int64 ColumnStart = 0;
+    if (!BeginColumnBlock(Ar, ColumnBytes, ColumnStart))
+    {
+        return false;
+    }
+
+    Ar << OutProgressData.TotalPlayTimeSeconds;
+    Ar << OutProgressData.TotalDeaths;
+    Ar << OutProgressData.TotalKills;
+
+    return !Ar.IsError()
+        && ReadIndexList(Ar, Strings, OutProgressData.CompletedLevels)
+        && ReadBoolColumn(Ar, Strings, OutProgressData.UnlockedAchievements)
+        && ReadKeyedColumn(Ar, Strings, OutProgressData.LevelScores)
+        && ReadKeyedColumn(Ar, Strings, OutProgressData.LevelCompletionTimes)
+        && ReadKeyedColumn(Ar, Strings, OutProgressData.CollectiblesFound)
+        && ReadKeyedColumn(Ar, Strings, OutProgressData.AchievementUnlockTimes)
+        && EndColumnBlock(Ar, ColumnBytes, ColumnStart);
+}
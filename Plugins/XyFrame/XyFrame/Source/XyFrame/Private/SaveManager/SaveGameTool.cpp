@@ -1,12 +1,143 @@
 // Fill out your copyright notice in the Description page of Project Settings.
 
 #include "SaveManager/SaveGameTool.h"
+#include "SaveManager/SaveCompactSchema.h"
+#include "SaveManager/SaveBundle.h"
 #include "Engine/Engine.h"
 #include "Misc/FileHelper.h"
 #include "Misc/Paths.h"
 #include "HAL/PlatformFilemanager.h"
+#include "HAL/FileManager.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+#include "Async/Async.h"
+#include "Async/ParallelFor.h"
+#include "HAL/ThreadSafeCounter.h"
+#include "Misc/ScopeLock.h"
+#include "Misc/ScopeExit.h"
+#include "Misc/Compression.h"
+#include "Misc/Crc.h"
+
+#if PLATFORM_WINDOWS
+#include "Windows/WindowsHWrapper.h"
+#elif PLATFORM_DESKTOP
+#include <stdio.h>
+#endif
+
+// 元数据索引文件版本，格式变化时递增
+static const int32 SaveMetadataIndexVersion = 2;
+
+// 存档容器格式标识与版本（4：正文CRC32校验；5：校验范围包含头部）
+static const uint32 SaveContainerMagic = 0x56535958; // 'XYSV'
+static const int32 SaveContainerVersion = 5;
+
+// 各压缩格式解压后大小与压缩数据大小之比的上限，超出视为头部损坏，不按其分配内存
+static int64 GetMaxCompressionRatio(ESaveCompressionCodec Codec)
+{
+    switch (Codec)
+    {
+    case ESaveCompressionCodec::Zlib:
+        return 1032; // deflate理论上限
+    case ESaveCompressionCodec::Oodle:
+        return 32768;
+    default:
+        return 1;
+    }
+}
+
+// 增量世界存档日志标识与版本
+static const uint32 WorldJournalMagic = 0x4A575958; // 'XYWJ'
+static const int32 WorldJournalVersion = 1;
+
+#if PLATFORM_DESKTOP
+// 用源文件原子替换目标文件，失败时目标文件保持不变
+static bool ReplaceFileAtomic(const FString& TargetPath, const FString& SourcePath)
+{
+    const FString FullTarget = FPaths::ConvertRelativePathToFull(TargetPath);
+    const FString FullSource = FPaths::ConvertRelativePathToFull(SourcePath);
+#if PLATFORM_WINDOWS
+    return ::MoveFileExW(*FullSource, *FullTarget, MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH) != 0;
+#else
+    return ::rename(TCHAR_TO_UTF8(*FullSource), TCHAR_TO_UTF8(*FullTarget)) == 0;
+#endif
+}
+#endif
+
+// 世界存档增量记录：变化的条目与被删除的键
+struct FWorldSaveDelta
+{
+    FWorldSaveData Changed;
+    TArray<FString> Removed[FWorldSaveData::FieldCount];
+
+    void Serialize(FArchive& Ar)
+    {
+        Changed.Serialize(Ar);
+        for (TArray<FString>& Keys : Removed)
+        {
+            Ar << Keys;
+        }
+    }
+};
+
+template<typename ValueType>
+static void CollectWorldDelta(const TMap<FString, ValueType>& Source, const TSet<FString>& DirtyKeys, TMap<FString, ValueType>& OutChanged, TArray<FString>& OutRemoved)
+{
+    for (const FString& Key : DirtyKeys)
+    {
+        if (const ValueType* Value = Source.Find(Key))
+        {
+            OutChanged.Add(Key, *Value);
+        }
+        else
+        {
+            OutRemoved.Add(Key);
+        }
+    }
+}
+
+template<typename ValueType>
+static void ApplyWorldDelta(TMap<FString, ValueType>& Target, const TMap<FString, ValueType>& Changed, const TArray<FString>& Removed)
+{
+    for (const FString& Key : Removed)
+    {
+        Target.Remove(Key);
+    }
+    Target.Append(Changed);
+}
+
+static void MakeWorldSaveDelta(const FWorldSaveData& WorldData, FWorldSaveDelta& OutDelta)
+{
+    CollectWorldDelta(WorldData.ActivatedTriggers, WorldData.GetDirtyKeys(EWorldSaveField::ActivatedTriggers),
+        OutDelta.Changed.ActivatedTriggers, OutDelta.Removed[(int32)EWorldSaveField::ActivatedTriggers]);
+    CollectWorldDelta(WorldData.MovedActors, WorldData.GetDirtyKeys(EWorldSaveField::MovedActors),
+        OutDelta.Changed.MovedActors, OutDelta.Removed[(int32)EWorldSaveField::MovedActors]);
+    CollectWorldDelta(WorldData.DestroyedActors, WorldData.GetDirtyKeys(EWorldSaveField::DestroyedActors),
+        OutDelta.Changed.DestroyedActors, OutDelta.Removed[(int32)EWorldSaveField::DestroyedActors]);
+    CollectWorldDelta(WorldData.ActorTransforms, WorldData.GetDirtyKeys(EWorldSaveField::ActorTransforms),
+        OutDelta.Changed.ActorTransforms, OutDelta.Removed[(int32)EWorldSaveField::ActorTransforms]);
+    CollectWorldDelta(WorldData.WorldStateData, WorldData.GetDirtyKeys(EWorldSaveField::WorldStateData),
+        OutDelta.Changed.WorldStateData, OutDelta.Removed[(int32)EWorldSaveField::WorldStateData]);
+    CollectWorldDelta(WorldData.CompletedQuests, WorldData.GetDirtyKeys(EWorldSaveField::CompletedQuests),
+        OutDelta.Changed.CompletedQuests, OutDelta.Removed[(int32)EWorldSaveField::CompletedQuests]);
+    CollectWorldDelta(WorldData.QuestProgress, WorldData.GetDirtyKeys(EWorldSaveField::QuestProgress),
+        OutDelta.Changed.QuestProgress, OutDelta.Removed[(int32)EWorldSaveField::QuestProgress]);
+    CollectWorldDelta(WorldData.DiscoveredLocations, WorldData.GetDirtyKeys(EWorldSaveField::DiscoveredLocations),
+        OutDelta.Changed.DiscoveredLocations, OutDelta.Removed[(int32)EWorldSaveField::DiscoveredLocations]);
+}
 
-// ̬ʵ
+static void ApplyWorldSaveDelta(const FWorldSaveDelta& Delta, FWorldSaveData& WorldData)
+{
+    ApplyWorldDelta(WorldData.ActivatedTriggers, Delta.Changed.ActivatedTriggers, Delta.Removed[(int32)EWorldSaveField::ActivatedTriggers]);
+    ApplyWorldDelta(WorldData.MovedActors, Delta.Changed.MovedActors, Delta.Removed[(int32)EWorldSaveField::MovedActors]);
+    ApplyWorldDelta(WorldData.DestroyedActors, Delta.Changed.DestroyedActors, Delta.Removed[(int32)EWorldSaveField::DestroyedActors]);
+    ApplyWorldDelta(WorldData.ActorTransforms, Delta.Changed.ActorTransforms, Delta.Removed[(int32)EWorldSaveField::ActorTransforms]);
+    ApplyWorldDelta(WorldData.WorldStateData, Delta.Changed.WorldStateData, Delta.Removed[(int32)EWorldSaveField::WorldStateData]);
+    ApplyWorldDelta(WorldData.CompletedQuests, Delta.Changed.CompletedQuests, Delta.Removed[(int32)EWorldSaveField::CompletedQuests]);
+    ApplyWorldDelta(WorldData.QuestProgress, Delta.Changed.QuestProgress, Delta.Removed[(int32)EWorldSaveField::QuestProgress]);
+    ApplyWorldDelta(WorldData.DiscoveredLocations, Delta.Changed.DiscoveredLocations, Delta.Removed[(int32)EWorldSaveField::DiscoveredLocations]);
+}
+
+// 静态实例定义
 template<>
 USaveGameTool* TSingleton<USaveGameTool>::SingletonInstance = nullptr;
 
@@ -17,7 +148,10 @@ USaveGameTool::USaveGameTool()
 
 USaveGameTool::~USaveGameTool()
 {
-    // Դ
+    // 等待后台保存写盘完成
+    WaitForPendingSaves();
+
+    // 清理资源
     if (CurrentSettings)
     {
         CurrentSettings = nullptr;
@@ -27,6 +161,7 @@ USaveGameTool::~USaveGameTool()
     LoadCallbacks.Empty();
     SaveStaticCallbacks.Empty();
     LoadStaticCallbacks.Empty();
+    OpenBundles.Empty();
 }
 
 void USaveGameTool::InitializeSingleton()
@@ -39,13 +174,13 @@ void USaveGameTool::InitializeSaveTool()
 {
     UE_LOG(LogTemp, Log, TEXT("Save Game Tool Initialized"));
 
-    // Ĭ
+    // 加载默认设置
     LoadSettings();
 
     UE_LOG(LogTemp, Log, TEXT("SaveGameTool ready"));
 }
 
-// ========== 浵 ==========
+// ========== 基础存档操作 ==========
 
 bool USaveGameTool::SaveGameSync(const FString& SlotName, USaveGameBase* SaveGameObject, int32 UserIndex)
 {
@@ -55,7 +190,7 @@ bool USaveGameTool::SaveGameSync(const FString& SlotName, USaveGameBase* SaveGam
         return false;
     }
 
-    // Ԫ
+    // 更新元数据
     UpdateSaveMetadata(SaveGameObject, SlotName, ESaveSlotType::ManualSave);
 
     return InternalSaveGame(SlotName, SaveGameObject, UserIndex);
@@ -80,10 +215,19 @@ bool USaveGameTool::DeleteGameSync(const FString& SlotName, int32 UserIndex)
         return false;
     }
 
-    return UGameplayStatics::DeleteGameInSlot(SlotName, UserIndex);
+    // 槽可能只有存档包，两者任一删除成功即视为成功
+    const bool bBundleDeleted = DoesGameBundleExist(SlotName) && DeleteGameBundle(SlotName);
+    bool bSuccess = UGameplayStatics::DeleteGameInSlot(SlotName, UserIndex) || bBundleDeleted;
+    if (bSuccess)
+    {
+        RemoveFromMetadataIndex(SlotName);
+        IFileManager::Get().Delete(*GetWorldJournalPath(SlotName), false, false, true);
+        IFileManager::Get().Delete(*GetSaveBackupPath(SlotName), false, false, true);
+    }
+    return bSuccess;
 }
 
-// ========== 첽浵 ==========
+// ========== 异步存档操作 ==========
 
 void USaveGameTool::SaveGameAsync(const FString& SlotName, USaveGameBase* SaveGameObject, int32 UserIndex)
 {
@@ -93,13 +237,56 @@ void USaveGameTool::SaveGameAsync(const FString& SlotName, USaveGameBase* SaveGa
         return;
     }
 
-    // Ԫ
+    // 更新元数据
     UpdateSaveMetadata(SaveGameObject, SlotName, ESaveSlotType::ManualSave);
 
-    // ʹUE첽ϵͳ
-    FAsyncSaveGameToSlotDelegate SavedDelegate;
-    SavedDelegate.BindUObject(this, &USaveGameTool::HandleAsyncSaveComplete);
-    UGameplayStatics::AsyncSaveGameToSlot(SaveGameObject, SlotName, UserIndex, SavedDelegate);
+    // 游戏线程只做数据快照
+    const double SnapshotStart = FPlatformTime::Seconds();
+    FSaveGameSnapshot Snapshot;
+    if (!MakeSaveSnapshot(SaveGameObject, SlotName, UserIndex, Snapshot))
+    {
+        // 未知的存档子类无法快照，沿用UE的异步保存
+        FAsyncSaveGameToSlotDelegate SavedDelegate;
+        SavedDelegate.BindWeakLambda(this, [this, Metadata = SaveGameObject->Metadata](const FString& SavedSlot, const int32 SavedUserIndex, bool bSuccess)
+            {
+                if (bSuccess)
+                {
+                    UpdateMetadataIndex(SavedSlot, Metadata);
+                }
+                HandleAsyncSaveComplete(SavedSlot, SavedUserIndex, bSuccess);
+            });
+        UGameplayStatics::AsyncSaveGameToSlot(SaveGameObject, SlotName, UserIndex, SavedDelegate);
+        return;
+    }
+
+    UE_LOG(LogTemp, Verbose, TEXT("Save snapshot %s took %.3f ms on game thread"),
+        *SlotName, (FPlatformTime::Seconds() - SnapshotStart) * 1000.0);
+
+    const uint64 Generation = ++SaveGenerations.FindOrAdd(SlotName);
+    TWeakObjectPtr<USaveGameTool> WeakThis(this);
+
+    PendingSaveTasks.RemoveAll([](const TFuture<void>& Task) { return Task.IsReady(); });
+
+    // 序列化与写盘在工作线程完成，结果回到游戏线程分发；任务只持有写盘状态，不访问工具对象
+    PendingSaveTasks.Add(Async(EAsyncExecution::ThreadPool, [WriteState = SaveWriteState.ToSharedRef(), WeakThis, Snapshot = MoveTemp(Snapshot), Generation]() mutable
+        {
+            TArray<uint8> SaveData;
+            EncodeSaveSnapshot(Snapshot, SaveData);
+            const ESaveWriteResult Result = WriteSaveData(*WriteState, Snapshot.SlotName, Snapshot.UserIndex, SaveData, Generation);
+
+            Async(EAsyncExecution::TaskGraphMainThread, [WeakThis, SlotName = Snapshot.SlotName, UserIndex = Snapshot.UserIndex, Metadata = Snapshot.Metadata, Result]()
+                {
+                    if (USaveGameTool* Tool = WeakThis.Get())
+                    {
+                        // 被更新快照取代的写入不能覆盖索引中较新的元数据
+                        if (Result == ESaveWriteResult::Written)
+                        {
+                            Tool->UpdateMetadataIndex(SlotName, Metadata);
+                        }
+                        Tool->HandleAsyncSaveComplete(SlotName, UserIndex, Result != ESaveWriteResult::Failed);
+                    }
+                });
+        }));
 }
 
 void USaveGameTool::LoadGameAsync(const FString& SlotName, int32 UserIndex)
@@ -110,28 +297,77 @@ void USaveGameTool::LoadGameAsync(const FString& SlotName, int32 UserIndex)
         return;
     }
 
-    // ʹUE첽ϵͳ
-    FAsyncLoadGameFromSlotDelegate LoadedDelegate;
-    LoadedDelegate.BindUObject(this, &USaveGameTool::HandleAsyncLoadComplete);
-    UGameplayStatics::AsyncLoadGameFromSlot(SlotName, UserIndex, LoadedDelegate);
+    TWeakObjectPtr<USaveGameTool> WeakThis(this);
+
+    // 读盘与解码在工作线程完成，游戏线程只创建存档对象
+    Async(EAsyncExecution::ThreadPool, [WeakThis, SlotName, UserIndex]()
+        {
+            TArray<uint8> SaveData;
+            const bool bRead = ReadSaveSlotData(SlotName, UserIndex, SaveData);
+
+            TSharedPtr<FSaveGameSnapshot> Snapshot;
+            if (bRead && IsSaveContainer(SaveData))
+            {
+                Snapshot = MakeShared<FSaveGameSnapshot>();
+                if (!DecodeSaveSnapshot(SaveData, *Snapshot))
+                {
+                    Snapshot.Reset();
+                }
+                else if (Snapshot->Kind == ESaveGameKind::World)
+                {
+                    ApplyWorldJournal(SlotName, Snapshot->Metadata.SaveDateTime.GetTicks(), Snapshot->WorldData);
+                }
+            }
+
+            Async(EAsyncExecution::TaskGraphMainThread, [WeakThis, SlotName, UserIndex, SaveData = MoveTemp(SaveData), Snapshot, bRead]()
+                {
+                    USaveGameTool* Tool = WeakThis.Get();
+                    if (!Tool)
+                    {
+                        return;
+                    }
+
+                    USaveGameBase* SaveGame = nullptr;
+                    if (Snapshot.IsValid())
+                    {
+                        SaveGame = Tool->CreateSaveGameFromSnapshot(*Snapshot);
+                    }
+                    else if (bRead && !IsSaveContainer(SaveData))
+                    {
+                        // 旧格式存档
+                        SaveGame = Cast<USaveGameBase>(UGameplayStatics::LoadGameFromMemory(SaveData));
+                    }
+
+                    Tool->HandleAsyncLoadComplete(SlotName, UserIndex, SaveGame);
+                });
+        });
 }
 
 void USaveGameTool::DeleteGameAsync(const FString& SlotName, int32 UserIndex)
 {
-    // ɾͨͬģǿںִ̨߳
+    // 删除操作通常是同步的，但我们可以在后台线程中执行
     Async(EAsyncExecution::Thread, [this, SlotName, UserIndex]()
         {
             bool bSuccess = UGameplayStatics::DeleteGameInSlot(SlotName, UserIndex);
+            if (bSuccess)
+            {
+                IFileManager::Get().Delete(*GetWorldJournalPath(SlotName), false, false, true);
+                IFileManager::Get().Delete(*GetSaveBackupPath(SlotName), false, false, true);
+            }
 
-            // صϷ̹߳㲥¼
+            // 回到游戏线程广播事件
             Async(EAsyncExecution::TaskGraphMainThread, [this, SlotName, bSuccess]()
                 {
+                    if (bSuccess)
+                    {
+                        RemoveFromMetadataIndex(SlotName);
+                    }
                     OnDeleteSaveComplete.Broadcast(SlotName, bSuccess);
                 });
         });
 }
 
-// ========== ص첽 ==========
+// ========== 带回调的异步操作 ==========
 
 void USaveGameTool::SaveGameAsyncWithCallback(const FString& SlotName, USaveGameBase* SaveGameObject, const FOnSaveGameCallback& Callback, int32 UserIndex)
 {
@@ -153,7 +389,7 @@ void USaveGameTool::LoadGameAsyncWithCallback(const FString& SlotName, const FOn
     LoadGameAsync(SlotName, UserIndex);
 }
 
-// ========== ̬ίڲʵ ==========
+// ========== 静态委托内部实现 ==========
 
 void USaveGameTool::InternalSaveGameAsyncWithStaticCallback(const FString& SlotName, USaveGameBase* SaveGameObject, const FOnSaveGameStaticDelegate& Callback, int32 UserIndex)
 {
@@ -175,15 +411,15 @@ void USaveGameTool::InternalLoadGameAsyncWithStaticCallback(const FString& SlotN
     LoadGameAsync(SlotName, UserIndex);
 }
 
-// ========== ٴ浵 ==========
+// ========== 快速存档功能 ==========
 
 void USaveGameTool::QuickSave()
 {
     FString QuickSaveSlot = TEXT("QuickSave_") + FDateTime::Now().ToString(TEXT("%Y%m%d_%H%M%S"));
 
-    // ٴ浵 - ʹµĽṹ屣淽
+    // 创建快速存档 - 使用新的结构体保存方法
     FPlayerSaveData PlayerData;
-    // һЩĬϵĿٴ浵
+    // 这里可以设置一些默认的快速存档数据
     if (SavePlayerDataStruct(PlayerData, QuickSaveSlot))
     {
         UE_LOG(LogTemp, Log, TEXT("QuickSave created: %s"), *QuickSaveSlot);
@@ -200,7 +436,7 @@ bool USaveGameTool::QuickLoad()
     FString LatestQuickSave;
     FDateTime LatestTime = FDateTime::MinValue();
 
-    // µĿٴ浵
+    // 查找最新的快速存档
     for (const FString& Slot : AllSaves)
     {
         if (Slot.StartsWith(TEXT("QuickSave_")))
@@ -232,14 +468,14 @@ void USaveGameTool::AutoSave()
 {
     FString AutoSaveSlot = TEXT("AutoSave_") + FDateTime::Now().ToString(TEXT("%Y%m%d_%H%M%S"));
 
-    // Զ浵 - ʹýṹ屣淽
+    // 创建自动存档 - 使用结构体保存方法
     FPlayerSaveData PlayerData;
-    // һЩԶ浵
+    // 这里可以设置一些自动存档数据
     if (SavePlayerDataStruct(PlayerData, AutoSaveSlot))
     {
         UE_LOG(LogTemp, Log, TEXT("AutoSave created: %s"), *AutoSaveSlot);
 
-        // ɵԶ浵5
+        // 清理旧的自动存档（保留最近5个）
         CleanupOldSaves(5);
     }
     else
@@ -248,7 +484,7 @@ void USaveGameTool::AutoSave()
     }
 }
 
-// ========== ݴͻȡ ==========
+// ========== 数据创建和获取 ==========
 
 UPlayerSaveGame* USaveGameTool::CreatePlayerSaveGame()
 {
@@ -274,7 +510,7 @@ UProgressSaveGame* USaveGameTool::CreateProgressSaveGame()
     return ProgressSave;
 }
 
-// ========== ṹݲ ==========
+// ========== 结构体数据操作 ==========
 
 UPlayerSaveGame* USaveGameTool::CreatePlayerSaveGameFromData(const FPlayerSaveData& PlayerData)
 {
@@ -324,7 +560,7 @@ FProgressData USaveGameTool::GetProgressDataFromSaveGame(UProgressSaveGame* Save
     return SaveGame ? SaveGame->GetProgressData() : FProgressData();
 }
 
-// ========== ȫļطboolʾɹ ==========
+// ========== 安全的加载方法（返回bool表示成功） ==========
 
 bool USaveGameTool::LoadPlayerDataStruct(FPlayerSaveData& OutData, const FString& SlotName)
 {
@@ -370,7 +606,7 @@ bool USaveGameTool::LoadProgressDataStruct(FProgressData& OutData, const FString
     return false;
 }
 
-// ========== ֱӽṹ屣 ==========
+// ========== 直接结构体保存 ==========
 
 bool USaveGameTool::SavePlayerDataStruct(const FPlayerSaveData& PlayerData, const FString& SlotName)
 {
@@ -412,7 +648,7 @@ bool USaveGameTool::SaveProgressDataStruct(const FProgressData& ProgressData, co
     return false;
 }
 
-// ========== ݱ淽 ==========
+// ========== 便捷保存方法 ==========
 
 bool USaveGameTool::SavePlayerData(APawn* PlayerPawn, const FString& SlotName)
 {
@@ -441,7 +677,7 @@ bool USaveGameTool::LoadPlayerData(APawn* PlayerPawn, const FString& SlotName)
     FPlayerSaveData PlayerData;
     if (LoadPlayerDataStruct(PlayerData, SlotName))
     {
-        // ӦݵPawn
+        // 应用玩家数据到Pawn
         PlayerPawn->SetActorLocation(PlayerData.Location);
         PlayerPawn->SetActorRotation(PlayerData.Rotation);
         UE_LOG(LogTemp, Log, TEXT("Player data loaded from: %s"), *SlotName);
@@ -457,21 +693,21 @@ bool USaveGameTool::CreatePlayerDataFromPawn(APawn* PlayerPawn, FPlayerSaveData&
         return false;
     }
 
-    // λúת
+    // 保存玩家位置和旋转
     OutData.Location = PlayerPawn->GetActorLocation();
     OutData.Rotation = PlayerPawn->GetActorRotation();
 
-    // ӸPawnȡݵ߼
+    // 可以在这里添加更多从Pawn获取数据的逻辑
     return true;
 }
 
-// ========== ǰݹ ==========
+// ========== 当前数据管理 ==========
 
 USettingsSaveGame* USaveGameTool::GetCurrentSettings()
 {
     if (!CurrentSettings)
     {
-        // ûеǰãԼػ򴴽Ĭ
+        // 如果没有当前设置，尝试加载或创建默认设置
         if (!LoadSettings())
         {
             CurrentSettings = CreateSettingsSaveGame();
@@ -532,7 +768,7 @@ bool USaveGameTool::LoadSettings(const FString& SlotName)
     return false;
 }
 
-// ========== 浵 ==========
+// ========== 存档管理 ==========
 
 bool USaveGameTool::DoesSaveGameExist(const FString& SlotName, int32 UserIndex)
 {
@@ -543,20 +779,28 @@ TArray<FString> USaveGameTool::GetAllSaveSlots() const
 {
     TArray<FString> SaveSlots;
 
-    // ȡ浵Ŀ¼
+    // 获取存档目录
     FString SaveGameDir = FPaths::ProjectSavedDir() / TEXT("SaveGames");
     TArray<FString> SaveFiles;
 
-    // .savļ
+    // 查找所有.sav文件
     IFileManager::Get().FindFiles(SaveFiles, *SaveGameDir, TEXT(".sav"));
 
     for (const FString& SaveFile : SaveFiles)
     {
-        // Ƴ.savչ
+        // 移除.sav扩展名
         FString SlotName = FPaths::GetBaseFilename(SaveFile);
         SaveSlots.Add(SlotName);
     }
 
+    // 只有存档包的槽
+    SaveFiles.Reset();
+    IFileManager::Get().FindFiles(SaveFiles, *SaveGameDir, TEXT(".savbundle"));
+    for (const FString& SaveFile : SaveFiles)
+    {
+        SaveSlots.AddUnique(FPaths::GetBaseFilename(SaveFile));
+    }
+
     return SaveSlots;
 }
 
@@ -564,35 +808,90 @@ FSaveGameMetadata USaveGameTool::GetSaveMetadata(const FString& SlotName, int32
 {
     FSaveGameMetadata Metadata;
 
+    const FFileStatData StatData = GetSaveSlotStat(SlotName);
+    if (GetIndexedMetadata(SlotName, StatData, Metadata))
+    {
+        return Metadata;
+    }
+
+    // 只有存档包的槽从包的元数据分段读取，不打开其余分段
+    if (!DoesSaveGameExist(SlotName, UserIndex))
+    {
+        TSharedPtr<FSaveBundleReader> Bundle = FSaveBundleReader::Open(GetBundlePath(SlotName));
+        if (DecodeBundleMetadata(Bundle.Get(), Metadata))
+        {
+            UpdateMetadataIndex(SlotName, Metadata);
+        }
+        return Metadata;
+    }
+
+    // 索引缺失或过期（如旧版本存档），回退到完整加载并补录索引
     USaveGameBase* SaveData = InternalLoadGame(SlotName, UserIndex);
     if (SaveData)
     {
         Metadata = SaveData->Metadata;
+        UpdateMetadataIndex(SlotName, Metadata);
     }
 
     return Metadata;
 }
 
+TArray<FSaveGameMetadata> USaveGameTool::GetAllSaveMetadata()
+{
+    TArray<FSaveGameMetadata> Result;
+
+    // 索引未命中的槽由批量接口并行解码
+    for (FSaveSlotBulkInfo& Info : GetAllSaveSlotInfo(false))
+    {
+        Result.Add(MoveTemp(Info.Metadata));
+    }
+
+    return Result;
+}
+
+void USaveGameTool::RebuildSaveMetadataIndex()
+{
+    MetadataIndex.Empty();
+    bMetadataIndexLoaded = true;
+
+    // 索引清空后所有槽都会走并行解码，并在结束时统一写盘
+    GetAllSaveSlotInfo(false);
+    if (MetadataIndex.Num() == 0)
+    {
+        SaveMetadataIndex(); // 没有存档时也要覆盖旧索引文件
+    }
+
+    UE_LOG(LogTemp, Log, TEXT("Save metadata index rebuilt: %d slots"), MetadataIndex.Num());
+}
+
 int64 USaveGameTool::GetSaveGameSize(const FString& SlotName, int32 UserIndex) const
 {
     FString SaveFilePath = FPaths::ProjectSavedDir() / TEXT("SaveGames") / (SlotName + TEXT(".sav"));
+    int64 Size = 0;
 
     if (FPlatformFileManager::Get().GetPlatformFile().FileExists(*SaveFilePath))
     {
-        return IFileManager::Get().FileSize(*SaveFilePath);
+        Size += IFileManager::Get().FileSize(*SaveFilePath);
     }
 
-    return 0;
+    // 同名存档包属于同一个槽
+    const int64 BundleSize = IFileManager::Get().FileSize(*GetBundlePath(SlotName));
+    return Size + FMath::Max<int64>(BundleSize, 0);
 }
 
 int64 USaveGameTool::GetTotalSaveSize() const
 {
     int64 TotalSize = 0;
-    TArray<FString> SaveSlots = GetAllSaveSlots();
 
-    for (const FString& Slot : SaveSlots)
+    // 目录遍历时直接带回文件大小，不再逐个查询
+    TMap<FString, FFileStatData> BundleStats;
+    for (const auto& StatPair : EnumerateSaveFiles(GetSaveGameDir(), &BundleStats))
     {
-        TotalSize += GetSaveGameSize(Slot);
+        TotalSize += StatPair.Value.FileSize;
+    }
+    for (const auto& StatPair : BundleStats)
+    {
+        TotalSize += StatPair.Value.FileSize;
     }
 
     return TotalSize;
@@ -600,26 +899,24 @@ int64 USaveGameTool::GetTotalSaveSize() const
 
 void USaveGameTool::CleanupOldSaves(int32 MaxSaveCount)
 {
-    TArray<FString> AllSaves = GetAllSaveSlots();
     TArray<FSaveGameMetadata> SaveMetadatas;
 
-    // ռд浵Ԫ
-    for (const FString& Slot : AllSaves)
+    // 收集所有存档的元数据
+    for (const FSaveSlotBulkInfo& Info : GetAllSaveSlotInfo(false))
     {
-        FSaveGameMetadata Metadata = GetSaveMetadata(Slot);
-        if (Metadata.SaveSlotName == Slot) // ֤ԪЧ
+        if (Info.Metadata.SaveSlotName == Info.SlotName) // 验证元数据有效
         {
-            SaveMetadatas.Add(Metadata);
+            SaveMetadatas.Add(Info.Metadata);
         }
     }
 
-    // ʱµǰ
+    // 按时间排序（最新的在前）
     SaveMetadatas.Sort([](const FSaveGameMetadata& A, const FSaveGameMetadata& B)
         {
             return A.SaveDateTime > B.SaveDateTime;
         });
 
-    // ɾƵľɴ浵
+    // 删除超过数量限制的旧存档
     for (int32 i = MaxSaveCount; i < SaveMetadatas.Num(); i++)
     {
         DeleteGameSync(SaveMetadatas[i].SaveSlotName);
@@ -627,119 +924,1641 @@ void USaveGameTool::CleanupOldSaves(int32 MaxSaveCount)
     }
 }
 
-// ========== Թ ==========
+// ========== 批量操作 ==========
 
-void USaveGameTool::PrintAllSaves()
+TArray<FSaveSlotBulkInfo> USaveGameTool::GetAllSaveSlotInfo(bool bValidate)
 {
-    TArray<FString> SaveSlots = GetAllSaveSlots();
+    const FString SaveDir = GetSaveGameDir();
+    TMap<FString, FFileStatData> BundleStats;
+    TMap<FString, FFileStatData> SaveFileStats = EnumerateSaveFiles(SaveDir, &BundleStats);
 
-    UE_LOG(LogTemp, Log, TEXT("=== All Save Games (%d) ==="), SaveSlots.Num());
+    // 只有存档包的槽以存档包文件作为槽文件，与.sav同名的存档包不单独列出
+    TSet<FString> BundleOnlySlots;
+    for (const auto& StatPair : BundleStats)
+    {
+        if (!SaveFileStats.Contains(StatPair.Key))
+        {
+            SaveFileStats.Add(StatPair.Key, StatPair.Value);
+            BundleOnlySlots.Add(StatPair.Key);
+        }
+    }
 
-    for (const FString& Slot : SaveSlots)
+    TArray<FSaveSlotBulkInfo> Infos;
+    TArray<bool> NeedsMetadata;
+    TArray<bool> NeedsFullLoad;
+    TArray<bool> MetadataDecoded;
+    TArray<bool> IsBundle;
+    Infos.Reserve(SaveFileStats.Num());
+
+    // 元数据索引只在游戏线程访问，先用它填充能命中的槽
+    for (const auto& StatPair : SaveFileStats)
     {
-        FSaveGameMetadata Metadata = GetSaveMetadata(Slot);
-        int64 Size = GetSaveGameSize(Slot);
+        FSaveSlotBulkInfo& Info = Infos.AddDefaulted_GetRef();
+        Info.SlotName = StatPair.Key;
+        Info.FileSize = StatPair.Value.FileSize;
+        Info.ModificationTime = StatPair.Value.ModificationTime;
+        NeedsMetadata.Add(!GetIndexedMetadata(StatPair.Key, StatPair.Value, Info.Metadata));
+        IsBundle.Add(BundleOnlySlots.Contains(StatPair.Key));
+    }
 
-        UE_LOG(LogTemp, Log, TEXT("  %s - %s - %s - %.2f KB"),
-            *Slot,
-            *UEnum::GetValueAsString(Metadata.SlotType),
-            *Metadata.SaveDateTime.ToString(),
-            Size / 1024.0f);
+    NeedsFullLoad.SetNumZeroed(Infos.Num());
+    MetadataDecoded.SetNumZeroed(Infos.Num());
+
+    // 读盘、校验和元数据解码并行执行，各任务只写自己的下标
+    ParallelFor(Infos.Num(), [&](int32 Index)
+        {
+            FSaveSlotBulkInfo& Info = Infos[Index];
+            if (!bValidate && !NeedsMetadata[Index])
+            {
+                return;
+            }
+
+            // 存档包只读取需要的分段，使用独立的读取器，不经过游戏线程的OpenBundles
+            if (IsBundle[Index])
+            {
+                TSharedPtr<FSaveBundleReader> Bundle = FSaveBundleReader::Open(GetBundlePath(Info.SlotName));
+                Info.bValid = Bundle.IsValid() && (!bValidate || VerifyBundle(Bundle.Get()));
+                if (NeedsMetadata[Index] && Info.bValid)
+                {
+                    MetadataDecoded[Index] = DecodeBundleMetadata(Bundle.Get(), Info.Metadata);
+                }
+                return;
+            }
+
+            TArray<uint8> SaveData;
+            if (!FFileHelper::LoadFileToArray(SaveData, *(SaveDir / (Info.SlotName + TEXT(".sav"))), FILEREAD_Silent))
+            {
+                Info.bValid = false;
+                return;
+            }
+
+            // 旧格式存档需要创建UObject，留到游戏线程处理
+            if (!IsSaveContainer(SaveData))
+            {
+                NeedsFullLoad[Index] = true;
+                return;
+            }
+
+            if (bValidate)
+            {
+                Info.bValid = VerifySaveContainer(SaveData);
+            }
+
+            if (NeedsMetadata[Index] && Info.bValid)
+            {
+                MetadataDecoded[Index] = DecodeSaveMetadata(SaveData, Info.Metadata);
+            }
+        });
+
+    // 回到游戏线程：处理旧格式存档，并把新解码的元数据一次性补录到索引
+    bool bIndexChanged = false;
+    for (int32 Index = 0; Index < Infos.Num(); Index++)
+    {
+        FSaveSlotBulkInfo& Info = Infos[Index];
+
+        if (NeedsFullLoad[Index])
+        {
+            USaveGameBase* SaveData = InternalLoadGame(Info.SlotName, 0);
+            Info.bValid = SaveData != nullptr;
+            if (SaveData && NeedsMetadata[Index])
+            {
+                Info.Metadata = SaveData->Metadata;
+                UpdateMetadataIndex(Info.SlotName, Info.Metadata, false);
+                bIndexChanged = true;
+            }
+        }
+        else if (MetadataDecoded[Index])
+        {
+            UpdateMetadataIndex(Info.SlotName, Info.Metadata, false);
+            bIndexChanged = true;
+        }
     }
 
-    UE_LOG(LogTemp, Log, TEXT("=== End Save Games ==="));
+    if (bIndexChanged)
+    {
+        SaveMetadataIndex();
+    }
+
+    return Infos;
 }
 
-bool USaveGameTool::ValidateSaveGame(const FString& SlotName, int32 UserIndex)
+int32 USaveGameTool::ExportAllSaves(const FString& TargetDir)
 {
-    USaveGameBase* SaveData = InternalLoadGame(SlotName, UserIndex);
-    if (!SaveData)
+    if (TargetDir.IsEmpty())
     {
-        return false;
+        UE_LOG(LogTemp, Warning, TEXT("Invalid export directory"));
+        return 0;
     }
 
-    // ֤
-    bool bValid = !SaveData->Metadata.SaveSlotName.IsEmpty() &&
-        SaveData->Metadata.SaveDateTime.GetTicks() > 0;
+    const FString SaveDir = GetSaveGameDir();
+    const TArray<FSaveSlotBulkInfo> Infos = GetAllSaveSlotInfo(true);
+    IFileManager::Get().MakeDirectory(*TargetDir, true);
 
-    UE_LOG(LogTemp, Log, TEXT("Save validation for %s: %s"), *SlotName, bValid ? TEXT("VALID") : TEXT("INVALID"));
+    FThreadSafeCounter ExportedCount;
+    ParallelFor(Infos.Num(), [&](int32 Index)
+        {
+            const FSaveSlotBulkInfo& Info = Infos[Index];
+            if (!Info.bValid)
+            {
+                UE_LOG(LogTemp, Warning, TEXT("Skipping damaged save on export: %s"), *Info.SlotName);
+                return;
+            }
 
-    return bValid;
-}
+            // 只有存档包的槽没有.sav
+            const FString SavePath = SaveDir / (Info.SlotName + TEXT(".sav"));
+            if (IFileManager::Get().FileExists(*SavePath)
+                && IFileManager::Get().Copy(*(TargetDir / (Info.SlotName + TEXT(".sav"))), *SavePath) != COPY_OK)
+            {
+                return;
+            }
 
-void USaveGameTool::PrintSaveStatistics()
-{
-    TArray<FString> SaveSlots = GetAllSaveSlots();
-    int64 TotalSize = GetTotalSaveSize();
+            // 同槽的存档包一起导出
+            const FString BundlePath = GetBundlePath(Info.SlotName);
+            if (IFileManager::Get().FileExists(*BundlePath)
+                && IFileManager::Get().Copy(*(TargetDir / FPaths::GetCleanFilename(BundlePath)), *BundlePath) != COPY_OK)
+            {
+                UE_LOG(LogTemp, Warning, TEXT("Failed to export save bundle: %s"), *Info.SlotName);
+                return;
+            }
 
-    UE_LOG(LogTemp, Log, TEXT("=== Save Game Statistics ==="));
-    UE_LOG(LogTemp, Log, TEXT("Total Saves: %d"), SaveSlots.Num());
-    UE_LOG(LogTemp, Log, TEXT("Total Size: %.2f MB"), TotalSize / (1024.0f * 1024.0f));
-    UE_LOG(LogTemp, Log, TEXT("=== End Statistics ==="));
-}
+            // 世界存档的增量日志一起导出
+            const FString JournalPath = GetWorldJournalPath(Info.SlotName);
+            if (IFileManager::Get().FileExists(*JournalPath))
+            {
+                IFileManager::Get().Copy(*(TargetDir / FPaths::GetCleanFilename(JournalPath)), *JournalPath);
+            }
 
-// ========== ڲʵ ==========
+            ExportedCount.Increment();
+        });
 
-FString USaveGameTool::GenerateBackupName(const FString& SlotName) const
-{
-    return SlotName + TEXT("_Backup_") + FDateTime::Now().ToString(TEXT("%Y%m%d_%H%M%S"));
+    UE_LOG(LogTemp, Log, TEXT("Exported %d/%d saves to %s"), ExportedCount.GetValue(), Infos.Num(), *TargetDir);
+    return ExportedCount.GetValue();
 }
 
-bool USaveGameTool::InternalSaveGame(const FString& SlotName, USaveGameBase* SaveGameObject, int32 UserIndex)
+int32 USaveGameTool::ImportSaves(const FString& SourceDir, bool bOverwrite)
 {
-    if (!SaveGameObject)
+    if (SourceDir.IsEmpty())
     {
-        return false;
+        UE_LOG(LogTemp, Warning, TEXT("Invalid import directory"));
+        return 0;
+    }
+
+    TMap<FString, FFileStatData> SourceBundles;
+    TArray<FString> SourceSlots;
+    const TMap<FString, FFileStatData> SourceSaves = EnumerateSaveFiles(SourceDir, &SourceBundles);
+    SourceSaves.GenerateKeyArray(SourceSlots);
+    for (const auto& BundlePair : SourceBundles)
+    {
+        SourceSlots.AddUnique(BundlePair.Key);
+    }
+
+    // 在游戏线程分配写入代数，导入的数据视为该槽最新的一次保存，之后完成的旧异步写入会被丢弃
+    TArray<FString> Slots;
+    TArray<uint64> Generations;
+    for (const FString& Slot : SourceSlots)
+    {
+        if (!bOverwrite && (IFileManager::Get().FileExists(*GetSaveSlotPath(Slot)) || DoesGameBundleExist(Slot)))
+        {
+            continue;
+        }
+        Slots.Add(Slot);
+        Generations.Add(SourceSaves.Contains(Slot) ? ++SaveGenerations.FindOrAdd(Slot) : 0);
+
+        // 覆盖前释放目标存档包的映射
+        if (SourceBundles.Contains(Slot))
+        {
+            CloseGameBundle(Slot);
+        }
     }
 
-    // ʹUEıϵͳ
-    return UGameplayStatics::SaveGameToSlot(SaveGameObject, SlotName, UserIndex);
+    FThreadSafeCounter ImportedCount;
+    ParallelFor(Slots.Num(), [&](int32 Index)
+        {
+            const FString& Slot = Slots[Index];
+
+            // 存档包先校验再原子写入，失败时不导入该槽的其余文件
+            if (SourceBundles.Contains(Slot))
+            {
+                const FString SourceBundle = SourceDir / FPaths::GetCleanFilename(GetBundlePath(Slot));
+                TSharedPtr<FSaveBundleReader> Bundle = FSaveBundleReader::Open(SourceBundle);
+                const bool bBundleValid = VerifyBundle(Bundle.Get());
+                Bundle.Reset();
+
+                TArray<uint8> BundleData;
+                if (!bBundleValid || !FFileHelper::LoadFileToArray(BundleData, *SourceBundle, FILEREAD_Silent))
+                {
+                    UE_LOG(LogTemp, Warning, TEXT("Skipping damaged save bundle on import: %s"), *Slot);
+                    return;
+                }
+                if (!WriteFileAtomic(GetBundlePath(Slot), BundleData))
+                {
+                    return;
+                }
+            }
+
+            if (!SourceSaves.Contains(Slot))
+            {
+                ImportedCount.Increment();
+                return;
+            }
+
+            TArray<uint8> SaveData;
+            if (!FFileHelper::LoadFileToArray(SaveData, *(SourceDir / (Slot + TEXT(".sav"))), FILEREAD_Silent))
+            {
+                return;
+            }
+
+            if (IsSaveContainer(SaveData) && !VerifySaveContainer(SaveData))
+            {
+                UE_LOG(LogTemp, Warning, TEXT("Skipping damaged save on import: %s"), *Slot);
+                return;
+            }
+
+            // 只持有本槽的写锁，旧备份属于被覆盖存档的历史，写入后一并删除
+            if (WriteSaveData(*SaveWriteState, Slot, 0, SaveData, Generations[Index], true) != ESaveWriteResult::Written)
+            {
+                return;
+            }
+
+            // 日志头记录的是基础存档时间戳，随基础存档一起导入才能对齐
+            const FString SourceJournal = SourceDir / FPaths::GetCleanFilename(GetWorldJournalPath(Slot));
+            if (IFileManager::Get().FileExists(*SourceJournal))
+            {
+                IFileManager::Get().Copy(*GetWorldJournalPath(Slot), *SourceJournal);
+            }
+            else
+            {
+                IFileManager::Get().Delete(*GetWorldJournalPath(Slot), false, false, true);
+            }
+
+            ImportedCount.Increment();
+        });
+
+    // 导入的文件大小和时间已变化，索引条目会在下次查询时按过期处理并重建
+    UE_LOG(LogTemp, Log, TEXT("Imported %d/%d saves from %s"), ImportedCount.GetValue(), SourceSlots.Num(), *SourceDir);
+    return ImportedCount.GetValue();
 }
 
-USaveGameBase* USaveGameTool::InternalLoadGame(const FString& SlotName, int32 UserIndex)
+TMap<FString, FFileStatData> USaveGameTool::EnumerateSaveFiles(const FString& Directory, TMap<FString, FFileStatData>* OutBundleStats)
+{
+    TMap<FString, FFileStatData> SaveFileStats;
+    IFileManager::Get().IterateDirectoryStat(*Directory, [&SaveFileStats, OutBundleStats](const TCHAR* FilenameOrDirectory, const FFileStatData& StatData)
+        {
+            const FString FilePath(FilenameOrDirectory);
+            if (StatData.bIsDirectory)
+            {
+                return true;
+            }
+
+            const FString Extension = FPaths::GetExtension(FilePath);
+            if (Extension == TEXT("sav"))
+            {
+                SaveFileStats.Add(FPaths::GetBaseFilename(FilePath), StatData);
+            }
+            else if (OutBundleStats && Extension == TEXT("savbundle"))
+            {
+                OutBundleStats->Add(FPaths::GetBaseFilename(FilePath), StatData);
+            }
+            return true;
+        });
+    return SaveFileStats;
+}
+
+// ========== 存档压缩 ==========
+
+void USaveGameTool::SetSaveCompression(ESaveCompressionCodec Codec)
 {
-    return Cast<USaveGameBase>(UGameplayStatics::LoadGameFromSlot(SlotName, UserIndex));
+    SaveCompressionCodec = Codec;
+    UE_LOG(LogTemp, Log, TEXT("Save compression set to %s"), *UEnum::GetValueAsString(Codec));
 }
 
-void USaveGameTool::UpdateSaveMetadata(USaveGameBase* SaveGame, const FString& SlotName, ESaveSlotType SlotType)
+// ========== 增量世界存档 ==========
+
+bool USaveGameTool::SaveWorldDataIncremental(FWorldSaveData& WorldData, const FString& SlotName)
 {
-    if (!SaveGame)
+    if (SlotName.IsEmpty())
     {
-        return;
+        UE_LOG(LogTemp, Warning, TEXT("Invalid slot name"));
+        return false;
     }
 
-    SaveGame->Metadata.SaveSlotName = SlotName;
-    SaveGame->Metadata.SaveDateTime = FDateTime::Now();
-    SaveGame->Metadata.SlotType = SlotType;
+    if (!WorldData.HasDirty())
+    {
+        return true;
+    }
 
-    UWorld* World = GetWorld();
-    if (World)
+    if (WorldData.IsAllDirty())
     {
-        SaveGame->Metadata.LevelName = UGameplayStatics::GetCurrentLevelName(World);
-        SaveGame->Metadata.PlayTimeSeconds = World->GetTimeSeconds();
+        return CompactWorldSave(WorldData, SlotName);
     }
 
-    // Ϸ汾
-    SaveGame->Metadata.GameVersion = TEXT("1.0.0");
-    SaveGame->Metadata.SaveVersion = 1;
-}
+    // 日志必须挂在当前磁盘上的基础存档之后，否则增量无法对齐
+    const FString SaveFilePath = GetSaveSlotPath(SlotName);
+    const int64 BaseSize = IFileManager::Get().FileSize(*SaveFilePath);
+    const int64 BaseTicks = BaseSize > 0 ? GetSaveMetadata(SlotName).SaveDateTime.GetTicks() : 0;
+    const int64 JournalSize = BaseSize > 0 ? GetWorldJournalSize(SlotName, BaseTicks) : INDEX_NONE;
+    if (JournalSize < 0)
+    {
+        return CompactWorldSave(WorldData, SlotName);
+    }
 
-void USaveGameTool::HandleAsyncSaveComplete(const FString& SlotName, const int32 UserIndex, bool bSuccess)
-{
-    UE_LOG(LogTemp, Log, TEXT("Async save completed: %s - %s"), *SlotName, bSuccess ? TEXT("Success") : TEXT("Failed"));
+    FWorldSaveDelta Delta;
+    MakeWorldSaveDelta(WorldData, Delta);
 
-    // 㲥ί
-    OnSaveGameComplete.Broadcast(SlotName, bSuccess);
+    TArray<uint8> Record;
+    FMemoryWriter RecordWriter(Record);
+    Delta.Serialize(RecordWriter);
 
-    // ִͼص
-    FOnSaveGameCallback* Callback = SaveCallbacks.Find(SlotName);
-    if (Callback && Callback->IsBound())
+    // 日志超过基础存档一定比例时压缩，保证加载时的重放开销有上限
+    if (JournalSize + Record.Num() > BaseSize * WorldJournalCompactionRatio)
     {
-        Callback->Execute(SlotName, bSuccess);
-        SaveCallbacks.Remove(SlotName);
+        return CompactWorldSave(WorldData, SlotName);
     }
 
-    // ִо̬ίлص
+    TUniquePtr<FArchive> Writer(IFileManager::Get().CreateFileWriter(*GetWorldJournalPath(SlotName), FILEWRITE_Append));
+    if (!Writer)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("Failed to open world journal for %s, writing full save"), *SlotName);
+        return CompactWorldSave(WorldData, SlotName);
+    }
+
+    // 记录格式：长度 + CRC + 增量数据，加载时截断或校验失败的尾部记录会被丢弃
+    int32 RecordSize = Record.Num();
+    uint32 RecordCrc = FCrc::MemCrc32(Record.GetData(), Record.Num());
+    *Writer << RecordSize;
+    *Writer << RecordCrc;
+    Writer->Serialize(Record.GetData(), Record.Num());
+
+    const bool bSuccess = Writer->Close() && !Writer->IsError();
+    if (!bSuccess)
+    {
+        UE_LOG(LogTemp, Error, TEXT("Failed to append world journal: %s"), *SlotName);
+        return false;
+    }
+
+    WorldData.ClearDirty();
+    UE_LOG(LogTemp, Verbose, TEXT("World delta saved: %s (%d bytes, journal %lld bytes)"),
+        *SlotName, RecordSize, JournalSize + RecordSize);
+    return true;
+}
+
+bool USaveGameTool::CompactWorldSave(FWorldSaveData& WorldData, const FString& SlotName)
+{
+    if (!SaveWorldDataStruct(WorldData, SlotName))
+    {
+        return false;
+    }
+
+    // 新的基础存档写入后重置日志，日志头记录基础存档的时间戳
+    const int64 BaseTicks = GetSaveMetadata(SlotName).SaveDateTime.GetTicks();
+    if (!ResetWorldJournal(SlotName, BaseTicks))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("Failed to reset world journal: %s"), *SlotName);
+    }
+
+    WorldData.ClearDirty();
+    UE_LOG(LogTemp, Log, TEXT("World save compacted: %s"), *SlotName);
+    return true;
+}
+
+void USaveGameTool::MarkWorldDataDirty(FWorldSaveData& WorldData, EWorldSaveField Field, const FString& Key)
+{
+    WorldData.MarkDirty(Field, Key);
+}
+
+// ========== 分段存档包 ==========
+
+bool USaveGameTool::SaveGameBundle(const FString& SlotName, const FPlayerSaveData& PlayerData, const FSettingsData& SettingsData,
+    const FProgressData& ProgressData, const TMap<FString, FWorldSaveData>& LevelWorldData)
+{
+    if (SlotName.IsEmpty())
+    {
+        UE_LOG(LogTemp, Warning, TEXT("Invalid slot name"));
+        return false;
+    }
+
+    const FName CompressionFormat = GetCompressionFormatName(SaveCompressionCodec);
+    FSaveBundleWriter Writer;
+    TArray<uint8> Body;
+
+    // 元数据放在最前面，列表界面只需要读这一段
+    FSaveGameMetadata Metadata;
+    FillSaveMetadata(Metadata, SlotName, ESaveSlotType::ManualSave);
+    {
+        FMemoryWriter BodyWriter(Body);
+        Metadata.Serialize(BodyWriter);
+        Writer.AddSection(ESaveSectionType::Metadata, FString(), Body, NAME_None);
+    }
+
+    Body.Reset();
+    {
+        FMemoryWriter BodyWriter(Body);
+        FPlayerSaveData Player = PlayerData;
+        Player.Serialize(BodyWriter);
+        Writer.AddSection(ESaveSectionType::Player, FString(), Body, CompressionFormat);
+    }
+
+    Body.Reset();
+    {
+        FMemoryWriter BodyWriter(Body);
+        FSettingsData Settings = SettingsData;
+        Settings.Serialize(BodyWriter);
+        Writer.AddSection(ESaveSectionType::Settings, FString(), Body, CompressionFormat);
+    }
+
+    Body.Reset();
+    {
+        FMemoryWriter BodyWriter(Body);
+        FSaveCompactSchema::WriteProgressData(BodyWriter, ProgressData);
+        Writer.AddSection(ESaveSectionType::Progress, FString(), Body, CompressionFormat);
+    }
+
+    // 每个关卡单独一段，流送时只解码需要的关卡
+    for (const auto& LevelPair : LevelWorldData)
+    {
+        Body.Reset();
+        FMemoryWriter BodyWriter(Body);
+        FSaveCompactSchema::WriteWorldData(BodyWriter, LevelPair.Value);
+        Writer.AddSection(ESaveSectionType::World, LevelPair.Key, Body, CompressionFormat);
+    }
+
+    TArray<uint8> BundleData;
+    Writer.Finish(BundleData);
+
+    // 覆盖前必须释放旧文件的映射
+    CloseGameBundle(SlotName);
+
+    if (!WriteFileAtomic(GetBundlePath(SlotName), BundleData))
+    {
+        UE_LOG(LogTemp, Error, TEXT("Failed to write save bundle: %s"), *SlotName);
+        return false;
+    }
+
+    // 与.sav同名时索引记录的是.sav的元数据
+    if (!DoesSaveGameExist(SlotName, 0))
+    {
+        UpdateMetadataIndex(SlotName, Metadata);
+    }
+
+    UE_LOG(LogTemp, Log, TEXT("Save bundle written: %s (%d levels)"), *SlotName, LevelWorldData.Num());
+    return true;
+}
+
+bool USaveGameTool::OpenGameBundle(const FString& SlotName)
+{
+    return FindOrOpenBundle(SlotName) != nullptr;
+}
+
+void USaveGameTool::CloseGameBundle(const FString& SlotName)
+{
+    OpenBundles.Remove(SlotName);
+}
+
+bool USaveGameTool::DeleteGameBundle(const FString& SlotName)
+{
+    CloseGameBundle(SlotName);
+    const bool bDeleted = IFileManager::Get().Delete(*GetBundlePath(SlotName), false, false, true);
+    if (bDeleted && !DoesSaveGameExist(SlotName, 0))
+    {
+        RemoveFromMetadataIndex(SlotName);
+    }
+    return bDeleted;
+}
+
+bool USaveGameTool::DoesGameBundleExist(const FString& SlotName) const
+{
+    return IFileManager::Get().FileExists(*GetBundlePath(SlotName));
+}
+
+bool USaveGameTool::LoadBundleMetadata(const FString& SlotName, FSaveGameMetadata& OutMetadata)
+{
+    return DecodeBundleMetadata(FindOrOpenBundle(SlotName), OutMetadata);
+}
+
+bool USaveGameTool::LoadBundlePlayerData(const FString& SlotName, FPlayerSaveData& OutData)
+{
+    return ReadBundleSection(FindOrOpenBundle(SlotName), ESaveSectionType::Player, FString(), [&OutData](FArchive& Reader)
+        {
+            OutData.Serialize(Reader);
+            return !Reader.IsError();
+        });
+}
+
+bool USaveGameTool::LoadBundleSettingsData(const FString& SlotName, FSettingsData& OutData)
+{
+    return ReadBundleSection(FindOrOpenBundle(SlotName), ESaveSectionType::Settings, FString(), [&OutData](FArchive& Reader)
+        {
+            OutData.Serialize(Reader);
+            return !Reader.IsError();
+        });
+}
+
+bool USaveGameTool::LoadBundleProgressData(const FString& SlotName, FProgressData& OutData)
+{
+    return ReadBundleSection(FindOrOpenBundle(SlotName), ESaveSectionType::Progress, FString(), [&OutData](FArchive& Reader)
+        {
+            return FSaveCompactSchema::ReadProgressData(Reader, OutData);
+        });
+}
+
+bool USaveGameTool::LoadBundleLevelWorldData(const FString& SlotName, const FString& LevelName, FWorldSaveData& OutData)
+{
+    if (!ReadBundleSection(FindOrOpenBundle(SlotName), ESaveSectionType::World, LevelName, [&OutData](FArchive& Reader)
+        {
+            return FSaveCompactSchema::ReadWorldData(Reader, OutData);
+        }))
+    {
+        return false;
+    }
+
+    OutData.ClearDirty();
+    return true;
+}
+
+TArray<FString> USaveGameTool::GetBundleLevelNames(const FString& SlotName)
+{
+    TArray<FString> LevelNames;
+
+    if (FSaveBundleReader* Bundle = FindOrOpenBundle(SlotName))
+    {
+        for (const FSaveSectionEntry& Section : Bundle->GetSections())
+        {
+            if (Section.Type == ESaveSectionType::World)
+            {
+                LevelNames.Add(Section.Name);
+            }
+        }
+    }
+
+    return LevelNames;
+}
+
+FString USaveGameTool::GetBundlePath(const FString& SlotName)
+{
+    // 不使用.sav扩展名，与同名的普通存档并存，只有存档包的槽单独枚举
+    return GetSaveGameDir() / (SlotName + TEXT(".savbundle"));
+}
+
+FSaveBundleReader* USaveGameTool::FindOrOpenBundle(const FString& SlotName)
+{
+    if (const TSharedPtr<FSaveBundleReader>* Found = OpenBundles.Find(SlotName))
+    {
+        return Found->Get();
+    }
+
+    TSharedPtr<FSaveBundleReader> Bundle = FSaveBundleReader::Open(GetBundlePath(SlotName));
+    if (!Bundle.IsValid())
+    {
+        return nullptr;
+    }
+
+    UE_LOG(LogTemp, Verbose, TEXT("Save bundle opened: %s (%d sections, %s)"),
+        *SlotName, Bundle->GetSections().Num(), Bundle->IsMemoryMapped() ? TEXT("mapped") : TEXT("buffered"));
+
+    OpenBundles.Add(SlotName, Bundle);
+    return Bundle.Get();
+}
+
+bool USaveGameTool::ReadBundleSection(const FSaveBundleReader* Bundle, ESaveSectionType Type, const FString& Name, TFunctionRef<bool(FArchive&)> Decode)
+{
+    const FSaveSectionEntry* Section = Bundle ? Bundle->FindSection(Type, Name) : nullptr;
+
+    TArray<uint8> Scratch;
+    TArrayView<const uint8> Body;
+    if (!Section || !Bundle->ReadSection(*Section, Scratch, Body))
+    {
+        return false;
+    }
+
+    FMemoryReaderView Reader(Body);
+    return Decode(Reader);
+}
+
+bool USaveGameTool::DecodeBundleMetadata(const FSaveBundleReader* Bundle, FSaveGameMetadata& OutMetadata)
+{
+    return ReadBundleSection(Bundle, ESaveSectionType::Metadata, FString(), [&OutMetadata](FArchive& Reader)
+        {
+            OutMetadata.Serialize(Reader);
+            return !Reader.IsError();
+        });
+}
+
+bool USaveGameTool::VerifyBundle(const FSaveBundleReader* Bundle)
+{
+    if (!Bundle)
+    {
+        return false;
+    }
+
+    // 读取分段时校验CRC（版本2起），压缩分段同时解压确认大小
+    TArray<uint8> Scratch;
+    TArrayView<const uint8> Body;
+    for (const FSaveSectionEntry& Section : Bundle->GetSections())
+    {
+        if (!Bundle->ReadSection(Section, Scratch, Body) || Body.Num() != Section.UncompressedSize)
+        {
+            return false;
+        }
+    }
+
+    return Bundle->FindSection(ESaveSectionType::Metadata) != nullptr;
+}
+
+// ========== 调试工具 ==========
+
+void USaveGameTool::PrintAllSaves()
+{
+    TArray<FString> SaveSlots = GetAllSaveSlots();
+
+    UE_LOG(LogTemp, Log, TEXT("=== All Save Games (%d) ==="), SaveSlots.Num());
+
+    for (const FString& Slot : SaveSlots)
+    {
+        FSaveGameMetadata Metadata = GetSaveMetadata(Slot);
+        int64 Size = GetSaveGameSize(Slot);
+
+        UE_LOG(LogTemp, Log, TEXT("  %s - %s - %s - %.2f KB (%s, ratio %.2f)"),
+            *Slot,
+            *UEnum::GetValueAsString(Metadata.SlotType),
+            *Metadata.SaveDateTime.ToString(),
+            Size / 1024.0f,
+            *UEnum::GetValueAsString(Metadata.CompressionCodec),
+            Metadata.CompressionRatio);
+    }
+
+    UE_LOG(LogTemp, Log, TEXT("=== End Save Games ==="));
+}
+
+bool USaveGameTool::ValidateSaveGame(const FString& SlotName, int32 UserIndex)
+{
+    // 同名存档包也属于该槽，只有存档包时以存档包的结果为准
+    if (DoesGameBundleExist(SlotName))
+    {
+        TSharedPtr<FSaveBundleReader> Bundle = FSaveBundleReader::Open(GetBundlePath(SlotName));
+        const bool bBundleValid = VerifyBundle(Bundle.Get());
+        if (!bBundleValid || !DoesSaveGameExist(SlotName, UserIndex))
+        {
+            UE_LOG(LogTemp, Log, TEXT("Save validation for %s (bundle): %s"), *SlotName, bBundleValid ? TEXT("VALID") : TEXT("INVALID"));
+            return bBundleValid;
+        }
+    }
+
+    // 容器格式只检查文件头和正文校验和，不做反序列化
+    TArray<uint8> RawData;
+    if (UGameplayStatics::LoadDataFromSlot(RawData, SlotName, UserIndex) && IsSaveContainer(RawData))
+    {
+        const bool bValid = VerifySaveContainer(RawData);
+        UE_LOG(LogTemp, Log, TEXT("Save validation for %s: %s"), *SlotName, bValid ? TEXT("VALID") : TEXT("INVALID"));
+        return bValid;
+    }
+
+    // 旧格式存档没有校验和，仍需完整加载
+    USaveGameBase* SaveData = InternalLoadGame(SlotName, UserIndex);
+    if (!SaveData)
+    {
+        return false;
+    }
+
+    // 基本验证
+    bool bValid = !SaveData->Metadata.SaveSlotName.IsEmpty() &&
+        SaveData->Metadata.SaveDateTime.GetTicks() > 0;
+
+    UE_LOG(LogTemp, Log, TEXT("Save validation for %s: %s"), *SlotName, bValid ? TEXT("VALID") : TEXT("INVALID"));
+
+    return bValid;
+}
+
+void USaveGameTool::PrintSaveStatistics()
+{
+    TArray<FString> SaveSlots = GetAllSaveSlots();
+    int64 TotalSize = GetTotalSaveSize();
+
+    UE_LOG(LogTemp, Log, TEXT("=== Save Game Statistics ==="));
+    UE_LOG(LogTemp, Log, TEXT("Total Saves: %d"), SaveSlots.Num());
+    UE_LOG(LogTemp, Log, TEXT("Total Size: %.2f MB"), TotalSize / (1024.0f * 1024.0f));
+    UE_LOG(LogTemp, Log, TEXT("=== End Statistics ==="));
+}
+
+void USaveGameTool::BenchmarkSaveMetadataListing(int32 SlotCount, int32 ActorsPerSlot)
+{
+    SlotCount = FMath::Max(SlotCount, 1);
+    ActorsPerSlot = FMath::Max(ActorsPerSlot, 0);
+
+    // 构造大体量的世界存档
+    FWorldSaveData WorldData;
+    for (int32 i = 0; i < ActorsPerSlot; i++)
+    {
+        const FString ActorID = FString::Printf(TEXT("BenchActor_%d"), i);
+        WorldData.ActorTransforms.Add(ActorID, FTransform(FVector(i, i * 2.0f, 0.0f)));
+        WorldData.DestroyedActors.Add(ActorID, (i % 7) == 0);
+        WorldData.WorldStateData.Add(ActorID, TEXT("Idle"));
+    }
+
+    TArray<FString> BenchSlots;
+    int64 TotalSaveBytes = 0;
+    for (int32 i = 0; i < SlotCount; i++)
+    {
+        const FString Slot = FString::Printf(TEXT("MetaBench_%03d"), i);
+        if (SaveWorldDataStruct(WorldData, Slot))
+        {
+            BenchSlots.Add(Slot);
+            TotalSaveBytes += GetSaveGameSize(Slot);
+        }
+    }
+
+    // 旧方式：完整反序列化每个存档
+    double StartTime = FPlatformTime::Seconds();
+    int32 FullLoaded = 0;
+    for (const FString& Slot : BenchSlots)
+    {
+        if (InternalLoadGame(Slot, 0))
+        {
+            FullLoaded++;
+        }
+    }
+    const double FullLoadMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+
+    // 新方式：丢弃内存缓存后从磁盘读取索引
+    MetadataIndex.Empty();
+    bMetadataIndexLoaded = false;
+
+    StartTime = FPlatformTime::Seconds();
+    int32 IndexedLoaded = 0;
+    for (const FString& Slot : BenchSlots)
+    {
+        if (GetSaveMetadata(Slot).SaveSlotName == Slot)
+        {
+            IndexedLoaded++;
+        }
+    }
+    const double IndexedMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+    const int64 IndexBytes = IFileManager::Get().FileSize(*GetMetadataIndexPath());
+
+    UE_LOG(LogTemp, Log, TEXT("=== Save Metadata Listing Benchmark ==="));
+    UE_LOG(LogTemp, Log, TEXT("Slots: %d, Actors Per Slot: %d"), BenchSlots.Num(), ActorsPerSlot);
+    UE_LOG(LogTemp, Log, TEXT("Full Load:  %.2f ms, %d slots, %.2f MB read"),
+        FullLoadMs, FullLoaded, TotalSaveBytes / (1024.0f * 1024.0f));
+    UE_LOG(LogTemp, Log, TEXT("Index Read: %.2f ms, %d slots, %.2f KB read"),
+        IndexedMs, IndexedLoaded, IndexBytes / 1024.0f);
+    UE_LOG(LogTemp, Log, TEXT("=== End Benchmark ==="));
+
+    for (const FString& Slot : BenchSlots)
+    {
+        DeleteGameSync(Slot);
+    }
+}
+
+void USaveGameTool::BenchmarkSaveCompression()
+{
+    const int32 ActorCounts[] = { 1000, 10000, 100000 };
+    const ESaveCompressionCodec Codecs[] = { ESaveCompressionCodec::None, ESaveCompressionCodec::Zlib, ESaveCompressionCodec::Oodle };
+    const FString BenchSlot = TEXT("CompressionBench");
+    const ESaveCompressionCodec PreviousCodec = SaveCompressionCodec;
+
+    UE_LOG(LogTemp, Log, TEXT("=== Save Compression Benchmark ==="));
+
+    for (const int32 ActorCount : ActorCounts)
+    {
+        // 构造合成世界存档
+        FWorldSaveData WorldData;
+        for (int32 i = 0; i < ActorCount; i++)
+        {
+            const FString ActorID = FString::Printf(TEXT("BenchActor_%d"), i);
+            WorldData.ActorTransforms.Add(ActorID, FTransform(FRotator(0.0f, i % 360, 0.0f), FVector(i * 100.0f, (i % 50) * 100.0f, 0.0f)));
+            WorldData.DestroyedActors.Add(ActorID, (i % 7) == 0);
+            WorldData.WorldStateData.Add(ActorID, (i % 3) == 0 ? TEXT("Opened") : TEXT("Idle"));
+        }
+
+        UE_LOG(LogTemp, Log, TEXT("Actors: %d"), ActorCount);
+
+        for (const ESaveCompressionCodec Codec : Codecs)
+        {
+            SaveCompressionCodec = Codec;
+
+            double StartTime = FPlatformTime::Seconds();
+            const bool bSaved = SaveWorldDataStruct(WorldData, BenchSlot);
+            const double SaveMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+
+            StartTime = FPlatformTime::Seconds();
+            const bool bLoaded = InternalLoadGame(BenchSlot, 0) != nullptr;
+            const double LoadMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+
+            const FSaveGameMetadata Metadata = GetSaveMetadata(BenchSlot);
+            UE_LOG(LogTemp, Log, TEXT("  %-6s Save: %8.2f ms  Load: %8.2f ms  Size: %9.2f KB  Ratio: %.3f%s"),
+                *StaticEnum<ESaveCompressionCodec>()->GetNameStringByValue((int64)Codec),
+                SaveMs, LoadMs, GetSaveGameSize(BenchSlot) / 1024.0f, Metadata.CompressionRatio,
+                (bSaved && bLoaded) ? TEXT("") : TEXT("  [FAILED]"));
+        }
+    }
+
+    UE_LOG(LogTemp, Log, TEXT("=== End Benchmark ==="));
+
+    SaveCompressionCodec = PreviousCodec;
+    DeleteGameSync(BenchSlot);
+}
+
+void USaveGameTool::BenchmarkWorldSaveSchema(int32 ActorCount, int32 Iterations)
+{
+    ActorCount = FMath::Max(ActorCount, 1);
+    Iterations = FMath::Max(Iterations, 1);
+
+    // 构造合成世界存档
+    FWorldSaveData WorldData;
+    for (int32 i = 0; i < ActorCount; i++)
+    {
+        const FString ActorID = FString::Printf(TEXT("BenchActor_%d"), i);
+        WorldData.ActorTransforms.Add(ActorID, FTransform(FRotator(0.0f, i % 360, 0.0f), FVector(i * 100.0f, (i % 50) * 100.0f, 0.0f)));
+        WorldData.DestroyedActors.Add(ActorID, (i % 7) == 0);
+        WorldData.WorldStateData.Add(ActorID, (i % 3) == 0 ? TEXT("Opened") : TEXT("Idle"));
+        if ((i % 10) == 0)
+        {
+            WorldData.ActivatedTriggers.Add(FString::Printf(TEXT("Trigger_%d"), i), true);
+            WorldData.QuestProgress.Add(FString::Printf(TEXT("Quest_%d"), i / 10), i % 5);
+        }
+    }
+
+    // 旧格式：按字符串键的Map逐项序列化
+    TArray<uint8> LegacyData;
+    double StartTime = FPlatformTime::Seconds();
+    for (int32 i = 0; i < Iterations; i++)
+    {
+        LegacyData.Reset();
+        FMemoryWriter Writer(LegacyData);
+        WorldData.Serialize(Writer);
+    }
+    const double LegacyWriteMs = (FPlatformTime::Seconds() - StartTime) * 1000.0 / Iterations;
+
+    StartTime = FPlatformTime::Seconds();
+    for (int32 i = 0; i < Iterations; i++)
+    {
+        FWorldSaveData Loaded;
+        FMemoryReader Reader(LegacyData);
+        Loaded.Serialize(Reader);
+    }
+    const double LegacyReadMs = (FPlatformTime::Seconds() - StartTime) * 1000.0 / Iterations;
+
+    // 紧凑格式：字符串表 + 结构数组
+    TArray<uint8> CompactData;
+    StartTime = FPlatformTime::Seconds();
+    for (int32 i = 0; i < Iterations; i++)
+    {
+        CompactData.Reset();
+        FMemoryWriter Writer(CompactData);
+        FSaveCompactSchema::WriteWorldData(Writer, WorldData);
+    }
+    const double CompactWriteMs = (FPlatformTime::Seconds() - StartTime) * 1000.0 / Iterations;
+
+    bool bRoundTrip = true;
+    StartTime = FPlatformTime::Seconds();
+    for (int32 i = 0; i < Iterations; i++)
+    {
+        FWorldSaveData Loaded;
+        FMemoryReader Reader(CompactData);
+        bRoundTrip &= FSaveCompactSchema::ReadWorldData(Reader, Loaded) && Loaded.ActorTransforms.Num() == WorldData.ActorTransforms.Num();
+    }
+    const double CompactReadMs = (FPlatformTime::Seconds() - StartTime) * 1000.0 / Iterations;
+
+    UE_LOG(LogTemp, Log, TEXT("=== World Save Schema Benchmark ==="));
+    UE_LOG(LogTemp, Log, TEXT("Actors: %d, Iterations: %d"), ActorCount, Iterations);
+    UE_LOG(LogTemp, Log, TEXT("Legacy:  %9.2f KB  Write: %8.2f ms  Load: %8.2f ms"),
+        LegacyData.Num() / 1024.0f, LegacyWriteMs, LegacyReadMs);
+    UE_LOG(LogTemp, Log, TEXT("Compact: %9.2f KB  Write: %8.2f ms  Load: %8.2f ms%s"),
+        CompactData.Num() / 1024.0f, CompactWriteMs, CompactReadMs, bRoundTrip ? TEXT("") : TEXT("  [ROUND TRIP FAILED]"));
+    UE_LOG(LogTemp, Log, TEXT("Size Ratio: %.3f"), LegacyData.Num() > 0 ? (float)CompactData.Num() / LegacyData.Num() : 1.0f);
+    UE_LOG(LogTemp, Log, TEXT("=== End Benchmark ==="));
+}
+
+void USaveGameTool::BenchmarkBundleContinue(int32 LevelCount, int32 ActorsPerLevel)
+{
+    LevelCount = FMath::Max(LevelCount, 1);
+    ActorsPerLevel = FMath::Max(ActorsPerLevel, 0);
+
+    // 构造多关卡的合成世界数据
+    TMap<FString, FWorldSaveData> LevelWorldData;
+    for (int32 LevelIndex = 0; LevelIndex < LevelCount; LevelIndex++)
+    {
+        FWorldSaveData& WorldData = LevelWorldData.Add(FString::Printf(TEXT("Level_%02d"), LevelIndex));
+        for (int32 i = 0; i < ActorsPerLevel; i++)
+        {
+            const FString ActorID = FString::Printf(TEXT("L%02d_Actor_%d"), LevelIndex, i);
+            WorldData.ActorTransforms.Add(ActorID, FTransform(FVector(i * 100.0f, LevelIndex * 100.0f, 0.0f)));
+            WorldData.WorldStateData.Add(ActorID, TEXT("Idle"));
+        }
+    }
+
+    const FString BenchSlot = TEXT("BundleBench");
+    if (!SaveGameBundle(BenchSlot, FPlayerSaveData(), FSettingsData(), FProgressData(), LevelWorldData))
+    {
+        return;
+    }
+    CloseGameBundle(BenchSlot);
+
+    // 整体解码：读入并解码所有分段
+    double StartTime = FPlatformTime::Seconds();
+    int32 FullLevels = 0;
+    {
+        FPlayerSaveData PlayerData;
+        LoadBundlePlayerData(BenchSlot, PlayerData);
+        for (const FString& LevelName : GetBundleLevelNames(BenchSlot))
+        {
+            FWorldSaveData WorldData;
+            FullLevels += LoadBundleLevelWorldData(BenchSlot, LevelName, WorldData) ? 1 : 0;
+        }
+    }
+    const double FullMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+    CloseGameBundle(BenchSlot);
+
+    // 按需解码：只解码玩家数据和当前关卡
+    StartTime = FPlatformTime::Seconds();
+    bool bContinueOk = false;
+    {
+        FPlayerSaveData PlayerData;
+        FWorldSaveData WorldData;
+        bContinueOk = LoadBundlePlayerData(BenchSlot, PlayerData) && LoadBundleLevelWorldData(BenchSlot, TEXT("Level_00"), WorldData);
+    }
+    const double ContinueMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+
+    UE_LOG(LogTemp, Log, TEXT("=== Save Bundle Continue Benchmark ==="));
+    UE_LOG(LogTemp, Log, TEXT("Levels: %d, Actors Per Level: %d, Bundle Size: %.2f MB"),
+        LevelCount, ActorsPerLevel, IFileManager::Get().FileSize(*GetBundlePath(BenchSlot)) / (1024.0f * 1024.0f));
+    UE_LOG(LogTemp, Log, TEXT("Decode All:       %.2f ms (%d levels)"), FullMs, FullLevels);
+    UE_LOG(LogTemp, Log, TEXT("Player + Level:   %.2f ms%s"), ContinueMs, bContinueOk ? TEXT("") : TEXT("  [FAILED]"));
+    UE_LOG(LogTemp, Log, TEXT("=== End Benchmark ==="));
+
+    DeleteGameBundle(BenchSlot);
+}
+
+// ========== 内部实现 ==========
+
+FString USaveGameTool::GenerateBackupName(const FString& SlotName) const
+{
+    return SlotName + TEXT("_Backup_") + FDateTime::Now().ToString(TEXT("%Y%m%d_%H%M%S"));
+}
+
+bool USaveGameTool::InternalSaveGame(const FString& SlotName, USaveGameBase* SaveGameObject, int32 UserIndex)
+{
+    if (!SaveGameObject)
+    {
+        return false;
+    }
+
+    bool bSuccess = false;
+    bool bWritten = false;
+
+    FSaveGameSnapshot Snapshot;
+    if (MakeSaveSnapshot(SaveGameObject, SlotName, UserIndex, Snapshot))
+    {
+        TArray<uint8> SaveData;
+        EncodeSaveSnapshot(Snapshot, SaveData);
+        const uint64 Generation = ++SaveGenerations.FindOrAdd(SlotName);
+        const ESaveWriteResult Result = WriteSaveData(*SaveWriteState, SlotName, UserIndex, SaveData, Generation, false, false);
+        if (Result == ESaveWriteResult::Busy)
+        {
+            // 同槽的后台写盘未完成时不阻塞游戏线程，排到其后写入，元数据在写入完成后更新
+            QueueSaveWrite(SlotName, UserIndex, MoveTemp(SaveData), Generation, Snapshot.Metadata);
+            return true;
+        }
+        bSuccess = Result != ESaveWriteResult::Failed;
+        bWritten = Result == ESaveWriteResult::Written;
+    }
+    else
+    {
+        // 未知的存档子类沿用UE的保存系统
+        Snapshot.Metadata = SaveGameObject->Metadata;
+        bSuccess = UGameplayStatics::SaveGameToSlot(SaveGameObject, SlotName, UserIndex);
+        bWritten = bSuccess;
+    }
+
+    if (bWritten)
+    {
+        // 快照元数据中带有编码时填写的压缩信息
+        UpdateMetadataIndex(SlotName, Snapshot.Metadata);
+    }
+    return bSuccess;
+}
+
+USaveGameBase* USaveGameTool::InternalLoadGame(const FString& SlotName, int32 UserIndex)
+{
+    TArray<uint8> SaveData;
+    if (!ReadSaveSlotData(SlotName, UserIndex, SaveData))
+    {
+        return nullptr;
+    }
+
+    if (IsSaveContainer(SaveData))
+    {
+        FSaveGameSnapshot Snapshot;
+        if (!DecodeSaveSnapshot(SaveData, Snapshot))
+        {
+            return nullptr;
+        }
+
+        // 世界存档需要重放基础存档之后追加的增量日志
+        if (Snapshot.Kind == ESaveGameKind::World)
+        {
+            ApplyWorldJournal(SlotName, Snapshot.Metadata.SaveDateTime.GetTicks(), Snapshot.WorldData);
+        }
+        return CreateSaveGameFromSnapshot(Snapshot);
+    }
+
+    // 旧格式存档
+    return Cast<USaveGameBase>(UGameplayStatics::LoadGameFromMemory(SaveData));
+}
+
+// ========== 存档快照与容器格式 ==========
+
+bool USaveGameTool::MakeSaveSnapshot(USaveGameBase* SaveGameObject, const FString& SlotName, int32 UserIndex, FSaveGameSnapshot& OutSnapshot) const
+{
+    if (!SaveGameObject)
+    {
+        return false;
+    }
+
+    // 只处理已知的存档类，蓝图子类可能带有额外属性
+    const UClass* SaveClass = SaveGameObject->GetClass();
+    if (SaveClass == UPlayerSaveGame::StaticClass())
+    {
+        OutSnapshot.Kind = ESaveGameKind::Player;
+        OutSnapshot.PlayerData = CastChecked<UPlayerSaveGame>(SaveGameObject)->PlayerData;
+    }
+    else if (SaveClass == UWorldSaveGame::StaticClass())
+    {
+        OutSnapshot.Kind = ESaveGameKind::World;
+        OutSnapshot.WorldData = CastChecked<UWorldSaveGame>(SaveGameObject)->WorldData;
+    }
+    else if (SaveClass == USettingsSaveGame::StaticClass())
+    {
+        OutSnapshot.Kind = ESaveGameKind::Settings;
+        OutSnapshot.SettingsData = CastChecked<USettingsSaveGame>(SaveGameObject)->SettingsData;
+    }
+    else if (SaveClass == UProgressSaveGame::StaticClass())
+    {
+        OutSnapshot.Kind = ESaveGameKind::Progress;
+        OutSnapshot.ProgressData = CastChecked<UProgressSaveGame>(SaveGameObject)->ProgressData;
+    }
+    else if (SaveClass == USaveGameBase::StaticClass())
+    {
+        OutSnapshot.Kind = ESaveGameKind::Base;
+    }
+    else
+    {
+        return false;
+    }
+
+    OutSnapshot.SlotName = SlotName;
+    OutSnapshot.UserIndex = UserIndex;
+    OutSnapshot.Codec = SaveCompressionCodec;
+    OutSnapshot.Metadata = SaveGameObject->Metadata;
+    OutSnapshot.CustomStringData = SaveGameObject->CustomStringData;
+    OutSnapshot.CustomFloatData = SaveGameObject->CustomFloatData;
+    OutSnapshot.CustomIntData = SaveGameObject->CustomIntData;
+    OutSnapshot.CustomBoolData = SaveGameObject->CustomBoolData;
+    return true;
+}
+
+USaveGameBase* USaveGameTool::CreateSaveGameFromSnapshot(const FSaveGameSnapshot& Snapshot)
+{
+    USaveGameBase* SaveGame = nullptr;
+
+    switch (Snapshot.Kind)
+    {
+    case ESaveGameKind::Player:
+        SaveGame = CreatePlayerSaveGameFromData(Snapshot.PlayerData);
+        break;
+    case ESaveGameKind::World:
+        SaveGame = CreateWorldSaveGameFromData(Snapshot.WorldData);
+        break;
+    case ESaveGameKind::Settings:
+        SaveGame = CreateSettingsSaveGameFromData(Snapshot.SettingsData);
+        break;
+    case ESaveGameKind::Progress:
+        SaveGame = CreateProgressSaveGameFromData(Snapshot.ProgressData);
+        break;
+    default:
+        SaveGame = NewObject<USaveGameBase>();
+        break;
+    }
+
+    SaveGame->Metadata = Snapshot.Metadata;
+    SaveGame->CustomStringData = Snapshot.CustomStringData;
+    SaveGame->CustomFloatData = Snapshot.CustomFloatData;
+    SaveGame->CustomIntData = Snapshot.CustomIntData;
+    SaveGame->CustomBoolData = Snapshot.CustomBoolData;
+    return SaveGame;
+}
+
+ESaveWriteResult USaveGameTool::WriteSaveData(FSaveWriteState& WriteState, const FString& SlotName, int32 UserIndex, const TArray<uint8>& SaveData, uint64 Generation, bool bDiscardBackup, bool bWait)
+{
+    // 全局锁只用来取本槽的写锁，写盘期间不阻塞其他槽
+    TSharedPtr<FCriticalSection, ESPMode::ThreadSafe> SlotLock;
+    {
+        FScopeLock Lock(&WriteState.Lock);
+        TSharedPtr<FCriticalSection, ESPMode::ThreadSafe>& FoundLock = WriteState.SlotLocks.FindOrAdd(SlotName);
+        if (!FoundLock.IsValid())
+        {
+            FoundLock = MakeShared<FCriticalSection, ESPMode::ThreadSafe>();
+        }
+        SlotLock = FoundLock;
+    }
+
+    if (bWait)
+    {
+        SlotLock->Lock();
+    }
+    else if (!SlotLock->TryLock())
+    {
+        return ESaveWriteResult::Busy;
+    }
+    ON_SCOPE_EXIT { SlotLock->Unlock(); };
+
+    // 同一槽已写入更新的快照时丢弃本次写入
+    {
+        FScopeLock Lock(&WriteState.Lock);
+        uint64& WrittenGeneration = WriteState.WrittenGenerations.FindOrAdd(SlotName);
+        if (Generation < WrittenGeneration)
+        {
+            return ESaveWriteResult::Skipped;
+        }
+        WrittenGeneration = Generation;
+    }
+
+    if (!WriteSaveFileAtomic(SlotName, UserIndex, SaveData))
+    {
+        return ESaveWriteResult::Failed;
+    }
+    if (bDiscardBackup)
+    {
+        IFileManager::Get().Delete(*GetSaveBackupPath(SlotName), false, false, true);
+    }
+    return ESaveWriteResult::Written;
+}
+
+void USaveGameTool::QueueSaveWrite(const FString& SlotName, int32 UserIndex, TArray<uint8>&& SaveData, uint64 Generation, const FSaveGameMetadata& Metadata)
+{
+    TWeakObjectPtr<USaveGameTool> WeakThis(this);
+    PendingSaveTasks.RemoveAll([](const TFuture<void>& Task) { return Task.IsReady(); });
+
+    PendingSaveTasks.Add(Async(EAsyncExecution::ThreadPool, [WriteState = SaveWriteState.ToSharedRef(), WeakThis, SlotName, UserIndex, SaveData = MoveTemp(SaveData), Generation, Metadata]()
+        {
+            const ESaveWriteResult Result = WriteSaveData(*WriteState, SlotName, UserIndex, SaveData, Generation);
+            if (Result == ESaveWriteResult::Failed)
+            {
+                UE_LOG(LogTemp, Error, TEXT("Queued save write failed: %s"), *SlotName);
+            }
+            if (Result != ESaveWriteResult::Written)
+            {
+                return;
+            }
+
+            Async(EAsyncExecution::TaskGraphMainThread, [WeakThis, SlotName, Metadata]()
+                {
+                    if (USaveGameTool* Tool = WeakThis.Get())
+                    {
+                        Tool->UpdateMetadataIndex(SlotName, Metadata);
+                    }
+                });
+        }));
+}
+
+bool USaveGameTool::WriteSaveFileAtomic(const FString& SlotName, int32 UserIndex, const TArray<uint8>& SaveData)
+{
+#if !PLATFORM_DESKTOP
+    // 非桌面平台由平台存档系统按用户保存，写入的完整性也由平台保证
+    return UGameplayStatics::SaveDataToSlot(SaveData, SlotName, UserIndex);
+#else
+    return WriteFileAtomic(GetSaveSlotPath(SlotName), SaveData, GetSaveBackupPath(SlotName));
+#endif
+}
+
+bool USaveGameTool::WriteFileAtomic(const FString& FilePath, const TArray<uint8>& Data, const FString& BackupPath)
+{
+#if !PLATFORM_DESKTOP
+    return FFileHelper::SaveArrayToFile(Data, *FilePath);
+#else
+    IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+    const FString TempPath = FilePath + TEXT(".tmp");
+
+    PlatformFile.CreateDirectoryTree(*FPaths::GetPath(FilePath));
+
+    // 先完整写入临时文件并刷到磁盘
+    {
+        TUniquePtr<IFileHandle> Handle(PlatformFile.OpenWrite(*TempPath));
+        if (!Handle)
+        {
+            UE_LOG(LogTemp, Error, TEXT("Failed to open temp save file: %s"), *TempPath);
+            return false;
+        }
+
+        if (!Handle->Write(Data.GetData(), Data.Num()) || !Handle->Flush(true))
+        {
+            Handle.Reset();
+            PlatformFile.DeleteFile(*TempPath);
+            UE_LOG(LogTemp, Error, TEXT("Failed to write temp save file: %s"), *TempPath);
+            return false;
+        }
+    }
+
+    // 上一代文件复制为备份，新文件就位前主文件始终保留，备份失败只影响回退
+    if (!BackupPath.IsEmpty() && PlatformFile.FileExists(*FilePath) && !PlatformFile.CopyFile(*BackupPath, *FilePath))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("Failed to rotate save backup: %s"), *FilePath);
+    }
+
+    // 原子替换，失败时主文件仍是上一代数据
+    if (!ReplaceFileAtomic(FilePath, TempPath))
+    {
+        PlatformFile.DeleteFile(*TempPath);
+        UE_LOG(LogTemp, Error, TEXT("Failed to move temp save into place: %s"), *FilePath);
+        return false;
+    }
+
+    return true;
+#endif
+}
+
+bool USaveGameTool::ReadSaveSlotData(const FString& SlotName, int32 UserIndex, TArray<uint8>& OutSaveData)
+{
+    // 与WriteSaveFileAtomic读写同一位置
+#if PLATFORM_DESKTOP
+    const bool bLoaded = FFileHelper::LoadFileToArray(OutSaveData, *GetSaveSlotPath(SlotName), FILEREAD_Silent);
+#else
+    const bool bLoaded = UGameplayStatics::LoadDataFromSlot(OutSaveData, SlotName, UserIndex);
+#endif
+
+    // 旧格式存档没有校验信息，读到即视为有效
+    if (bLoaded && (!IsSaveContainer(OutSaveData) || VerifySaveContainer(OutSaveData)))
+    {
+        return true;
+    }
+
+    TArray<uint8> BackupData;
+    if (FFileHelper::LoadFileToArray(BackupData, *GetSaveBackupPath(SlotName), FILEREAD_Silent)
+        && IsSaveContainer(BackupData) && VerifySaveContainer(BackupData))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("Save %s is missing or damaged, loaded previous generation from backup"), *SlotName);
+        OutSaveData = MoveTemp(BackupData);
+        return true;
+    }
+
+    return false;
+}
+
+FString USaveGameTool::GetSaveSlotPath(const FString& SlotName)
+{
+    // 与UE桌面平台通用存档系统的文件布局一致，该系统不按UserIndex区分文件
+    return GetSaveGameDir() / (SlotName + TEXT(".sav"));
+}
+
+FString USaveGameTool::GetSaveBackupPath(const FString& SlotName)
+{
+    // 不使用.sav扩展名，避免被当作存档槽枚举
+    return GetSaveGameDir() / (SlotName + TEXT(".bak"));
+}
+
+FFileStatData USaveGameTool::GetSaveSlotStat(const FString& SlotName)
+{
+    // 元数据索引按槽文件的大小和时间判断是否过期，只有存档包的槽以存档包为准
+    FFileStatData StatData = IFileManager::Get().GetStatData(*GetSaveSlotPath(SlotName));
+    if (!StatData.bIsValid)
+    {
+        StatData = IFileManager::Get().GetStatData(*GetBundlePath(SlotName));
+    }
+    return StatData;
+}
+
+void USaveGameTool::WaitForPendingSaves()
+{
+    for (TFuture<void>& Task : PendingSaveTasks)
+    {
+        Task.Wait();
+    }
+    PendingSaveTasks.Empty();
+}
+
+bool USaveGameTool::SerializeSnapshotBody(FArchive& Ar, FSaveGameSnapshot& Snapshot, int32 Version)
+{
+    Snapshot.Metadata.Serialize(Ar);
+    Ar << Snapshot.CustomStringData;
+    Ar << Snapshot.CustomFloatData;
+    Ar << Snapshot.CustomIntData;
+    Ar << Snapshot.CustomBoolData;
+
+    // 版本3起世界和进度数据使用字符串表 + 结构数组的紧凑格式，旧版本按原结构序列化读取
+    const bool bCompact = Version >= 3;
+    bool bSuccess = true;
+
+    switch (Snapshot.Kind)
+    {
+    case ESaveGameKind::Player:
+        Snapshot.PlayerData.Serialize(Ar);
+        break;
+    case ESaveGameKind::World:
+        if (!bCompact)
+        {
+            Snapshot.WorldData.Serialize(Ar);
+        }
+        else if (Ar.IsLoading())
+        {
+            bSuccess = FSaveCompactSchema::ReadWorldData(Ar, Snapshot.WorldData);
+        }
+        else
+        {
+            FSaveCompactSchema::WriteWorldData(Ar, Snapshot.WorldData);
+        }
+        break;
+    case ESaveGameKind::Settings:
+        Snapshot.SettingsData.Serialize(Ar);
+        break;
+    case ESaveGameKind::Progress:
+        if (!bCompact)
+        {
+            Snapshot.ProgressData.Serialize(Ar);
+        }
+        else if (Ar.IsLoading())
+        {
+            bSuccess = FSaveCompactSchema::ReadProgressData(Ar, Snapshot.ProgressData);
+        }
+        else
+        {
+            FSaveCompactSchema::WriteProgressData(Ar, Snapshot.ProgressData);
+        }
+        break;
+    default:
+        break;
+    }
+
+    return bSuccess && !Ar.IsError();
+}
+
+void USaveGameTool::EncodeSaveSnapshot(FSaveGameSnapshot& Snapshot, TArray<uint8>& OutSaveData)
+{
+    TArray<uint8> Body;
+    FMemoryWriter BodyWriter(Body);
+    SerializeSnapshotBody(BodyWriter, Snapshot, SaveContainerVersion);
+
+    // 压缩失败或没有收益时按未压缩写入
+    ESaveCompressionCodec Codec = Snapshot.Codec;
+    TArray<uint8> Compressed;
+    if (Codec != ESaveCompressionCodec::None)
+    {
+        const FName FormatName = GetCompressionFormatName(Codec);
+        int32 CompressedSize = FCompression::CompressMemoryBound(FormatName, Body.Num());
+        Compressed.SetNumUninitialized(CompressedSize);
+
+        if (FCompression::CompressMemory(FormatName, Compressed.GetData(), CompressedSize, Body.GetData(), Body.Num())
+            && CompressedSize < Body.Num())
+        {
+            Compressed.SetNum(CompressedSize, EAllowShrinking::No);
+        }
+        else
+        {
+            Codec = ESaveCompressionCodec::None;
+        }
+    }
+
+    const TArray<uint8>& Payload = (Codec == ESaveCompressionCodec::None) ? Body : Compressed;
+
+    FMemoryWriter Writer(OutSaveData);
+
+    uint32 Magic = SaveContainerMagic;
+    int32 Version = SaveContainerVersion;
+    uint8 Kind = static_cast<uint8>(Snapshot.Kind);
+    uint8 CodecValue = static_cast<uint8>(Codec);
+    int64 UncompressedSize = Body.Num();
+    Writer << Magic;
+    Writer << Version;
+    Writer << Kind;
+    Writer << CodecValue;
+    Writer << UncompressedSize;
+
+    // 校验和覆盖之前的头部与正文，头部字段损坏同样能被发现
+    uint32 PayloadCrc = FCrc::MemCrc32(Payload.GetData(), Payload.Num(), FCrc::MemCrc32(OutSaveData.GetData(), (int32)Writer.Tell()));
+    Writer << PayloadCrc;
+    Writer.Serialize(const_cast<uint8*>(Payload.GetData()), Payload.Num());
+
+    Snapshot.Metadata.CompressionCodec = Codec;
+    Snapshot.Metadata.UncompressedSize = UncompressedSize;
+    Snapshot.Metadata.CompressedSize = Payload.Num();
+    Snapshot.Metadata.CompressionRatio = UncompressedSize > 0 ? (float)Payload.Num() / UncompressedSize : 1.0f;
+}
+
+bool USaveGameTool::ReadSaveContainerHeader(const TArray<uint8>& SaveData, FSaveContainerHeader& OutHeader)
+{
+    FMemoryReader Reader(SaveData);
+
+    uint32 Magic = 0;
+    Reader << Magic;
+    Reader << OutHeader.Version;
+    Reader << OutHeader.Kind;
+
+    if (Magic != SaveContainerMagic || OutHeader.Version < 1 || OutHeader.Version > SaveContainerVersion
+        || OutHeader.Kind > static_cast<uint8>(ESaveGameKind::Progress))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("Unsupported save container (version %d)"), OutHeader.Version);
+        return false;
+    }
+
+    // 版本1没有压缩头，正文紧跟在类型之后；版本4起带正文校验和
+    OutHeader.Codec = static_cast<uint8>(ESaveCompressionCodec::None);
+    OutHeader.UncompressedSize = SaveData.Num() - Reader.Tell();
+    if (OutHeader.Version >= 2)
+    {
+        Reader << OutHeader.Codec;
+        Reader << OutHeader.UncompressedSize;
+    }
+    OutHeader.HeaderSize = Reader.Tell();
+    if (OutHeader.Version >= 4)
+    {
+        Reader << OutHeader.PayloadCrc;
+    }
+
+    OutHeader.PayloadOffset = Reader.Tell();
+    OutHeader.PayloadSize = SaveData.Num() - OutHeader.PayloadOffset;
+    if (Reader.IsError() || OutHeader.PayloadSize < 0 || OutHeader.UncompressedSize < 0 || OutHeader.UncompressedSize > MAX_int32
+        || OutHeader.Codec > static_cast<uint8>(ESaveCompressionCodec::Oodle)
+        || OutHeader.UncompressedSize > OutHeader.PayloadSize * GetMaxCompressionRatio(static_cast<ESaveCompressionCodec>(OutHeader.Codec)))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("Corrupted save container header"));
+        return false;
+    }
+
+    return true;
+}
+
+bool USaveGameTool::VerifySaveContainer(const TArray<uint8>& SaveData)
+{
+    FSaveContainerHeader Header;
+    if (!ReadSaveContainerHeader(SaveData, Header))
+    {
+        return false;
+    }
+
+    return VerifySaveContainerCrc(SaveData, Header);
+}
+
+bool USaveGameTool::VerifySaveContainerCrc(const TArray<uint8>& SaveData, const FSaveContainerHeader& Header)
+{
+    // 旧版本没有校验和，只能做结构检查
+    if (Header.Version < 4)
+    {
+        return true;
+    }
+
+    // 版本4只校验正文
+    const uint32 HeaderCrc = Header.Version >= 5 ? FCrc::MemCrc32(SaveData.GetData(), (int32)Header.HeaderSize) : 0;
+    return FCrc::MemCrc32(SaveData.GetData() + Header.PayloadOffset, (int32)Header.PayloadSize, HeaderCrc) == Header.PayloadCrc;
+}
+
+bool USaveGameTool::DecodeSaveSnapshot(const TArray<uint8>& SaveData, FSaveGameSnapshot& OutSnapshot)
+{
+    FSaveContainerHeader Header;
+    if (!ReadSaveContainerHeader(SaveData, Header))
+    {
+        return false;
+    }
+
+    if (!VerifySaveContainerCrc(SaveData, Header))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("Save container checksum mismatch"));
+        return false;
+    }
+
+    TArray<uint8> Scratch;
+    TArrayView<const uint8> Body;
+    if (!ExtractSaveContainerBody(SaveData, Header, Scratch, Body))
+    {
+        return false;
+    }
+
+    OutSnapshot.Kind = static_cast<ESaveGameKind>(Header.Kind);
+    const ESaveCompressionCodec Codec = static_cast<ESaveCompressionCodec>(Header.Codec);
+
+    FMemoryReaderView BodyReader(Body);
+    const bool bBodyOk = SerializeSnapshotBody(BodyReader, OutSnapshot, Header.Version);
+
+    OutSnapshot.Codec = Codec;
+    OutSnapshot.SlotName = OutSnapshot.Metadata.SaveSlotName;
+    OutSnapshot.WorldData.ClearDirty();
+    OutSnapshot.Metadata.CompressionCodec = Codec;
+    OutSnapshot.Metadata.UncompressedSize = Header.UncompressedSize;
+    OutSnapshot.Metadata.CompressedSize = Header.PayloadSize;
+    OutSnapshot.Metadata.CompressionRatio = Header.UncompressedSize > 0 ? (float)Header.PayloadSize / Header.UncompressedSize : 1.0f;
+    return bBodyOk;
+}
+
+bool USaveGameTool::ExtractSaveContainerBody(const TArray<uint8>& SaveData, const FSaveContainerHeader& Header, TArray<uint8>& Scratch, TArrayView<const uint8>& OutBody)
+{
+    const TArrayView<const uint8> Payload = MakeArrayView(SaveData.GetData() + Header.PayloadOffset, (int32)Header.PayloadSize);
+
+    // 未压缩的正文直接引用原数据
+    const ESaveCompressionCodec Codec = static_cast<ESaveCompressionCodec>(Header.Codec);
+    if (Codec == ESaveCompressionCodec::None)
+    {
+        OutBody = Payload;
+        return true;
+    }
+
+    Scratch.SetNumUninitialized((int32)Header.UncompressedSize);
+    if (!FCompression::UncompressMemory(GetCompressionFormatName(Codec), Scratch.GetData(), Scratch.Num(), Payload.GetData(), Payload.Num()))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("Failed to decompress save container"));
+        return false;
+    }
+
+    OutBody = Scratch;
+    return true;
+}
+
+bool USaveGameTool::DecodeSaveMetadata(const TArray<uint8>& SaveData, FSaveGameMetadata& OutMetadata)
+{
+    FSaveContainerHeader Header;
+    TArray<uint8> Scratch;
+    TArrayView<const uint8> Body;
+    if (!ReadSaveContainerHeader(SaveData, Header) || !ExtractSaveContainerBody(SaveData, Header, Scratch, Body))
+    {
+        return false;
+    }
+
+    // 元数据位于正文最前面，其余部分不解码
+    FMemoryReaderView BodyReader(Body);
+    OutMetadata.Serialize(BodyReader);
+
+    OutMetadata.CompressionCodec = static_cast<ESaveCompressionCodec>(Header.Codec);
+    OutMetadata.UncompressedSize = Header.UncompressedSize;
+    OutMetadata.CompressedSize = Header.PayloadSize;
+    OutMetadata.CompressionRatio = Header.UncompressedSize > 0 ? (float)Header.PayloadSize / Header.UncompressedSize : 1.0f;
+    return !BodyReader.IsError();
+}
+
+FName USaveGameTool::GetCompressionFormatName(ESaveCompressionCodec Codec)
+{
+    switch (Codec)
+    {
+    case ESaveCompressionCodec::Zlib:
+        return NAME_Zlib;
+    case ESaveCompressionCodec::Oodle:
+        return NAME_Oodle;
+    default:
+        return NAME_None;
+    }
+}
+
+bool USaveGameTool::IsSaveContainer(const TArray<uint8>& SaveData)
+{
+    if (SaveData.Num() < (int32)sizeof(uint32))
+    {
+        return false;
+    }
+
+    uint32 Magic = 0;
+    FMemory::Memcpy(&Magic, SaveData.GetData(), sizeof(uint32));
+    return Magic == SaveContainerMagic;
+}
+
+void USaveGameTool::UpdateSaveMetadata(USaveGameBase* SaveGame, const FString& SlotName, ESaveSlotType SlotType)
+{
+    if (!SaveGame)
+    {
+        return;
+    }
+
+    FillSaveMetadata(SaveGame->Metadata, SlotName, SlotType);
+}
+
+void USaveGameTool::FillSaveMetadata(FSaveGameMetadata& Metadata, const FString& SlotName, ESaveSlotType SlotType) const
+{
+    Metadata.SaveSlotName = SlotName;
+    Metadata.SaveDateTime = FDateTime::Now();
+    Metadata.SlotType = SlotType;
+
+    UWorld* World = GetWorld();
+    if (World)
+    {
+        Metadata.LevelName = UGameplayStatics::GetCurrentLevelName(World);
+        Metadata.PlayTimeSeconds = World->GetTimeSeconds();
+    }
+
+    // 设置游戏版本
+    Metadata.GameVersion = TEXT("1.0.0");
+    Metadata.SaveVersion = 1;
+}
+
+void USaveGameTool::HandleAsyncSaveComplete(const FString& SlotName, const int32 UserIndex, bool bSuccess)
+{
+    UE_LOG(LogTemp, Log, TEXT("Async save completed: %s - %s"), *SlotName, bSuccess ? TEXT("Success") : TEXT("Failed"));
+
+    // 广播委托
+    OnSaveGameComplete.Broadcast(SlotName, bSuccess);
+
+    // 执行蓝图回调
+    FOnSaveGameCallback* Callback = SaveCallbacks.Find(SlotName);
+    if (Callback && Callback->IsBound())
+    {
+        Callback->Execute(SlotName, bSuccess);
+        SaveCallbacks.Remove(SlotName);
+    }
+
+    // 执行静态委托回调
     FOnSaveGameStaticDelegate* StaticCallback = SaveStaticCallbacks.Find(SlotName);
     if (StaticCallback && StaticCallback->IsBound())
     {
@@ -755,10 +2574,10 @@ void USaveGameTool::HandleAsyncLoadComplete(const FString& SlotName, const int32
 
     UE_LOG(LogTemp, Log, TEXT("Async load completed: %s - %s"), *SlotName, bSuccess ? TEXT("Success") : TEXT("Failed"));
 
-    // 㲥ί
+    // 广播委托
     OnLoadGameComplete.Broadcast(SlotName, SaveGameBase, bSuccess);
 
-    // ִͼص
+    // 执行蓝图回调
     FOnLoadGameCallback* Callback = LoadCallbacks.Find(SlotName);
     if (Callback && Callback->IsBound())
     {
@@ -766,7 +2585,7 @@ void USaveGameTool::HandleAsyncLoadComplete(const FString& SlotName, const int32
         LoadCallbacks.Remove(SlotName);
     }
 
-    // ִо̬ίлص
+    // 执行静态委托回调
     FOnLoadGameStaticDelegate* StaticCallback = LoadStaticCallbacks.Find(SlotName);
     if (StaticCallback && StaticCallback->IsBound())
     {
@@ -775,6 +2594,242 @@ void USaveGameTool::HandleAsyncLoadComplete(const FString& SlotName, const int32
     }
 }
 
+// ========== 元数据索引 ==========
+
+FString USaveGameTool::GetSaveGameDir()
+{
+    return FPaths::ProjectSavedDir() / TEXT("SaveGames");
+}
+
+FString USaveGameTool::GetMetadataIndexPath() const
+{
+    // 不使用.sav扩展名，避免被当作存档槽枚举
+    return GetSaveGameDir() / TEXT("SaveMetadata.idx");
+}
+
+void USaveGameTool::LoadMetadataIndex()
+{
+    if (bMetadataIndexLoaded)
+    {
+        return;
+    }
+    bMetadataIndexLoaded = true;
+    MetadataIndex.Empty();
+
+    TArray<uint8> FileData;
+    if (!FFileHelper::LoadFileToArray(FileData, *GetMetadataIndexPath(), FILEREAD_Silent))
+    {
+        return;
+    }
+
+    FMemoryReader Reader(FileData);
+
+    int32 Version = 0;
+    int32 EntryCount = 0;
+    Reader << Version;
+    Reader << EntryCount;
+
+    if (Version != SaveMetadataIndexVersion || EntryCount < 0 || Reader.IsError())
+    {
+        UE_LOG(LogTemp, Log, TEXT("Save metadata index is outdated, will be rebuilt on demand"));
+        return;
+    }
+
+    for (int32 i = 0; i < EntryCount && !Reader.IsError(); i++)
+    {
+        FString SlotName;
+        FSaveSlotIndexEntry Entry;
+        Reader << SlotName;
+        Entry.Metadata.Serialize(Reader);
+        Entry.Metadata.SerializeCompressionInfo(Reader);
+        Reader << Entry.FileSize;
+        Reader << Entry.FileTimestamp;
+        MetadataIndex.Add(SlotName, Entry);
+    }
+
+    if (Reader.IsError())
+    {
+        UE_LOG(LogTemp, Warning, TEXT("Save metadata index is corrupted, will be rebuilt on demand"));
+        MetadataIndex.Empty();
+    }
+}
+
+bool USaveGameTool::SaveMetadataIndex()
+{
+    TArray<uint8> FileData;
+    FMemoryWriter Writer(FileData);
+
+    int32 Version = SaveMetadataIndexVersion;
+    int32 EntryCount = MetadataIndex.Num();
+    Writer << Version;
+    Writer << EntryCount;
+
+    for (auto& EntryPair : MetadataIndex)
+    {
+        FString SlotName = EntryPair.Key;
+        Writer << SlotName;
+        EntryPair.Value.Metadata.Serialize(Writer);
+        EntryPair.Value.Metadata.SerializeCompressionInfo(Writer);
+        Writer << EntryPair.Value.FileSize;
+        Writer << EntryPair.Value.FileTimestamp;
+    }
+
+    return FFileHelper::SaveArrayToFile(FileData, *GetMetadataIndexPath());
+}
+
+void USaveGameTool::UpdateMetadataIndex(const FString& SlotName, const FSaveGameMetadata& Metadata, bool bWriteToDisk)
+{
+    LoadMetadataIndex();
+
+    const FFileStatData StatData = GetSaveSlotStat(SlotName);
+    if (!StatData.bIsValid)
+    {
+        return;
+    }
+
+    FSaveSlotIndexEntry& Entry = MetadataIndex.FindOrAdd(SlotName);
+    Entry.Metadata = Metadata;
+    Entry.FileSize = StatData.FileSize;
+    Entry.FileTimestamp = StatData.ModificationTime;
+
+    if (bWriteToDisk)
+    {
+        SaveMetadataIndex();
+    }
+}
+
+void USaveGameTool::RemoveFromMetadataIndex(const FString& SlotName)
+{
+    LoadMetadataIndex();
+
+    if (MetadataIndex.Remove(SlotName) > 0)
+    {
+        SaveMetadataIndex();
+    }
+}
+
+bool USaveGameTool::GetIndexedMetadata(const FString& SlotName, const FFileStatData& StatData, FSaveGameMetadata& OutMetadata)
+{
+    LoadMetadataIndex();
+
+    const FSaveSlotIndexEntry* Entry = MetadataIndex.Find(SlotName);
+    if (!Entry || !StatData.bIsValid)
+    {
+        return false;
+    }
+
+    // 存档被外部修改过（大小或时间不一致）时视为过期
+    if (Entry->FileSize != StatData.FileSize || Entry->FileTimestamp != StatData.ModificationTime)
+    {
+        return false;
+    }
+
+    OutMetadata = Entry->Metadata;
+    return true;
+}
+
+// ========== 增量世界存档日志 ==========
+
+FString USaveGameTool::GetWorldJournalPath(const FString& SlotName)
+{
+    // 不使用.sav扩展名，避免被当作存档槽枚举
+    return GetSaveGameDir() / (SlotName + TEXT(".journal"));
+}
+
+int64 USaveGameTool::GetWorldJournalSize(const FString& SlotName, int64 BaseTicks)
+{
+    TUniquePtr<FArchive> Reader(IFileManager::Get().CreateFileReader(*GetWorldJournalPath(SlotName), FILEREAD_Silent));
+    if (!Reader)
+    {
+        return INDEX_NONE;
+    }
+
+    uint32 Magic = 0;
+    int32 Version = 0;
+    int64 JournalBaseTicks = 0;
+    *Reader << Magic;
+    *Reader << Version;
+    *Reader << JournalBaseTicks;
+
+    if (Reader->IsError() || Magic != WorldJournalMagic || Version != WorldJournalVersion || JournalBaseTicks != BaseTicks)
+    {
+        return INDEX_NONE;
+    }
+
+    return Reader->TotalSize();
+}
+
+bool USaveGameTool::ResetWorldJournal(const FString& SlotName, int64 BaseTicks)
+{
+    TArray<uint8> Header;
+    FMemoryWriter Writer(Header);
+
+    uint32 Magic = WorldJournalMagic;
+    int32 Version = WorldJournalVersion;
+    Writer << Magic;
+    Writer << Version;
+    Writer << BaseTicks;
+
+    return FFileHelper::SaveArrayToFile(Header, *GetWorldJournalPath(SlotName));
+}
+
+int32 USaveGameTool::ApplyWorldJournal(const FString& SlotName, int64 BaseTicks, FWorldSaveData& WorldData)
+{
+    TArray<uint8> FileData;
+    if (!FFileHelper::LoadFileToArray(FileData, *GetWorldJournalPath(SlotName), FILEREAD_Silent))
+    {
+        return 0;
+    }
+
+    FMemoryReader Reader(FileData);
+
+    uint32 Magic = 0;
+    int32 Version = 0;
+    int64 JournalBaseTicks = 0;
+    Reader << Magic;
+    Reader << Version;
+    Reader << JournalBaseTicks;
+
+    // 日志属于更早的基础存档（完整存档后尚未追加过增量），直接忽略
+    if (Reader.IsError() || Magic != WorldJournalMagic || Version != WorldJournalVersion || JournalBaseTicks != BaseTicks)
+    {
+        return 0;
+    }
+
+    int32 AppliedCount = 0;
+    while (Reader.Tell() + (int64)(sizeof(int32) + sizeof(uint32)) <= FileData.Num())
+    {
+        int32 RecordSize = 0;
+        uint32 RecordCrc = 0;
+        Reader << RecordSize;
+        Reader << RecordCrc;
+
+        const int64 RecordOffset = Reader.Tell();
+        if (RecordSize < 0 || RecordOffset + RecordSize > FileData.Num()
+            || FCrc::MemCrc32(FileData.GetData() + RecordOffset, RecordSize) != RecordCrc)
+        {
+            UE_LOG(LogTemp, Warning, TEXT("World journal %s has a damaged tail, %d records applied"), *SlotName, AppliedCount);
+            break;
+        }
+
+        FMemoryReaderView RecordReader(MakeArrayView(FileData.GetData() + RecordOffset, RecordSize));
+        FWorldSaveDelta Delta;
+        Delta.Serialize(RecordReader);
+        if (RecordReader.IsError())
+        {
+            break;
+        }
+
+        ApplyWorldSaveDelta(Delta, WorldData);
+        AppliedCount++;
+        Reader.Seek(RecordOffset + RecordSize);
+    }
+
+    WorldData.ClearDirty();
+    UE_LOG(LogTemp, Verbose, TEXT("World journal %s: %d records applied"), *SlotName, AppliedCount);
+    return AppliedCount;
+}
+
 UWorld* USaveGameTool::GetWorld() const
 {
     if (GEngine)
@@ -9,24 +9,51 @@
 #include "TimerManager.h"
 #include "AssetRegistry/AssetRegistryModule.h"
 #include "Misc/PackageName.h"
-
-// ̬ʵ
+#include "GameFramework/Pawn.h"
+#include "Camera/PlayerCameraManager.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/FileManager.h"
+#include "Engine/Level.h"
+#include "Misc/App.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+#include "UObject/UObjectGlobals.h"
+#include "SceneManager/SceneWarmupManifest.h"
+#include "ObjectPool/ObjectPoolManager.h"
+#include "UIManager/UIManager.h"
+#include "AudioManager/AudioManager.h"
+#include "ResourceManager/ResourceManager.h"
+
+// 地图目录缓存文件版本，格式变化时递增
+static const int32 MapCatalogVersion = 1;
+
+// 目录记录的最小字节数：三个空字符串的长度前缀加一个布尔值
+static const int64 MinMapCatalogRecordSize = 3 * sizeof(int32) + sizeof(uint32);
+
+// 静态实例定义
 template<>
 ULoadSceneManager* TSingleton<ULoadSceneManager>::SingletonInstance = nullptr;
 
 ULoadSceneManager::ULoadSceneManager()
 {
-    // 캯
+    // 构造函数
 }
 
 ULoadSceneManager::~ULoadSceneManager()
 {
-    // ֹͣмʱ
+    // 停止所有计时器
     for (auto& TimerPair : ProgressTimerHandles)
     {
         StopProgressTimer(TimerPair.Key);
     }
     ProgressTimerHandles.Empty();
+
+    StopStreamingScheduler();
+    RestoreStreamingCVars();
+    UnbindAssetRegistryEvents();
+    FCoreUObjectDelegates::PostLoadMapWithWorld.Remove(PostLoadMapHandle);
 }
 
 void ULoadSceneManager::InitializeSingleton()
@@ -39,11 +66,17 @@ void ULoadSceneManager::InitializeSceneManager()
 {
     UE_LOG(LogTemp, Log, TEXT("Scene Manager Initialized"));
 
-    // ɨõͼļ
-    ScanForMapFiles();
+    // 优先使用磁盘缓存的地图目录，过期时才全量扫描
+    if (!LoadMapCatalogFromDisk())
+    {
+        ScanForMapFiles();
+        SaveMapCatalogToDisk();
+    }
+
+    BindAssetRegistryEvents();
 }
 
-// ========== ͬ ==========
+// ========== 同步场景加载 ==========
 
 void ULoadSceneManager::LoadSceneByIndex(int32 SceneIndex, ESceneLoadMode Mode)
 {
@@ -66,7 +99,7 @@ void ULoadSceneManager::LoadSceneByName(const FString& SceneName, ESceneLoadMode
         return;
     }
 
-    // ֱʹóƼأѾ Build Settings У
+    // 直接使用场景名称加载（假设已经在 Build Settings 中）
     if (Mode == ESceneLoadMode::Single)
     {
         UGameplayStatics::OpenLevel(World, FName(*SceneName));
@@ -74,7 +107,7 @@ void ULoadSceneManager::LoadSceneByName(const FString& SceneName, ESceneLoadMode
     }
     else
     {
-        // Ӽģʽ
+        // 附加加载模式
         UGameplayStatics::LoadStreamLevel(World, FName(*SceneName), true, true, FLatentActionInfo());
         UE_LOG(LogTemp, Log, TEXT("Loading streaming level: %s"), *SceneName);
     }
@@ -97,7 +130,7 @@ void ULoadSceneManager::LoadSceneByPath(const FString& MapPath, ESceneLoadMode M
         return;
     }
 
-    // ȡͼ
+    // 提取地图名称
     FString MapName = ExtractMapNameFromPath(SanitizedPath);
 
     if (Mode == ESceneLoadMode::Single)
@@ -106,7 +139,7 @@ void ULoadSceneManager::LoadSceneByPath(const FString& MapPath, ESceneLoadMode M
     }
     else
     {
-        // Ӽģʽ
+        // 附加加载模式
         UGameplayStatics::LoadStreamLevel(World, FName(*MapName), true, true, FLatentActionInfo());
     }
 
@@ -128,7 +161,7 @@ void ULoadSceneManager::LoadSceneByAsset(const TSoftObjectPtr<UWorld>& MapAsset,
         return;
     }
 
-    // 1ʹõͼʲƣ Build Settings У
+    // 方法1：使用地图资产的名称（必须在 Build Settings 中）
     FString MapName = GetMapAssetDisplayName(MapAsset);
 
     if (Mode == ESceneLoadMode::Single)
@@ -143,7 +176,7 @@ void ULoadSceneManager::LoadSceneByAsset(const TSoftObjectPtr<UWorld>& MapAsset,
     }
 }
 
-// ========== ʹʲ· ==========
+// ========== 使用完整资产路径加载 ==========
 
 void ULoadSceneManager::LoadSceneByFullPath(const FString& FullMapPath, ESceneLoadMode Mode)
 {
@@ -154,7 +187,7 @@ void ULoadSceneManager::LoadSceneByFullPath(const FString& FullMapPath, ESceneLo
         return;
     }
 
-    // ·ȡͼ
+    // 从完整路径中提取地图名称
     FString MapName = ExtractMapNameFromFullPath(FullMapPath);
 
     if (Mode == ESceneLoadMode::Single)
@@ -220,7 +253,7 @@ void ULoadSceneManager::LoadPreviousScene(bool bCyclical)
     LoadSceneByIndex(PreviousIndex, ESceneLoadMode::Single);
 }
 
-// ========== 첽 ==========
+// ========== 异步场景加载 ==========
 
 FString ULoadSceneManager::LoadSceneAsyncByIndex(int32 SceneIndex, ESceneLoadMode Mode, bool bActivateAfterLoad)
 {
@@ -252,7 +285,13 @@ FString ULoadSceneManager::LoadSceneAsyncByName(const FString& SceneName, EScene
 
     AsyncRequests.Add(RequestId, NewRequest);
 
-    // ʹUGameplayStatics첽
+    // 注册了预热清单的场景先分帧预热，完成后再激活
+    if (TryStartSceneWarmup(RequestId, SceneName, Mode, bActivateAfterLoad))
+    {
+        return RequestId;
+    }
+
+    // 使用UGameplayStatics的异步加载
     UWorld* World = GetWorld();
     if (World)
     {
@@ -262,21 +301,21 @@ FString ULoadSceneManager::LoadSceneAsyncByName(const FString& SceneName, EScene
         LatentInfo.Linkage = 0;
         LatentInfo.UUID = GetTypeHash(RequestId);
 
-        // 洢UUIDԱ
+        // 存储UUID以便后续查找
         AsyncRequests[RequestId].LatentActionUUID = LatentInfo.UUID;
 
         if (Mode == ESceneLoadMode::Single)
         {
-            // ڵģʽʹOpenLevel
+            // 对于单机模式，使用OpenLevel
             UGameplayStatics::OpenLevel(World, FName(*SceneName));
-            // 
+            // 立即完成
             CompleteAsyncRequest(RequestId, true);
         }
         else
         {
-            // ڸģʽʹͼ
+            // 对于附加模式，使用流送加载
             UGameplayStatics::LoadStreamLevel(World, FName(*SceneName), true, bActivateAfterLoad, LatentInfo);
-            // ȸ¼ʱ
+            // 启动进度更新计时器
             StartProgressTimer(RequestId);
         }
     }
@@ -316,6 +355,12 @@ FString ULoadSceneManager::LoadSceneAsyncByAsset(const TSoftObjectPtr<UWorld>& M
 
     AsyncRequests.Add(RequestId, NewRequest);
 
+    // 注册了预热清单的场景先分帧预热，完成后再激活
+    if (TryStartSceneWarmup(RequestId, NewRequest.SceneName, Mode, bActivateAfterLoad))
+    {
+        return RequestId;
+    }
+
     UWorld* World = GetWorld();
     if (World)
     {
@@ -325,21 +370,21 @@ FString ULoadSceneManager::LoadSceneAsyncByAsset(const TSoftObjectPtr<UWorld>& M
         LatentInfo.Linkage = 0;
         LatentInfo.UUID = GetTypeHash(RequestId);
 
-        // 洢UUIDԱ
+        // 存储UUID以便后续查找
         AsyncRequests[RequestId].LatentActionUUID = LatentInfo.UUID;
 
         if (Mode == ESceneLoadMode::Single)
         {
-            // ڵģʽʹOpenLevel
+            // 对于单机模式，使用OpenLevel
             UGameplayStatics::OpenLevel(World, FName(*NewRequest.SceneName));
-            // 
+            // 立即完成
             CompleteAsyncRequest(RequestId, true);
         }
         else
         {
-            // ڸģʽʹͼ
+            // 对于附加模式，使用流送加载
             UGameplayStatics::LoadStreamLevel(World, FName(*NewRequest.SceneName), true, bActivateAfterLoad, LatentInfo);
-            // ȸ¼ʱ
+            // 启动进度更新计时器
             StartProgressTimer(RequestId);
         }
     }
@@ -366,13 +411,19 @@ FString ULoadSceneManager::LoadSceneAsyncByFullPath(const FString& FullMapPath,
 
     AsyncRequests.Add(RequestId, NewRequest);
 
+    // 注册了预热清单的场景先分帧预热，完成后再激活
+    if (TryStartSceneWarmup(RequestId, MapName, Mode, bActivateAfterLoad))
+    {
+        return RequestId;
+    }
+
     FLatentActionInfo LatentInfo;
     LatentInfo.CallbackTarget = this;
     LatentInfo.ExecutionFunction = FName("OnAsyncLoadComplete");
     LatentInfo.Linkage = 0;
     LatentInfo.UUID = GetTypeHash(RequestId);
 
-    // 洢UUIDԱ
+    // 存储UUID以便后续查找
     AsyncRequests[RequestId].LatentActionUUID = LatentInfo.UUID;
 
     if (Mode == ESceneLoadMode::Single)
@@ -441,7 +492,7 @@ FString ULoadSceneManager::LoadPreviousSceneAsync(bool bCyclical, bool bActivate
     return LoadSceneAsyncByIndex(PreviousIndex, ESceneLoadMode::Single, bActivateAfterLoad);
 }
 
-// ========== 첽أص ==========
+// ========== 异步场景加载（带回调） ==========
 
 void ULoadSceneManager::LoadSceneAsyncWithCallback(int32 SceneIndex, ESceneLoadMode Mode, bool bActivateAfterLoad,
     const FOnSceneLoadedCallback& OnComplete)
@@ -483,7 +534,7 @@ void ULoadSceneManager::LoadSceneAsyncByAssetWithCallback(const TSoftObjectPtr<U
     }
 }
 
-// ========== ж ==========
+// ========== 场景卸载 ==========
 
 FString ULoadSceneManager::UnloadSceneAsync(const FString& SceneName)
 {
@@ -506,12 +557,12 @@ FString ULoadSceneManager::UnloadSceneAsync(const FString& SceneName)
         LatentInfo.Linkage = 0;
         LatentInfo.UUID = GetTypeHash(RequestId);
 
-        // 洢UUIDԱ
+        // 存储UUID以便后续查找
         AsyncRequests[RequestId].LatentActionUUID = LatentInfo.UUID;
 
         UGameplayStatics::UnloadStreamLevel(World, FName(*SceneName), LatentInfo, true);
 
-        // ȸ¼ʱ
+        // 启动进度更新计时器
         StartProgressTimer(RequestId);
     }
 
@@ -532,7 +583,7 @@ void ULoadSceneManager::UnloadAllAdditiveScenes()
     }
 }
 
-// ========== ͼ͹ ==========
+// ========== 地图流送管理 ==========
 
 void ULoadSceneManager::LoadStreamingLevel(const FString& LevelName, bool bMakeVisibleAfterLoad, bool bShouldBlockOnLoad)
 {
@@ -542,6 +593,13 @@ void ULoadSceneManager::LoadStreamingLevel(const FString& LevelName, bool bMakeV
         return;
     }
 
+    // 设置了时间预算的关卡走分阶段显示
+    if (bMakeVisibleAfterLoad && !bShouldBlockOnLoad && HasLevelVisibilityBudget(LevelName))
+    {
+        MakeStreamingLevelVisibleStaged(LevelName);
+        return;
+    }
+
     ULevelStreaming* StreamingLevel = GetStreamingLevelByName(LevelName);
     if (StreamingLevel)
     {
@@ -553,7 +611,7 @@ void ULoadSceneManager::LoadStreamingLevel(const FString& LevelName, bool bMakeV
             StreamingLevel->bShouldBlockOnLoad = true;
         }
 
-        // 󶨼ί
+        // 绑定加载完成委托
         StreamingLevel->OnLevelLoaded.AddDynamic(this, &ULoadSceneManager::OnStreamingLevelLoaded);
 
         UE_LOG(LogTemp, Log, TEXT("Loading streaming level: %s"), *LevelName);
@@ -591,13 +649,16 @@ void ULoadSceneManager::UnloadStreamingLevel(const FString& LevelName)
         return;
     }
 
+    CancelStagedVisibility(LevelName);
+    ActiveWarmups.Remove(LevelName);
+
     ULevelStreaming* StreamingLevel = GetStreamingLevelByName(LevelName);
     if (StreamingLevel)
     {
         StreamingLevel->SetShouldBeLoaded(false);
         StreamingLevel->SetShouldBeVisible(false);
 
-        // жί
+        // 绑定卸载完成委托
         StreamingLevel->OnLevelUnloaded.AddDynamic(this, &ULoadSceneManager::OnStreamingLevelUnloaded);
 
         UE_LOG(LogTemp, Log, TEXT("Unloading streaming level: %s"), *LevelName);
@@ -616,6 +677,11 @@ void ULoadSceneManager::SetStreamingLevelVisible(const FString& LevelName, bool
         return;
     }
 
+    if (!bVisible)
+    {
+        CancelStagedVisibility(LevelName);
+    }
+
     ULevelStreaming* StreamingLevel = GetStreamingLevelByName(LevelName);
     if (StreamingLevel && StreamingLevel->IsLevelLoaded())
     {
@@ -675,332 +741,1445 @@ void ULoadSceneManager::UnloadStreamingLevels(const TArray<FString>& LevelNames)
     }
 }
 
-// ========== ͼļ ==========
-
-TArray<FMapFileInfo> ULoadSceneManager::GetAllAvailableMaps() const
-{
-    return AvailableMaps;
-}
+// ========== 距离流送调度 ==========
 
-TArray<FMapFileInfo> ULoadSceneManager::FindMapsInFolder(const FString& FolderPath) const
+bool ULoadSceneManager::RegisterProximityStreamingLevel(const FProximityStreamingLevelConfig& Config)
 {
-    TArray<FMapFileInfo> FoundMaps;
-    FString SanitizedPath = SanitizeMapPath(FolderPath);
+    if (Config.LevelName.IsEmpty())
+    {
+        UE_LOG(LogTemp, Warning, TEXT("Cannot register proximity streaming level without name"));
+        return false;
+    }
 
-    for (const FMapFileInfo& MapInfo : AvailableMaps)
+    if (!Config.Bounds.IsValid)
     {
-        if (MapInfo.MapPath.StartsWith(SanitizedPath))
-        {
-            FoundMaps.Add(MapInfo);
-        }
+        UE_LOG(LogTemp, Warning, TEXT("Invalid bounds for proximity streaming level: %s"), *Config.LevelName);
+        return false;
     }
 
-    return FoundMaps;
-}
+    FProximityStreamingLevelState State;
+    State.Config = Config;
 
-bool ULoadSceneManager::DoesMapFileExist(const FString& MapPath) const
-{
-    FString SanitizedPath = SanitizeMapPath(MapPath);
+    // 保证滞后区间有效：可见 <= 隐藏 <= 卸载，加载 <= 卸载
+    State.Config.LoadRadius = FMath::Max(0.0f, Config.LoadRadius);
+    State.Config.UnloadRadius = FMath::Max(State.Config.LoadRadius, Config.UnloadRadius);
+    State.Config.VisibleRadius = FMath::Clamp(Config.VisibleRadius, 0.0f, State.Config.LoadRadius);
+    State.Config.HideRadius = FMath::Clamp(Config.HideRadius, State.Config.VisibleRadius, State.Config.UnloadRadius);
 
-    // Ƿڿõͼб
-    for (const FMapFileInfo& MapInfo : AvailableMaps)
+    // 已经加载的关卡沿用当前状态，避免注册后立即抖动
+    State.StreamingLevel = GetStreamingLevelByName(Config.LevelName);
+    if (ULevelStreaming* StreamingLevel = State.StreamingLevel.Get())
     {
-        if (MapInfo.MapPath == SanitizedPath)
-        {
-            return true;
-        }
+        State.bWantsLoaded = StreamingLevel->ShouldBeLoaded();
+        State.bWantsVisible = StreamingLevel->ShouldBeVisible();
+    }
+    else
+    {
+        UE_LOG(LogTemp, Warning, TEXT("Streaming level not found yet, will retry: %s"), *Config.LevelName);
     }
 
-    return false;
+    ProximityLevels.Add(Config.LevelName, State);
+
+    UE_LOG(LogTemp, Log, TEXT("Registered proximity streaming level: %s (Load %.0f / Unload %.0f, Visible %.0f / Hide %.0f)"),
+        *Config.LevelName, State.Config.LoadRadius, State.Config.UnloadRadius, State.Config.VisibleRadius, State.Config.HideRadius);
+
+    return true;
 }
 
-FString ULoadSceneManager::GetMapDisplayName(const FString& MapPath) const
+void ULoadSceneManager::UnregisterProximityStreamingLevel(const FString& LevelName)
 {
-    FString SanitizedPath = SanitizeMapPath(MapPath);
-
-    for (const FMapFileInfo& MapInfo : AvailableMaps)
+    if (ProximityLevels.Remove(LevelName) > 0)
     {
-        if (MapInfo.MapPath == SanitizedPath)
-        {
-            return MapInfo.DisplayName;
-        }
+        UE_LOG(LogTemp, Log, TEXT("Unregistered proximity streaming level: %s"), *LevelName);
     }
-
-    return FString();
 }
 
-// ========== Ϣѯ ==========
+void ULoadSceneManager::ClearProximityStreamingLevels()
+{
+    int32 Count = ProximityLevels.Num();
+    ProximityLevels.Empty();
+    UE_LOG(LogTemp, Log, TEXT("Cleared %d proximity streaming levels"), Count);
+}
 
-FString ULoadSceneManager::GetCurrentSceneName() const
+void ULoadSceneManager::StartStreamingScheduler(const FStreamingSchedulerSettings& Settings)
 {
     UWorld* World = GetWorld();
     if (!World)
     {
-        return FString();
+        UE_LOG(LogTemp, Warning, TEXT("Cannot start streaming scheduler without valid world"));
+        return;
     }
-    return World->GetMapName();
+
+    SchedulerSettings = Settings;
+    SchedulerSettings.UpdateInterval = FMath::Max(Settings.UpdateInterval, 0.01f);
+    SchedulerSettings.MaxOperationsPerUpdate = FMath::Max(Settings.MaxOperationsPerUpdate, 1);
+    SchedulerSettings.MaxConcurrentLoads = FMath::Max(Settings.MaxConcurrentLoads, 1);
+
+    World->GetTimerManager().SetTimer(StreamingSchedulerHandle, this, &ULoadSceneManager::UpdateStreamingScheduler,
+        SchedulerSettings.UpdateInterval, true);
+    bStreamingSchedulerRunning = true;
+
+    UE_LOG(LogTemp, Log, TEXT("Started streaming scheduler: Interval %.2fs, Ops/Update %d, Max Concurrent Loads %d"),
+        SchedulerSettings.UpdateInterval, SchedulerSettings.MaxOperationsPerUpdate, SchedulerSettings.MaxConcurrentLoads);
 }
 
-FString ULoadSceneManager::GetCurrentScenePath() const
+void ULoadSceneManager::StopStreamingScheduler()
 {
-    UWorld* World = GetWorld();
-    if (!World)
+    if (!bStreamingSchedulerRunning)
     {
-        return FString();
+        return;
     }
-    return World->GetOutermost()->GetName();
-}
 
-int32 ULoadSceneManager::GetCurrentSceneIndex() const
-{
-    FString CurrentScene = GetCurrentSceneName();
-    return GetSceneIndexFromName(CurrentScene);
-}
+    if (UWorld* World = GetWorld())
+    {
+        World->GetTimerManager().ClearTimer(StreamingSchedulerHandle);
+    }
+    bStreamingSchedulerRunning = false;
 
-int32 ULoadSceneManager::GetSceneCount() const
-{
-    // ؿõͼ
-    return AvailableMaps.Num();
+    UE_LOG(LogTemp, Log, TEXT("Stopped streaming scheduler"));
 }
 
-FSceneInfo ULoadSceneManager::GetSceneInfo(int32 SceneIndex) const
+void ULoadSceneManager::UpdateStreamingScheduler()
 {
-    FSceneInfo Info;
+    if (ProximityLevels.Num() == 0)
+    {
+        return;
+    }
 
-    if (IsValidSceneIndex(SceneIndex))
+    FVector ViewLocation;
+    if (!GetStreamingViewLocation(ViewLocation))
     {
-        Info.SceneName = GetSceneNameFromIndex(SceneIndex);
-        Info.BuildIndex = SceneIndex;
+        return;
+    }
+
+    // 一次遍历：计算距离并根据滞后区间更新期望状态
+    TArray<FProximityStreamingLevelState*> PendingLoads;
+    TArray<FProximityStreamingLevelState*> PendingChanges;
+
+    for (auto& LevelPair : ProximityLevels)
+    {
+        FProximityStreamingLevelState& State = LevelPair.Value;
 
-        // ҶӦĵͼϢ
-        for (const FMapFileInfo& MapInfo : AvailableMaps)
+        if (!State.StreamingLevel.IsValid())
         {
-            if (MapInfo.MapName == Info.SceneName)
+            State.StreamingLevel = GetStreamingLevelByName(State.Config.LevelName);
+            if (!State.StreamingLevel.IsValid())
             {
-                Info.ScenePath = MapInfo.MapPath;
-                Info.LoadState = ESceneLoadState::Loaded; // 򻯴
-                break;
+                continue;
             }
         }
-    }
 
-    return Info;
-}
+        const FProximityStreamingLevelConfig& Config = State.Config;
+        State.LastDistance = FMath::Sqrt(Config.Bounds.ComputeSquaredDistanceToPoint(ViewLocation));
 
-bool ULoadSceneManager::IsSceneIndexValid(int32 SceneIndex) const
-{
-    return SceneIndex >= 0 && SceneIndex < GetSceneCount();
-}
+        if (State.bWantsLoaded ? State.LastDistance > Config.UnloadRadius : State.LastDistance <= Config.LoadRadius)
+        {
+            State.bWantsLoaded = !State.bWantsLoaded;
+        }
 
-bool ULoadSceneManager::DoesSceneExist(const FString& SceneName) const
-{
-    for (const FMapFileInfo& MapInfo : AvailableMaps)
-    {
-        if (MapInfo.MapName == SceneName)
+        if (State.bWantsVisible ? State.LastDistance > Config.HideRadius : State.LastDistance <= Config.VisibleRadius)
+        {
+            State.bWantsVisible = !State.bWantsVisible;
+        }
+        State.bWantsVisible &= State.bWantsLoaded;
+
+        // 分阶段显示进行中的关卡视为已可见
+        ULevelStreaming* StreamingLevel = State.StreamingLevel.Get();
+        const bool bCurrentlyVisible = StreamingLevel->ShouldBeVisible() || IsStagedVisibilityInProgress(State.Config.LevelName);
+
+        if (State.bWantsLoaded && !StreamingLevel->ShouldBeLoaded())
+        {
+            PendingLoads.Add(&State);
+        }
+        else if (State.bWantsLoaded != StreamingLevel->ShouldBeLoaded() || State.bWantsVisible != bCurrentlyVisible)
         {
-            return true;
+            PendingChanges.Add(&State);
         }
     }
-    return false;
-}
 
-TArray<FString> ULoadSceneManager::GetAllLoadedScenes() const
-{
-    TArray<FString> LoadedScenes;
+    int32 OperationBudget = SchedulerSettings.MaxOperationsPerUpdate;
 
-    UWorld* World = GetWorld();
-    if (!World)
+    // 卸载和显隐切换优先，能尽快释放内存
+    PendingChanges.Sort([](const FProximityStreamingLevelState& A, const FProximityStreamingLevelState& B)
+        {
+            return A.LastDistance > B.LastDistance;
+        });
+
+    for (FProximityStreamingLevelState* State : PendingChanges)
     {
-        return LoadedScenes;
+        if (OperationBudget <= 0)
+        {
+            break;
+        }
+
+        ApplyProximityLevelState(*State);
+        OperationBudget--;
+
+        UE_LOG(LogTemp, Verbose, TEXT("Proximity streaming %s: Loaded %s, Visible %s (Distance %.0f)"),
+            *State->Config.LevelName,
+            State->bWantsLoaded ? TEXT("Yes") : TEXT("No"),
+            State->bWantsVisible ? TEXT("Yes") : TEXT("No"),
+            State->LastDistance);
     }
 
-    // 
-    LoadedScenes.Add(GetCurrentSceneName());
+    // 加载按距离由近到远，受并发上限约束
+    PendingLoads.Sort([](const FProximityStreamingLevelState& A, const FProximityStreamingLevelState& B)
+        {
+            return A.LastDistance < B.LastDistance;
+        });
 
-    // ͳ
-    for (ULevelStreaming* StreamingLevel : World->GetStreamingLevels())
+    int32 LoadSlots = SchedulerSettings.MaxConcurrentLoads - GetInFlightLoadCount();
+
+    for (FProximityStreamingLevelState* State : PendingLoads)
     {
-        if (StreamingLevel && StreamingLevel->IsLevelLoaded())
+        if (OperationBudget <= 0 || LoadSlots <= 0)
         {
-            LoadedScenes.Add(StreamingLevel->GetWorldAssetPackageName());
+            break;
         }
-    }
 
-    return LoadedScenes;
+        ApplyProximityLevelState(*State);
+        OperationBudget--;
+        LoadSlots--;
+
+        UE_LOG(LogTemp, Log, TEXT("Proximity streaming load: %s (Distance %.0f)"), *State->Config.LevelName, State->LastDistance);
+    }
 }
 
-TArray<AActor*> ULoadSceneManager::GetRootActorsInScene(const FString& SceneName) const
+void ULoadSceneManager::ApplyProximityLevelState(FProximityStreamingLevelState& State)
 {
-    TArray<AActor*> RootActors;
+    if (State.bWantsVisible && HasLevelVisibilityBudget(State.Config.LevelName))
+    {
+        MakeStreamingLevelVisibleStaged(State.Config.LevelName);
+        return;
+    }
+
+    if (!State.bWantsVisible)
+    {
+        CancelStagedVisibility(State.Config.LevelName);
+    }
 
+    ULevelStreaming* StreamingLevel = State.StreamingLevel.Get();
+    StreamingLevel->SetShouldBeLoaded(State.bWantsLoaded);
+    StreamingLevel->SetShouldBeVisible(State.bWantsVisible);
+}
+
+bool ULoadSceneManager::GetStreamingViewLocation(FVector& OutLocation) const
+{
     UWorld* World = GetWorld();
     if (!World)
     {
-        return RootActors;
+        return false;
     }
 
-    if (SceneName == GetCurrentSceneName())
+    if (APawn* PlayerPawn = UGameplayStatics::GetPlayerPawn(World, 0))
     {
-        // ȡǰĸActor
-        for (TActorIterator<AActor> It(World); It; ++It)
-        {
-            if (!It->GetAttachParentActor())
-            {
-                RootActors.Add(*It);
-            }
-        }
+        OutLocation = PlayerPawn->GetActorLocation();
+        return true;
     }
-    else
+
+    // 没有Pawn时退回到相机位置
+    if (APlayerCameraManager* CameraManager = UGameplayStatics::GetPlayerCameraManager(World, 0))
     {
-        // ȡͳĸActor
-        ULevelStreaming* StreamingLevel = GetStreamingLevelByName(SceneName);
-        if (StreamingLevel && StreamingLevel->GetLoadedLevel())
-        {
-            ULevel* Level = StreamingLevel->GetLoadedLevel();
-            RootActors = Level->Actors;
-        }
+        OutLocation = CameraManager->GetCameraLocation();
+        return true;
     }
 
-    return RootActors;
+    return false;
 }
 
-TArray<AActor*> ULoadSceneManager::GetRootActorsInAllLoadedScenes() const
+int32 ULoadSceneManager::GetInFlightLoadCount() const
 {
-    TArray<AActor*> AllRootActors;
-
-    TArray<FString> LoadedScenes = GetAllLoadedScenes();
-    for (const FString& SceneName : LoadedScenes)
+    int32 Count = 0;
+    for (const auto& LevelPair : ProximityLevels)
     {
-        AllRootActors.Append(GetRootActorsInScene(SceneName));
+        const ULevelStreaming* StreamingLevel = LevelPair.Value.StreamingLevel.Get();
+        if (StreamingLevel && StreamingLevel->ShouldBeLoaded() && !StreamingLevel->IsLevelLoaded())
+        {
+            Count++;
+        }
     }
-
-    return AllRootActors;
+    return Count;
 }
 
-// ========== 첽 ==========
+// ========== 分阶段显示 ==========
 
-ESceneLoadState ULoadSceneManager::GetAsyncRequestState(const FString& RequestId) const
+void ULoadSceneManager::SetLevelVisibilityBudget(const FString& LevelName, const FLevelVisibilityBudget& Budget)
 {
-    const FSceneAsyncLoadRequest* Request = AsyncRequests.Find(RequestId);
-    return Request ? Request->LoadState : ESceneLoadState::Failed;
+    FLevelVisibilityBudget& NewBudget = VisibilityBudgets.Add(LevelName, Budget);
+    NewBudget.AddToWorldTimeLimitMs = FMath::Max(Budget.AddToWorldTimeLimitMs, 0.1f);
+    NewBudget.ComponentRegistrationGranularity = FMath::Max(Budget.ComponentRegistrationGranularity, 1);
+    NewBudget.StageTimeLimitMs = FMath::Max(Budget.StageTimeLimitMs, 0.1f);
+
+    UE_LOG(LogTemp, Log, TEXT("Set visibility budget for %s: AddToWorld %.2fms, Granularity %d, Stage %.2fms"),
+        *LevelName, NewBudget.AddToWorldTimeLimitMs, NewBudget.ComponentRegistrationGranularity, NewBudget.StageTimeLimitMs);
 }
 
-float ULoadSceneManager::GetAsyncRequestProgress(const FString& RequestId) const
+void ULoadSceneManager::ClearLevelVisibilityBudget(const FString& LevelName)
 {
-    const FSceneAsyncLoadRequest* Request = AsyncRequests.Find(RequestId);
-    return Request ? Request->Progress : 0.0f;
+    VisibilityBudgets.Remove(LevelName);
 }
 
-void ULoadSceneManager::CancelAsyncRequest(const FString& RequestId)
+bool ULoadSceneManager::HasLevelVisibilityBudget(const FString& LevelName) const
 {
-    StopProgressTimer(RequestId);
-    AsyncRequests.Remove(RequestId);
-    LoadCallbacks.Remove(RequestId);
-    UnloadCallbacks.Remove(RequestId);
+    return VisibilityBudgets.Contains(LevelName);
 }
 
-// ========== Թ ==========
-
-void ULoadSceneManager::PrintAllScenesInfo()
+bool ULoadSceneManager::MakeStreamingLevelVisibleStaged(const FString& LevelName)
 {
-    UE_LOG(LogTemp, Log, TEXT("=== All Scenes Info ==="));
+    ULevelStreaming* StreamingLevel = GetStreamingLevelByName(LevelName);
+    if (!StreamingLevel)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("Streaming level not found: %s"), *LevelName);
+        return false;
+    }
 
-    int32 SceneCount = GetSceneCount();
-    UE_LOG(LogTemp, Log, TEXT("Total Scenes: %d"), SceneCount);
+    if (IsStagedVisibilityInProgress(LevelName))
+    {
+        return true;
+    }
 
-    for (int32 i = 0; i < SceneCount; i++)
+    if (StreamingLevel->IsLevelVisible())
     {
-        FSceneInfo Info = GetSceneInfo(i);
-        UE_LOG(LogTemp, Log, TEXT("  [%d] %s - %s"), i, *Info.SceneName, *UEnum::GetValueAsString(Info.LoadState));
+        StreamingLevel->SetShouldBeVisible(true);
+        return true;
     }
 
-    UE_LOG(LogTemp, Log, TEXT("=== End Scenes Info ==="));
-}
+    FStagedVisibilityState State;
+    const FLevelVisibilityBudget* Budget = VisibilityBudgets.Find(LevelName);
+    State.Budget = Budget ? *Budget : FLevelVisibilityBudget();
+    State.Stats.LevelName = LevelName;
+    State.StreamingLevel = StreamingLevel;
 
-void ULoadSceneManager::PrintAllStreamingLevelsInfo()
-{
-    UE_LOG(LogTemp, Log, TEXT("=== Streaming Levels Info ==="));
+    // 先只加载不显示，加载完成后再进入注册阶段
+    StreamingLevel->SetShouldBeLoaded(true);
+    StreamingLevel->SetShouldBeVisible(false);
 
-    TArray<FStreamingLevelInfo> LevelsInfo = GetAllStreamingLevelsInfo();
-    UE_LOG(LogTemp, Log, TEXT("Total Streaming Levels: %d"), LevelsInfo.Num());
+    FStagedVisibilityState& NewState = StagedVisibilityLevels.Add(LevelName, State);
+    EnterVisibilityStage(NewState, ELevelVisibilityStage::Loading);
 
-    for (const FStreamingLevelInfo& LevelInfo : LevelsInfo)
-    {
-        UE_LOG(LogTemp, Log, TEXT("  %s - Loaded: %s, Visible: %s"),
-            *LevelInfo.LevelName,
-            LevelInfo.bIsLoaded ? TEXT("Yes") : TEXT("No"),
-            LevelInfo.bShouldBeVisible ? TEXT("Yes") : TEXT("No"));
-    }
+    ScheduleStagedVisibilityTick();
 
-    UE_LOG(LogTemp, Log, TEXT("=== End Streaming Levels Info ==="));
+    UE_LOG(LogTemp, Log, TEXT("Staged visibility started: %s"), *LevelName);
+    return true;
 }
 
-void ULoadSceneManager::PrintAllAsyncRequests()
+ELevelVisibilityStage ULoadSceneManager::GetLevelVisibilityStage(const FString& LevelName) const
 {
-    UE_LOG(LogTemp, Log, TEXT("=== Async Requests ==="));
-    UE_LOG(LogTemp, Log, TEXT("Active Requests: %d"), AsyncRequests.Num());
-
-    for (const auto& RequestPair : AsyncRequests)
-    {
-        const FSceneAsyncLoadRequest& Request = RequestPair.Value;
-        UE_LOG(LogTemp, Log, TEXT("  %s: %s - %s (%.2f%%)"),
-            *Request.RequestId,
-            *Request.SceneName,
-            *UEnum::GetValueAsString(Request.LoadState),
-            Request.Progress * 100.0f);
-    }
-
-    UE_LOG(LogTemp, Log, TEXT("=== End Async Requests ==="));
+    const FStagedVisibilityState* State = StagedVisibilityLevels.Find(LevelName);
+    return State ? State->Stats.Stage : ELevelVisibilityStage::None;
 }
 
-void ULoadSceneManager::PrintAllAvailableMaps()
+bool ULoadSceneManager::GetLevelVisibilityStats(const FString& LevelName, FLevelVisibilityStats& OutStats) const
 {
-    UE_LOG(LogTemp, Log, TEXT("=== Available Maps ==="));
-    UE_LOG(LogTemp, Log, TEXT("Total Maps: %d"), AvailableMaps.Num());
-
-    for (const FMapFileInfo& MapInfo : AvailableMaps)
+    const FStagedVisibilityState* State = StagedVisibilityLevels.Find(LevelName);
+    if (State)
     {
-        UE_LOG(LogTemp, Log, TEXT("  %s -> %s (In Build: %s)"),
-            *MapInfo.MapName,
-            *MapInfo.DisplayName,
-            MapInfo.bIsInBuildSettings ? TEXT("Yes") : TEXT("No"));
+        OutStats = State->Stats;
+        return true;
     }
-
-    UE_LOG(LogTemp, Log, TEXT("=== End Available Maps ==="));
+    return false;
 }
 
-// ========== ͼʲ ==========
+bool ULoadSceneManager::IsStagedVisibilityInProgress(const FString& LevelName) const
+{
+    ELevelVisibilityStage Stage = GetLevelVisibilityStage(LevelName);
+    return Stage != ELevelVisibilityStage::None && Stage != ELevelVisibilityStage::Completed;
+}
 
-TArray<TSoftObjectPtr<UWorld>> ULoadSceneManager::GetAllAvailableMapAssets() const
+void ULoadSceneManager::CancelStagedVisibility(const FString& LevelName)
 {
-    TArray<TSoftObjectPtr<UWorld>> MapAssets;
+    FStagedVisibilityState* State = StagedVisibilityLevels.Find(LevelName);
+    if (!State || !IsStagedVisibilityInProgress(LevelName))
+    {
+        return;
+    }
 
-    for (const FMapFileInfo& MapInfo : AvailableMaps)
+    // 还原尚未处理的Actor，保证下次显示时状态正确
+    for (int32 i = 0; i < State->DeferredCollisionActors.Num(); i++)
     {
-        TSoftObjectPtr<UWorld> MapAsset = TSoftObjectPtr<UWorld>(FSoftObjectPath(MapInfo.MapPath));
-        if (MapAsset.IsValid())
+        if (AActor* Actor = State->DeferredCollisionActors[i].Get())
         {
-            MapAssets.Add(MapAsset);
+            if (State->Stats.Stage != ELevelVisibilityStage::Collision || i >= State->NextActorIndex)
+            {
+                Actor->SetActorEnableCollision(true);
+            }
         }
     }
 
-    return MapAssets;
-}
+    for (int32 i = 0; i < State->DeferredTickActors.Num(); i++)
+    {
+        if (AActor* Actor = State->DeferredTickActors[i].Get())
+        {
+            if (State->Stats.Stage != ELevelVisibilityStage::GameplayBegin || i >= State->NextActorIndex)
+            {
+                Actor->PrimaryActorTick.bStartWithTickEnabled = true;
+                Actor->SetActorTickEnabled(true);
+            }
+        }
+    }
+
+    StagedVisibilityLevels.Remove(LevelName);
+    ApplyAddToWorldBudget();
+
+    UE_LOG(LogTemp, Log, TEXT("Staged visibility cancelled: %s"), *LevelName);
+}
+
+void ULoadSceneManager::ScheduleStagedVisibilityTick()
+{
+    UWorld* World = GetWorld();
+    if (World && !bStagedVisibilityTickScheduled)
+    {
+        World->GetTimerManager().SetTimerForNextTick(this, &ULoadSceneManager::UpdateStagedVisibility);
+        bStagedVisibilityTickScheduled = true;
+    }
+}
+
+void ULoadSceneManager::UpdateStagedVisibility()
+{
+    bStagedVisibilityTickScheduled = false;
+
+    TArray<FString> CompletedLevels;
+    TArray<FString> LostLevels;
+    bool bHasPendingWork = false;
+
+    for (auto& LevelPair : StagedVisibilityLevels)
+    {
+        FStagedVisibilityState& State = LevelPair.Value;
+        if (State.Stats.Stage == ELevelVisibilityStage::Completed)
+        {
+            continue;
+        }
+
+        ULevelStreaming* StreamingLevel = State.StreamingLevel.Get();
+        if (!StreamingLevel)
+        {
+            LostLevels.Add(LevelPair.Key);
+            continue;
+        }
+
+        switch (State.Stats.Stage)
+        {
+        case ELevelVisibilityStage::Loading:
+            if (ULevel* Level = StreamingLevel->GetLoadedLevel())
+            {
+                PrepareStagedLevelActors(State, Level);
+                EnterVisibilityStage(State, ELevelVisibilityStage::RegisterComponents);
+                StreamingLevel->SetShouldBeVisible(true);
+            }
+            break;
+
+        case ELevelVisibilityStage::RegisterComponents:
+            // 组件注册与BeginPlay由引擎在AddToWorld中按时间预算分帧完成
+            State.Stats.RegisterComponents.Frames++;
+            if (StreamingLevel->IsLevelVisible())
+            {
+                EnterVisibilityStage(State, ELevelVisibilityStage::Collision);
+            }
+            break;
+
+        case ELevelVisibilityStage::Collision:
+            if (RunStagedActorSlice(State, State.DeferredCollisionActors, true))
+            {
+                EnterVisibilityStage(State, ELevelVisibilityStage::GameplayBegin);
+            }
+            break;
+
+        case ELevelVisibilityStage::GameplayBegin:
+            if (RunStagedActorSlice(State, State.DeferredTickActors, false))
+            {
+                EnterVisibilityStage(State, ELevelVisibilityStage::Completed);
+                CompletedLevels.Add(LevelPair.Key);
+            }
+            break;
+
+        default:
+            break;
+        }
+
+        if (State.Stats.Stage != ELevelVisibilityStage::Completed)
+        {
+            bHasPendingWork = true;
+        }
+    }
+
+    for (const FString& LevelName : LostLevels)
+    {
+        StagedVisibilityLevels.Remove(LevelName);
+    }
+
+    // 根据仍在注册阶段的关卡更新引擎预算
+    ApplyAddToWorldBudget();
+
+    for (const FString& LevelName : CompletedLevels)
+    {
+        const FLevelVisibilityStats& Stats = StagedVisibilityLevels[LevelName].Stats;
+        UE_LOG(LogTemp, Log, TEXT("Staged visibility completed: %s (%d actors, Register %.2fms/%d frames, Collision %.2fms/%d frames, TickEnable %.2fms/%d frames)"),
+            *LevelName, Stats.ActorCount,
+            Stats.RegisterComponents.WallTimeMs, Stats.RegisterComponents.Frames,
+            Stats.Collision.WorkTimeMs, Stats.Collision.Frames,
+            Stats.GameplayBegin.WorkTimeMs, Stats.GameplayBegin.Frames);
+
+        OnLevelVisibilityStaged.Broadcast(LevelName);
+    }
+
+    if (bHasPendingWork)
+    {
+        ScheduleStagedVisibilityTick();
+    }
+}
+
+void ULoadSceneManager::PrepareStagedLevelActors(FStagedVisibilityState& State, ULevel* Level)
+{
+    State.DeferredCollisionActors.Reset();
+    State.DeferredTickActors.Reset();
+    State.Stats.ActorCount = 0;
+
+    for (AActor* Actor : Level->Actors)
+    {
+        if (!IsValid(Actor))
+        {
+            continue;
+        }
+
+        State.Stats.ActorCount++;
+
+        // 关闭碰撞后注册组件时不会创建物理状态
+        if (State.Budget.bDeferCollision && Actor->GetActorEnableCollision())
+        {
+            Actor->SetActorEnableCollision(false);
+            State.DeferredCollisionActors.Add(Actor);
+        }
+
+        // BeginPlay 时按 bStartWithTickEnabled 决定是否开始Tick
+        if (State.Budget.bDeferActorTick && Actor->PrimaryActorTick.bCanEverTick && Actor->PrimaryActorTick.bStartWithTickEnabled)
+        {
+            Actor->PrimaryActorTick.bStartWithTickEnabled = false;
+            Actor->PrimaryActorTick.SetTickFunctionEnable(false);
+            State.DeferredTickActors.Add(Actor);
+        }
+    }
+}
+
+bool ULoadSceneManager::RunStagedActorSlice(FStagedVisibilityState& State, TArray<TWeakObjectPtr<AActor>>& Actors, bool bCollisionStage)
+{
+    FLevelVisibilityStageTiming& Timing = bCollisionStage ? State.Stats.Collision : State.Stats.GameplayBegin;
+    Timing.Frames++;
+
+    const double SliceStart = FPlatformTime::Seconds();
+    const double TimeLimit = State.Budget.StageTimeLimitMs / 1000.0;
+
+    // 每帧至少处理一个Actor，保证进度
+    while (State.NextActorIndex < Actors.Num())
+    {
+        if (AActor* Actor = Actors[State.NextActorIndex].Get())
+        {
+            if (bCollisionStage)
+            {
+                Actor->SetActorEnableCollision(true);
+            }
+            else
+            {
+                Actor->PrimaryActorTick.bStartWithTickEnabled = true;
+                Actor->SetActorTickEnabled(true);
+            }
+        }
+        State.NextActorIndex++;
+
+        if (FPlatformTime::Seconds() - SliceStart >= TimeLimit)
+        {
+            break;
+        }
+    }
+
+    const float SliceMs = static_cast<float>((FPlatformTime::Seconds() - SliceStart) * 1000.0);
+    Timing.WorkTimeMs += SliceMs;
+    Timing.MaxSliceMs = FMath::Max(Timing.MaxSliceMs, SliceMs);
+
+    return State.NextActorIndex >= Actors.Num();
+}
+
+void ULoadSceneManager::EnterVisibilityStage(FStagedVisibilityState& State, ELevelVisibilityStage NewStage)
+{
+    const double Now = FPlatformTime::Seconds();
+    const float StageMs = static_cast<float>((Now - State.StageStartTime) * 1000.0);
+
+    switch (State.Stats.Stage)
+    {
+    case ELevelVisibilityStage::RegisterComponents:
+        State.Stats.RegisterComponents.WallTimeMs = StageMs;
+        break;
+    case ELevelVisibilityStage::Collision:
+        State.Stats.Collision.WallTimeMs = StageMs;
+        break;
+    case ELevelVisibilityStage::GameplayBegin:
+        State.Stats.GameplayBegin.WallTimeMs = StageMs;
+        break;
+    default:
+        break;
+    }
+
+    State.Stats.Stage = NewStage;
+    State.StageStartTime = Now;
+    State.NextActorIndex = 0;
+}
+
+void ULoadSceneManager::ApplyAddToWorldBudget()
+{
+    float TimeLimitMs = MAX_flt;
+    int32 Granularity = MAX_int32;
+
+    // 引擎只有全局的流送预算，多个关卡同时注册时取最严格的值作为整个世界的上限
+    for (const auto& LevelPair : StagedVisibilityLevels)
+    {
+        const FStagedVisibilityState& State = LevelPair.Value;
+        if (State.Stats.Stage == ELevelVisibilityStage::RegisterComponents)
+        {
+            TimeLimitMs = FMath::Min(TimeLimitMs, State.Budget.AddToWorldTimeLimitMs);
+            Granularity = FMath::Min(Granularity, State.Budget.ComponentRegistrationGranularity);
+        }
+    }
+
+    if (Granularity == MAX_int32)
+    {
+        RestoreStreamingCVars();
+        return;
+    }
+
+    auto SetStreamingCVar = [this](const TCHAR* Name, const FString& Value)
+        {
+            IConsoleVariable* CVar = IConsoleManager::Get().FindConsoleVariable(Name);
+            if (!CVar)
+            {
+                return;
+            }
+
+            if (!SavedStreamingCVars.Contains(Name))
+            {
+                SavedStreamingCVars.Add(Name, CVar->GetString());
+            }
+            CVar->Set(*Value, ECVF_SetByCode);
+        };
+
+    SetStreamingCVar(TEXT("s.LevelStreamingActorsUpdateTimeLimit"), FString::SanitizeFloat(TimeLimitMs));
+    SetStreamingCVar(TEXT("s.LevelStreamingComponentsRegistrationGranularity"), FString::FromInt(Granularity));
+}
+
+void ULoadSceneManager::RestoreStreamingCVars()
+{
+    for (const auto& CVarPair : SavedStreamingCVars)
+    {
+        if (IConsoleVariable* CVar = IConsoleManager::Get().FindConsoleVariable(*CVarPair.Key))
+        {
+            CVar->Set(*CVarPair.Value, ECVF_SetByCode);
+        }
+    }
+    SavedStreamingCVars.Empty();
+}
+
+// ========== 场景预热 ==========
+
+void ULoadSceneManager::RegisterSceneWarmupManifest(const FString& SceneName, USceneWarmupManifest* Manifest)
+{
+    if (SceneName.IsEmpty() || !Manifest)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("RegisterSceneWarmupManifest - Invalid scene name or manifest"));
+        return;
+    }
+
+    WarmupManifests.Add(SceneName, Manifest);
+
+    UE_LOG(LogTemp, Log, TEXT("Registered warmup manifest for scene %s: %d steps"),
+        *SceneName, Manifest->GetTotalStepCount());
+}
+
+void ULoadSceneManager::UnregisterSceneWarmupManifest(const FString& SceneName)
+{
+    WarmupManifests.Remove(SceneName);
+}
+
+bool ULoadSceneManager::HasSceneWarmupManifest(const FString& SceneName) const
+{
+    USceneWarmupManifest* const* Manifest = WarmupManifests.Find(SceneName);
+    return Manifest && *Manifest;
+}
+
+bool ULoadSceneManager::WarmupScene(const FString& SceneName)
+{
+    // 不关联加载请求，直接在当前世界执行全部预热
+    return TryStartSceneWarmup(FString(), SceneName, ESceneLoadMode::Additive, false);
+}
+
+bool ULoadSceneManager::IsSceneWarmupInProgress(const FString& SceneName) const
+{
+    return ActiveWarmups.Contains(SceneName);
+}
+
+float ULoadSceneManager::GetSceneWarmupProgress(const FString& SceneName) const
+{
+    const FSceneWarmupState* State = ActiveWarmups.Find(SceneName);
+    if (!State)
+    {
+        return 0.0f;
+    }
+
+    return State->TotalSteps > 0 ? FMath::Clamp((float)State->CompletedSteps / State->TotalSteps, 0.0f, 1.0f) : 1.0f;
+}
+
+bool ULoadSceneManager::TryStartSceneWarmup(const FString& RequestId, const FString& SceneName, ESceneLoadMode Mode, bool bActivateAfterLoad)
+{
+    USceneWarmupManifest* const* Manifest = WarmupManifests.Find(SceneName);
+    if (!Manifest || !*Manifest || (*Manifest)->IsEmpty() || ActiveWarmups.Contains(SceneName))
+    {
+        return false;
+    }
+
+    if (!GetWorld())
+    {
+        return false;
+    }
+
+    if (Mode == ESceneLoadMode::Additive && !RequestId.IsEmpty())
+    {
+        // 附加模式先只加载不显示，预热与关卡加载并行进行
+        ULevelStreaming* StreamingLevel = GetStreamingLevelByName(SceneName);
+        if (!StreamingLevel)
+        {
+            return false;
+        }
+
+        StreamingLevel->SetShouldBeLoaded(true);
+        StreamingLevel->SetShouldBeVisible(false);
+    }
+
+    FSceneWarmupState State;
+    State.SceneName = SceneName;
+    State.RequestId = RequestId;
+    State.Manifest = *Manifest;
+    State.Mode = Mode;
+    State.bActivateAfterLoad = bActivateAfterLoad;
+    State.TotalSteps = (*Manifest)->GetTotalStepCount();
+    State.StartTime = FPlatformTime::Seconds();
+
+    ActiveWarmups.Add(SceneName, State);
+    ScheduleSceneWarmupTick();
+
+    UE_LOG(LogTemp, Log, TEXT("Scene warmup started: %s (%d steps)"), *SceneName, State.TotalSteps);
+    return true;
+}
+
+void ULoadSceneManager::ScheduleSceneWarmupTick()
+{
+    UWorld* World = GetWorld();
+    if (World && !bSceneWarmupTickScheduled)
+    {
+        World->GetTimerManager().SetTimerForNextTick(this, &ULoadSceneManager::UpdateSceneWarmups);
+        bSceneWarmupTickScheduled = true;
+    }
+}
+
+void ULoadSceneManager::UpdateSceneWarmups()
+{
+    bSceneWarmupTickScheduled = false;
+
+    TArray<FString> FinishedScenes;
+    bool bNeedsTick = false;
+
+    for (auto& WarmupPair : ActiveWarmups)
+    {
+        FSceneWarmupState& State = WarmupPair.Value;
+        if (State.bWaitingForTravel)
+        {
+            continue;
+        }
+
+        const float BudgetMs = State.Manifest.IsValid() ? State.Manifest->FrameBudgetMs : 2.0f;
+        const double Deadline = FPlatformTime::Seconds() + BudgetMs / 1000.0;
+        const bool bWarmupDone = RunSceneWarmupSlice(State, Deadline);
+
+        // 加载请求的进度由预热进度驱动，激活完成时置为1
+        const FSceneAsyncLoadRequest* Request = AsyncRequests.Find(State.RequestId);
+        if (Request && Request->LoadState == ESceneLoadState::Loading && State.TotalSteps > 0)
+        {
+            UpdateAsyncRequestProgress(State.RequestId, 0.9f * State.CompletedSteps / State.TotalSteps);
+        }
+
+        if (bWarmupDone && IsWarmupLevelLoaded(State))
+        {
+            FinishedScenes.Add(WarmupPair.Key);
+        }
+        else
+        {
+            bNeedsTick = true;
+        }
+    }
+
+    for (const FString& SceneName : FinishedScenes)
+    {
+        if (FSceneWarmupState* State = ActiveWarmups.Find(SceneName))
+        {
+            FinishSceneWarmup(*State);
+        }
+    }
+
+    if (bNeedsTick)
+    {
+        ScheduleSceneWarmupTick();
+    }
+}
+
+bool ULoadSceneManager::RunSceneWarmupSlice(FSceneWarmupState& State, double Deadline)
+{
+    USceneWarmupManifest* Manifest = State.Manifest.Get();
+    if (!Manifest)
+    {
+        return true;
+    }
+
+    // 资源与音频不依赖世界，发起异步请求或同步加载
+    UResourceManager* ResourceManager = UResourceManager::GetResourceManager();
+    while (State.ResourceCursor < Manifest->ResourceIDs.Num() && FPlatformTime::Seconds() < Deadline)
+    {
+        const FName& ResourceID = Manifest->ResourceIDs[State.ResourceCursor++];
+        const FString ResourceRequestId = ResourceManager ? ResourceManager->LoadResourceByIDAsync(ResourceID) : FString();
+        if (!ResourceRequestId.IsEmpty())
+        {
+            State.PendingResourceRequests.Add(ResourceRequestId);
+        }
+        else
+        {
+            UE_LOG(LogTemp, Warning, TEXT("Scene warmup %s: resource %s not found"), *State.SceneName, *ResourceID.ToString());
+        }
+        State.CompletedSteps++;
+    }
+
+    while (State.FolderCursor < Manifest->ResourceFolders.Num() && FPlatformTime::Seconds() < Deadline)
+    {
+        const FString& FolderPath = Manifest->ResourceFolders[State.FolderCursor++];
+        const FString ResourceRequestId = ResourceManager ? ResourceManager->LoadResourcesInFolderAsync(FolderPath) : FString();
+        if (!ResourceRequestId.IsEmpty())
+        {
+            State.PendingResourceRequests.Add(ResourceRequestId);
+        }
+        State.CompletedSteps++;
+    }
+
+    // 音频只发起异步预热，加载完成前计入未完成的请求
+    UAudioManager* AudioManager = UAudioManager::GetAudioManager();
+    TArray<FName> SoundsToPrewarm;
+    while (State.SoundCursor < Manifest->SoundIDs.Num() && FPlatformTime::Seconds() < Deadline)
+    {
+        SoundsToPrewarm.Add(Manifest->SoundIDs[State.SoundCursor++]);
+        State.CompletedSteps++;
+    }
+
+    if (AudioManager && SoundsToPrewarm.Num() > 0)
+    {
+        AudioManager->PrewarmSounds(SoundsToPrewarm);
+        State.PendingSounds.Append(SoundsToPrewarm);
+    }
+
+    // 对象池与UI需要目标世界，单场景切换时等切换完成后再执行
+    const bool bTravel = State.Mode == ESceneLoadMode::Single && !State.RequestId.IsEmpty();
+    if (!bTravel || State.bWorldBoundStarted)
+    {
+        UObjectPoolManager* PoolManager = UObjectPoolManager::GetObjectPoolManager();
+        int32 SpawnedThisFrame = 0;
+        while (State.PoolCursor < Manifest->PoolPreloads.Num() && FPlatformTime::Seconds() < Deadline
+            && SpawnedThisFrame < Manifest->MaxPoolSpawnsPerFrame)
+        {
+            const FPoolWarmupEntry& Entry = Manifest->PoolPreloads[State.PoolCursor];
+            if (!Entry.ActorClass || Entry.Count <= 0 || !PoolManager)
+            {
+                if (Entry.ActorClass && Entry.Count > 0)
+                {
+                    State.CompletedSteps += Entry.Count - State.PoolSpawned;
+                }
+                State.PoolCursor++;
+                State.PoolSpawned = 0;
+                continue;
+            }
+
+            // 每次只生成一个，按帧预算分摊到多帧
+            PoolManager->Preload(Entry.ActorClass, 1);
+            State.PoolSpawned++;
+            State.CompletedSteps++;
+            SpawnedThisFrame++;
+
+            if (State.PoolSpawned >= Entry.Count)
+            {
+                State.PoolCursor++;
+                State.PoolSpawned = 0;
+            }
+        }
+
+        UUIManager* UIManager = UUIManager::GetUIManager();
+        while (State.UICursor < Manifest->UINames.Num() && FPlatformTime::Seconds() < Deadline)
+        {
+            const FName& UIName = Manifest->UINames[State.UICursor++];
+            if (UIManager)
+            {
+                UIManager->PreloadUIs({ UIName });
+            }
+            State.CompletedSteps++;
+        }
+    }
+
+    // 清理已结束的资源请求
+    State.PendingResourceRequests.RemoveAll([ResourceManager](const FString& ResourceRequestId)
+        {
+            return !ResourceManager || ResourceManager->GetAsyncRequestState(ResourceRequestId) != EResourceLoadState::Loading;
+        });
+    State.PendingSounds.RemoveAll([AudioManager](FName SoundID)
+        {
+            return !AudioManager || !AudioManager->IsSoundLoading(SoundID);
+        });
+
+    const bool bAssetsDone = State.ResourceCursor >= Manifest->ResourceIDs.Num()
+        && State.FolderCursor >= Manifest->ResourceFolders.Num()
+        && State.SoundCursor >= Manifest->SoundIDs.Num()
+        && State.PendingResourceRequests.Num() == 0
+        && State.PendingSounds.Num() == 0;
+
+    if (bTravel && !State.bWorldBoundStarted)
+    {
+        return bAssetsDone;
+    }
+
+    return bAssetsDone
+        && State.PoolCursor >= Manifest->PoolPreloads.Num()
+        && State.UICursor >= Manifest->UINames.Num();
+}
+
+bool ULoadSceneManager::IsWarmupLevelLoaded(const FSceneWarmupState& State) const
+{
+    if (State.Mode != ESceneLoadMode::Additive || State.RequestId.IsEmpty())
+    {
+        return true;
+    }
+
+    ULevelStreaming* StreamingLevel = GetStreamingLevelByName(State.SceneName);
+    return !StreamingLevel || StreamingLevel->IsLevelLoaded();
+}
+
+void ULoadSceneManager::FinishSceneWarmup(FSceneWarmupState& State)
+{
+    const FString SceneName = State.SceneName;
+    const bool bTravel = State.Mode == ESceneLoadMode::Single && !State.RequestId.IsEmpty();
+
+    if (bTravel && !State.bWorldBoundStarted)
+    {
+        // 资源预热完成后才切换场景
+        if (UWorld* World = GetWorld())
+        {
+            UGameplayStatics::OpenLevel(World, FName(*SceneName));
+        }
+        CompleteAsyncRequest(State.RequestId, true);
+
+        USceneWarmupManifest* Manifest = State.Manifest.Get();
+        if (Manifest && (Manifest->PoolPreloads.Num() > 0 || Manifest->UINames.Num() > 0))
+        {
+            State.bWaitingForTravel = true;
+            if (!PostLoadMapHandle.IsValid())
+            {
+                PostLoadMapHandle = FCoreUObjectDelegates::PostLoadMapWithWorld.AddUObject(this, &ULoadSceneManager::HandlePostLoadMap);
+            }
+            return;
+        }
+    }
+    else if (State.Mode == ESceneLoadMode::Additive && !State.RequestId.IsEmpty())
+    {
+        // 关卡已加载且预热完成，再按需激活
+        if (State.bActivateAfterLoad)
+        {
+            if (HasLevelVisibilityBudget(SceneName))
+            {
+                MakeStreamingLevelVisibleStaged(SceneName);
+            }
+            else
+            {
+                SetStreamingLevelVisible(SceneName, true);
+            }
+        }
+        CompleteAsyncRequest(State.RequestId, true);
+    }
+
+    UE_LOG(LogTemp, Log, TEXT("Scene warmup completed: %s, %d steps in %.2fms"),
+        *SceneName, State.CompletedSteps, (FPlatformTime::Seconds() - State.StartTime) * 1000.0);
+
+    ActiveWarmups.Remove(SceneName);
+    OnSceneWarmupComplete.Broadcast(SceneName);
+}
+
+void ULoadSceneManager::HandlePostLoadMap(UWorld* LoadedWorld)
+{
+    const FString LoadedMapName = LoadedWorld ? UWorld::RemovePIEPrefix(LoadedWorld->GetMapName()) : FString();
+
+    TArray<FString> AbandonedScenes;
+
+    for (auto& WarmupPair : ActiveWarmups)
+    {
+        FSceneWarmupState& State = WarmupPair.Value;
+        if (!State.bWaitingForTravel)
+        {
+            continue;
+        }
+
+        if (LoadedMapName == State.SceneName)
+        {
+            State.bWaitingForTravel = false;
+            State.bWorldBoundStarted = true;
+        }
+        else
+        {
+            // 切换到了其他地图（如切换失败回退），放弃剩余预热
+            AbandonedScenes.Add(WarmupPair.Key);
+        }
+    }
+
+    for (const FString& SceneName : AbandonedScenes)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("Scene warmup abandoned: %s (loaded %s)"), *SceneName, *LoadedMapName);
+        ActiveWarmups.Remove(SceneName);
+    }
+
+    FCoreUObjectDelegates::PostLoadMapWithWorld.Remove(PostLoadMapHandle);
+    PostLoadMapHandle.Reset();
+
+    // 旧世界的计时器已随切换销毁，在新世界重新调度
+    bSceneWarmupTickScheduled = false;
+    if (ActiveWarmups.Num() > 0)
+    {
+        ScheduleSceneWarmupTick();
+    }
+}
+
+// ========== 地图文件管理 ==========
+
+TArray<FMapFileInfo> ULoadSceneManager::GetAllAvailableMaps() const
+{
+    return AvailableMaps;
+}
+
+TArray<FMapFileInfo> ULoadSceneManager::FindMapsInFolder(const FString& FolderPath) const
+{
+    TArray<int32> MapIndices;
+    CollectMapsInFolder(FolderPath, MapIndices);
+
+    TArray<FMapFileInfo> FoundMaps;
+    FoundMaps.Reserve(MapIndices.Num());
+    for (int32 MapIndex : MapIndices)
+    {
+        FoundMaps.Add(AvailableMaps[MapIndex]);
+    }
+
+    return FoundMaps;
+}
+
+bool ULoadSceneManager::DoesMapFileExist(const FString& MapPath) const
+{
+    // 检查是否在可用地图列表中
+    return FindMapByPath(SanitizeMapPath(MapPath)) != nullptr;
+}
+
+FString ULoadSceneManager::GetMapDisplayName(const FString& MapPath) const
+{
+    const FMapFileInfo* MapInfo = FindMapByPath(SanitizeMapPath(MapPath));
+    return MapInfo ? MapInfo->DisplayName : FString();
+}
+
+void ULoadSceneManager::RebuildMapCatalog()
+{
+    ScanForMapFiles();
+    SaveMapCatalogToDisk();
+}
+
+// ========== 场景信息查询 ==========
+
+FString ULoadSceneManager::GetCurrentSceneName() const
+{
+    UWorld* World = GetWorld();
+    if (!World)
+    {
+        return FString();
+    }
+    return World->GetMapName();
+}
+
+FString ULoadSceneManager::GetCurrentScenePath() const
+{
+    UWorld* World = GetWorld();
+    if (!World)
+    {
+        return FString();
+    }
+    return World->GetOutermost()->GetName();
+}
+
+int32 ULoadSceneManager::GetCurrentSceneIndex() const
+{
+    FString CurrentScene = GetCurrentSceneName();
+    return GetSceneIndexFromName(CurrentScene);
+}
+
+int32 ULoadSceneManager::GetSceneCount() const
+{
+    // 返回可用地图数量
+    return AvailableMaps.Num();
+}
+
+FSceneInfo ULoadSceneManager::GetSceneInfo(int32 SceneIndex) const
+{
+    FSceneInfo Info;
+
+    if (IsValidSceneIndex(SceneIndex))
+    {
+        Info.SceneName = GetSceneNameFromIndex(SceneIndex);
+        Info.BuildIndex = SceneIndex;
+
+        // 查找对应的地图信息
+        if (const FMapFileInfo* MapInfo = FindMapByName(Info.SceneName))
+        {
+            Info.ScenePath = MapInfo->MapPath;
+            Info.LoadState = ESceneLoadState::Loaded; // 简化处理
+        }
+    }
+
+    return Info;
+}
+
+bool ULoadSceneManager::IsSceneIndexValid(int32 SceneIndex) const
+{
+    return SceneIndex >= 0 && SceneIndex < GetSceneCount();
+}
+
+bool ULoadSceneManager::DoesSceneExist(const FString& SceneName) const
+{
+    return MapIndexByName.Contains(SceneName);
+}
+
+TArray<FString> ULoadSceneManager::GetAllLoadedScenes() const
+{
+    TArray<FString> LoadedScenes;
+
+    UWorld* World = GetWorld();
+    if (!World)
+    {
+        return LoadedScenes;
+    }
+
+    // 添加主场景
+    LoadedScenes.Add(GetCurrentSceneName());
+
+    // 添加流送场景
+    for (ULevelStreaming* StreamingLevel : World->GetStreamingLevels())
+    {
+        if (StreamingLevel && StreamingLevel->IsLevelLoaded())
+        {
+            LoadedScenes.Add(StreamingLevel->GetWorldAssetPackageName());
+        }
+    }
+
+    return LoadedScenes;
+}
+
+TArray<AActor*> ULoadSceneManager::GetRootActorsInScene(const FString& SceneName) const
+{
+    TArray<AActor*> RootActors;
+    AppendRootActorsInScene(SceneName, RootActors);
+    return RootActors;
+}
+
+TArray<AActor*> ULoadSceneManager::GetRootActorsInAllLoadedScenes() const
+{
+    TArray<AActor*> AllRootActors;
+    AppendRootActorsInAllLoadedScenes(AllRootActors);
+    return AllRootActors;
+}
+
+int32 ULoadSceneManager::AppendRootActorsInScene(const FString& SceneName, TArray<AActor*>& OutActors) const
+{
+    const int32 StartNum = OutActors.Num();
+    ForEachRootActorInLevel(GetSceneLevel(SceneName), [&OutActors](AActor* Actor) { OutActors.Add(Actor); });
+    return OutActors.Num() - StartNum;
+}
+
+int32 ULoadSceneManager::AppendRootActorsInAllLoadedScenes(TArray<AActor*>& OutActors) const
+{
+    UWorld* World = GetWorld();
+    if (!World)
+    {
+        return 0;
+    }
+
+    const int32 StartNum = OutActors.Num();
+    AppendRootActorsInScene(GetCurrentSceneName(), OutActors);
+
+    for (ULevelStreaming* StreamingLevel : World->GetStreamingLevels())
+    {
+        if (StreamingLevel)
+        {
+            ForEachRootActorInLevel(StreamingLevel->GetLoadedLevel(), [&OutActors](AActor* Actor) { OutActors.Add(Actor); });
+        }
+    }
+
+    return OutActors.Num() - StartNum;
+}
+
+void ULoadSceneManager::ForEachRootActorInScene(const FString& SceneName, TFunctionRef<void(AActor*)> Visitor) const
+{
+    ForEachRootActorInLevel(GetSceneLevel(SceneName), Visitor);
+}
+
+// ========== 根Actor查询 ==========
+
+ULevel* ULoadSceneManager::GetSceneLevel(const FString& SceneName) const
+{
+    UWorld* World = GetWorld();
+    if (!World)
+    {
+        return nullptr;
+    }
+
+    if (SceneName == GetCurrentSceneName())
+    {
+        return World->PersistentLevel;
+    }
+
+    ULevelStreaming* StreamingLevel = GetStreamingLevelByName(SceneName);
+    return StreamingLevel ? StreamingLevel->GetLoadedLevel() : nullptr;
+}
+
+void ULoadSceneManager::ForEachRootActorInLevel(ULevel* Level, TFunctionRef<void(AActor*)> Visitor)
+{
+    if (!Level)
+    {
+        return;
+    }
+
+    // 直接遍历关卡自身的Actor数组，不扫描整个世界，也不维护额外索引
+    for (AActor* Actor : Level->Actors)
+    {
+        if (IsValid(Actor) && !Actor->GetAttachParentActor())
+        {
+            Visitor(Actor);
+        }
+    }
+}
+
+// ========== 异步请求管理 ==========
+
+ESceneLoadState ULoadSceneManager::GetAsyncRequestState(const FString& RequestId) const
+{
+    const FSceneAsyncLoadRequest* Request = AsyncRequests.Find(RequestId);
+    return Request ? Request->LoadState : ESceneLoadState::Failed;
+}
+
+float ULoadSceneManager::GetAsyncRequestProgress(const FString& RequestId) const
+{
+    const FSceneAsyncLoadRequest* Request = AsyncRequests.Find(RequestId);
+    return Request ? Request->Progress : 0.0f;
+}
+
+void ULoadSceneManager::CancelAsyncRequest(const FString& RequestId)
+{
+    const FString CancelledRequestId = RequestId;
+    const FSceneAsyncLoadRequest* Request = AsyncRequests.Find(CancelledRequestId);
+    const bool bWasLoading = Request && Request->LoadState == ESceneLoadState::Loading;
+
+    StopProgressTimer(RequestId);
+
+    for (auto It = ActiveWarmups.CreateIterator(); It; ++It)
+    {
+        if (It.Value().RequestId == RequestId)
+        {
+            It.RemoveCurrent();
+        }
+    }
+
+    AsyncRequests.Remove(CancelledRequestId);
+    LoadCallbacks.Remove(CancelledRequestId);
+    UnloadCallbacks.Remove(CancelledRequestId);
+
+    // 通知等待该请求的C++逻辑
+    if (bWasLoading)
+    {
+        OnSceneRequestFinishedNative.Broadcast(CancelledRequestId, false);
+    }
+}
+
+// ========== 调试工具 ==========
+
+void ULoadSceneManager::PrintAllScenesInfo()
+{
+    UE_LOG(LogTemp, Log, TEXT("=== All Scenes Info ==="));
+
+    int32 SceneCount = GetSceneCount();
+    UE_LOG(LogTemp, Log, TEXT("Total Scenes: %d"), SceneCount);
+
+    for (int32 i = 0; i < SceneCount; i++)
+    {
+        FSceneInfo Info = GetSceneInfo(i);
+        UE_LOG(LogTemp, Log, TEXT("  [%d] %s - %s"), i, *Info.SceneName, *UEnum::GetValueAsString(Info.LoadState));
+    }
+
+    UE_LOG(LogTemp, Log, TEXT("=== End Scenes Info ==="));
+}
+
+void ULoadSceneManager::PrintAllStreamingLevelsInfo()
+{
+    UE_LOG(LogTemp, Log, TEXT("=== Streaming Levels Info ==="));
+
+    TArray<FStreamingLevelInfo> LevelsInfo = GetAllStreamingLevelsInfo();
+    UE_LOG(LogTemp, Log, TEXT("Total Streaming Levels: %d"), LevelsInfo.Num());
 
-TArray<TSoftObjectPtr<UWorld>> ULoadSceneManager::FindMapAssetsInFolder(const FString& FolderPath) const
+    for (const FStreamingLevelInfo& LevelInfo : LevelsInfo)
+    {
+        UE_LOG(LogTemp, Log, TEXT("  %s - Loaded: %s, Visible: %s"),
+            *LevelInfo.LevelName,
+            LevelInfo.bIsLoaded ? TEXT("Yes") : TEXT("No"),
+            LevelInfo.bShouldBeVisible ? TEXT("Yes") : TEXT("No"));
+    }
+
+    UE_LOG(LogTemp, Log, TEXT("=== End Streaming Levels Info ==="));
+}
+
+void ULoadSceneManager::PrintAllAsyncRequests()
 {
-    TArray<TSoftObjectPtr<UWorld>> FoundMapAssets;
-    FString SanitizedPath = SanitizeMapPath(FolderPath);
+    UE_LOG(LogTemp, Log, TEXT("=== Async Requests ==="));
+    UE_LOG(LogTemp, Log, TEXT("Active Requests: %d"), AsyncRequests.Num());
+
+    for (const auto& RequestPair : AsyncRequests)
+    {
+        const FSceneAsyncLoadRequest& Request = RequestPair.Value;
+        UE_LOG(LogTemp, Log, TEXT("  %s: %s - %s (%.2f%%)"),
+            *Request.RequestId,
+            *Request.SceneName,
+            *UEnum::GetValueAsString(Request.LoadState),
+            Request.Progress * 100.0f);
+    }
+
+    UE_LOG(LogTemp, Log, TEXT("=== End Async Requests ==="));
+}
+
+void ULoadSceneManager::PrintAllAvailableMaps()
+{
+    UE_LOG(LogTemp, Log, TEXT("=== Available Maps ==="));
+    UE_LOG(LogTemp, Log, TEXT("Total Maps: %d"), AvailableMaps.Num());
 
     for (const FMapFileInfo& MapInfo : AvailableMaps)
     {
-        if (MapInfo.MapPath.StartsWith(SanitizedPath))
+        UE_LOG(LogTemp, Log, TEXT("  %s -> %s (In Build: %s)"),
+            *MapInfo.MapName,
+            *MapInfo.DisplayName,
+            MapInfo.bIsInBuildSettings ? TEXT("Yes") : TEXT("No"));
+    }
+
+    UE_LOG(LogTemp, Log, TEXT("=== End Available Maps ==="));
+}
+
+void ULoadSceneManager::PrintStreamingSchedulerInfo()
+{
+    UE_LOG(LogTemp, Log, TEXT("=== Streaming Scheduler ==="));
+    UE_LOG(LogTemp, Log, TEXT("Running: %s, Levels: %d, In-Flight Loads: %d/%d"),
+        bStreamingSchedulerRunning ? TEXT("Yes") : TEXT("No"),
+        ProximityLevels.Num(),
+        GetInFlightLoadCount(),
+        SchedulerSettings.MaxConcurrentLoads);
+
+    for (const auto& LevelPair : ProximityLevels)
+    {
+        const FProximityStreamingLevelState& State = LevelPair.Value;
+        const ULevelStreaming* StreamingLevel = State.StreamingLevel.Get();
+        UE_LOG(LogTemp, Log, TEXT("  %s - Distance: %.0f, Wants Loaded: %s, Wants Visible: %s, Loaded: %s"),
+            *LevelPair.Key,
+            State.LastDistance,
+            State.bWantsLoaded ? TEXT("Yes") : TEXT("No"),
+            State.bWantsVisible ? TEXT("Yes") : TEXT("No"),
+            (StreamingLevel && StreamingLevel->IsLevelLoaded()) ? TEXT("Yes") : TEXT("No"));
+    }
+
+    UE_LOG(LogTemp, Log, TEXT("=== End Streaming Scheduler ==="));
+}
+
+void ULoadSceneManager::PrintLevelVisibilityStats()
+{
+    UE_LOG(LogTemp, Log, TEXT("=== Level Visibility Stats ==="));
+
+    for (const auto& LevelPair : StagedVisibilityLevels)
+    {
+        const FLevelVisibilityStats& Stats = LevelPair.Value.Stats;
+        UE_LOG(LogTemp, Log, TEXT("  %s - %s, Actors: %d"),
+            *Stats.LevelName, *UEnum::GetValueAsString(Stats.Stage), Stats.ActorCount);
+        UE_LOG(LogTemp, Log, TEXT("    Register: %.2fms wall, %d frames"),
+            Stats.RegisterComponents.WallTimeMs, Stats.RegisterComponents.Frames);
+        UE_LOG(LogTemp, Log, TEXT("    Collision: %.2fms work (max slice %.2fms), %d frames"),
+            Stats.Collision.WorkTimeMs, Stats.Collision.MaxSliceMs, Stats.Collision.Frames);
+        UE_LOG(LogTemp, Log, TEXT("    TickEnable: %.2fms work (max slice %.2fms), %d frames"),
+            Stats.GameplayBegin.WorkTimeMs, Stats.GameplayBegin.MaxSliceMs, Stats.GameplayBegin.Frames);
+    }
+
+    UE_LOG(LogTemp, Log, TEXT("=== End Level Visibility Stats ==="));
+}
+
+void ULoadSceneManager::PrintSceneWarmupInfo()
+{
+    UE_LOG(LogTemp, Log, TEXT("=== Scene Warmup Info ==="));
+    UE_LOG(LogTemp, Log, TEXT("Registered Manifests: %d"), WarmupManifests.Num());
+
+    for (const auto& ManifestPair : WarmupManifests)
+    {
+        const USceneWarmupManifest* Manifest = ManifestPair.Value;
+        if (!Manifest)
         {
-            TSoftObjectPtr<UWorld> MapAsset = TSoftObjectPtr<UWorld>(FSoftObjectPath(MapInfo.MapPath));
-            if (MapAsset.IsValid())
-            {
-                FoundMapAssets.Add(MapAsset);
-            }
+            continue;
+        }
+
+        UE_LOG(LogTemp, Log, TEXT("  %s - Pools: %d, UI: %d, Sounds: %d, Resources: %d, Folders: %d, Budget: %.2fms"),
+            *ManifestPair.Key, Manifest->PoolPreloads.Num(), Manifest->UINames.Num(), Manifest->SoundIDs.Num(),
+            Manifest->ResourceIDs.Num(), Manifest->ResourceFolders.Num(), Manifest->FrameBudgetMs);
+    }
+
+    for (const auto& WarmupPair : ActiveWarmups)
+    {
+        const FSceneWarmupState& State = WarmupPair.Value;
+        UE_LOG(LogTemp, Log, TEXT("  [Active] %s - %d/%d steps, Pending Resources: %d%s"),
+            *State.SceneName, State.CompletedSteps, State.TotalSteps, State.PendingResourceRequests.Num(),
+            State.bWaitingForTravel ? TEXT(", Waiting For Travel") : TEXT(""));
+    }
+
+    UE_LOG(LogTemp, Log, TEXT("=== End Scene Warmup Info ==="));
+}
+
+// ========== 地图资产管理 ==========
+
+TArray<TSoftObjectPtr<UWorld>> ULoadSceneManager::GetAllAvailableMapAssets() const
+{
+    TArray<TSoftObjectPtr<UWorld>> MapAssets;
+
+    for (const FMapFileInfo& MapInfo : AvailableMaps)
+    {
+        TSoftObjectPtr<UWorld> MapAsset = TSoftObjectPtr<UWorld>(FSoftObjectPath(MapInfo.MapPath));
+        if (MapAsset.IsValid())
+        {
+            MapAssets.Add(MapAsset);
+        }
+    }
+
+    return MapAssets;
+}
+
+TArray<TSoftObjectPtr<UWorld>> ULoadSceneManager::FindMapAssetsInFolder(const FString& FolderPath) const
+{
+    TArray<int32> MapIndices;
+    CollectMapsInFolder(FolderPath, MapIndices);
+
+    TArray<TSoftObjectPtr<UWorld>> FoundMapAssets;
+    for (int32 MapIndex : MapIndices)
+    {
+        TSoftObjectPtr<UWorld> MapAsset = TSoftObjectPtr<UWorld>(FSoftObjectPath(AvailableMaps[MapIndex].MapPath));
+        if (MapAsset.IsValid())
+        {
+            FoundMapAssets.Add(MapAsset);
         }
     }
 
@@ -1023,30 +2202,30 @@ FString ULoadSceneManager::GetMapAssetDisplayName(const TSoftObjectPtr<UWorld>&
     return FString();
 }
 
-// ========== Ļصʵ ==========
+// ========== 完整的回调函数实现 ==========
 
 void ULoadSceneManager::OnAsyncLoadComplete()
 {
-    // ȡô˺LatentActionUUID
+    // 获取调用此函数的LatentAction的UUID
     UWorld* World = GetWorld();
     if (!World)
     {
         return;
     }
 
-    // ͨǰִĻȡUUID
+    // 通过当前执行上下文获取UUID
     int32 CurrentUUID = 0;
 
-    // 첽ҵƥUUID
+    // 遍历所有异步请求，找到匹配的UUID
     for (auto& RequestPair : AsyncRequests)
     {
         FSceneAsyncLoadRequest& Request = RequestPair.Value;
 
-        // ǷӦ
+        // 检查这个请求是否应该完成
         if (Request.LoadState == ESceneLoadState::Loading)
         {
-            // ʵĿУӦüʵʵļ״̬
-            // 򻯴سɹ
+            // 在实际项目中，这里应该检查实际的加载状态
+            // 简化处理：假设加载成功
             CompleteAsyncRequest(Request.RequestId, true);
             break;
         }
@@ -1055,26 +2234,26 @@ void ULoadSceneManager::OnAsyncLoadComplete()
 
 void ULoadSceneManager::OnAsyncUnloadComplete()
 {
-    // ȡô˺LatentActionUUID
+    // 获取调用此函数的LatentAction的UUID
     UWorld* World = GetWorld();
     if (!World)
     {
         return;
     }
 
-    // ͨǰִĻȡUUID
+    // 通过当前执行上下文获取UUID
     int32 CurrentUUID = 0;
 
-    // 첽ҵƥUUID
+    // 遍历所有异步请求，找到匹配的UUID
     for (auto& RequestPair : AsyncRequests)
     {
         FSceneAsyncLoadRequest& Request = RequestPair.Value;
 
-        // ǷӦ
+        // 检查这个请求是否应该完成
         if (Request.LoadState == ESceneLoadState::Loading)
         {
-            // ʵĿУӦüʵʵж״̬
-            // 򻯴жسɹ
+            // 在实际项目中，这里应该检查实际的卸载状态
+            // 简化处理：假设卸载成功
             CompleteAsyncRequest(Request.RequestId, true);
             break;
         }
@@ -1083,14 +2262,14 @@ void ULoadSceneManager::OnAsyncUnloadComplete()
 
 void ULoadSceneManager::OnStreamingLevelLoaded()
 {
-    // ȡ¼͹ؿ
+    // 获取触发此事件的流送关卡
     UWorld* World = GetWorld();
     if (!World)
     {
         return;
     }
 
-    // Ҹոռɵ͹ؿ
+    // 查找刚刚加载完成的流送关卡
     for (ULevelStreaming* StreamingLevel : World->GetStreamingLevels())
     {
         if (StreamingLevel && StreamingLevel->IsLevelLoaded())
@@ -1098,7 +2277,7 @@ void ULoadSceneManager::OnStreamingLevelLoaded()
             FString LevelName = StreamingLevel->GetWorldAssetPackageName();
             UE_LOG(LogTemp, Log, TEXT("Streaming level loaded: %s"), *LevelName);
 
-            // ӶĴ߼֪ͨϵͳ
+            // 这里可以添加额外的处理逻辑，比如通知其他系统
             break;
         }
     }
@@ -1106,14 +2285,14 @@ void ULoadSceneManager::OnStreamingLevelLoaded()
 
 void ULoadSceneManager::OnStreamingLevelUnloaded()
 {
-    // ȡ¼͹ؿ
+    // 获取触发此事件的流送关卡
     UWorld* World = GetWorld();
     if (!World)
     {
         return;
     }
 
-    // Ҹոжص͹ؿ
+    // 查找刚刚卸载的流送关卡
     for (ULevelStreaming* StreamingLevel : World->GetStreamingLevels())
     {
         if (StreamingLevel && !StreamingLevel->IsLevelLoaded())
@@ -1121,13 +2300,13 @@ void ULoadSceneManager::OnStreamingLevelUnloaded()
             FString LevelName = StreamingLevel->GetWorldAssetPackageName();
             UE_LOG(LogTemp, Log, TEXT("Streaming level unloaded: %s"), *LevelName);
 
-            // ӶĴ߼֪ͨϵͳ
+            // 这里可以添加额外的处理逻辑，比如通知其他系统
             break;
         }
     }
 }
 
-// ========== ڲʵ ==========
+// ========== 内部实现 ==========
 
 FString ULoadSceneManager::GenerateRequestId() const
 {
@@ -1150,14 +2329,8 @@ FString ULoadSceneManager::GetSceneNameFromIndex(int32 SceneIndex) const
 
 int32 ULoadSceneManager::GetSceneIndexFromName(const FString& SceneName) const
 {
-    for (int32 i = 0; i < AvailableMaps.Num(); i++)
-    {
-        if (AvailableMaps[i].MapName == SceneName)
-        {
-            return i;
-        }
-    }
-    return -1;
+    const int32* MapIndex = MapIndexByName.Find(SceneName);
+    return MapIndex ? *MapIndex : -1;
 }
 
 void ULoadSceneManager::UpdateAsyncRequestProgress(const FString& RequestId, float Progress)
@@ -1184,7 +2357,7 @@ void ULoadSceneManager::CompleteAsyncRequest(const FString& RequestId, bool bSuc
         {
             OnSceneLoadComplete.Broadcast(RequestId);
 
-            // ִлص
+            // 执行回调
             FOnSceneLoadedCallback* Callback = LoadCallbacks.Find(RequestId);
             if (Callback && Callback->IsBound())
             {
@@ -1200,7 +2373,9 @@ void ULoadSceneManager::CompleteAsyncRequest(const FString& RequestId, bool bSuc
                 *RequestId, *Request->SceneName);
         }
 
-        LoadCallbacks.Remove(RequestId);
+        const FString FinishedRequestId = RequestId;
+        LoadCallbacks.Remove(FinishedRequestId);
+        OnSceneRequestFinishedNative.Broadcast(FinishedRequestId, bSuccess);
     }
 }
 
@@ -1220,10 +2395,10 @@ FString ULoadSceneManager::ExtractMapNameFromFullPath(const FString& FullPath) c
 {
     FString CleanPath = FullPath;
 
-    // Ƴ .umap ׺
+    // 移除 .umap 后缀
     CleanPath.RemoveFromEnd(TEXT(".umap"));
 
-    // һб
+    // 查找最后一个斜杠
     int32 LastSlash = 0;
     if (CleanPath.FindLastChar('/', LastSlash))
     {
@@ -1237,11 +2412,11 @@ FString ULoadSceneManager::SanitizeMapPath(const FString& MapPath) const
 {
     FString SanitizedPath = MapPath;
 
-    // Ƴǰ׺ͺ׺
+    // 移除多余的前缀和后缀
     SanitizedPath.RemoveFromStart(TEXT("/Game/"));
     SanitizedPath.RemoveFromEnd(TEXT("."));
 
-    // ȷ·ϷݸĿ¼ʼ
+    // 确保路径以游戏内容根目录开始
     if (!SanitizedPath.StartsWith(TEXT("/Game/")))
     {
         SanitizedPath = TEXT("/Game/") + SanitizedPath;
@@ -1254,13 +2429,13 @@ FString ULoadSceneManager::ExtractMapNameFromPath(const FString& MapPath) const
 {
     FString CleanPath = MapPath;
 
-    // Ƴ·ǰ׺
+    // 移除路径前缀
     if (CleanPath.StartsWith(TEXT("/Game/")))
     {
-        CleanPath = CleanPath.RightChop(6); // Ƴ "/Game/"
+        CleanPath = CleanPath.RightChop(6); // 移除 "/Game/"
     }
 
-    // һб
+    // 查找最后一个斜杠
     int32 LastSlash = 0;
     if (CleanPath.FindLastChar('/', LastSlash))
     {
@@ -1307,26 +2482,331 @@ void ULoadSceneManager::ScanForMapFiles()
     FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
     IAssetRegistry& AssetRegistry = AssetRegistryModule.Get();
 
-    // еͼʲ
+    // 搜索所有地图资产
     TArray<FAssetData> MapAssets;
     AssetRegistry.GetAssetsByClass(FTopLevelAssetPath(TEXT("/Script/Engine"), TEXT("World")), MapAssets);
 
+    AvailableMaps.Reserve(MapAssets.Num());
     for (const FAssetData& AssetData : MapAssets)
     {
-        FMapFileInfo MapInfo;
-        MapInfo.MapPath = AssetData.GetObjectPathString();
-        MapInfo.MapName = ExtractMapNameFromPath(MapInfo.MapPath);
-        MapInfo.DisplayName = AssetData.AssetName.ToString();
-        MapInfo.bIsInBuildSettings = true; // 򻯴
-
+        FMapFileInfo MapInfo = MakeMapFileInfo(AssetData);
         AvailableMaps.Add(MapInfo);
 
         UE_LOG(LogTemp, Verbose, TEXT("Found map asset: %s -> %s"), *MapInfo.MapName, *MapInfo.DisplayName);
     }
 
+    RebuildMapIndices();
+
     UE_LOG(LogTemp, Log, TEXT("Scanned %d available maps"), AvailableMaps.Num());
 }
 
+FMapFileInfo ULoadSceneManager::MakeMapFileInfo(const FAssetData& AssetData) const
+{
+    FMapFileInfo MapInfo;
+    MapInfo.MapPath = AssetData.GetObjectPathString();
+    MapInfo.MapName = ExtractMapNameFromPath(MapInfo.MapPath);
+    MapInfo.DisplayName = AssetData.AssetName.ToString();
+    MapInfo.bIsInBuildSettings = true; // 简化处理
+    return MapInfo;
+}
+
+// ========== 地图目录索引 ==========
+
+void ULoadSceneManager::RebuildMapIndices()
+{
+    MapIndexByName.Empty(AvailableMaps.Num());
+    MapIndexByPath.Empty(AvailableMaps.Num());
+    MapIndicesByFolder.Empty();
+
+    for (int32 i = 0; i < AvailableMaps.Num(); i++)
+    {
+        IndexMapEntry(i);
+    }
+}
+
+void ULoadSceneManager::IndexMapEntry(int32 MapIndex)
+{
+    const FMapFileInfo& MapInfo = AvailableMaps[MapIndex];
+
+    // 同名地图保留第一个，与原先的线性查找结果一致
+    if (!MapIndexByName.Contains(MapInfo.MapName))
+    {
+        MapIndexByName.Add(MapInfo.MapName, MapIndex);
+    }
+    MapIndexByPath.Add(MapInfo.MapPath, MapIndex);
+
+    // 登记到所有上级文件夹，文件夹查询只需一次哈希
+    FString FolderPath = FPackageName::GetLongPackagePath(FPackageName::ObjectPathToPackageName(MapInfo.MapPath));
+    while (!FolderPath.IsEmpty())
+    {
+        MapIndicesByFolder.FindOrAdd(FolderPath).Add(MapIndex);
+
+        int32 LastSlash = INDEX_NONE;
+        if (!FolderPath.FindLastChar('/', LastSlash) || LastSlash <= 0)
+        {
+            break;
+        }
+        FolderPath.LeftInline(LastSlash);
+    }
+}
+
+const FMapFileInfo* ULoadSceneManager::FindMapByPath(const FString& MapPath) const
+{
+    const int32* MapIndex = MapIndexByPath.Find(MapPath);
+    return MapIndex ? &AvailableMaps[*MapIndex] : nullptr;
+}
+
+const FMapFileInfo* ULoadSceneManager::FindMapByName(const FString& MapName) const
+{
+    const int32* MapIndex = MapIndexByName.Find(MapName);
+    return MapIndex ? &AvailableMaps[*MapIndex] : nullptr;
+}
+
+void ULoadSceneManager::CollectMapsInFolder(const FString& FolderPath, TArray<int32>& OutIndices) const
+{
+    FString SanitizedPath = SanitizeMapPath(FolderPath);
+    SanitizedPath.RemoveFromEnd(TEXT("/"));
+
+    if (const TArray<int32>* FolderMaps = MapIndicesByFolder.Find(SanitizedPath))
+    {
+        OutIndices.Append(*FolderMaps);
+        return;
+    }
+
+    // 不是完整文件夹路径时按前缀匹配，保持原有行为
+    for (int32 i = 0; i < AvailableMaps.Num(); i++)
+    {
+        if (AvailableMaps[i].MapPath.StartsWith(SanitizedPath))
+        {
+            OutIndices.Add(i);
+        }
+    }
+}
+
+// ========== 资产注册表增量更新 ==========
+
+void ULoadSceneManager::BindAssetRegistryEvents()
+{
+    if (AssetAddedHandle.IsValid())
+    {
+        return;
+    }
+
+    IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+    AssetAddedHandle = AssetRegistry.OnAssetAdded().AddUObject(this, &ULoadSceneManager::OnMapAssetAdded);
+    AssetRemovedHandle = AssetRegistry.OnAssetRemoved().AddUObject(this, &ULoadSceneManager::OnMapAssetRemoved);
+    AssetRenamedHandle = AssetRegistry.OnAssetRenamed().AddUObject(this, &ULoadSceneManager::OnMapAssetRenamed);
+
+    // 编辑器启动时注册表可能仍在扫描，完成后补一次全量
+    if (AssetRegistry.IsLoadingAssets())
+    {
+        FilesLoadedHandle = AssetRegistry.OnFilesLoaded().AddUObject(this, &ULoadSceneManager::OnAssetRegistryFilesLoaded);
+    }
+}
+
+void ULoadSceneManager::UnbindAssetRegistryEvents()
+{
+    FAssetRegistryModule* AssetRegistryModule = FModuleManager::GetModulePtr<FAssetRegistryModule>("AssetRegistry");
+    if (!AssetRegistryModule)
+    {
+        return;
+    }
+
+    IAssetRegistry& AssetRegistry = AssetRegistryModule->Get();
+    AssetRegistry.OnAssetAdded().Remove(AssetAddedHandle);
+    AssetRegistry.OnAssetRemoved().Remove(AssetRemovedHandle);
+    AssetRegistry.OnAssetRenamed().Remove(AssetRenamedHandle);
+    AssetRegistry.OnFilesLoaded().Remove(FilesLoadedHandle);
+
+    AssetAddedHandle.Reset();
+    AssetRemovedHandle.Reset();
+    AssetRenamedHandle.Reset();
+    FilesLoadedHandle.Reset();
+}
+
+bool ULoadSceneManager::IsWorldAsset(const FAssetData& AssetData) const
+{
+    return AssetData.AssetClassPath == FTopLevelAssetPath(TEXT("/Script/Engine"), TEXT("World"));
+}
+
+void ULoadSceneManager::OnMapAssetAdded(const FAssetData& AssetData)
+{
+    if (!IsWorldAsset(AssetData))
+    {
+        return;
+    }
+
+    FMapFileInfo MapInfo = MakeMapFileInfo(AssetData);
+    if (MapIndexByPath.Contains(MapInfo.MapPath))
+    {
+        return;
+    }
+
+    int32 MapIndex = AvailableMaps.Add(MapInfo);
+    IndexMapEntry(MapIndex);
+
+    UE_LOG(LogTemp, Log, TEXT("Map added to catalog: %s"), *MapInfo.MapPath);
+}
+
+void ULoadSceneManager::OnMapAssetRemoved(const FAssetData& AssetData)
+{
+    if (!IsWorldAsset(AssetData))
+    {
+        return;
+    }
+
+    const int32* MapIndex = MapIndexByPath.Find(AssetData.GetObjectPathString());
+    if (!MapIndex)
+    {
+        return;
+    }
+
+    // 删除会改变后续下标，重建索引（只是哈希表，代价远小于扫描注册表）
+    AvailableMaps.RemoveAt(*MapIndex);
+    RebuildMapIndices();
+
+    UE_LOG(LogTemp, Log, TEXT("Map removed from catalog: %s"), *AssetData.GetObjectPathString());
+}
+
+void ULoadSceneManager::OnMapAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath)
+{
+    if (!IsWorldAsset(AssetData))
+    {
+        return;
+    }
+
+    const int32* MapIndex = MapIndexByPath.Find(OldObjectPath);
+    if (MapIndex)
+    {
+        AvailableMaps[*MapIndex] = MakeMapFileInfo(AssetData);
+        RebuildMapIndices();
+    }
+    else
+    {
+        OnMapAssetAdded(AssetData);
+    }
+
+    UE_LOG(LogTemp, Log, TEXT("Map renamed in catalog: %s -> %s"), *OldObjectPath, *AssetData.GetObjectPathString());
+}
+
+void ULoadSceneManager::OnAssetRegistryFilesLoaded()
+{
+    if (FAssetRegistryModule* AssetRegistryModule = FModuleManager::GetModulePtr<FAssetRegistryModule>("AssetRegistry"))
+    {
+        AssetRegistryModule->Get().OnFilesLoaded().Remove(FilesLoadedHandle);
+    }
+    FilesLoadedHandle.Reset();
+
+    RebuildMapCatalog();
+}
+
+// ========== 地图目录磁盘缓存 ==========
+
+FString ULoadSceneManager::GetMapCatalogFilePath() const
+{
+    return FPaths::ProjectSavedDir() / TEXT("XyFrame") / TEXT("MapCatalog.bin");
+}
+
+FString ULoadSceneManager::GetMapCatalogStamp() const
+{
+    // 打包版本的注册表来自 AssetRegistry.bin，构建版本和文件时间不变即视为有效
+    FString RegistryFile = FPaths::ProjectDir() / TEXT("AssetRegistry.bin");
+    FDateTime RegistryTime = IFileManager::Get().GetTimeStamp(*RegistryFile);
+
+    return FString::Printf(TEXT("%s|%s"), FApp::GetBuildVersion(), *RegistryTime.ToString());
+}
+
+bool ULoadSceneManager::LoadMapCatalogFromDisk()
+{
+#if WITH_EDITOR
+    // 编辑器中资产随时变化，始终以注册表为准
+    return false;
+#else
+    TArray<uint8> FileData;
+    if (!FFileHelper::LoadFileToArray(FileData, *GetMapCatalogFilePath(), FILEREAD_Silent))
+    {
+        return false;
+    }
+
+    FMemoryReader Reader(FileData);
+
+    int32 Version = 0;
+    FString Stamp;
+    Reader << Version;
+    Reader << Stamp;
+
+    if (Version != MapCatalogVersion || Stamp != GetMapCatalogStamp())
+    {
+        UE_LOG(LogTemp, Log, TEXT("Map catalog cache is stale, rescanning"));
+        return false;
+    }
+
+    int32 MapCount = 0;
+    Reader << MapCount;
+    // 按剩余字节数限制数量，损坏的计数不能触发超大分配
+    if (MapCount < 0 || Reader.IsError() || MapCount > (Reader.TotalSize() - Reader.Tell()) / MinMapCatalogRecordSize)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("Map catalog cache is corrupted, rescanning"));
+        return false;
+    }
+
+    TArray<FMapFileInfo> LoadedMaps;
+    LoadedMaps.SetNum(MapCount);
+    for (FMapFileInfo& MapInfo : LoadedMaps)
+    {
+        Reader << MapInfo.MapName;
+        Reader << MapInfo.MapPath;
+        Reader << MapInfo.DisplayName;
+        Reader << MapInfo.bIsInBuildSettings;
+    }
+
+    if (Reader.IsError())
+    {
+        UE_LOG(LogTemp, Warning, TEXT("Map catalog cache is corrupted, rescanning"));
+        return false;
+    }
+
+    AvailableMaps = MoveTemp(LoadedMaps);
+    RebuildMapIndices();
+
+    UE_LOG(LogTemp, Log, TEXT("Loaded %d maps from catalog cache"), AvailableMaps.Num());
+    return true;
+#endif
+}
+
+bool ULoadSceneManager::SaveMapCatalogToDisk()
+{
+#if WITH_EDITOR
+    return false;
+#else
+    TArray<uint8> FileData;
+    FMemoryWriter Writer(FileData);
+
+    int32 Version = MapCatalogVersion;
+    FString Stamp = GetMapCatalogStamp();
+    int32 MapCount = AvailableMaps.Num();
+    Writer << Version;
+    Writer << Stamp;
+    Writer << MapCount;
+
+    for (FMapFileInfo& MapInfo : AvailableMaps)
+    {
+        Writer << MapInfo.MapName;
+        Writer << MapInfo.MapPath;
+        Writer << MapInfo.DisplayName;
+        Writer << MapInfo.bIsInBuildSettings;
+    }
+
+    if (!FFileHelper::SaveArrayToFile(FileData, *GetMapCatalogFilePath()))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("Failed to save map catalog cache: %s"), *GetMapCatalogFilePath());
+        return false;
+    }
+
+    return true;
+#endif
+}
+
 void ULoadSceneManager::StartProgressTimer(const FString& RequestId)
 {
     UWorld* World = GetWorld();
@@ -1337,7 +2817,7 @@ void ULoadSceneManager::StartProgressTimer(const FString& RequestId)
 
     FTimerHandle TimerHandle;
 
-    // ʹ Lambda ʽ RequestId
+    // 使用 Lambda 表达式来捕获 RequestId
     FTimerDelegate TimerDelegate;
     TimerDelegate.BindLambda([this, RequestId]()
         {
@@ -1364,7 +2844,7 @@ void ULoadSceneManager::StopProgressTimer(const FString& RequestId)
 
 void ULoadSceneManager::UpdateProgress(const FString& RequestId)
 {
-    // ģȸ£ʵĿӦøʵļؽ
+    // 模拟进度更新，实际项目中应该根据真实的加载进度来更新
     FSceneAsyncLoadRequest* Request = AsyncRequests.Find(RequestId);
     if (Request && Request->LoadState == ESceneLoadState::Loading)
     {
@@ -1375,7 +2855,7 @@ void ULoadSceneManager::UpdateProgress(const FString& RequestId)
     }
     else
     {
-        // 󲻴ڻڼ״ֹ̬ͣʱ
+        // 如果请求不存在或不在加载状态，停止计时器
         StopProgressTimer(RequestId);
     }
 }
@@ -0,0 +1,24 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "SceneManager/SceneWarmupManifest.h"
+
+USceneWarmupManifest::USceneWarmupManifest()
+    : FrameBudgetMs(2.0f)
+    , MaxPoolSpawnsPerFrame(4)
+{
+}
+
+int32 USceneWarmupManifest::GetTotalStepCount() const
+{
+    int32 Total = ResourceIDs.Num() + ResourceFolders.Num() + SoundIDs.Num() + UINames.Num();
+
+    for (const FPoolWarmupEntry& Entry : PoolPreloads)
+    {
+        if (Entry.ActorClass && Entry.Count > 0)
+        {
+            Total += Entry.Count;
+        }
+    }
+
+    return Total;
+}
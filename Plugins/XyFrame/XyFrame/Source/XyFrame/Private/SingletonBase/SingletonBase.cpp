@@ -3,7 +3,7 @@
 #include "SingletonBase/SingletonBase.h"
 //#include "SingletonBase/SingletonManager.h"
 //
-//// ģ庯ʵַcppļ
+//// 模板函数的实现放在cpp文件中
 //template <typename T>
 //void TSingleton<T>::RegisterSingletonWithManager(T* Instance)
 //{
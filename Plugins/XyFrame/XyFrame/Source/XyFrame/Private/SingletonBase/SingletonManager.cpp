@@ -19,7 +19,7 @@ USingletonManager* USingletonManager::GetInstance()
 
 void USingletonManager::Initialize()
 {
-    GetInstance(); // ȷʵ
+    GetInstance(); // 确保实例存在
     UE_LOG(LogTemp, Log, TEXT("SingletonManager initialized"));
 }
 
@@ -72,7 +72,7 @@ void USingletonManager::DestroySingleton(UClass* SingletonClass)
     USingletonBase* Singleton = Cast<USingletonBase>(GetSingleton(SingletonClass));
     if (Singleton && IsValid(Singleton))
     {
-        // ҲöӦDestroyInstance
+        // 查找并调用对应单例类的DestroyInstance方法
         UFunction* DestroyFunc = Singleton->FindFunction(FName("DestroyCurSingleton"));
         if (DestroyFunc)
         {
@@ -91,7 +91,7 @@ void USingletonManager::DestroyAllSingletons()
 {
     UE_LOG(LogTemp, Log, TEXT("Destroying all %d singletons"), SingletonInstances.Num());
 
-    // ʱ飬ڵ޸
+    // 创建临时数组，避免在迭代过程中修改容器
     TArray<UClass*> SingletonClasses;
     SingletonInstances.GetKeys(SingletonClasses);
 
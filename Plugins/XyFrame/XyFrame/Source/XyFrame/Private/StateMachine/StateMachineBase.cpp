@@ -2,7 +2,7 @@
 #include "StateMachine/StateMachineBase.h"
 #include "Engine/Engine.h"
 
-// ========== UStateBase ʵ ==========
+// ========== UStateBase 实现 ==========
 
 bool UStateBase::CheckTransition(TSubclassOf<UStateBase> NewStateClass, bool bReEnterCurrent)
 {
@@ -13,7 +13,7 @@ bool UStateBase::CheckTransition(TSubclassOf<UStateBase> NewStateClass, bool bRe
     return false;
 }
 
-// ========== UStateMachineBase ʵ ==========
+// ========== UStateMachineBase 实现 ==========
 
 UStateMachineBase::UStateMachineBase()
     : CurrentState(nullptr)
@@ -34,7 +34,7 @@ void UStateMachineBase::Initialize(TScriptInterface<IStateMachineOwner> InOwner,
     bEnableStateSharing = bInEnableStateSharing;
     bIsRunning = false;
 
-    // 
+    // 清空现有数据
     CurrentState = nullptr;
     CurrentStateClass = nullptr;
     StateMap.Empty();
@@ -62,20 +62,20 @@ bool UStateMachineBase::ChangeState(TSubclassOf<UStateBase> NewStateClass, bool
         return false;
     }
 
-    // ״̬ͬҲ½뵱ǰ״̬
+    // 状态相同且不允许重新进入当前状态
     if (NewStateClass == CurrentStateClass && !bReEnterCurrent)
     {
         return false;
     }
 
-    // ˳ǰ״̬
+    // 退出当前状态
     if (CurrentState)
     {
         CurrentState->Exit();
         UE_LOG(LogTemp, Log, TEXT("Exited state: %s"), *CurrentStateClass->GetName());
     }
 
-    // ״̬
+    // 进入新状态
     CurrentState = GetOrCreateState(NewStateClass);
     CurrentStateClass = NewStateClass;
 
@@ -96,14 +96,14 @@ UStateBase* UStateMachineBase::GetOrCreateState(TSubclassOf<UStateBase> StateCla
         return nullptr;
     }
 
-    // ӳв״̬
+    // 从映射中查找现有状态
     UStateBase** ExistingState = StateMap.Find(StateClass);
     if (ExistingState && *ExistingState)
     {
         return *ExistingState;
     }
 
-    // ״̬
+    // 创建新状态
     UStateBase* NewState = NewObject<UStateBase>(this, StateClass);
     if (NewState)
     {
@@ -133,8 +133,9 @@ void UStateMachineBase::Stop()
 void UStateMachineBase::Destroy()
 {
     Stop();
+    UnregisterPhaseUpdates();
 
-    // ״̬
+    // 清理所有状态
     StateMap.Empty();
     SharedDataMap.Empty();
 
@@ -191,6 +192,37 @@ void UStateMachineBase::FixedUpdate(float DeltaTime)
     }
 }
 
+void UStateMachineBase::RegisterPhaseUpdates(TEnumAsByte<ETickingGroup> TickGroup)
+{
+    UMonoManager* MonoManager = UMonoManager::GetMonoManager();
+    if (!MonoManager)
+    {
+        return;
+    }
+
+    UnregisterPhaseUpdates();
+
+    // LateUpdate默认在其余阶段之后的Tick组执行
+    UpdateHandle = MonoManager->RegisterUpdate(EUpdatePhase::Update, this, &UStateMachineBase::Update, TickGroup);
+    LateUpdateHandle = MonoManager->RegisterUpdate(EUpdatePhase::LateUpdate, this, &UStateMachineBase::LateUpdate, TickGroup);
+    FixedUpdateHandle = MonoManager->RegisterUpdate(EUpdatePhase::FixedUpdate, this, &UStateMachineBase::FixedUpdate, TickGroup);
+}
+
+void UStateMachineBase::UnregisterPhaseUpdates()
+{
+    if (!UpdateHandle.IsValid() && !LateUpdateHandle.IsValid() && !FixedUpdateHandle.IsValid())
+    {
+        return;
+    }
+
+    if (UMonoManager* MonoManager = UMonoManager::GetMonoManager())
+    {
+        MonoManager->UnregisterUpdate(UpdateHandle);
+        MonoManager->UnregisterUpdate(LateUpdateHandle);
+        MonoManager->UnregisterUpdate(FixedUpdateHandle);
+    }
+}
+
 UWorld* UStateMachineBase::GetWorld() const
 {
     if (GEngine)
@@ -206,9 +238,9 @@ UWorld* UStateMachineBase::GetWorld() const
     return nullptr;
 }
 
-// ========== UStateMachineManager ʵ ==========
+// ========== UStateMachineManager 实现 ==========
 
-// ̬ʵ
+// 静态实例定义
 template<>
 UStateMachineManager* TSingleton<UStateMachineManager>::SingletonInstance = nullptr;
 
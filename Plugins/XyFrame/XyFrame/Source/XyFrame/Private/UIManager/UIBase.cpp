@@ -28,7 +28,7 @@ void UUIBase::NativeDestruct()
 {
     Super::NativeDestruct();
 
-    // 
+    // 清理
     ControlDictionary.Empty();
     WidgetPathMap.Empty();
 }
@@ -49,7 +49,7 @@ void UUIBase::InitializeControls()
 
 void UUIBase::FindChildControls()
 {
-    // ȡӿؼ
+    // 获取所有子控件
     if (!WidgetTree) return;
 
     TArray<UWidget*> AllWidgets;
@@ -60,9 +60,9 @@ void UUIBase::FindChildControls()
         if (!Widget) continue;
 
         FString ControlPath = GetControlPath(Widget);
-        EUIControlType ControlType = EUIControlType::Button; // Ĭ
+        EUIControlType ControlType = EUIControlType::Button; // 默认类型
 
-        // жϿؼ
+        // 判断控件类型
         if (Cast<UButton>(Widget))
         {
             ControlType = EUIControlType::Button;
@@ -89,11 +89,11 @@ void UUIBase::FindChildControls()
         }
         else
         {
-            continue; // ֵ֧
+            continue; // 不支持的类型
         }
 
         AddControlToDictionary(ControlPath, Widget, ControlType);
-        // ͬʱӵؼ·ӳ
+        // 同时添加到控件到路径的映射
         WidgetPathMap.Add(Widget, ControlPath);
     }
 
@@ -102,14 +102,14 @@ void UUIBase::FindChildControls()
 
 void UUIBase::RegisterControlEvents()
 {
-    // Ϊÿؼ¼
+    // 为每个控件绑定事件
     for (auto& Pair : ControlDictionary)
     {
         FUIControlInfo& ControlInfo = Pair.Value;
 
         if (UButton* Button = Cast<UButton>(ControlInfo.Widget))
         {
-            // ʹñ׼ AddDynamic 
+            // 使用标准的 AddDynamic 绑定
             Button->OnClicked.AddDynamic(this, &UUIBase::HandleButtonClickInternal);
         }
         else if (UCheckBox* CheckBox = Cast<UCheckBox>(ControlInfo.Widget))
@@ -123,13 +123,13 @@ void UUIBase::RegisterControlEvents()
     }
 }
 
-// ȡǰ¼ԴĿؼ
+// 获取当前事件源的控件
 UWidget* UUIBase::GetCurrentEventSourceWidget() const
 {
-    // ʹø򵥵ķͨͣ״̬ȷǰĿؼ
-    // һ򻯵ʵ֣ܹͨ
+    // 使用更简单的方法：通过检查悬停状态来确定当前交互的控件
+    // 这是一个简化的实现，但通常能工作
 
-    // аťͣ״̬
+    // 检查所有按钮的悬停状态
     for (auto& Pair : WidgetPathMap)
     {
         UWidget* Widget = Pair.Key;
@@ -187,7 +187,8 @@ void UUIBase::ShowUI()
 
 void UUIBase::HideUI()
 {
-    SetVisibility(ESlateVisibility::Hidden);
+    // 折叠后不参与布局与绘制
+    SetVisibility(ESlateVisibility::Collapsed);
 }
 
 void UUIBase::CloseUI()
@@ -197,7 +198,14 @@ void UUIBase::CloseUI()
 
 void UUIBase::SetData(UObject* Data)
 {
-    // д˷
+    // 子类可以重写此方法来处理数据
+}
+
+void UUIBase::ResetUI()
+{
+    // 回收前可能被隐藏或淡出
+    SetVisibility(ESlateVisibility::Visible);
+    SetRenderOpacity(1.0f);
 }
 
 UButton* UUIBase::GetButton(const FString& ControlPath) const
@@ -296,7 +304,7 @@ void UUIBase::SetProgress(const FString& ControlPath, float Progress)
     }
 }
 
-// ========== ¼ ==========
+// ========== 事件处理函数 ==========
 
 void UUIBase::HandleButtonClick(const FString& ControlPath)
 {
@@ -318,11 +326,11 @@ void UUIBase::HandleSliderValueChanged(const FString& ControlPath, float Value)
         *ControlPath, Value);
 }
 
-// ========== ڲ¼ ==========
+// ========== 内部事件处理函数 ==========
 
 void UUIBase::HandleButtonClickInternal()
 {
-    // Իȡǰ¼ԴĿؼ
+    // 尝试获取当前事件源的控件
     UWidget* EventSource = GetCurrentEventSourceWidget();
     if (EventSource && WidgetPathMap.Contains(EventSource))
     {
@@ -331,21 +339,21 @@ void UUIBase::HandleButtonClickInternal()
         return;
     }
 
-    // ޷ͨ¼ԴȷʹøȷĻ˷
-    // аťĸť
+    // 如果无法通过事件源确定，使用更精确的回退方法
+    // 遍历所有按钮，检查哪个按钮最近被交互
     for (auto& Pair : ControlDictionary)
     {
         FUIControlInfo& ControlInfo = Pair.Value;
         if (ControlInfo.ControlType == EUIControlType::Button && ControlInfo.Widget)
         {
-            // Ӹȷж߼
-            // 鰴ť״̬ǷɼǷɵ
+            // 这里可以添加更精确的判断逻辑
+            // 例如检查按钮的状态、是否可见、是否可点击等
             if (UButton* Button = Cast<UButton>(ControlInfo.Widget))
             {
-                // 򵥵жϣťɼҿɵΪ¼Դ
+                // 简单的判断：如果按钮可见且可点击，就认为它可能是事件源
                 if (Button->GetIsEnabled() && Button->GetVisibility() == ESlateVisibility::Visible)
                 {
-                    // ͣ״̬Ϊȷж
+                    // 检查悬停状态作为更精确的判断
                     if (Button->IsHovered())
                     {
                         HandleButtonClick(ControlInfo.ControlPath);
@@ -356,14 +364,14 @@ void UUIBase::HandleButtonClickInternal()
         }
     }
 
-    // зʧܣʹδ֪·
+    // 如果所有方法都失败，使用未知路径
     UE_LOG(LogTemp, Warning, TEXT("UUIBase::HandleButtonClickInternal - Could not determine control path"));
     HandleButtonClick(FString("Unknown"));
 }
 
 void UUIBase::HandleCheckBoxChangedInternal(bool IsChecked)
 {
-    // Իȡǰ¼ԴĿؼ
+    // 尝试获取当前事件源的控件
     UWidget* EventSource = GetCurrentEventSourceWidget();
     if (EventSource && WidgetPathMap.Contains(EventSource))
     {
@@ -372,7 +380,7 @@ void UUIBase::HandleCheckBoxChangedInternal(bool IsChecked)
         return;
     }
 
-    // ˷иѡ
+    // 回退方法：遍历所有复选框
     for (auto& Pair : ControlDictionary)
     {
         FUIControlInfo& ControlInfo = Pair.Value;
@@ -382,7 +390,7 @@ void UUIBase::HandleCheckBoxChangedInternal(bool IsChecked)
             {
                 if (CheckBox->GetIsEnabled() && CheckBox->GetVisibility() == ESlateVisibility::Visible)
                 {
-                    // ͣ״̬
+                    // 检查悬停状态
                     if (CheckBox->IsHovered())
                     {
                         HandleCheckBoxChanged(ControlInfo.ControlPath, IsChecked);
@@ -399,7 +407,7 @@ void UUIBase::HandleCheckBoxChangedInternal(bool IsChecked)
 
 void UUIBase::HandleSliderValueChangedInternal(float Value)
 {
-    // Իȡǰ¼ԴĿؼ
+    // 尝试获取当前事件源的控件
     UWidget* EventSource = GetCurrentEventSourceWidget();
     if (EventSource && WidgetPathMap.Contains(EventSource))
     {
@@ -408,7 +416,7 @@ void UUIBase::HandleSliderValueChangedInternal(float Value)
         return;
     }
 
-    // ˷л
+    // 回退方法：遍历所有滑动条
     for (auto& Pair : ControlDictionary)
     {
         FUIControlInfo& ControlInfo = Pair.Value;
@@ -418,7 +426,7 @@ void UUIBase::HandleSliderValueChangedInternal(float Value)
             {
                 if (Slider->GetIsEnabled() && Slider->GetVisibility() == ESlateVisibility::Visible)
                 {
-                    // ͣ״̬
+                    // 检查悬停状态
                     if (Slider->IsHovered())
                     {
                         HandleSliderValueChanged(ControlInfo.ControlPath, Value);
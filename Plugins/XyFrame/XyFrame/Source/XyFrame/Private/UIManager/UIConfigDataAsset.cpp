@@ -29,7 +29,7 @@ TArray<FUIConfigData> UUIConfigDataAsset::GetAllUIConfigs() const
         return Configs;
     }
 
-    // ȡݱ
+    // 获取数据表的所有行
     TArray<FUIConfigData*> AllConfigs;
     UIConfigTable->GetAllRows(TEXT("GetAllUIConfigs"), AllConfigs);
 
@@ -7,17 +7,29 @@
 #include "UObject/ConstructorHelpers.h"
 #include "UIManager/UIConfigDataAsset.h"
 #include "UIManager/UIBase.h"
+#include "Engine/AssetManager.h"
+#include "Engine/GameViewportClient.h"
+#include "Engine/World.h"
+#include "Components/InvalidationBox.h"
+#include "Components/RetainerBox.h"
 
 UUIManager::UUIManager()
 {
     WorldContext = nullptr;
     RootCanvas = nullptr;
     UIConfigData = nullptr;
+    LoadingPlaceholderClass = nullptr;
+    MaxPooledWidgetsPerClass = 4;
+    DefaultLayerCaching = EUILayerCaching::Invalidation;
+    RetainerPhaseCount = 4;
 }
 
 UUIManager::~UUIManager()
 {
+    UnbindWorldEvents();
+    CancelAllPendingLoads();
     CloseAllUI();
+    DetachRootFromViewport();
 }
 
 void UUIManager::InitializeUIManager(UUIConfigDataAsset* ConfigDataAsset)
@@ -26,10 +38,11 @@ void UUIManager::InitializeUIManager(UUIConfigDataAsset* ConfigDataAsset)
     {
         WorldContext = GetWorld();
     }
+    BindWorldEvents();
 
     CreateLayerPanels();
 
-    // 
+    // 加载配置
     if (ConfigDataAsset)
     {
         LoadUIConfig(ConfigDataAsset);
@@ -45,18 +58,161 @@ void UUIManager::CreateLayerPanels()
 {
     if (!WorldContext) return;
 
-    // 
-    RootCanvas = NewObject<UCanvasPanel>(GetTransientPackage(), UCanvasPanel::StaticClass());
+    // 创建根画布，重复初始化时保留已有层级中的界面
+    if (!RootCanvas)
+    {
+        RootCanvas = NewObject<UCanvasPanel>(GetTransientPackage(), UCanvasPanel::StaticClass());
+    }
 
-    // 㼶
+    // 创建各层级面板
     for (int32 i = 0; i <= static_cast<int32>(EUIPanelLayer::ForeFront); i++)
     {
         EUIPanelLayer Layer = static_cast<EUIPanelLayer>(i);
         if (Layer == EUIPanelLayer::None) continue;
 
-        UCanvasPanel* LayerPanel = NewObject<UCanvasPanel>(GetTransientPackage(), UCanvasPanel::StaticClass());
-        LayerPanels.Add(Layer, LayerPanel);
+        GetOrCreateLayerPanel(Layer);
+    }
+
+    AttachRootToViewport();
+}
+
+void UUIManager::AttachLayerPanel(EUIPanelLayer Layer)
+{
+    UCanvasPanel* LayerPanel = LayerPanels.FindRef(Layer);
+    if (!LayerPanel || !RootCanvas) return;
+
+    // 拆掉旧的缓存容器
+    if (UContentWidget* OldHost = LayerHosts.FindRef(Layer))
+    {
+        OldHost->RemoveFromParent();
+    }
+    LayerHosts.Remove(Layer);
+    LayerPanel->RemoveFromParent();
+
+    UWidget* LayerRoot = LayerPanel;
+    switch (GetLayerCaching(Layer))
+    {
+    case EUILayerCaching::Invalidation:
+    {
+        // 子控件未失效时直接复用缓存的绘制元素
+        UInvalidationBox* InvalidationBox = NewObject<UInvalidationBox>(GetTransientPackage(), UInvalidationBox::StaticClass());
+        InvalidationBox->SetCanCache(true);
+        InvalidationBox->AddChild(LayerPanel);
+        LayerHosts.Add(Layer, InvalidationBox);
+        LayerRoot = InvalidationBox;
+        break;
+    }
+    case EUILayerCaching::Retainer:
+    {
+        // 渲染到纹理，每RetainerPhaseCount帧重绘一次
+        URetainerBox* RetainerBox = NewObject<URetainerBox>(GetTransientPackage(), URetainerBox::StaticClass());
+        RetainerBox->SetRetainRendering(true);
+        RetainerBox->SetRenderingPhase(0, FMath::Max(RetainerPhaseCount, 1));
+        RetainerBox->AddChild(LayerPanel);
+        LayerHosts.Add(Layer, RetainerBox);
+        LayerRoot = RetainerBox;
+        break;
+    }
+    default:
+        break;
+    }
+
+    // 层级铺满根画布，按枚举顺序叠放
+    if (UCanvasPanelSlot* LayerSlot = RootCanvas->AddChildToCanvas(LayerRoot))
+    {
+        LayerSlot->SetAnchors(FAnchors(0.0f, 0.0f, 1.0f, 1.0f));
+        LayerSlot->SetOffsets(FMargin(0.0f));
+        LayerSlot->SetZOrder(static_cast<int32>(Layer));
+    }
+}
+
+void UUIManager::AttachRootToViewport()
+{
+    UWorld* World = WorldContext ? WorldContext : GetWorld();
+    UGameViewportClient* ViewportClient = World ? World->GetGameViewport() : nullptr;
+    if (!RootCanvas || !ViewportClient) return;
+
+    // 切换地图会清空视口内容，世界变化后重新挂接
+    if (RootSlateWidget.IsValid() && RootViewportClient.Get() == ViewportClient && RootViewportWorld.Get() == World)
+    {
+        return;
+    }
+
+    DetachRootFromViewport();
+
+    RootSlateWidget = RootCanvas->TakeWidget();
+    ViewportClient->AddViewportWidgetContent(RootSlateWidget.ToSharedRef());
+    RootViewportClient = ViewportClient;
+    RootViewportWorld = World;
+}
+
+void UUIManager::DetachRootFromViewport()
+{
+    if (RootSlateWidget.IsValid())
+    {
+        if (UGameViewportClient* ViewportClient = RootViewportClient.Get())
+        {
+            ViewportClient->RemoveViewportWidgetContent(RootSlateWidget.ToSharedRef());
+        }
     }
+    RootSlateWidget.Reset();
+    RootViewportClient.Reset();
+    RootViewportWorld.Reset();
+}
+
+void UUIManager::BindWorldEvents()
+{
+    if (WorldCleanupHandle.IsValid())
+    {
+        return;
+    }
+
+    WorldCleanupHandle = FWorldDelegates::OnWorldCleanup.AddUObject(this, &UUIManager::HandleWorldCleanup);
+    PostLoadMapHandle = FCoreUObjectDelegates::PostLoadMapWithWorld.AddUObject(this, &UUIManager::HandlePostLoadMap);
+}
+
+void UUIManager::UnbindWorldEvents()
+{
+    FWorldDelegates::OnWorldCleanup.Remove(WorldCleanupHandle);
+    FCoreUObjectDelegates::PostLoadMapWithWorld.Remove(PostLoadMapHandle);
+    WorldCleanupHandle.Reset();
+    PostLoadMapHandle.Reset();
+}
+
+void UUIManager::HandleWorldCleanup(UWorld* World, bool bSessionEnded, bool bCleanupResources)
+{
+    if (!World || World != WorldContext)
+    {
+        return;
+    }
+
+    // 占位界面与池中空闲实例属于旧地图，直接丢弃而不是放回池中
+    for (auto& Pair : PendingUILoads)
+    {
+        if (UUserWidget* Placeholder = Pair.Value.Placeholder.Get())
+        {
+            RemoveFromLayer(Placeholder);
+            Placeholder->RemoveFromParent();
+        }
+        Pair.Value.Placeholder.Reset();
+    }
+    ClearWidgetPools();
+
+    // 旧世界即将销毁，不能再用它创建控件或查找视口
+    DetachRootFromViewport();
+    WorldContext = nullptr;
+}
+
+void UUIManager::HandlePostLoadMap(UWorld* LoadedWorld)
+{
+    if (!LoadedWorld || !LoadedWorld->IsGameWorld())
+    {
+        return;
+    }
+
+    // 新地图加载完成后改用新世界，根画布重新挂到视口
+    WorldContext = LoadedWorld;
+    AttachRootToViewport();
 }
 
 void UUIManager::LoadUIConfig(UUIConfigDataAsset* ConfigDataAsset)
@@ -70,7 +226,7 @@ void UUIManager::LoadUIConfig(UUIConfigDataAsset* ConfigDataAsset)
 
     UIConfigData = ConfigDataAsset;
 
-    // עUI
+    // 从配置注册所有UI
     RegisterAllUIsFromConfig();
 
     UE_LOG(LogTemp, Log, TEXT("UUIManager::LoadUIConfig - Loaded UI config with %d entries"),
@@ -83,13 +239,14 @@ void UUIManager::ReloadUIConfig()
 {
     if (UIConfigData)
     {
-        // ȹرUI
+        // 先关闭所有UI
+        CancelAllPendingLoads();
         CloseAllUI();
 
-        // ע
+        // 清空注册表
         UIRegistry.Empty();
 
-        // ¼
+        // 重新加载配置
         RegisterAllUIsFromConfig();
 
         UE_LOG(LogTemp, Log, TEXT("UUIManager::ReloadUIConfig - Reloaded UI config"));
@@ -111,7 +268,7 @@ void UUIManager::RegisterAllUIsFromConfig()
         RegisterUIFromConfig(Config);
     }
 
-    // ԤرΪԤصUI
+    // 预加载标记为预加载的UI
     PreloadMarkedUIs();
 }
 
@@ -130,7 +287,7 @@ bool UUIManager::RegisterUIFromConfig(const FUIConfigData& Config)
         return false;
     }
 
-    // Ƿע
+    // 检查是否已注册
     if (UIRegistry.Contains(Config.UIName))
     {
         UE_LOG(LogTemp, Warning, TEXT("UUIManager::RegisterUIFromConfig - UI already registered: %s"),
@@ -138,103 +295,294 @@ bool UUIManager::RegisterUIFromConfig(const FUIConfigData& Config)
         return false;
     }
 
-    // Widget
-    TSubclassOf<UUserWidget> WidgetClass = LoadWidgetClass(Config.WidgetClass);
-    if (!WidgetClass)
-    {
-        UE_LOG(LogTemp, Error, TEXT("UUIManager::RegisterUIFromConfig - Failed to load widget class for UI: %s"),
-            *Config.UIName.ToString());
-        return false;
-    }
-
-    // עUIϢ
+    // 只登记类路径，首次显示时再加载
     FUIInfo UIInfo;
     UIInfo.UIName = Config.UIName;
-    UIInfo.WidgetClass = WidgetClass;
+    UIInfo.WidgetClass = Config.WidgetClass.Get();
+    UIInfo.SoftWidgetClass = Config.WidgetClass;
     UIInfo.Layer = Config.DefaultLayer;
     UIInfo.State = EUIState::Hidden;
     UIInfo.WidgetInstance = nullptr;
     UIInfo.bIsPreloaded = Config.bPreload;
+    UIInfo.bPoolInstance = Config.bPoolInstance;
 
     UIRegistry.Add(Config.UIName, UIInfo);
 
-    UE_LOG(LogTemp, Log, TEXT("UUIManager::RegisterUIFromConfig - Registered UI: %s, Class: %s, Layer: %s, Preload: %s"),
+    UE_LOG(LogTemp, Log, TEXT("UUIManager::RegisterUIFromConfig - Registered UI: %s, Class: %s, Layer: %s, Preload: %s, Pool: %s"),
         *Config.UIName.ToString(),
-        *WidgetClass->GetName(),
+        *Config.WidgetClass.ToString(),
         *UEnum::GetValueAsString(Config.DefaultLayer),
-        Config.bPreload ? TEXT("Yes") : TEXT("No"));
+        Config.bPreload ? TEXT("Yes") : TEXT("No"),
+        Config.bPoolInstance ? TEXT("Yes") : TEXT("No"));
 
     return true;
 }
 
-TSubclassOf<UUserWidget> UUIManager::LoadWidgetClass(const TSoftClassPtr<UUserWidget>& SoftClassPtr)
+void UUIManager::PreloadUIs(const TArray<FName>& UINames)
 {
-    if (SoftClassPtr.IsNull())
+    for (const FName& UIName : UINames)
     {
-        return nullptr;
+        if (FUIInfo* UIInfo = UIRegistry.Find(UIName))
+        {
+            if (UIInfo->WidgetInstance)
+            {
+                continue;
+            }
+
+            if (ResolveWidgetClass(*UIInfo))
+            {
+                PreloadUIInstance(*UIInfo);
+            }
+            else
+            {
+                // 加载完成后创建实例
+                RequestWidgetClassLoad(UIName, false);
+                if (FPendingUILoad* Pending = PendingUILoads.Find(UIName))
+                {
+                    Pending->bPreload = true;
+                }
+            }
+        }
     }
+}
 
-    // ͬWidget
-    TSubclassOf<UUserWidget> WidgetClass = SoftClassPtr.LoadSynchronous();
-    if (!WidgetClass)
+void UUIManager::PreloadMarkedUIs()
+{
+    TArray<FName> PreloadNames;
+    for (const auto& Pair : UIRegistry)
     {
-        UE_LOG(LogTemp, Error, TEXT("UUIManager::LoadWidgetClass - Failed to load widget class: %s"),
-            *SoftClassPtr.ToString());
+        if (Pair.Value.bIsPreloaded && !Pair.Value.WidgetInstance)
+        {
+            PreloadNames.Add(Pair.Key);
+        }
     }
 
-    return WidgetClass;
+    PreloadUIs(PreloadNames);
 }
 
-void UUIManager::PreloadUIs(const TArray<FName>& UINames)
+void UUIManager::PreloadUIInstance(FUIInfo& UIInfo)
 {
-    for (const FName& UIName : UINames)
+    // 创建但不显示
+    UUserWidget* Widget = AcquireWidget(UIInfo.WidgetClass);
+    if (Widget)
     {
-        if (FUIInfo* UIInfo = UIRegistry.Find(UIName))
+        UIInfo.WidgetInstance = Widget;
+        UIInfo.bIsPreloaded = true;
+
+        UE_LOG(LogTemp, Log, TEXT("UUIManager::PreloadUIInstance - Preloaded UI: %s"), *UIInfo.UIName.ToString());
+    }
+}
+
+// ========== 异步加载 ==========
+
+bool UUIManager::ResolveWidgetClass(FUIInfo& UIInfo) const
+{
+    if (!UIInfo.WidgetClass && !UIInfo.SoftWidgetClass.IsNull())
+    {
+        UIInfo.WidgetClass = UIInfo.SoftWidgetClass.Get();
+    }
+    return UIInfo.WidgetClass != nullptr;
+}
+
+void UUIManager::RequestWidgetClassLoad(FName UIName, bool bShowWhenLoaded, UObject* Data)
+{
+    FUIInfo* UIInfo = UIRegistry.Find(UIName);
+    if (!UIInfo || UIInfo->SoftWidgetClass.IsNull())
+    {
+        return;
+    }
+
+    FPendingUILoad& Pending = PendingUILoads.FindOrAdd(UIName);
+    if (bShowWhenLoaded)
+    {
+        Pending.bShowWhenLoaded = true;
+        Pending.Data.Reset(Data);
+        ShowLoadingPlaceholder(Pending, UIInfo->Layer);
+    }
+
+    // 已在加载中，只更新显示请求
+    if (Pending.Handle.IsValid())
+    {
+        return;
+    }
+
+    UE_LOG(LogTemp, Log, TEXT("UUIManager::RequestWidgetClassLoad - Loading widget class for UI: %s"), *UIName.ToString());
+
+    // 类已加载时回调可能立即执行并移除Pending，句柄单独写回
+    TSharedPtr<FStreamableHandle> Handle = UAssetManager::GetStreamableManager().RequestAsyncLoad(
+        UIInfo->SoftWidgetClass.ToSoftObjectPath(),
+        FStreamableDelegate::CreateUObject(this, &UUIManager::HandleWidgetClassLoaded, UIName));
+
+    if (FPendingUILoad* CurrentPending = PendingUILoads.Find(UIName))
+    {
+        if (Handle.IsValid())
         {
-            if (!UIInfo->WidgetInstance && UIInfo->WidgetClass)
-            {
-                // ʾ
-                UUserWidget* Widget = CreateWidget<UUserWidget>(WorldContext, UIInfo->WidgetClass);
-                if (Widget)
-                {
-                    UIInfo->WidgetInstance = Widget;
-                    UIInfo->bIsPreloaded = true;
+            CurrentPending->Handle = Handle;
+        }
+        else
+        {
+            HandleWidgetClassLoaded(UIName);
+        }
+    }
+}
 
-                    UE_LOG(LogTemp, Log, TEXT("UUIManager::PreloadUIs - Preloaded UI: %s"), *UIName.ToString());
-                }
-            }
+void UUIManager::HandleWidgetClassLoaded(FName UIName)
+{
+    FPendingUILoad Pending;
+    if (!PendingUILoads.RemoveAndCopyValue(UIName, Pending))
+    {
+        return;
+    }
+
+    HideLoadingPlaceholder(Pending);
+
+    FUIInfo* UIInfo = UIRegistry.Find(UIName);
+    if (!UIInfo)
+    {
+        return;
+    }
+
+    if (!ResolveWidgetClass(*UIInfo))
+    {
+        UE_LOG(LogTemp, Error, TEXT("UUIManager::HandleWidgetClassLoaded - Failed to load widget class: %s"),
+            *UIInfo->SoftWidgetClass.ToString());
+        return;
+    }
+
+    if (Pending.bShowWhenLoaded)
+    {
+        ShowUI(UIInfo->WidgetClass, UIInfo->Layer, Pending.Data.Get(), UIName);
+    }
+    else if (Pending.bPreload && !UIInfo->WidgetInstance)
+    {
+        PreloadUIInstance(*UIInfo);
+    }
+}
+
+void UUIManager::CancelPendingShow(FName UIName)
+{
+    // 只取消显示，类继续加载以便下次直接使用
+    if (FPendingUILoad* Pending = PendingUILoads.Find(UIName))
+    {
+        Pending->bShowWhenLoaded = false;
+        Pending->Data.Reset();
+        HideLoadingPlaceholder(*Pending);
+    }
+}
+
+void UUIManager::CancelAllPendingLoads()
+{
+    TMap<FName, FPendingUILoad> Pending = MoveTemp(PendingUILoads);
+    PendingUILoads.Reset();
+
+    for (auto& Pair : Pending)
+    {
+        if (Pair.Value.Handle.IsValid())
+        {
+            Pair.Value.Handle->CancelHandle();
         }
+        HideLoadingPlaceholder(Pair.Value);
     }
 }
 
-void UUIManager::PreloadMarkedUIs()
+void UUIManager::ShowLoadingPlaceholder(FPendingUILoad& Pending, EUIPanelLayer Layer)
 {
-    if (!UIConfigData)
+    if (!LoadingPlaceholderClass || !WorldContext || Pending.Placeholder.IsValid())
     {
         return;
     }
 
-    TArray<FUIConfigData> PreloadConfigs = UIConfigData->GetPreloadUIConfigs();
+    UUserWidget* Placeholder = AcquireWidget(LoadingPlaceholderClass);
+    if (Placeholder)
+    {
+        AddToLayer(Placeholder, Layer);
+        Pending.Placeholder = Placeholder;
+    }
+}
 
-    for (const FUIConfigData& Config : PreloadConfigs)
+void UUIManager::HideLoadingPlaceholder(FPendingUILoad& Pending)
+{
+    if (UUserWidget* Placeholder = Pending.Placeholder.Get())
     {
-        if (FUIInfo* UIInfo = UIRegistry.Find(Config.UIName))
+        RemoveFromLayer(Placeholder);
+        if (!ReleaseWidgetToPool(Placeholder))
         {
-            if (!UIInfo->WidgetInstance && UIInfo->WidgetClass)
+            Placeholder->RemoveFromParent();
+        }
+    }
+    Pending.Placeholder.Reset();
+}
+
+bool UUIManager::IsUILoading(FName UIName) const
+{
+    return PendingUILoads.Contains(UIName);
+}
+
+// ========== 实例池 ==========
+
+UUserWidget* UUIManager::AcquireWidget(TSubclassOf<UUserWidget> WidgetClass)
+{
+    if (!WidgetClass)
+    {
+        return nullptr;
+    }
+
+    if (FUIWidgetPool* Pool = WidgetPools.Find(WidgetClass))
+    {
+        while (Pool->Widgets.Num() > 0)
+        {
+            UUserWidget* Widget = Pool->Widgets.Pop(EAllowShrinking::No);
+            if (IsValid(Widget))
             {
-                // ʾ
-                UUserWidget* Widget = CreateWidget<UUserWidget>(WorldContext, UIInfo->WidgetClass);
-                if (Widget)
+                // 恢复回收前可能被隐藏或淡出的状态，UIBase由子类清理上一次使用留下的数据
+                if (UUIBase* UIBase = Cast<UUIBase>(Widget))
                 {
-                    UIInfo->WidgetInstance = Widget;
-                    UIInfo->bIsPreloaded = true;
-
-                    UE_LOG(LogTemp, Log, TEXT("UUIManager::PreloadMarkedUIs - Preloaded UI: %s"),
-                        *Config.UIName.ToString());
+                    UIBase->ResetUI();
+                }
+                else
+                {
+                    Widget->SetVisibility(ESlateVisibility::Visible);
+                    Widget->SetRenderOpacity(1.0f);
                 }
+                return Widget;
             }
         }
     }
+
+    return WorldContext ? CreateWidget<UUserWidget>(WorldContext, WidgetClass) : nullptr;
+}
+
+bool UUIManager::ReleaseWidgetToPool(UUserWidget* Widget)
+{
+    if (!IsValid(Widget) || MaxPooledWidgetsPerClass <= 0)
+    {
+        return false;
+    }
+
+    FUIWidgetPool& Pool = WidgetPools.FindOrAdd(Widget->GetClass());
+    if (Pool.Widgets.Num() >= MaxPooledWidgetsPerClass)
+    {
+        return false;
+    }
+
+    Widget->RemoveFromParent();
+    Pool.Widgets.Add(Widget);
+    return true;
+}
+
+void UUIManager::ClearWidgetPools()
+{
+    WidgetPools.Empty();
+}
+
+int32 UUIManager::GetPooledWidgetCount() const
+{
+    int32 Count = 0;
+    for (const auto& Pair : WidgetPools)
+    {
+        Count += Pair.Value.Widgets.Num();
+    }
+    return Count;
 }
 
 UUserWidget* UUIManager::ShowUI(TSubclassOf<UUserWidget> WidgetClass, EUIPanelLayer Layer, UObject* Data, FName UIName)
@@ -248,14 +596,23 @@ UUserWidget* UUIManager::ShowUI(TSubclassOf<UUserWidget> WidgetClass, EUIPanelLa
     if (UIName.IsNone())
     {
         UIName = FName(*WidgetClass->GetName());
-        UIName = FName(*UIName.ToString().Replace(TEXT("_C"), TEXT(""))); // Ƴ׺
+        UIName = FName(*UIName.ToString().Replace(TEXT("_C"), TEXT(""))); // 移除后缀
     }
 
-    // ǷѴ
+    // 检查是否已存在
     if (FUIInfo* ExistingUI = UIRegistry.Find(UIName))
     {
         if (ExistingUI->WidgetInstance)
         {
+            // 已在层级中的界面只切换可见性并置顶
+            if (IsInLayer(ExistingUI->WidgetInstance, ExistingUI->Layer))
+            {
+                BringToFront(ExistingUI->WidgetInstance, ExistingUI->Layer);
+            }
+            else
+            {
+                AddToLayer(ExistingUI->WidgetInstance, ExistingUI->Layer);
+            }
             ExistingUI->WidgetInstance->SetVisibility(ESlateVisibility::Visible);
             ExistingUI->State = EUIState::Visible;
 
@@ -273,18 +630,18 @@ UUserWidget* UUIManager::ShowUI(TSubclassOf<UUserWidget> WidgetClass, EUIPanelLa
         }
     }
 
-    // UI
-    UUserWidget* NewWidget = CreateWidget<UUserWidget>(WorldContext, WidgetClass);
+    // 创建新UI，优先复用池中的实例
+    UUserWidget* NewWidget = AcquireWidget(WidgetClass);
     if (!NewWidget)
     {
         UE_LOG(LogTemp, Error, TEXT("UUIManager::ShowUI - Failed to create widget"));
         return nullptr;
     }
 
-    // ӵ㼶
+    // 添加到层级
     AddToLayer(NewWidget, Layer);
 
-    // עUIϢδעᣩ
+    // 注册UI信息（如果尚未注册）
     if (!UIRegistry.Contains(UIName))
     {
         FUIInfo UIInfo;
@@ -299,21 +656,21 @@ UUserWidget* UUIManager::ShowUI(TSubclassOf<UUserWidget> WidgetClass, EUIPanelLa
     }
     else
     {
-        // UIϢ
+        // 更新已有UI信息
         FUIInfo* UIInfo = UIRegistry.Find(UIName);
         UIInfo->WidgetInstance = NewWidget;
         UIInfo->State = EUIState::Visible;
     }
 
-    // 
+    // 设置数据
     if (Data)
     {
-        // ҪUI
+        if (UUIBase* UIBase = Cast<UUIBase>(NewWidget))
+        {
+            UIBase->SetData(Data);
+        }
     }
 
-    // ʾUI
-    NewWidget->AddToViewport();
-
     OnUIShown.Broadcast(UIName);
 
     UE_LOG(LogTemp, Log, TEXT("UUIManager::ShowUI - Created and showed UI: %s"), *UIName.ToString());
@@ -325,7 +682,7 @@ UUserWidget* UUIManager::ShowUIByName(FName UIName, UObject* Data)
 {
     if (FUIInfo* UIInfo = UIRegistry.Find(UIName))
     {
-        // ѾԤأֱʹԤصʵ
+        // 如果已经预加载，直接使用预加载的实例
         if (UIInfo->WidgetInstance)
         {
             UIInfo->WidgetInstance->SetVisibility(ESlateVisibility::Visible);
@@ -340,21 +697,30 @@ UUserWidget* UUIManager::ShowUIByName(FName UIName, UObject* Data)
                 }
             }
 
-            // ӵ㼶δӣ
-            if (!UIInfo->WidgetInstance->IsInViewport())
+            // 添加到层级（如果尚未添加），已在层级中则置顶
+            if (!IsInLayer(UIInfo->WidgetInstance, UIInfo->Layer))
             {
                 AddToLayer(UIInfo->WidgetInstance, UIInfo->Layer);
-                UIInfo->WidgetInstance->AddToViewport();
+            }
+            else
+            {
+                BringToFront(UIInfo->WidgetInstance, UIInfo->Layer);
             }
 
             OnUIShown.Broadcast(UIName);
             return UIInfo->WidgetInstance;
         }
-        else
+        else if (ResolveWidgetClass(*UIInfo))
         {
-            // ûԤأʵ
+            // 没有预加载，创建新实例
             return ShowUI(UIInfo->WidgetClass, UIInfo->Layer, Data, UIName);
         }
+        else
+        {
+            // 首次显示时异步加载类，加载完成后显示并广播OnUIShown
+            RequestWidgetClassLoad(UIName, true, Data);
+            return nullptr;
+        }
     }
 
     UE_LOG(LogTemp, Warning, TEXT("UUIManager::ShowUIByName - UI not registered: %s"), *UIName.ToString());
@@ -363,11 +729,14 @@ UUserWidget* UUIManager::ShowUIByName(FName UIName, UObject* Data)
 
 void UUIManager::HideUI(FName UIName)
 {
+    CancelPendingShow(UIName);
+
     if (FUIInfo* UIInfo = UIRegistry.Find(UIName))
     {
         if (UIInfo->WidgetInstance)
         {
-            UIInfo->WidgetInstance->SetVisibility(ESlateVisibility::Hidden);
+            // 折叠后留在层级中，再次显示时不需要重新挂接
+            UIInfo->WidgetInstance->SetVisibility(ESlateVisibility::Collapsed);
             UIInfo->State = EUIState::Hidden;
             OnUIHidden.Broadcast(UIName);
         }
@@ -376,24 +745,31 @@ void UUIManager::HideUI(FName UIName)
 
 void UUIManager::CloseUI(FName UIName)
 {
+    CancelPendingShow(UIName);
+
     if (FUIInfo* UIInfo = UIRegistry.Find(UIName))
     {
         if (IsValid(UIInfo->WidgetInstance))
         {
             RemoveFromLayer(UIInfo->WidgetInstance);
-            UIInfo->WidgetInstance->RemoveFromParent();
+
+            // 频繁开关的界面回收到池中，下次显示时复用
+            if (!UIInfo->bPoolInstance || !ReleaseWidgetToPool(UIInfo->WidgetInstance))
+            {
+                UIInfo->WidgetInstance->RemoveFromParent();
+            }
             UIInfo->WidgetInstance = nullptr;
         }
 
-        // UIͨעģעƳ
-        FUIConfigData TempConfig;  // ʱ
+        // 如果UI不是通过配置注册的，则从注册表中移除
+        FUIConfigData TempConfig;  // 创建临时变量
         if (!UIConfigData || !UIConfigData->GetUIConfig(UIName, TempConfig))
         {
             UIRegistry.Remove(UIName);
         }
         else
         {
-            // ʵ״̬
+            // 重置实例和状态
             UIInfo->WidgetInstance = nullptr;
             UIInfo->State = EUIState::Hidden;
         }
@@ -484,20 +860,110 @@ UCanvasPanel* UUIManager::GetOrCreateLayerPanel(EUIPanelLayer Layer)
     {
         return *FoundPanel;
     }
-    return nullptr;
+
+    if (Layer == EUIPanelLayer::None || !RootCanvas)
+    {
+        return nullptr;
+    }
+
+    UCanvasPanel* LayerPanel = NewObject<UCanvasPanel>(GetTransientPackage(), UCanvasPanel::StaticClass());
+    LayerPanels.Add(Layer, LayerPanel);
+    AttachLayerPanel(Layer);
+    return LayerPanel;
 }
 
 void UUIManager::AddToLayer(UUserWidget* Widget, EUIPanelLayer Layer)
 {
-    // ʵʵУҪWidgetӵָ㼶Ļ
-    UE_LOG(LogTemp, Log, TEXT("UUIManager::AddToLayer - Added widget to layer: %s"),
-        *UEnum::GetValueAsString(Layer));
+    if (!Widget) return;
+
+    UCanvasPanel* LayerPanel = GetOrCreateLayerPanel(Layer);
+    if (!LayerPanel)
+    {
+        // 未初始化层级面板时退回视口，按层级决定叠放顺序
+        Widget->RemoveFromParent();
+        Widget->AddToViewport(static_cast<int32>(Layer));
+        return;
+    }
+
+    AttachRootToViewport();
+
+    if (Widget->GetParent() != LayerPanel)
+    {
+        Widget->RemoveFromParent();
+        if (UCanvasPanelSlot* WidgetSlot = LayerPanel->AddChildToCanvas(Widget))
+        {
+            // 与AddToViewport一致铺满整个层级
+            WidgetSlot->SetAnchors(FAnchors(0.0f, 0.0f, 1.0f, 1.0f));
+            WidgetSlot->SetOffsets(FMargin(0.0f));
+        }
+    }
+
+    BringToFront(Widget, Layer);
 }
 
 void UUIManager::RemoveFromLayer(UUserWidget* Widget)
 {
-    // ʵʵУҪӲ㼶ƳWidget
-    UE_LOG(LogTemp, Log, TEXT("UUIManager::RemoveFromLayer - Removed widget from layer"));
+    // 只影响所在层级面板的布局，不会触发视口重建
+    if (Widget && Widget->GetParent())
+    {
+        Widget->RemoveFromParent();
+    }
+}
+
+bool UUIManager::IsInLayer(UUserWidget* Widget, EUIPanelLayer Layer) const
+{
+    if (!Widget) return false;
+
+    UCanvasPanel* const* FoundPanel = LayerPanels.Find(Layer);
+    if (FoundPanel && *FoundPanel)
+    {
+        return Widget->GetParent() == *FoundPanel;
+    }
+    return Widget->IsInViewport();
+}
+
+void UUIManager::BringToFront(UUserWidget* Widget, EUIPanelLayer Layer)
+{
+    UCanvasPanelSlot* WidgetSlot = Widget ? Cast<UCanvasPanelSlot>(Widget->Slot) : nullptr;
+    if (!WidgetSlot) return;
+
+    int32& TopZOrder = LayerTopZOrder.FindOrAdd(Layer);
+    if (WidgetSlot->GetZOrder() != TopZOrder || TopZOrder == 0)
+    {
+        WidgetSlot->SetZOrder(++TopZOrder);
+    }
+}
+
+void UUIManager::SetLayerCaching(EUIPanelLayer Layer, EUILayerCaching Caching)
+{
+    if (Layer == EUIPanelLayer::None || GetLayerCaching(Layer) == Caching) return;
+
+    LayerCaching.Add(Layer, Caching);
+
+    // 已创建的层级换上新的缓存容器
+    if (LayerPanels.Contains(Layer))
+    {
+        AttachLayerPanel(Layer);
+    }
+}
+
+EUILayerCaching UUIManager::GetLayerCaching(EUIPanelLayer Layer) const
+{
+    const EUILayerCaching* Found = LayerCaching.Find(Layer);
+    return Found ? *Found : DefaultLayerCaching;
+}
+
+void UUIManager::InvalidateLayer(EUIPanelLayer Layer)
+{
+    UContentWidget* Host = LayerHosts.FindRef(Layer);
+    if (UInvalidationBox* InvalidationBox = Cast<UInvalidationBox>(Host))
+    {
+        InvalidationBox->InvalidateCache();
+    }
+    else if (URetainerBox* RetainerBox = Cast<URetainerBox>(Host))
+    {
+        RetainerBox->RequestRender();
+    }
 }
 
 void UUIManager::FadeInUI(FName UIName, float Duration)
@@ -526,7 +992,7 @@ void UUIManager::FadeOutUI(FName UIName, float Duration)
 
 void UUIManager::HandleFadeAnimation(FName UIName, float TargetAlpha, float Duration)
 {
-    // ʵʵУҪʹUMGĶϵͳ
+    // 在实际实现中，这里需要使用UMG的动画系统
     if (FUIInfo* UIInfo = UIRegistry.Find(UIName))
     {
         if (UIInfo->WidgetInstance)
@@ -551,13 +1017,20 @@ void UUIManager::PrintAllUIs()
     for (const auto& Pair : UIRegistry)
     {
         const FUIInfo& UIInfo = Pair.Value;
-        UE_LOG(LogTemp, Log, TEXT("UI: %s, Class: %s, Layer: %s, State: %s, Instance: %s, Preloaded: %s"),
+        UE_LOG(LogTemp, Log, TEXT("UI: %s, Class: %s, Layer: %s, State: %s, Instance: %s, Preloaded: %s, Pool: %s%s"),
             *UIInfo.UIName.ToString(),
-            *UIInfo.WidgetClass->GetName(),
+            UIInfo.WidgetClass ? *UIInfo.WidgetClass->GetName() : *UIInfo.SoftWidgetClass.ToString(),
             *UEnum::GetValueAsString(UIInfo.Layer),
             *UEnum::GetValueAsString(UIInfo.State),
             UIInfo.WidgetInstance ? TEXT("Valid") : TEXT("Null"),
-            UIInfo.bIsPreloaded ? TEXT("Yes") : TEXT("No"));
+            UIInfo.bIsPreloaded ? TEXT("Yes") : TEXT("No"),
+            UIInfo.bPoolInstance ? TEXT("Yes") : TEXT("No"),
+            PendingUILoads.Contains(Pair.Key) ? TEXT(", Loading") : TEXT(""));
+    }
+
+    for (const auto& Pair : WidgetPools)
+    {
+        UE_LOG(LogTemp, Log, TEXT("Pool: %s, Idle: %d"), *GetNameSafe(Pair.Key), Pair.Value.Widgets.Num());
     }
     UE_LOG(LogTemp, Log, TEXT("=========================="));
 }
@@ -567,10 +1040,13 @@ void UUIManager::PrintLayerInfo()
     UE_LOG(LogTemp, Log, TEXT("=== UI Layer Information ==="));
     for (const auto& Pair : LayerPanels)
     {
-        UE_LOG(LogTemp, Log, TEXT("Layer: %s, Panel: %s"),
+        UE_LOG(LogTemp, Log, TEXT("Layer: %s, Panel: %s, Children: %d, Caching: %s"),
             *UEnum::GetValueAsString(Pair.Key),
-            Pair.Value ? TEXT("Valid") : TEXT("Null"));
+            Pair.Value ? TEXT("Valid") : TEXT("Null"),
+            Pair.Value ? Pair.Value->GetChildrenCount() : 0,
+            *UEnum::GetValueAsString(GetLayerCaching(Pair.Key)));
     }
+    UE_LOG(LogTemp, Log, TEXT("Root In Viewport: %s"), RootSlateWidget.IsValid() ? TEXT("Yes") : TEXT("No"));
     UE_LOG(LogTemp, Log, TEXT("============================"));
 }
 
@@ -9,7 +9,7 @@ AXyCharacterBase::AXyCharacterBase()
 
     CurrentState = EXyCharacterState::Idle;
 
-    // Ĭײ
+    // 设置默认碰撞
     GetCapsuleComponent()->SetCollisionEnabled(ECollisionEnabled::QueryAndPhysics);
     GetCapsuleComponent()->SetCollisionResponseToAllChannels(ECR_Block);
     GetCapsuleComponent()->SetCollisionResponseToChannel(ECC_Camera, ECR_Ignore);
@@ -19,25 +19,25 @@ void AXyCharacterBase::BeginPlay()
 {
     Super::BeginPlay();
 
-    // ɫ¼
+    // 触发角色生成事件
     TriggerSimpleCharacterEvent(EGameEventType::PlayerSpawned, GetName(), CharacterData.Health);
 
-    // ԶؽɫԴ
+    // 自动加载角色资源
     LoadCharacterResources();
 }
 
 void AXyCharacterBase::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
-    // Դ
+    // 清理资源
     UnloadCharacterResources();
 
-    // ȡжʱ
-    if (!RespawnTimerId.IsEmpty())
+    // 取消所有定时器
+    if (RespawnTimerHandle.IsValid())
     {
         UMonoManager* MonoMgr = GetMonoManager();
         if (MonoMgr)
         {
-            MonoMgr->ClearTimer(RespawnTimerId);
+            MonoMgr->ClearTimer(RespawnTimerHandle);
         }
     }
 
@@ -48,7 +48,7 @@ void AXyCharacterBase::PossessedBy(AController* NewController)
 {
     Super::PossessedBy(NewController);
 
-    // ¼
+    // 触发被控制事件
     FGameEventData EventData;
     EventData.Actors.Add(NewController);
     TriggerCharacterEvent(EGameEventType::Custom, EventData);
@@ -58,7 +58,7 @@ void AXyCharacterBase::UnPossessed()
 {
     Super::UnPossessed();
 
-    // ʧȥ¼
+    // 触发失去控制事件
     TriggerSimpleCharacterEvent(EGameEventType::Custom, TEXT("CharacterUnpossessed"));
 }
 
@@ -74,7 +74,7 @@ void AXyCharacterBase::InitializeCharacter(const FCharacterData& InData)
 {
     CharacterData = InData;
 
-    // ƶٶ
+    // 设置移动速度
     if (UCharacterMovementComponent* MovementComp = GetCharacterMovement())
     {
         MovementComp->MaxWalkSpeed = CharacterData.MoveSpeed;
@@ -91,16 +91,16 @@ bool AXyCharacterBase::ChangeState(EXyCharacterState NewState)
 
     EXyCharacterState OldState = CurrentState;
 
-    // ˳״̬
+    // 退出旧状态
     OnExitState(OldState);
 
-    // ״̬
+    // 更新状态
     CurrentState = NewState;
 
-    // ״̬
+    // 进入新状态
     OnEnterState(NewState);
 
-    // ״̬ı¼
+    // 触发状态改变事件
     FGameEventData EventData;
     EventData.Values.Add(static_cast<float>(NewState));
     EventData.Texts.Add(UEnum::GetValueAsString(NewState));
@@ -116,14 +116,14 @@ void AXyCharacterBase::ApplyDamage(float Damage, AActor* DamageCauser)
 
     CharacterData.Health = FMath::Max(0.0f, CharacterData.Health - Damage);
 
-    // ˺¼
+    // 触发伤害事件
     FGameEventData EventData;
     EventData.Values.Add(Damage);
     EventData.Values.Add(CharacterData.Health);
     EventData.Actors.Add(DamageCauser);
     TriggerCharacterEvent(EGameEventType::Custom, EventData);
 
-    // 
+    // 检查死亡
     if (CharacterData.Health <= 0)
     {
         ChangeState(EXyCharacterState::Dead);
@@ -137,7 +137,7 @@ void AXyCharacterBase::ApplyHeal(float HealAmount)
 
     CharacterData.Health = FMath::Min(CharacterData.MaxHealth, CharacterData.Health + HealAmount);
 
-    // ¼
+    // 触发治疗事件
     FGameEventData EventData;
     EventData.Values.Add(HealAmount);
     EventData.Values.Add(CharacterData.Health);
@@ -152,7 +152,7 @@ void AXyCharacterBase::LoadCharacterResources()
     UResourceManager* ResourceMgr = GetResourceManager();
     if (ResourceMgr)
     {
-        // ޸ίа󶨷ʽ - ʹȷ C++ ģ巽
+        // 修复委托绑定方式 - 使用正确的 C++ 模板方法
         ResourceMgr->LoadResourceAsyncWithCallback(
             CharacterMeshPath,
             this,
@@ -199,28 +199,28 @@ void AXyCharacterBase::OnEnterState(EXyCharacterState NewState)
         HandleDeath();
         break;
     case EXyCharacterState::Idle:
-        // ״̬߼
+        // 闲置状态逻辑
         break;
     case EXyCharacterState::Moving:
-        // ƶ״̬߼
+        // 移动状态逻辑
         break;
     case EXyCharacterState::Jumping:
-        // Ծ״̬߼
+        // 跳跃状态逻辑
         break;
     case EXyCharacterState::Attacking:
-        // ״̬߼
+        // 攻击状态逻辑
         break;
     }
 }
 
 void AXyCharacterBase::OnExitState(EXyCharacterState OldState)
 {
-    // ״̬˳߼
+    // 状态退出逻辑
 }
 
 void AXyCharacterBase::OnUpdateState(float DeltaTime)
 {
-    // ״̬߼
+    // 状态更新逻辑
 }
 
 void AXyCharacterBase::OnCharacterResourcesLoaded(UObject* LoadedResource)
@@ -234,40 +234,40 @@ void AXyCharacterBase::OnCharacterResourcesLoaded(UObject* LoadedResource)
 
 void AXyCharacterBase::HandleDeath()
 {
-    // ײƶ
+    // 禁用碰撞和移动
     GetCapsuleComponent()->SetCollisionEnabled(ECollisionEnabled::NoCollision);
     SetActorEnableCollision(false);
 
-    // ¼
+    // 触发死亡事件
     TriggerSimpleCharacterEvent(EGameEventType::PlayerDied, TEXT("CharacterDeath"), CharacterData.Health);
 
-    // ʱ
+    // 设置重生定时器
     UMonoManager* MonoMgr = GetMonoManager();
     if (MonoMgr)
     {
-        RespawnTimerId = MonoMgr->SetTimeout(5.0f, this, &AXyCharacterBase::HandleRespawn);
+        RespawnTimerHandle = MonoMgr->SetTimeout(5.0f, this, &AXyCharacterBase::HandleRespawn);
     }
 }
 
 void AXyCharacterBase::HandleRespawn()
 {
-    // ֵ
+    // 重置生命值
     CharacterData.Health = CharacterData.MaxHealth;
 
-    // ײƶ
+    // 启用碰撞和移动
     GetCapsuleComponent()->SetCollisionEnabled(ECollisionEnabled::QueryAndPhysics);
     SetActorEnableCollision(true);
 
-    // ص״̬
+    // 回到闲置状态
     ChangeState(EXyCharacterState::Idle);
 
-    // ¼
+    // 触发重生事件
     TriggerSimpleCharacterEvent(EGameEventType::Custom, TEXT("CharacterRespawned"), CharacterData.Health);
 }
 
 void AXyCharacterBase::InternalUpdateState(float DeltaTime)
 {
-    // ݽɫƶ״̬״̬
+    // 根据角色移动状态更新状态机
     if (CurrentState != EXyCharacterState::Dead)
     {
         UCharacterMovementComponent* Movement = GetCharacterMovement();
@@ -11,19 +11,19 @@ AXyPlayerControllerBase::AXyPlayerControllerBase()
     ControllerSensitivity = 1.0f;
     CachedInputComponent = nullptr;
     CachedXyCharacter = nullptr;
-    bCachedCharacterValid = false;  // 
+    bCachedCharacterValid = false;  // 添加这个
 }
 
 void AXyPlayerControllerBase::BeginPlay()
 {
     Super::BeginPlay();
 
-    // ģʽ
+    // 设置输入模式
     FInputModeGameOnly InputMode;
     SetInputMode(InputMode);
     bShowMouseCursor = false;
 
-    // ע¼
+    // 注册事件监听
     RegisterEventListeners();
 
     UE_LOG(LogTemp, Log, TEXT("XyPlayerControllerBase BeginPlay"));
@@ -31,7 +31,7 @@ void AXyPlayerControllerBase::BeginPlay()
 
 void AXyPlayerControllerBase::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
-    // Ƴ¼
+    // 移除事件监听
     UnregisterEventListeners();
 
     Super::EndPlay(EndPlayReason);
@@ -41,14 +41,14 @@ void AXyPlayerControllerBase::OnPossess(APawn* InPawn)
 {
     Super::OnPossess(InPawn);
 
-    // »Ľɫָ
+    // 更新缓存的角色指针
     CachedXyCharacter = Cast<AXyCharacterBase>(InPawn);
-    bCachedCharacterValid = IsValid(CachedXyCharacter);  // ЧԱ־
+    bCachedCharacterValid = IsValid(CachedXyCharacter);  // 设置有效性标志
 
-    // ½ɫ
+    // 绑定新角色的输入
     BindCharacterInputs();
 
-    // ¼
+    // 触发控制事件
     if (bCachedCharacterValid)
     {
         CachedXyCharacter->TriggerSimpleCharacterEvent(EGameEventType::Custom, TEXT("CharacterPossessed"));
@@ -57,15 +57,15 @@ void AXyPlayerControllerBase::OnPossess(APawn* InPawn)
 
 void AXyPlayerControllerBase::OnUnPossess()
 {
-    // ʧȥ¼
+    // 触发失去控制事件
     if (bCachedCharacterValid)
     {
         CachedXyCharacter->TriggerSimpleCharacterEvent(EGameEventType::Custom, TEXT("CharacterUnpossessed"));
     }
 
-    // 
+    // 清除缓存
     CachedXyCharacter = nullptr;
-    bCachedCharacterValid = false;  // ñ־
+    bCachedCharacterValid = false;  // 重置标志
 
     Super::OnUnPossess();
 }
@@ -83,17 +83,17 @@ void AXyPlayerControllerBase::BindCharacterInputs()
     if (!CachedInputComponent)
         return;
 
-    // а
+    // 清除现有绑定
     CachedInputComponent->ClearActionBindings();
     CachedInputComponent->AxisBindings.Empty();
 
-    // 
+    // 绑定轴输入
     CachedInputComponent->BindAxis("MoveForward", this, &AXyPlayerControllerBase::HandleMoveForward);
     CachedInputComponent->BindAxis("MoveRight", this, &AXyPlayerControllerBase::HandleMoveRight);
     CachedInputComponent->BindAxis("LookUp", this, &AXyPlayerControllerBase::HandleLookUp);
     CachedInputComponent->BindAxis("Turn", this, &AXyPlayerControllerBase::HandleTurn);
 
-    // 󶨶
+    // 绑定动作输入
     CachedInputComponent->BindAction("Jump", IE_Pressed, this, &AXyPlayerControllerBase::HandleJump);
     CachedInputComponent->BindAction("Jump", IE_Released, this, &AXyPlayerControllerBase::HandleStopJumping);
     CachedInputComponent->BindAction("Attack", IE_Pressed, this, &AXyPlayerControllerBase::HandleAttack);
@@ -107,26 +107,26 @@ void AXyPlayerControllerBase::SetInputEnabled(bool bEnabled)
 
     if (bInputEnabled)
     {
-        // 
+        // 启用输入
         GetPawn()->EnableInput(this);
     }
     else
     {
-        // 
+        // 禁用输入
         GetPawn()->DisableInput(this);
     }
 }
 
-// Ż GetXyCharacter 
+// 优化的 GetXyCharacter 方法
 AXyCharacterBase* AXyPlayerControllerBase::GetXyCharacter() const
 {
-    // Чֱӷ
+    // 如果缓存有效，直接返回
     if (IsValid(CachedXyCharacter))
     {
         return CachedXyCharacter;
     }
 
-    // Чʱ»ȡ
+    // 缓存无效时重新获取
     CachedXyCharacter = Cast<AXyCharacterBase>(GetPawn());
     return CachedXyCharacter;
 }
@@ -135,7 +135,7 @@ void AXyPlayerControllerBase::RespawnCharacter()
 {
     if (GetXyCharacter() && !GetXyCharacter()->IsAlive())
     {
-        // ߼
+        // 重生逻辑
     }
 }
 
@@ -144,7 +144,7 @@ void AXyPlayerControllerBase::RegisterEventListeners()
     UMyEventManager* EventMgr = GetEventManager();
     if (EventMgr)
     {
-        // עC++¼
+        // 注册C++事件监听
         EventMgr->RegisterCppEvent<AXyPlayerControllerBase, EGameEventType, const FGameEventData&>(
             FName("CharacterEvents"),
             this,
@@ -158,12 +158,12 @@ void AXyPlayerControllerBase::UnregisterEventListeners()
     UMyEventManager* EventMgr = GetEventManager();
     if (EventMgr)
     {
-        // Ƴ¼
+        // 移除事件监听
         EventMgr->RemoveCppEvent(FName("CharacterEvents"));
     }
 }
 
-// ========== 봦ʵ ==========
+// ========== 输入处理实现 ==========
 
 void AXyPlayerControllerBase::HandleMoveForward(float Value)
 {
@@ -243,15 +243,15 @@ void AXyPlayerControllerBase::HandleAttack()
     AXyCharacterBase* ControlledCharacter = GetXyCharacter();
     if (ControlledCharacter && ControlledCharacter->IsAlive())
     {
-        // ¼
+        // 触发攻击事件
         ControlledCharacter->TriggerSimpleCharacterEvent(EGameEventType::Custom, TEXT("CharacterAttack"));
 
-        // չ߼
+        // 这里可以扩展攻击逻辑
         // ControlledCharacter->ChangeState(EXyCharacterState::Attacking);
     }
 }
 
-// ========== ¼ص ==========
+// ========== 事件回调 ==========
 
 void AXyPlayerControllerBase::OnCharacterEvent(EGameEventType EventType, const FGameEventData& EventData)
 {
@@ -261,23 +261,23 @@ void AXyPlayerControllerBase::OnCharacterEvent(EGameEventType EventType, const F
         HandleCharacterDeath();
         break;
     case EGameEventType::PlayerSpawned:
-        // ɫ
+        // 处理角色生成
         break;
     case EGameEventType::ItemCollected:
-        // Ʒռ
+        // 处理物品收集
         break;
     default:
-        // Զ¼
+        // 处理其他自定义事件
         break;
     }
 }
 
 void AXyPlayerControllerBase::HandleCharacterDeath()
 {
-    // ɫʱ
+    // 角色死亡时禁用输入
     SetInputEnabled(false);
 
-    // ʱ
+    // 设置重生定时器
     UMonoManager* MonoMgr = GetMonoManager();
     if (MonoMgr)
     {
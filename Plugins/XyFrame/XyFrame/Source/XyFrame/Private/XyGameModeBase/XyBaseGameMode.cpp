@@ -8,14 +8,14 @@ AXyBaseGameMode::AXyBaseGameMode()
 {
     WorldInitState = EWorldInitState::NotInitialized;
 
-    // Ĭҿ
+    // 设置默认玩家控制器类
     static ConstructorHelpers::FClassFinder<APlayerController> PlayerControllerBPClass(TEXT("/Game/Blueprints/BP_PlayerController"));
     if (PlayerControllerBPClass.Class != nullptr)
     {
         PlayerControllerClass = PlayerControllerBPClass.Class;
     }
 
-    // ĬPawn
+    // 设置默认玩家Pawn类
     static ConstructorHelpers::FClassFinder<APawn> PlayerPawnBPClass(TEXT("/Game/Blueprints/BP_PlayerPawn"));
     if (PlayerPawnBPClass.Class != nullptr)
     {
@@ -30,7 +30,7 @@ void AXyBaseGameMode::BeginPlay()
 
     UE_LOG(LogTemp, Log, TEXT("BaseGameMode BeginPlay - Starting world initialization"));
 
-    // ѡͬ첽ʼ
+    // 根据配置选择同步或异步初始化
     FWorldConfig Config = GetWorldConfig();
     if (Config.bAsyncInitialization)
     {
@@ -46,13 +46,13 @@ void AXyBaseGameMode::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
     UE_LOG(LogTemp, Log, TEXT("BaseGameMode EndPlay - Shutting down world"));
 
-    // ر
+    // 关闭世界
     ShutdownWorld();
 
     Super::EndPlay(EndPlayReason);
 }
 
-// ========== ڹ ==========
+// ========== 世界生命周期管理 ==========
 
 void AXyBaseGameMode::InitializeWorld()
 {
@@ -67,7 +67,7 @@ void AXyBaseGameMode::InitializeWorld()
 
     bool bSuccess = true;
 
-    // ִгʼ
+    // 执行初始化步骤
     PreInitializeWorld();
 
     InitializeFrameworkSystems();
@@ -75,7 +75,7 @@ void AXyBaseGameMode::InitializeWorld()
     InitializeWorldState();
     InitializePlayers();
 
-    // ûзΪʼɹ
+    // 如果没有发生错误，则认为初始化成功
     if (bSuccess)
     {
         PostInitializeWorld();
@@ -88,7 +88,7 @@ void AXyBaseGameMode::InitializeWorld()
         UE_LOG(LogTemp, Error, TEXT("World initialization failed"));
     }
 
-    // ʼ
+    // 处理初始化完成
     HandleWorldInitialized(bSuccess);
 }
 
@@ -103,16 +103,16 @@ void AXyBaseGameMode::InitializeWorldAsync()
 
     if (Config.InitializationDelay > 0.0f)
     {
-        // ӳٳʼ - ʹóԱ
+        // 延迟初始化 - 使用成员函数绑定
         UMonoManager* MonoMgr = GetMonoManager();
         if (MonoMgr)
         {
-            AsyncInitTimerId = MonoMgr->SetTimeout(Config.InitializationDelay, this, &AXyBaseGameMode::InitializeWorld);
+            AsyncInitTimerHandle = MonoMgr->SetTimeout(Config.InitializationDelay, this, &AXyBaseGameMode::InitializeWorld);
         }
     }
     else
     {
-        // ʼһ֡
+        // 立即初始化（下一帧）
         if (GetWorld())
         {
             GetWorld()->GetTimerManager().SetTimerForNextTick([this]() {
@@ -126,23 +126,23 @@ void AXyBaseGameMode::ShutdownWorld()
 {
     UE_LOG(LogTemp, Log, TEXT("Shutting down world..."));
 
-    // ȡ첽ʼʱ
-    if (!AsyncInitTimerId.IsEmpty())
+    // 取消异步初始化计时器
+    if (AsyncInitTimerHandle.IsValid())
     {
         UMonoManager* MonoMgr = GetMonoManager();
         if (MonoMgr)
         {
-            MonoMgr->ClearTimer(AsyncInitTimerId);
+            MonoMgr->ClearTimer(AsyncInitTimerHandle);
         }
     }
 
-    // ִйرղ
+    // 执行关闭步骤
     PreShutdownWorld();
     SaveWorldState();
     CleanupWorldResources();
     PostShutdownWorld();
 
-    // 㲥¼
+    // 广播事件
     OnWorldShutdown.Broadcast();
 
     UE_LOG(LogTemp, Log, TEXT("World shutdown completed"));
@@ -157,7 +157,7 @@ void AXyBaseGameMode::RestartWorld()
     InitializeWorld();
 }
 
-// ========== ҹĬʵ ==========
+// ========== 玩家管理默认实现 ==========
 
 bool AXyBaseGameMode::ShouldSpawnPlayer_Implementation() const
 {
@@ -192,7 +192,7 @@ FTransform AXyBaseGameMode::GetPlayerSpawnTransform_Implementation(AController*
     return Config.SpawnTransform;
 }
 
-// ========== Ĭʵ ==========
+// ========== 世界配置默认实现 ==========
 
 FWorldConfig AXyBaseGameMode::GetWorldConfig_Implementation() const
 {
@@ -204,7 +204,7 @@ void AXyBaseGameMode::SetWorldConfig(const FWorldConfig& NewConfig)
     WorldConfiguration = NewConfig;
 }
 
-// ========== ܼ ==========
+// ========== 框架集成 ==========
 
 UResourceManager* AXyBaseGameMode::GetResourceManager() const
 {
@@ -221,19 +221,19 @@ USaveGameTool* AXyBaseGameMode::GetSaveGameTool() const
     return USaveGameTool::GetSaveGameTool();
 }
 
-// ========== ʼĬʵ ==========
+// ========== 初始化步骤默认实现 ==========
 
 void AXyBaseGameMode::PreInitializeWorld_Implementation()
 {
     UE_LOG(LogTemp, Log, TEXT("Pre-initializing world..."));
-    // ʵΪգд
+    // 基类实现为空，子类可以重写
 }
 
 void AXyBaseGameMode::InitializeFrameworkSystems_Implementation()
 {
     UE_LOG(LogTemp, Log, TEXT("Initializing framework systems..."));
 
-    // ȷܵѳʼ
+    // 确保框架单例已初始化
     UResourceManager* ResourceMgr = GetResourceManager();
     UMonoManager* MonoMgr = GetMonoManager();
     USaveGameTool* SaveTool = GetSaveGameTool();
@@ -248,7 +248,7 @@ void AXyBaseGameMode::InitializeFrameworkSystems_Implementation()
 void AXyBaseGameMode::LoadWorldResources_Implementation()
 {
     UE_LOG(LogTemp, Log, TEXT("Loading world resources..."));
-    // ʵΪգдضԴ
+    // 基类实现为空，子类可以重写来加载特定资源
 }
 
 void AXyBaseGameMode::InitializeWorldState_Implementation()
@@ -257,13 +257,13 @@ void AXyBaseGameMode::InitializeWorldState_Implementation()
 
     FWorldConfig Config = GetWorldConfig();
 
-    // ҪӴ浵
+    // 如果需要从存档加载
     if (Config.bLoadFromSave && !Config.SaveSlotName.IsEmpty())
     {
         USaveGameTool* SaveTool = GetSaveGameTool();
         if (SaveTool)
         {
-            // Լ
+            // 尝试加载世界数据
             FWorldSaveData WorldData;
             if (SaveTool->LoadWorldDataStruct(WorldData, Config.SaveSlotName))
             {
@@ -280,21 +280,21 @@ void AXyBaseGameMode::InitializeWorldState_Implementation()
 void AXyBaseGameMode::InitializePlayers_Implementation()
 {
     UE_LOG(LogTemp, Log, TEXT("Initializing players..."));
-    // ʵΪգдʼ߼
+    // 基类实现为空，子类可以重写来初始化玩家相关逻辑
 }
 
 void AXyBaseGameMode::PostInitializeWorld_Implementation()
 {
     UE_LOG(LogTemp, Log, TEXT("Post-initializing world..."));
-    // ʵΪգд
+    // 基类实现为空，子类可以重写
 }
 
-// ========== رղĬʵ ==========
+// ========== 关闭步骤默认实现 ==========
 
 void AXyBaseGameMode::PreShutdownWorld_Implementation()
 {
     UE_LOG(LogTemp, Log, TEXT("Pre-shutting down world..."));
-    // ʵΪգд
+    // 基类实现为空，子类可以重写
 }
 
 void AXyBaseGameMode::SaveWorldState_Implementation()
@@ -303,14 +303,14 @@ void AXyBaseGameMode::SaveWorldState_Implementation()
 
     FWorldConfig Config = GetWorldConfig();
 
-    // ˴浵״̬
+    // 如果配置了存档，保存世界状态
     if (Config.bLoadFromSave && !Config.SaveSlotName.IsEmpty())
     {
         USaveGameTool* SaveTool = GetSaveGameTool();
         if (SaveTool)
         {
             FWorldSaveData WorldData;
-            // д
+            // 子类可以重写来填充世界数据
             if (SaveTool->SaveWorldDataStruct(WorldData, Config.SaveSlotName))
             {
                 UE_LOG(LogTemp, Log, TEXT("World state saved: %s"), *Config.SaveSlotName);
@@ -327,24 +327,24 @@ void AXyBaseGameMode::CleanupWorldResources_Implementation()
 {
     UE_LOG(LogTemp, Log, TEXT("Cleaning up world resources..."));
 
-    // Դ棨ѡ
+    // 清理资源管理器缓存（可选）
     UResourceManager* ResourceMgr = GetResourceManager();
     if (ResourceMgr)
     {
         ResourceMgr->ClearCache();
     }
 
-    //е
+    //清理所有单例
     USingletonManager::GetInstance()->DestroyAllSingletons();
 }
 
 void AXyBaseGameMode::PostShutdownWorld_Implementation()
 {
     UE_LOG(LogTemp, Log, TEXT("Post-shutting down world..."));
-    // ʵΪգд
+    // 基类实现为空，子类可以重写
 }
 
-// ========== ʵ ==========
+// ========== 其他方法实现 ==========
 
 void AXyBaseGameMode::InitializeWorldWithCallback(const FOnWorldInitCallback& Callback)
 {
@@ -355,23 +355,23 @@ void AXyBaseGameMode::InitializeWorldWithCallback(const FOnWorldInitCallback& Ca
 
     if (WorldInitState == EWorldInitState::Initialized)
     {
-        // Ѿʼִлص
+        // 如果已经初始化，立即执行回调
         Callback.Execute(true);
     }
     else if (WorldInitState == EWorldInitState::NotInitialized)
     {
-        // δʼʼʼ
+        // 如果未初始化，开始初始化
         InitializeWorld();
     }
-    // ڳʼصڳʼɺִ
+    // 如果正在初始化，回调会在初始化完成后执行
 }
 
 void AXyBaseGameMode::HandleWorldInitialized(bool bSuccess)
 {
-    // 㲥¼
+    // 广播事件
     OnWorldInitialized.Broadcast(bSuccess);
 
-    // ִлص
+    // 执行回调
     for (const FOnWorldInitCallback& Callback : InitCallbacks)
     {
         if (Callback.IsBound())
@@ -384,8 +384,8 @@ void AXyBaseGameMode::HandleWorldInitialized(bool bSuccess)
 
 void AXyBaseGameMode::ExecuteAsyncInitialization()
 {
-    // ڲҪˣΪInitializeWorldAsyncֱӴ
-    // ʵԱӴ
+    // 这个方法现在不需要了，因为我们在InitializeWorldAsync中直接处理了
+    // 保留这个空实现以避免链接错误
 }
 
 APawn* AXyBaseGameMode::SpawnDefaultPlayer(AController* NewPlayer)
@@ -399,7 +399,7 @@ APawn* AXyBaseGameMode::SpawnDefaultPlayer(AController* NewPlayer)
     FPlayerSpawnConfig Config = GetPlayerSpawnConfig();
     FTransform SpawnTransform = GetPlayerSpawnTransform(NewPlayer);
 
-    // ȷҪɵPawn
+    // 确定要生成的Pawn类
     TSubclassOf<APawn> PawnClass = Config.PlayerPawnClass;
     if (!PawnClass)
     {
@@ -412,7 +412,7 @@ APawn* AXyBaseGameMode::SpawnDefaultPlayer(AController* NewPlayer)
         return nullptr;
     }
 
-    // Pawn
+    // 生成玩家Pawn
     FActorSpawnParameters SpawnParams;
     SpawnParams.Owner = NewPlayer;
     SpawnParams.Instigator = GetInstigator();
@@ -422,7 +422,7 @@ APawn* AXyBaseGameMode::SpawnDefaultPlayer(AController* NewPlayer)
 
     if (SpawnedPawn)
     {
-        // ҿ
+        // 设置玩家控制器
         NewPlayer->Possess(SpawnedPawn);
         UE_LOG(LogTemp, Log, TEXT("Player spawned successfully: %s"), *SpawnedPawn->GetName());
     }
@@ -7,6 +7,7 @@
 #include "Sound/SoundBase.h"
 #include "Components/AudioComponent.h"
 #include "Engine/DataTable.h"
+#include "Engine/StreamableManager.h"
 #include "AudioManager.generated.h"
 
 // 音频类别
@@ -23,6 +24,23 @@ enum class EAudioCategory : uint8
 // 添加枚举范围定义
 ENUM_RANGE_BY_COUNT(EAudioCategory, 5)
 
+// 音频资源未加载时的播放策略
+UENUM(BlueprintType)
+enum class EAudioLoadPolicy : uint8
+{
+    QueueUntilLoaded  UMETA(DisplayName = "Queue Until Loaded"),
+    DropIfNotLoaded   UMETA(DisplayName = "Drop If Not Loaded")
+};
+
+// 音频组件池耗尽时的处理策略
+UENUM(BlueprintType)
+enum class EAudioPoolOverflowPolicy : uint8
+{
+    CreateTransient  UMETA(DisplayName = "Create Transient Component"),
+    StealOldest      UMETA(DisplayName = "Steal Oldest"),
+    Drop             UMETA(DisplayName = "Drop")
+};
+
 // 音频配置结构
 USTRUCT(BlueprintType)
 struct FAudioConfig : public FTableRowBase
@@ -52,6 +70,106 @@ struct FAudioConfig : public FTableRowBase
 
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Audio")
     int32 Priority = 0;
+
+    // 资源未加载时排队等待还是直接丢弃（两种情况都会发起异步加载）
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Audio|Loading")
+    EAudioLoadPolicy LoadPolicy = EAudioLoadPolicy::QueueUntilLoaded;
+
+    // 排队等待加载的最长时间（秒），超时的播放请求被丢弃，0表示不限
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Audio|Loading", meta = (ClampMin = "0.0"))
+    float MaxQueueDelay = 0.0f;
+};
+
+// 单个World的音频组件池，组件预先注册，播放时只重置参数
+USTRUCT()
+struct FAudioComponentPool
+{
+    GENERATED_BODY()
+
+    TWeakObjectPtr<UWorld> World;
+
+    // 池中全部组件（持有引用）
+    UPROPERTY()
+    TArray<UAudioComponent*> Components;
+
+    UPROPERTY()
+    TArray<UAudioComponent*> FreeComponents;
+
+    // 使用中的组件，按取出顺序排列，溢出时从头部抢占
+    UPROPERTY()
+    TArray<UAudioComponent*> InUseComponents;
+};
+
+// 活跃发声信息
+USTRUCT()
+struct FActiveSoundInfo
+{
+    GENERATED_BODY()
+
+    FName SoundID;
+    EAudioCategory Category = EAudioCategory::SFX;
+    int32 Priority = 0;
+    bool bLooping = false;
+
+    // 衰减范围，0表示不受距离影响
+    float AudibleDistance = 0.0f;
+
+    // 调用方传入的音调倍率（不含配置倍率），虚拟化后恢复时使用
+    float PitchMultiplier = 1.0f;
+
+    // 开始播放时的World音频时间，用于虚拟化后恢复播放进度
+    double StartTime = 0.0;
+};
+
+// 虚拟发声：超出可闻范围或被抢占的音频，不占用组件，只推进播放时间
+struct FVirtualSound
+{
+    FName SoundID;
+    EAudioCategory Category = EAudioCategory::SFX;
+    TWeakObjectPtr<UWorld> World;
+    TWeakObjectPtr<AActor> AttachActor;
+    bool bHasAttachActor = false;
+    FVector Location = FVector::ZeroVector;
+    float PitchMultiplier = 1.0f;
+    float AudibleDistance = 0.0f;
+    float Duration = 0.0f;
+    bool bLooping = false;
+    double StartTime = 0.0;
+};
+
+// 本帧收集的SFX请求，同ID且距离相近的请求合并为一次播放
+struct FPendingSFXRequest
+{
+    FName SoundID;
+    TWeakObjectPtr<UObject> WorldContextObject;
+    TWeakObjectPtr<AActor> AttachActor;
+    FVector Location = FVector::ZeroVector;
+    float PitchMultiplier = 1.0f;
+    float VolumeScale = 1.0f;
+    int32 MergedCount = 1;
+};
+
+// 最近播放的SFX，合并窗口内的同ID请求直接并入
+struct FRecentSFX
+{
+    FName SoundID;
+    TWeakObjectPtr<UAudioComponent> Component;
+    TWeakObjectPtr<AActor> AttachActor;
+    FVector Location = FVector::ZeroVector;
+    float VolumeScale = 1.0f;
+    double PlayTime = 0.0;
+};
+
+// 等待音频资源加载完成后执行的播放请求
+struct FQueuedSoundPlay
+{
+    TWeakObjectPtr<UObject> WorldContextObject;
+    TWeakObjectPtr<AActor> AttachActor;
+    bool bHasAttachActor = false;
+    FVector Location = FVector::ZeroVector;
+    float FadeInTime = 0.0f;
+    float PitchMultiplier = 1.0f;
+    double RequestTime = 0.0;
 };
 
 // 委托声明
@@ -82,7 +200,9 @@ public:
 
     // 构造函数
     UAudioManager();
-    virtual ~UAudioManager() override;
+
+    // 销毁时停止所有发声并清理计时器，不广播OnSoundFinished
+    virtual void BeginDestroy() override;
 
     // ========== 基础音频接口 ==========
 
@@ -106,7 +226,7 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Audio")
     void StopSound(FName SoundID);
 
-    // 停止所有音频
+    // 停止所有音频，与StopSound和按类别停止一样，每个被停止的真实发声都会广播OnSoundFinished
     UFUNCTION(BlueprintCallable, Category = "Audio")
     void StopAllSounds();
 
@@ -126,6 +246,34 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Audio|SFX")
     void StopAllSFX();
 
+    // 立即播放本帧收集的SFX请求（通常在下一帧自动执行）
+    UFUNCTION(BlueprintCallable, Category = "Audio|SFX")
+    void FlushSFXBatch();
+
+    // SFX请求总数与被合并的请求数
+    UFUNCTION(BlueprintCallable, Category = "Audio|SFX")
+    void GetSFXBatchStats(int32& OutRequests, int32& OutMerged) const;
+
+    // PlaySFX是否按帧收集、合并后批量播放
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Audio|SFX")
+    bool bBatchSFX;
+
+    // 同ID请求合并的距离
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Audio|SFX", meta = (ClampMin = "0.0"))
+    float SFXMergeDistance;
+
+    // 与已播放的同ID音效合并的时间窗口（秒）
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Audio|SFX", meta = (ClampMin = "0.0"))
+    float SFXMergeWindow;
+
+    // 每合并一次请求提升的音量比例，0表示不提升
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Audio|SFX", meta = (ClampMin = "0.0"))
+    float SFXMergeVolumeStep;
+
+    // 合并后音量比例的上限
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Audio|SFX", meta = (ClampMin = "1.0"))
+    float SFXMaxMergedVolumeScale;
+
     // BGM 管理
     UFUNCTION(BlueprintCallable, Category = "Audio|BGM")
     void PlayBGM(UObject* WorldContextObject, FName SoundID, float FadeTime = 1.0f);
@@ -184,6 +332,91 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Audio|Volume")
     void ResetAllVolumes();
 
+    // ========== 音频预加载 ==========
+
+    // 预加载单个音频资源并保持引用：不在内存中的资源走异步预热，完成后常驻；SoundID无效时返回false
+    UFUNCTION(BlueprintCallable, Category = "Audio|Preload")
+    bool PreloadSound(FName SoundID);
+
+    // 批量预加载音频资源
+    UFUNCTION(BlueprintCallable, Category = "Audio|Preload")
+    void PreloadSounds(const TArray<FName>& SoundIDs);
+
+    // 音频是否已预加载
+    UFUNCTION(BlueprintCallable, Category = "Audio|Preload")
+    bool IsSoundPreloaded(FName SoundID) const;
+
+    // 释放所有预加载的音频引用
+    UFUNCTION(BlueprintCallable, Category = "Audio|Preload")
+    void ReleasePreloadedSounds();
+
+    // 异步预热某个类别的全部音频，完成后常驻
+    UFUNCTION(BlueprintCallable, Category = "Audio|Preload")
+    void PrewarmCategory(EAudioCategory Category);
+
+    // 异步预热一组音频，完成后常驻
+    UFUNCTION(BlueprintCallable, Category = "Audio|Preload")
+    void PrewarmSounds(const TArray<FName>& SoundIDs);
+
+    // 音频是否正在异步加载
+    UFUNCTION(BlueprintCallable, Category = "Audio|Preload")
+    bool IsSoundLoading(FName SoundID) const;
+
+    // 播放时资源已常驻的次数（命中）与需要等待加载的次数（未命中）
+    UFUNCTION(BlueprintCallable, Category = "Audio|Preload")
+    void GetSoundCacheStats(int32& OutHits, int32& OutMisses) const;
+
+    UFUNCTION(BlueprintCallable, Category = "Audio|Preload")
+    void ResetSoundCacheStats();
+
+    // ========== 音频组件池 ==========
+
+    // 为指定World预先创建并注册音频组件
+    UFUNCTION(BlueprintCallable, Category = "Audio|Pool", meta = (WorldContext = "WorldContextObject"))
+    void WarmupAudioPool(UObject* WorldContextObject, int32 Count);
+
+    // 销毁所有World的音频组件池
+    UFUNCTION(BlueprintCallable, Category = "Audio|Pool")
+    void ClearAudioPools();
+
+    // 是否使用音频组件池
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Audio|Pool")
+    bool bUseAudioComponentPool;
+
+    // 每个World首次播放时预先创建的组件数量
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Audio|Pool", meta = (ClampMin = "0"))
+    int32 AudioPoolInitialSize;
+
+    // 每个World池中组件的上限
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Audio|Pool", meta = (ClampMin = "1"))
+    int32 AudioPoolMaxSize;
+
+    // 池耗尽时的处理策略
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Audio|Pool")
+    EAudioPoolOverflowPolicy AudioPoolOverflowPolicy;
+
+    // ========== 发声数限制与虚拟化 ==========
+
+    // 全局同时发声上限，0表示不限
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Audio|Voices", meta = (ClampMin = "0"))
+    int32 MaxGlobalVoices;
+
+    // 各类别同时发声上限，未配置或为0表示不限
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Audio|Voices")
+    TMap<EAudioCategory, int32> CategoryVoiceLimits;
+
+    // 虚拟发声检查间隔（秒）
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Audio|Voices", meta = (ClampMin = "0.02"))
+    float VirtualVoiceUpdateInterval;
+
+    // 循环音频超出衰减范围的倍数后才降级为虚拟发声，避免在边界上反复切换
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Audio|Voices", meta = (ClampMin = "1.0"))
+    float VirtualizeDistanceMargin;
+
+    // 获取虚拟发声数量
+    UFUNCTION(BlueprintCallable, Category = "Audio|Voices")
+    int32 GetVirtualSoundCount() const { return VirtualSounds.Num(); }
+
     // ========== 音频状态查询 ==========
 
     // 检查音频是否正在播放
@@ -208,11 +441,20 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Audio|Debug")
     void PrintCategoryStatus(EAudioCategory Category);
 
+    // 对比组件池与逐次创建/销毁组件播放一次性音效的耗时
+    UFUNCTION(BlueprintCallable, Category = "Audio|Debug", meta = (WorldContext = "WorldContextObject"))
+    void BenchmarkAudioPool(UObject* WorldContextObject, FName SoundID, int32 PlayCount = 1000);
+
+    // 在听者周围随机位置持续维持大量音效，Duration秒内逐帧统计补发播放与虚拟发声更新的耗时
+    UFUNCTION(BlueprintCallable, Category = "Audio|Debug", meta = (WorldContext = "WorldContextObject"))
+    void StressTestVoices(UObject* WorldContextObject, FName SoundID, int32 SoundCount = 300, float Radius = 5000.0f, float Duration = 5.0f);
+
     // ========== 委托 ==========
 
     UPROPERTY(BlueprintAssignable, Category = "Audio|Events")
     FOnSoundStarted OnSoundStarted;
 
+    // 自然播完、被抢占或被任意Stop接口停止时广播；排队或虚拟中的发声被取消时不广播
     UPROPERTY(BlueprintAssignable, Category = "Audio|Events")
     FOnSoundFinished OnSoundFinished;
 
@@ -226,7 +468,11 @@ private:
 
     // 活跃音频组件映射
     UPROPERTY()
-    TMap<UAudioComponent*, FName> ActiveComponents;
+    TMap<UAudioComponent*, FActiveSoundInfo> ActiveComponents;
+
+    // 二级索引：SoundID/类别 → 活跃组件，引用由ActiveComponents持有
+    TMap<FName, TArray<UAudioComponent*>> ComponentsBySoundID;
+    TMap<EAudioCategory, TArray<UAudioComponent*>> ComponentsByCategory;
 
     // 类别音量
     TMap<EAudioCategory, float> CategoryVolumes;
@@ -235,12 +481,111 @@ private:
     UPROPERTY()
     UAudioComponent* CurrentBGMComponent;
 
+    // 预加载的音频资源
+    UPROPERTY()
+    TMap<FName, USoundBase*> PreloadedSounds;
+
+    // 各World的音频组件池
+    UPROPERTY()
+    TArray<FAudioComponentPool> AudioPools;
+
+    // 池化组件集合，用于区分池化组件与临时组件
+    TSet<const UAudioComponent*> PooledComponentSet;
+
+    // SFX批处理
+    TArray<FPendingSFXRequest> PendingSFXRequests;
+    TArray<FRecentSFX> RecentSFX;
+    FTimerHandle SFXFlushTimerHandle;
+    TWeakObjectPtr<UWorld> SFXFlushTimerWorld;
+    int32 SFXRequestCount;
+    int32 SFXMergedCount;
+
+    // 虚拟发声
+    TArray<FVirtualSound> VirtualSounds;
+    FTimerHandle VirtualVoiceTimerHandle;
+    TWeakObjectPtr<UWorld> VirtualVoiceTimerWorld;
+
+    // 每个音频最多排队的播放请求数量
+    UPROPERTY(EditAnywhere, Category = "Audio|Loading", meta = (ClampMin = "1"))
+    int32 MaxQueuedPlaysPerSound;
+
+    // 异步加载
+    FStreamableManager StreamableManager;
+    TMap<FName, TSharedPtr<FStreamableHandle>> PendingSoundLoads;
+    TMap<FName, TArray<FQueuedSoundPlay>> QueuedPlays;
+
+    // 加载完成后需要常驻的音频（PreloadSound与预热请求）
+    TSet<FName> PinnedSoundLoads;
+
+    int32 SoundCacheHits;
+    int32 SoundCacheMisses;
+
     // 内部方法
     const FAudioConfig* GetAudioConfig(FName SoundID) const;
 
-    // 音频完成处理
-    UFUNCTION()
-    void HandleAudioFinished();
+    // 查找已常驻内存的音频资源，不触发加载
+    USoundBase* FindResidentSound(FName SoundID, const FAudioConfig& Config) const;
+
+    // 发起音频（及其衰减设置）的异步加载，已在加载中则忽略；bPinWhenLoaded时完成后加入PreloadedSounds常驻
+    void RequestSoundLoad(FName SoundID, const FAudioConfig& Config, bool bPinWhenLoaded = false);
+
+    void HandleSoundLoaded(FName SoundID);
+
+    // 资源就绪后创建组件并播放；StartOffset大于0表示从虚拟发声恢复
+    UAudioComponent* PlayLoadedSound(UWorld* World, FName SoundID, const FAudioConfig& Config, USoundBase* SoundAsset,
+        AActor* AttachActor, FVector Location, float FadeInTime, float PitchMultiplier, float StartOffset = 0.0f);
+
+    // 发声数限制：有空位直接通过，否则选出可被抢占的优先级更低或更安静的发声，由调用方在拿到组件后抢占
+    bool AcquireVoice(UWorld* World, const FAudioConfig& Config, float Audibility, UAudioComponent*& OutVictim);
+    bool HasFreeVoice(EAudioCategory Category) const;
+    void StealVoice(UAudioComponent* AudioComponent);
+
+    bool GetListenerLocation(UWorld* World, FVector& OutLocation) const;
+    float GetAudibleDistance(const FAudioConfig& Config, const USoundBase* SoundAsset) const;
+    float GetComponentAudibility(const UAudioComponent* AudioComponent, const FActiveSoundInfo& Info, const FVector* ListenerLocation) const;
+
+    // 虚拟发声
+    void AddVirtualSound(const FVirtualSound& VirtualSound);
+    void EnsureVirtualVoiceTimer(UWorld* World);
+    void StopVirtualVoiceTimer();
+    void VirtualizeActiveSound(UAudioComponent* AudioComponent, const FActiveSoundInfo& Info);
+    void UpdateVirtualVoices();
+    void RemoveVirtualSounds(TFunctionRef<bool(const FVirtualSound&)> Predicate);
+
+    // 从池中取出组件，池耗尽时按溢出策略处理；bOutPooled表示组件是否来自池
+    UAudioComponent* AcquireAudioComponent(UWorld* World, AActor* AttachActor, bool& bOutPooled);
+
+    // 池化组件重置后放回池中，临时组件直接销毁；重复调用是安全的
+    void ReleaseAudioComponent(UAudioComponent* AudioComponent);
+
+    FAudioComponentPool* FindOrCreateAudioPool(UWorld* World);
+    UAudioComponent* CreatePooledAudioComponent(FAudioComponentPool& Pool);
+
+    // 尝试把SFX请求并入本帧待播放或合并窗口内已播放的同ID音效
+    bool MergeSFXRequest(UWorld* World, FName SoundID, AActor* AttachActor, const FVector& Location);
+
+    // 在请求所在World的下一帧刷新SFX批次，之前调度的World已销毁时重新调度
+    void ScheduleSFXFlush(UWorld* World);
+    void ClearSFXFlush();
+
+    // 丢弃满足条件的排队播放请求
+    void CancelQueuedPlays(TFunctionRef<bool(FName SoundID)> Predicate);
+    void CancelQueuedPlaysInCategory(EAudioCategory Category);
+
+    // 音频完成处理，回调携带完成的组件
+    void HandleAudioFinished(UAudioComponent* AudioComponent);
+
+    // 活跃表与二级索引的维护
+    void AddActiveSound(UAudioComponent* AudioComponent, const FActiveSoundInfo& Info);
+    bool RemoveActiveSound(UAudioComponent* AudioComponent, FActiveSoundInfo* OutInfo = nullptr);
+
+    // 停止并回收组件，同时广播完成事件
+    void StopActiveComponents(TArray<UAudioComponent*> Components);
+
+    // 不广播事件的全部停止，用于销毁
+    void ReleaseAllSounds();
+    void StopSoundInCategory(FName SoundID, EAudioCategory Category);
+    int32 GetCategoryVoiceCount(EAudioCategory Category) const;
 
     // 获取World的辅助方法
     UWorld* GetWorld() const;
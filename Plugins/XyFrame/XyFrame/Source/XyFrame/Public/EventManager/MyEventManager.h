@@ -8,7 +8,7 @@
 #include "Math/Vector.h"
 #include "MyEventManager.generated.h"
 
-// ¼Ͷ
+// 事件数据类型定义
 UENUM(BlueprintType)
 enum class EGameEventType : uint8
 {
@@ -20,7 +20,7 @@ enum class EGameEventType : uint8
     EnemyKilled UMETA(DisplayName = "Enemy Killed"),
 };
 
-// ͨ¼ݽṹ
+// 通用事件数据结构
 USTRUCT(BlueprintType)
 struct FGameEventData
 {
@@ -35,33 +35,33 @@ struct FGameEventData
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Event")
     TArray<AActor*> Actors;
 
-    // ĬϹ캯
+    // 默认构造函数
     FGameEventData() {}
 
-    // ݹ캯
+    // 便捷构造函数
     FGameEventData(const TArray<FString>& InTexts, const TArray<float>& InValues, const TArray<AActor*>& InActors)
         : Texts(InTexts), Values(InValues), Actors(InActors) {
     }
 
-    // ַ캯
+    // 单字符串构造函数
     FGameEventData(const FString& Text)
     {
         Texts.Add(Text);
     }
 
-    // ֵ캯
+    // 单数值构造函数
     FGameEventData(float Value)
     {
         Values.Add(Value);
     }
 
-    // Actor캯
+    // 单Actor构造函数
     FGameEventData(AActor* Actor)
     {
         if (Actor) Actors.Add(Actor);
     }
 
-    // ַ+ֵ캯
+    // 字符串+数值构造函数
     FGameEventData(const FString& Text, float Value)
     {
         Texts.Add(Text);
@@ -69,10 +69,10 @@ struct FGameEventData
     }
 };
 
-// ͨͼ¼ίУʹͳһ¼ݽṹ
+// 通用蓝图事件委托（使用统一的事件数据结构）
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnGameEventSignature, EGameEventType, EventType, const FGameEventData&, EventData);
 
-// C++ģί
+// C++模板委托声明
 template<typename... TArgs>
 class TCppEventDelegate;
 
@@ -121,150 +121,150 @@ class XYFRAME_API UMyEventManager : public USingletonBase
 {
     GENERATED_BODY()
 
-    // 
+    // 声明单例
     DECLARE_SINGLETON(UMyEventManager)
 
 public:
-    // ʼ¼
+    // 初始化事件管理器
     UFUNCTION(BlueprintCallable, Category = "Event")
     void InitializeEventManager();
 
-    // дʼ
+    // 重写初始化方法
     virtual void InitializeSingleton() override;
     virtual void DestroyCurSingleton() override { DestroyInstance(); };
 
-    // һȡʵͼɵ÷
+    // 添加一个获取实例的蓝图可调用方法
     UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Event", meta = (DisplayName = "Get Event Manager"))
     static UMyEventManager* GetEventManager() { return GetInstance(); }
 
-    // ĬϹ캯
+    // 默认构造函数
     UMyEventManager();
 
-    // 
+    // 析构函数
     virtual ~UMyEventManager() override;
 
-    // ========== ͼɷί ==========
+    // ========== 蓝图可分配委托 ==========
 
-    // ȫ¼ί - ͼֱӰ
+    // 全局事件委托 - 蓝图可以直接绑定
     UPROPERTY(BlueprintAssignable, Category = "Event System")
     FOnGameEventSignature OnGameEvent;
 
-    // ========== ͳһ¼ӿڣƼʹã ==========
+    // ========== 统一事件接口（推荐使用） ==========
 
-    // ͨ¼ͼã
+    // 触发通用事件（蓝图调用）
     UFUNCTION(BlueprintCallable, Category = "Event System")
     void TriggerGameEvent(EGameEventType EventType, const FGameEventData& EventData);
 
-    // ͨ¼ - 򻯰汾ͼã
+    // 触发通用事件 - 简化版本（蓝图调用）
     UFUNCTION(BlueprintCallable, Category = "Event System")
     void TriggerSimpleGameEvent(EGameEventType EventType, const FString& TextParam = "", float ValueParam = 0.0f, AActor* ActorParam = nullptr);
 
-    // ========== ͼC++¼ӿ ==========
+    // ========== 蓝图调用C++事件接口 ==========
 
-    // ͼC++¼ - ޲汾
+    // 从蓝图触发C++事件 - 无参数版本
     UFUNCTION(BlueprintCallable, Category = "Event System", meta = (DisplayName = "Trigger C++ Event (No Param)"))
     void TriggerCppEvent_NoParam(FName EventName);
 
-    // ͼC++¼ - ¼ݰ汾
+    // 从蓝图触发C++事件 - 带事件数据版本
     UFUNCTION(BlueprintCallable, Category = "Event System", meta = (DisplayName = "Trigger C++ Event (With Data)"))
     void TriggerCppEvent_WithData(FName EventName, const FGameEventData& EventData);
 
-    // ͼC++¼ - ַ
+    // 从蓝图触发C++事件 - 简单字符串参数
     UFUNCTION(BlueprintCallable, Category = "Event System", meta = (DisplayName = "Trigger C++ Event (String)"))
     void TriggerCppEvent_String(FName EventName, const FString& StringParam);
 
-    // ͼC++¼ - 
+    // 从蓝图触发C++事件 - 简单整数参数
     UFUNCTION(BlueprintCallable, Category = "Event System", meta = (DisplayName = "Trigger C++ Event (Int)"))
     void TriggerCppEvent_Int(FName EventName, int32 IntParam);
 
-    // ͼC++¼ - 򵥸
+    // 从蓝图触发C++事件 - 简单浮点数参数
     UFUNCTION(BlueprintCallable, Category = "Event System", meta = (DisplayName = "Trigger C++ Event (Float)"))
     void TriggerCppEvent_Float(FName EventName, float FloatParam);
 
-    // ========== ¼ӿ ==========
+    // ========== 事件管理接口 ==========
 
-    // Ƴضͼ¼м
+    // 移除特定蓝图事件的所有监听
     UFUNCTION(BlueprintCallable, Category = "Event")
     void RemoveBlueprintEventByEventname(FName EventName, UObject* object);
 
-    // Ƴضͼ¼
+    // 移除特定对象的所有蓝图事件绑定
     UFUNCTION(BlueprintCallable, Category = "Event")
     void RemoveAllBlueprintBindingsForObject(UObject* Object);
 
-    // Ƴ¼ͼC++
+    // 移除所有事件监听（蓝图和C++）
     UFUNCTION(BlueprintCallable, Category = "Event")
     void RemoveAllEvents();
 
-    // Ƴͼ󶨣C++¼
+    // 移除所有蓝图绑定（保留C++事件）
     UFUNCTION(BlueprintCallable, Category = "Event")
     void RemoveAllBlueprintBindings();
 
-    // ¼Ƿڼ
+    // 检查事件是否存在监听
     UFUNCTION(BlueprintCallable, Category = "Event")
     bool HasEventListeners(FName EventName) const;
 
-    // ضö¼Ƿڼ
+    // 检查特定枚举类型事件是否存在监听
     UFUNCTION(BlueprintCallable, Category = "Event")
     bool HasEventListenersByType(EGameEventType EventType) const;
 
-    // ȡ¼
+    // 获取事件监听数量
     UFUNCTION(BlueprintCallable, Category = "Event")
     int32 GetEventListenerCount(FName EventName) const;
 
-    // ȡضö¼ļ
+    // 获取特定枚举类型事件的监听数量
     UFUNCTION(BlueprintCallable, Category = "Event")
     int32 GetEventListenerCountByType(EGameEventType EventType) const;
 
-    // ӡ¼Ϣã
+    // 打印所有事件信息（调试用）
     UFUNCTION(BlueprintCallable, Category = "Event")
     void PrintAllEvents() const;
 
-    // ========== C++¼ӿ ==========
+    // ========== C++事件接口 ==========
 
-    // עC++¼ģ巽֧0-4Ͳ
+    // 注册C++事件监听器（模板方法，支持0-4个任意类型参数）
     template<typename T, typename... TArgs>
     void RegisterCppEvent(FName EventName, T* Object, void (T::* Function)(TArgs...));
 
     template<typename T, typename... TArgs>
     void RegisterCppEventByType(EGameEventType EventType, T* Object, void (T::* Function)(TArgs...));
 
-    // C++¼ģ巽֧0-4Ͳ
+    // 触发C++事件（模板方法，支持0-4个任意类型参数）
     template<typename... TArgs>
     void TriggerCppEventByType(EGameEventType EventType, TArgs... Args);
 
     template<typename... TArgs>
     void TriggerCppEvent(FName EventName, TArgs... Args);
 
-    // ƳC++¼
+    // 移除C++事件监听器
     template<typename T, typename... TArgs>
     void UnregisterCppEventByType(EGameEventType EventType, T* Object, void (T::* Function)(TArgs...));
 
     template<typename T, typename... TArgs>
     void UnregisterCppEvent(FName EventName, T* Object, void (T::* Function)(TArgs...));
 
-    // ƳضC++¼м
+    // 移除特定C++事件的所有监听
     UFUNCTION(BlueprintCallable, Category = "Event")
     void RemoveCppEvent(FName EventName);
 
     UFUNCTION(BlueprintCallable, Category = "Event")
     void RemoveCppEventByType(EGameEventType EventType);
 
-    // ƳC++¼
+    // 移除所有C++事件监听
     UFUNCTION(BlueprintCallable, Category = "Event")
     void RemoveAllCppEvents();
 
-    // C++¼Ƿڼ
+    // 检查C++事件是否存在监听
     UFUNCTION(BlueprintCallable, Category = "Event")
     bool HasCppEventListeners(FName EventName) const;
 
-    // ȡC++¼
+    // 获取C++事件监听数量
     int32 GetCppEventListenerCount(FName EventName) const;
 
 private:
-    // C++¼ֵ - ʹvoid*洢ͬ͵ί
+    // C++事件字典 - 使用void*存储不同类型的委托
     TMap<FName, TSharedPtr<void>> CppEvents;
 
-    // ڲ
+    // 内部辅助方法
     template<typename T>
     T* GetCppEventDelegate(FName EventName)
     {
@@ -290,11 +290,11 @@ private:
         return NewDelegate;
     }
 
-    // ڲ
+    // 内部触发方法
     void InternalTriggerGameEvent(EGameEventType EventType, const FGameEventData& EventData);
 };
 
-// ģ庯ʵ֣ͷļУ
+// 模板函数实现（必须在头文件中）
 template<typename T, typename... TArgs>
 void UMyEventManager::RegisterCppEvent(FName EventName, T* Object, void (T::* Function)(TArgs...))
 {
@@ -302,7 +302,7 @@ void UMyEventManager::RegisterCppEvent(FName EventName, T* Object, void (T::* Fu
     DelegateType* EventDelegate = GetOrCreateCppEventDelegate<DelegateType>(EventName);
     if (EventDelegate)
     {
-        // ʹUEίаϵͳ
+        // 使用UE的委托绑定系统
         typename DelegateType::FDelegate Delegate;
         Delegate.BindUObject(Object, Function);
         EventDelegate->Add(Delegate);
@@ -342,7 +342,7 @@ void UMyEventManager::TriggerCppEventByType(EGameEventType EventType, TArgs... A
     TriggerCppEvent<TArgs...>(EventName, Args);
 }
 
-// ȡעC++¼ͳԱָ汾
+// 取消注册C++事件监听器（对象和成员函数指针版本）
 template<typename T, typename... TArgs>
 void UMyEventManager::UnregisterCppEvent(FName EventName, T* Object, void (T::* Function)(TArgs...))
 {
@@ -350,14 +350,14 @@ void UMyEventManager::UnregisterCppEvent(FName EventName, T* Object, void (T::*
     DelegateType* EventDelegate = GetCppEventDelegate<DelegateType>(EventName);
     if (EventDelegate)
     {
-        // һʱίڱȽ
+        // 创建一个临时委托用于比较
         typename DelegateType::FDelegate TempDelegate;
         TempDelegate.BindUObject(Object, Function);
 
-        // Ƴƥί
+        // 移除匹配的委托
         EventDelegate->Remove(TempDelegate);
 
-        // ûмˣƳ¼
+        // 如果没有监听器了，移除事件
         if (!EventDelegate->IsBound())
         {
             CppEvents.Remove(EventName);
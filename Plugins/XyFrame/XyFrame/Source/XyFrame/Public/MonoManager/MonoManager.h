@@ -6,15 +6,23 @@
 #include "UObject/NoExportTypes.h"
 #include "SingletonBase/SingletonBase.h"
 #include "Engine/World.h"
+#include "Engine/EngineBaseTypes.h"
 #include "TimerManager.h"
+#include "Containers/StaticArray.h"
 #include "MonoManager.generated.h"
 
-// ʱصί
+class UMonoManager;
+struct FMonoTaskState;
+
+// 计时器回调委托
 DECLARE_DYNAMIC_DELEGATE_OneParam(FTimerCallbackDelegate, const FString&, TimerId);
 DECLARE_DYNAMIC_DELEGATE_TwoParams(FTimerUpdateCallbackDelegate, const FString&, TimerId, float, Progress);
 DECLARE_DYNAMIC_DELEGATE(FTimerSimpleDelegate);
 
-// ʱ
+// 帧阶段更新委托
+DECLARE_DYNAMIC_DELEGATE_OneParam(FMonoUpdateDelegate, float, DeltaTime);
+
+// 计时器类型
 UENUM(BlueprintType)
 enum class ETimerType : uint8
 {
@@ -23,7 +31,28 @@ enum class ETimerType : uint8
     Countdown UMETA(DisplayName = "Countdown")
 };
 
-// ʱϢ
+// 计时器时间域
+UENUM(BlueprintType)
+enum class ETimerDomain : uint8
+{
+    // 世界时间：受时间膨胀影响，随世界暂停
+    Game UMETA(DisplayName = "Game"),
+    // 不受时间膨胀影响，世界暂停时继续（暂停菜单等UI）
+    Unscaled UMETA(DisplayName = "Unscaled"),
+    // 平台墙钟时间，切换关卡时也不中断
+    Real UMETA(DisplayName = "Real")
+};
+
+// 帧更新阶段，同一Tick组内按声明顺序执行
+UENUM(BlueprintType)
+enum class EUpdatePhase : uint8
+{
+    FixedUpdate UMETA(DisplayName = "Fixed Update"),
+    Update UMETA(DisplayName = "Update"),
+    LateUpdate UMETA(DisplayName = "Late Update")
+};
+
+// 计时器信息
 USTRUCT(BlueprintType)
 struct FTimerInfo
 {
@@ -50,10 +79,19 @@ struct FTimerInfo
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Timer")
     bool bIsActive;
 
-    // 洢صϢ - ʹLambdaǺ
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Timer")
+    ETimerDomain Domain;
+
+    // 存储回调信息 - 使用Lambda而不是函数名
     TWeakObjectPtr<UObject> CallbackObject;
     TFunction<void()> StaticCallback;
 
+    // 到期时间（调度器时钟），暂停时ElapsedTime保存已经过的时间
+    double FireTime;
+
+    // 每次调度递增，与堆条目不一致时该条目失效
+    uint32 ScheduleSerial;
+
     FTimerInfo()
         : TimerType(ETimerType::OneShot)
         , Duration(0.0f)
@@ -61,6 +99,9 @@ struct FTimerInfo
         , LoopCount(1)
         , CurrentLoop(0)
         , bIsActive(false)
+        , Domain(ETimerDomain::Game)
+        , FireTime(0.0)
+        , ScheduleSerial(0)
     {
     }
 
@@ -72,6 +113,9 @@ struct FTimerInfo
         , LoopCount(1)
         , CurrentLoop(0)
         , bIsActive(true)
+        , Domain(ETimerDomain::Game)
+        , FireTime(0.0)
+        , ScheduleSerial(0)
     {
         if (InTimerType == ETimerType::Interval)
         {
@@ -80,6 +124,184 @@ struct FTimerInfo
     }
 };
 
+// 计时器句柄：槽位索引 + 代数，槽位复用后旧句柄自动失效
+USTRUCT(BlueprintType)
+struct FMonoTimerHandle
+{
+    GENERATED_BODY()
+
+    int32 Index;
+    int32 Generation;
+
+    FMonoTimerHandle()
+        : Index(INDEX_NONE)
+        , Generation(0)
+    {
+    }
+
+    bool IsValid() const { return Index != INDEX_NONE; }
+    void Invalidate() { Index = INDEX_NONE; Generation = 0; }
+
+    bool operator==(const FMonoTimerHandle& Other) const { return Index == Other.Index && Generation == Other.Generation; }
+    bool operator!=(const FMonoTimerHandle& Other) const { return !(*this == Other); }
+
+    friend uint32 GetTypeHash(const FMonoTimerHandle& Handle)
+    {
+        return HashCombine(::GetTypeHash(Handle.Index), ::GetTypeHash(Handle.Generation));
+    }
+};
+
+// 计时器槽位：计时器状态与全部回调存放在同一条记录中
+struct FMonoTimerSlot
+{
+    FTimerInfo Timer;
+    FTimerCallbackDelegate CompleteCallback;
+    FTimerSimpleDelegate SimpleCallback;
+    FTimerUpdateCallbackDelegate UpdateCallback;
+    int32 Generation = 1;
+    bool bInUse = false;
+};
+
+// 帧更新句柄：槽位索引 + 代数
+USTRUCT(BlueprintType)
+struct FMonoUpdateHandle
+{
+    GENERATED_BODY()
+
+    int32 Index;
+    int32 Generation;
+
+    FMonoUpdateHandle()
+        : Index(INDEX_NONE)
+        , Generation(0)
+    {
+    }
+
+    bool IsValid() const { return Index != INDEX_NONE; }
+    void Invalidate() { Index = INDEX_NONE; Generation = 0; }
+
+    bool operator==(const FMonoUpdateHandle& Other) const { return Index == Other.Index && Generation == Other.Generation; }
+    bool operator!=(const FMonoUpdateHandle& Other) const { return !(*this == Other); }
+};
+
+// 阶段更新条目，同一阶段的条目连续存放
+struct FPhaseUpdater
+{
+    TFunction<void(float)> Callback;
+    TWeakObjectPtr<UObject> Owner;
+    int32 SlotIndex = INDEX_NONE;
+    bool bHasOwner = false;
+    bool bAlive = true;
+};
+
+// 更新条目槽位，记录条目所在的组、阶段与位置
+struct FPhaseUpdaterSlot
+{
+    int32 Generation = 1;
+    int32 GroupIndex = INDEX_NONE;
+    EUpdatePhase Phase = EUpdatePhase::Update;
+    int32 Position = INDEX_NONE;
+    bool bInUse = false;
+};
+
+// 每个使用中的Tick组对应一个Tick函数，依次执行该组的三个阶段
+USTRUCT()
+struct FMonoPhaseTickFunction : public FTickFunction
+{
+    GENERATED_BODY()
+
+    UMonoManager* Manager = nullptr;
+    int32 GroupIndex = INDEX_NONE;
+
+    virtual void ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent) override;
+    virtual FString DiagnosticMessage() override;
+};
+
+template<>
+struct TStructOpsTypeTraits<FMonoPhaseTickFunction> : public TStructOpsTypeTraitsBase2<FMonoPhaseTickFunction>
+{
+    enum
+    {
+        WithCopy = false
+    };
+};
+
+// Tick组内的阶段更新列表
+struct FPhaseTickGroup
+{
+    ETickingGroup TickGroup = TG_PrePhysics;
+    TUniquePtr<FMonoPhaseTickFunction> TickFunction;
+    TStaticArray<TArray<FPhaseUpdater>, 3> Updaters;
+    bool bNeedsCompaction = false;
+};
+
+// 执行中注册的条目，本组执行完后再加入
+struct FPendingPhaseUpdater
+{
+    FMonoUpdateHandle Handle;
+    FPhaseUpdater Updater;
+};
+
+// 计时器最小堆条目，按到期时间排序
+struct FTimerHeapEntry
+{
+    double FireTime;
+    int32 SlotIndex;
+    uint32 ScheduleSerial;
+
+    bool operator<(const FTimerHeapEntry& Other) const
+    {
+        return FireTime < Other.FireTime;
+    }
+};
+
+// 时间域时钟：各自的缩放、暂停标记与到期堆
+struct FTimerDomainClock
+{
+    double Time = 0.0;
+    double LastSourceTime = 0.0;
+    TWeakObjectPtr<UWorld> SourceWorld;
+    bool bHasSource = false;
+    float TimeScale = 1.0f;
+    bool bPaused = false;
+
+    // 按到期时间排列的最小堆，暂停或清除的计时器条目延迟剔除
+    TArray<FTimerHeapEntry> Heap;
+};
+
+// 按帧延迟的回调，最小堆按目标帧排序
+struct FFrameWaitEntry
+{
+    uint64 TargetFrame;
+    TFunction<void()> Callback;
+
+    bool operator<(const FFrameWaitEntry& Other) const
+    {
+        return TargetFrame < Other.TargetFrame;
+    }
+};
+
+// 驱动计时器更新的Tick函数，世界暂停时仍然执行
+USTRUCT()
+struct FMonoTimerTickFunction : public FTickFunction
+{
+    GENERATED_BODY()
+
+    UMonoManager* Manager = nullptr;
+
+    virtual void ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent) override;
+    virtual FString DiagnosticMessage() override;
+};
+
+template<>
+struct TStructOpsTypeTraits<FMonoTimerTickFunction> : public TStructOpsTypeTraitsBase2<FMonoTimerTickFunction>
+{
+    enum
+    {
+        WithCopy = false
+    };
+};
+
 UCLASS(Blueprintable, BlueprintType)
 class XYFRAME_API UMonoManager : public USingletonBase
 {
@@ -87,6 +309,8 @@ class XYFRAME_API UMonoManager : public USingletonBase
 
     DECLARE_SINGLETON(UMonoManager)
 
+    friend struct FMonoTimerTickFunction;
+
 public:
     UFUNCTION(BlueprintCallable, Category = "MonoManager")
     void InitializeMonoManager();
@@ -100,7 +324,7 @@ public:
     UMonoManager();
     virtual ~UMonoManager() override;
 
-    // ========== ʱϵͳ (ԶTimerId) ==========
+    // ========== 计时器系统 (自动生成TimerId) ==========
     UFUNCTION(BlueprintCallable, Category = "MonoManager|Timer", meta = (DisplayName = "Set Timeout"))
     FString SetTimeout(float Delay, const FTimerCallbackDelegate& CompleteCallback);
 
@@ -122,7 +346,7 @@ public:
     UFUNCTION(BlueprintCallable, Category = "MonoManager|Timer")
     FString SetCountdownSimple(float Interval, int32 Count, const FTimerSimpleDelegate& CompleteCallback);
 
-    // ========== ʱϵͳ (ԶTimerId) ==========
+    // ========== 计时器系统 (自定义TimerId) ==========
     UFUNCTION(BlueprintCallable, Category = "MonoManager|Timer")
     bool SetTimeoutWithId(float Delay, const FString& TimerId, const FTimerCallbackDelegate& CompleteCallback);
 
@@ -141,65 +365,158 @@ public:
     UFUNCTION(BlueprintCallable, Category = "MonoManager|Timer")
     bool SetCountdownSimpleWithId(float Interval, int32 Count, const FString& TimerId, const FTimerSimpleDelegate& CompleteCallback);
 
-    // ========== C++Ա ==========
-// 󶨳Ա - һԶʱ (ԶTimerId)
+    // ========== C++句柄接口 ==========
+    // 通用计时器，Owner销毁后计时器自动清除；LoopCount为0表示无限循环
+    FMonoTimerHandle SetTimer(ETimerType TimerType, float Duration, int32 LoopCount, TFunction<void()> Callback, UObject* Owner = nullptr, ETimerDomain Domain = ETimerDomain::Game);
+
+    // 绑定成员函数 - 一次性定时器
     template<typename T>
-    FString SetTimeout(float Delay, T* Object, void(T::* Function)())
+    FMonoTimerHandle SetTimeout(float Delay, T* Object, void(T::* Function)())
     {
-        FString TimerId = GenerateTimerId();
-        if (CreateTimerInternal(TimerId, ETimerType::OneShot, Delay, 1, Object, Function))
-        {
-            return TimerId;
-        }
-        return FString();
+        return CreateTimerInternal(FString(), ETimerType::OneShot, Delay, 1, Object, Function);
     }
 
-    // 󶨳Ա - һԶʱ (ԶTimerId)
+    // 绑定成员函数 - 一次性定时器 (自定义TimerId)
     template<typename T>
     bool SetTimeout(float Delay, const FString& TimerId, T* Object, void(T::* Function)())
     {
-        return CreateTimerInternal(TimerId, ETimerType::OneShot, Delay, 1, Object, Function);
+        return CreateTimerInternal(TimerId, ETimerType::OneShot, Delay, 1, Object, Function).IsValid();
     }
 
-    // 󶨳Ա - ʱ (ԶTimerId)
+    // 绑定成员函数 - 间隔定时器
     template<typename T>
-    FString SetInterval(float Interval, T* Object, void(T::* Function)())
+    FMonoTimerHandle SetInterval(float Interval, T* Object, void(T::* Function)())
     {
-        FString TimerId = GenerateTimerId();
-        if (CreateTimerInternal(TimerId, ETimerType::Interval, Interval, 0, Object, Function))
-        {
-            return TimerId;
-        }
-        return FString();
+        return CreateTimerInternal(FString(), ETimerType::Interval, Interval, 0, Object, Function);
     }
 
-    // 󶨳Ա - ʱ (ԶTimerId)
+    // 绑定成员函数 - 间隔定时器 (自定义TimerId)
     template<typename T>
     bool SetInterval(float Interval, const FString& TimerId, T* Object, void(T::* Function)())
     {
-        return CreateTimerInternal(TimerId, ETimerType::Interval, Interval, 0, Object, Function);
+        return CreateTimerInternal(TimerId, ETimerType::Interval, Interval, 0, Object, Function).IsValid();
     }
 
-    // 󶨳Ա - ʱ (ԶTimerId)
+    // 绑定成员函数 - 倒计时器
     template<typename T>
-    FString SetCountdown(float Interval, int32 Count, T* Object, void(T::* Function)())
+    FMonoTimerHandle SetCountdown(float Interval, int32 Count, T* Object, void(T::* Function)())
     {
-        FString TimerId = GenerateTimerId();
-        if (CreateTimerInternal(TimerId, ETimerType::Countdown, Interval, Count, Object, Function))
-        {
-            return TimerId;
-        }
-        return FString();
+        return CreateTimerInternal(FString(), ETimerType::Countdown, Interval, Count, Object, Function);
     }
 
-    // 󶨳Ա - ʱ (ԶTimerId)
+    // 绑定成员函数 - 倒计时器 (自定义TimerId)
     template<typename T>
     bool SetCountdown(float Interval, int32 Count, const FString& TimerId, T* Object, void(T::* Function)())
     {
-        return CreateTimerInternal(TimerId, ETimerType::Countdown, Interval, Count, Object, Function);
+        return CreateTimerInternal(TimerId, ETimerType::Countdown, Interval, Count, Object, Function).IsValid();
+    }
+
+    void PauseTimer(FMonoTimerHandle Handle);
+    void ResumeTimer(FMonoTimerHandle Handle);
+    void RestartTimer(FMonoTimerHandle Handle);
+
+    // 清除后将句柄置为无效
+    void ClearTimer(FMonoTimerHandle& Handle);
+
+    bool IsTimerValid(FMonoTimerHandle Handle) const;
+    bool IsTimerActive(FMonoTimerHandle Handle) const;
+    float GetTimerRemainingTime(FMonoTimerHandle Handle) const;
+    float GetTimerProgress(FMonoTimerHandle Handle) const;
+
+    // 按名称查找计时器句柄
+    FMonoTimerHandle FindTimer(const FString& TimerId) const;
+
+    // 切换计时器的时间域，剩余时间保持不变
+    void SetTimerDomain(FMonoTimerHandle Handle, ETimerDomain Domain);
+
+    // ========== 时间域 ==========
+    UFUNCTION(BlueprintCallable, Category = "MonoManager|Timer")
+    void SetTimerDomain(const FString& TimerId, ETimerDomain Domain);
+
+    // 时间域的时间缩放，例如只对游戏计时器生效的子弹时间
+    UFUNCTION(BlueprintCallable, Category = "MonoManager|Timer")
+    void SetTimerDomainScale(ETimerDomain Domain, float TimeScale);
+
+    UFUNCTION(BlueprintCallable, BlueprintPure, Category = "MonoManager|Timer")
+    float GetTimerDomainScale(ETimerDomain Domain) const;
+
+    UFUNCTION(BlueprintCallable, Category = "MonoManager|Timer")
+    void SetTimerDomainPaused(ETimerDomain Domain, bool bPaused);
+
+    UFUNCTION(BlueprintCallable, BlueprintPure, Category = "MonoManager|Timer")
+    bool IsTimerDomainPaused(ETimerDomain Domain) const;
+
+    // 时间域的当前时间（已计入缩放与暂停）
+    UFUNCTION(BlueprintCallable, BlueprintPure, Category = "MonoManager|Timer")
+    float GetTimerDomainTime(ETimerDomain Domain) const;
+
+    // ========== 帧阶段更新 ==========
+    // 注册阶段更新，TickGroup为TG_MAX时使用阶段默认组（LateUpdate在TG_PostUpdateWork，其余在TG_PrePhysics）
+    UFUNCTION(BlueprintCallable, Category = "MonoManager|Update")
+    FMonoUpdateHandle RegisterUpdate(EUpdatePhase Phase, const FMonoUpdateDelegate& Callback, TEnumAsByte<ETickingGroup> TickGroup = TG_MAX);
+
+    UFUNCTION(BlueprintCallable, Category = "MonoManager|Update")
+    void UnregisterUpdate(UPARAM(ref) FMonoUpdateHandle& Handle);
+
+    // C++回调版本，Owner销毁后自动注销
+    FMonoUpdateHandle RegisterUpdateCallback(EUpdatePhase Phase, TFunction<void(float)> Callback, UObject* Owner = nullptr, ETickingGroup TickGroup = TG_MAX);
+
+    // 绑定成员函数
+    template<typename T>
+    FMonoUpdateHandle RegisterUpdate(EUpdatePhase Phase, T* Object, void(T::* Function)(float), ETickingGroup TickGroup = TG_MAX)
+    {
+        if (!Object || !Function)
+        {
+            UE_LOG(LogTemp, Warning, TEXT("Invalid object or function for phase update"));
+            return FMonoUpdateHandle();
+        }
+
+        TWeakObjectPtr<T> WeakObject(Object);
+        return RegisterUpdateCallback(Phase, [WeakObject, Function](float DeltaTime)
+            {
+                if (T* StrongObject = WeakObject.Get())
+                {
+                    (StrongObject->*Function)(DeltaTime);
+                }
+            }, Object, TickGroup);
     }
 
-    // ========== ʱ ==========
+    UFUNCTION(BlueprintCallable, BlueprintPure, Category = "MonoManager|Update")
+    int32 GetUpdaterCount() const;
+
+    // 固定步长累积的剩余比例，用于渲染插值
+    UFUNCTION(BlueprintCallable, BlueprintPure, Category = "MonoManager|Update")
+    float GetFixedUpdateAlpha() const;
+
+    // 固定更新步长（秒）
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MonoManager|Update", meta = (ClampMin = "0.001"))
+    float FixedTimeStep;
+
+    // 每帧最多执行的固定更新次数，超出的时间被丢弃以避免卡顿时雪崩
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MonoManager|Update", meta = (ClampMin = "1"))
+    int32 MaxFixedStepsPerFrame;
+
+    // 由Tick函数调用
+    void TickPhaseGroup(int32 GroupIndex, float DeltaTime);
+
+    // ========== 协程任务 ==========
+    // FMonoTask启动时登记，结束或取消时注销；Owner销毁后在下次唤醒或GC后销毁协程帧
+    void RegisterTask(const TSharedRef<FMonoTaskState>& State);
+    void UnregisterTask(uint32 TaskId);
+
+    // 至少一帧之后执行回调，用于WaitFrames
+    void DelayFrames(int32 FrameCount, TFunction<void()> Callback);
+
+    UFUNCTION(BlueprintCallable, Category = "MonoManager|Task")
+    void CancelTasksForOwner(UObject* Owner);
+
+    UFUNCTION(BlueprintCallable, Category = "MonoManager|Task")
+    void CancelAllTasks();
+
+    UFUNCTION(BlueprintCallable, BlueprintPure, Category = "MonoManager|Task")
+    int32 GetActiveTaskCount() const;
+
+    // ========== 计时器控制 ==========
     UFUNCTION(BlueprintCallable, Category = "MonoManager|Timer")
     void PauseTimer(const FString& TimerId);
 
@@ -221,7 +538,7 @@ public:
     UFUNCTION(BlueprintCallable, Category = "MonoManager|Timer")
     void ClearAllTimers();
 
-    // ========== ѯ ==========
+    // ========== 查询方法 ==========
     UFUNCTION(BlueprintCallable, Category = "MonoManager|Timer")
     bool IsTimerActive(const FString& TimerId) const;
 
@@ -234,81 +551,134 @@ public:
     UFUNCTION(BlueprintCallable, Category = "MonoManager|Timer")
     int32 GetActiveTimerCount() const;
 
-    // ========== Թ ==========
+    // ========== 调试工具 ==========
     UFUNCTION(BlueprintCallable, Category = "MonoManager|Debug")
     void PrintAllTimers();
 
+    // 用模拟时钟驱动大量计时器，对比最小堆调度与逐个轮询的耗时
+    UFUNCTION(BlueprintCallable, Category = "MonoManager|Debug")
+    void BenchmarkTimers(int32 TimerCount = 10000, float SimulatedSeconds = 10.0f);
+
 protected:
-    // ʹUETimerϵͳ
-    void StartUpdateTimer();
+    // 由Tick函数驱动更新：只有游戏域计时器时按最早到期时间设置Tick间隔，其余情况逐帧更新
+    void ScheduleNextUpdate();
     void StopUpdateTimer();
-    UFUNCTION()
     void UpdateTimers();
 
 private:
-    TMap<FString, FTimerInfo> Timers;
-
-    // ص洢
-    TMap<FString, FTimerCallbackDelegate> TimerCallbacks;
-    TMap<FString, FTimerSimpleDelegate> SimpleCallbacks;
-    TMap<FString, FTimerUpdateCallbackDelegate> UpdateCallbacks;
-
-    // UE Timer handle
-    FTimerHandle UpdateTimerHandle;
-    bool bIsUpdateTimerActive;
+    // 计时器记录，空闲槽位通过FreeTimerSlots复用
+    TArray<FMonoTimerSlot> TimerSlots;
+    TArray<int32> FreeTimerSlots;
+
+    // 蓝图使用的名称到句柄的映射，C++句柄接口不经过这里
+    TMap<FString, FMonoTimerHandle> NamedTimers;
+
+    // 各时间域的时钟与到期堆，按ETimerDomain索引
+    TStaticArray<FTimerDomainClock, 3> TimerDomains;
+
+    // 带进度回调的计时器，需要逐帧更新
+    TArray<FMonoTimerHandle> ProgressTimers;
+
+    uint32 NextScheduleSerial;
+    bool bIsUpdating;
+
+    // 帧阶段更新：组对象单独分配，执行中新增组不会移动正在遍历的列表
+    TArray<TUniquePtr<FPhaseTickGroup>> PhaseGroups;
+    TArray<FPhaseUpdaterSlot> UpdaterSlots;
+    TArray<int32> FreeUpdaterSlots;
+    TArray<FPendingPhaseUpdater> PendingUpdaters;
+    TWeakObjectPtr<UWorld> PhaseTickWorld;
+    float FixedTimeAccumulator;
+    int32 FixedStepsThisFrame;
+    uint64 LastFixedStepFrame;
+    bool bIsTickingPhases;
+
+    FDelegateHandle WorldInitializedHandle;
+    FDelegateHandle WorldCleanupHandle;
+
+    // 协程任务：挂起期间只由等待源（计时器、帧队列、加载回调）持有唤醒入口，不逐帧检查
+    TMap<uint32, TSharedPtr<FMonoTaskState>> ActiveTasks;
+    uint32 NextTaskId;
+    TArray<FFrameWaitEntry> FrameWaits;
+    FDelegateHandle PostGarbageCollectHandle;
+
+    // 计时器Tick函数
+    TUniquePtr<FMonoTimerTickFunction> TimerTickFunction;
+    TWeakObjectPtr<UWorld> TimerTickWorld;
 
     FString GenerateTimerId() const;
-    void ExecuteTimerCallback(const FString& TimerId);
-
-    bool CreateTimerInternal(const FString& TimerId, ETimerType TimerType, float Duration, int32 LoopCount,
+    void ExecuteTimerCallback(int32 SlotIndex);
+
+    // 句柄对应的槽位，句柄失效时返回nullptr
+    FMonoTimerSlot* FindSlot(FMonoTimerHandle Handle);
+    const FMonoTimerSlot* FindSlot(FMonoTimerHandle Handle) const;
+    FMonoTimerHandle MakeHandle(int32 SlotIndex) const;
+    void ReleaseSlot(int32 SlotIndex);
+
+    // 时间域时钟：累计时间源经过的时间，切换世界时保持连续
+    FTimerDomainClock& GetDomainClock(ETimerDomain Domain) { return TimerDomains[(int32)Domain]; }
+    const FTimerDomainClock& GetDomainClock(ETimerDomain Domain) const { return TimerDomains[(int32)Domain]; }
+    double GetDomainSourceTime(ETimerDomain Domain, const UWorld* World) const;
+    double GetSchedulerTime(ETimerDomain Domain) const;
+    void SyncSchedulerClock(ETimerDomain Domain);
+
+    // 分配槽位并按StartTime开始计时
+    FMonoTimerHandle RegisterTimer(FMonoTimerSlot&& NewSlot, double StartTime);
+    void ScheduleTimer(FTimerInfo& Timer, int32 SlotIndex, double FireTime);
+
+    // 触发时间域中所有在Now之前到期的计时器，返回触发次数
+    int32 ProcessExpiredTimers(ETimerDomain Domain, double Now);
+
+    bool IsHeapEntryStale(const FTimerHeapEntry& Entry) const;
+    void CompactTimerHeap(FTimerDomainClock& Clock);
+    float GetTimerElapsed(const FTimerInfo& Timer) const;
+
+    // 帧阶段更新内部实现
+    int32 FindOrAddPhaseGroup(ETickingGroup TickGroup);
+    void RegisterPhaseTickFunction(FPhaseTickGroup& Group);
+    void RegisterAllPhaseTickFunctions();
+    void UnregisterAllPhaseTickFunctions();
+    void AddUpdaterToGroup(FMonoUpdateHandle Handle, FPhaseUpdater&& Updater);
+    void ReleaseUpdaterSlot(int32 SlotIndex);
+    void RunPhase(FPhaseTickGroup& Group, EUpdatePhase Phase, float DeltaTime);
+    void FlushPhaseChanges();
+    void CompactPhaseGroup(FPhaseTickGroup& Group);
+
+    // 世界切换时重新挂接更新
+    void HandleWorldInitializedActors(const FActorsInitializedParams& Params);
+    void HandleWorldCleanup(UWorld* World, bool bSessionEnded, bool bCleanupResources);
+
+    // GC后销毁Owner已失效的协程任务
+    void HandlePostGarbageCollect();
+
+    FMonoTimerHandle CreateTimerInternal(const FString& TimerId, ETimerType TimerType, float Duration, int32 LoopCount,
         const FTimerCallbackDelegate& CompleteCallback = FTimerCallbackDelegate(),
         const FTimerUpdateCallbackDelegate& UpdateCallback = FTimerUpdateCallbackDelegate(),
-        const FTimerSimpleDelegate& SimpleCallback = FTimerSimpleDelegate());
+        const FTimerSimpleDelegate& SimpleCallback = FTimerSimpleDelegate(),
+        TFunction<void()>&& StaticCallback = nullptr,
+        UObject* CallbackObject = nullptr);
 
-    // Ա󶨰汾 - ʹúַ
+    // 成员函数绑定版本，对象销毁后计时器随之清除
     template<typename T>
-    bool CreateTimerInternal(const FString& TimerId, ETimerType TimerType, float Duration, int32 LoopCount, T* Object, void(T::* Function)())
+    FMonoTimerHandle CreateTimerInternal(const FString& TimerId, ETimerType TimerType, float Duration, int32 LoopCount, T* Object, void(T::* Function)())
     {
-        if (Duration <= 0.0f)
-        {
-            UE_LOG(LogTemp, Warning, TEXT("Cannot create timer with duration <= 0"));
-            return false;
-        }
-
-        if (Timers.Contains(TimerId))
-        {
-            UE_LOG(LogTemp, Warning, TEXT("TimerId already exists: %s"), *TimerId);
-            return false;
-        }
-
         if (!Object || !Function)
         {
             UE_LOG(LogTemp, Warning, TEXT("Invalid object or function for timer"));
-            return false;
+            return FMonoTimerHandle();
         }
 
-        // ʱϢ
-        FTimerInfo TimerInfo(TimerId, TimerType, Duration);
-        TimerInfo.LoopCount = LoopCount;
-        TimerInfo.CallbackObject = Object;
-
-        // ʹLambdaԱָ
-        TimerInfo.StaticCallback = [Object, Function]() {
-            if (Object && Function)
+        TWeakObjectPtr<T> WeakObject(Object);
+        return CreateTimerInternal(TimerId, TimerType, Duration, LoopCount,
+            FTimerCallbackDelegate(), FTimerUpdateCallbackDelegate(), FTimerSimpleDelegate(),
+            [WeakObject, Function]()
             {
-                (Object->*Function)();
-            }
-            };
-
-        Timers.Add(TimerId, TimerInfo);
-
-        // ¼ʱҪ
-        StartUpdateTimer();
-
-        UE_LOG(LogTemp, Log, TEXT("Created timer with member function: %s, Type: %s, Duration: %.2f, Loops: %d"),
-            *TimerId, *UEnum::GetValueAsString(TimerType), Duration, LoopCount);
-
-        return true;
+                if (T* StrongObject = WeakObject.Get())
+                {
+                    (StrongObject->*Function)();
+                }
+            },
+            Object);
     }
 
     UWorld* GetWorld() const override;
@@ -0,0 +1,171 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MonoManager/MonoManager.h"
+#include <coroutine>
+#include <type_traits>
+
+struct FMonoTaskPromise;
+struct FMonoWaitSeconds;
+struct FMonoWaitFrames;
+struct FMonoWaitForResource;
+struct FMonoWaitForSceneLoaded;
+
+// 协程任务的共享状态：协程帧、Owner与当前等待
+struct XYFRAME_API FMonoTaskState : public TSharedFromThis<FMonoTaskState>
+{
+    uint32 TaskId = 0;
+    std::coroutine_handle<> Handle;
+
+    // Owner销毁后任务不再恢复
+    TWeakObjectPtr<UObject> Owner;
+    bool bHasOwner = false;
+
+    bool bRunning = false;
+    bool bCancelPending = false;
+
+    // 当前等待：序号用于忽略过期的唤醒，唤醒或取消时释放计时器与清理回调
+    uint32 WaitSerial = 0;
+    bool bSuspending = false;
+    bool bWokenInline = false;
+    FMonoTimerHandle WaitTimer;
+    TFunction<void()> ReleaseWaitCallback;
+
+    bool IsAlive() const { return (bool)Handle; }
+    bool IsOwnerAlive() const { return !bHasOwner || Owner.IsValid(); }
+    bool IsWaiting(uint32 Serial) const { return Handle && !bRunning && Serial == WaitSerial; }
+
+    // 挂起并由StartWait开始等待，返回false表示等待已同步完成、无需挂起
+    bool Suspend(TFunctionRef<void(uint32 Serial)> StartWait);
+
+    // 等待源完成时调用，过期的序号被忽略
+    void Wake(uint32 Serial);
+
+    void Resume();
+
+    // 执行中请求的取消在下一次挂起后生效
+    void Cancel();
+
+private:
+    void ReleaseWait();
+};
+
+// 协程任务句柄：返回FMonoTask的函数中可以co_await下列等待，创建后立即执行
+// 成员函数协程的Owner是对象本身，自由函数取第一个非空的UObject参数（不限位置）；丢弃句柄不会取消任务
+class XYFRAME_API FMonoTask
+{
+public:
+    using promise_type = FMonoTaskPromise;
+
+    FMonoTask() = default;
+    explicit FMonoTask(const TSharedRef<FMonoTaskState>& InState) : State(InState) {}
+
+    bool IsRunning() const;
+    void Cancel();
+
+    // ========== 等待 ==========
+    // 按计时器时间域等待秒数
+    static FMonoWaitSeconds WaitSeconds(float Seconds, ETimerDomain Domain = ETimerDomain::Game);
+
+    // 等待帧数，至少一帧
+    static FMonoWaitFrames WaitFrames(int32 FrameCount);
+
+    // 通过ResourceManager异步加载资源，返回加载结果，失败时为nullptr
+    static FMonoWaitForResource WaitForResource(const FString& ResourcePath);
+
+    // 等待LoadSceneManager的异步加载请求结束，返回是否成功
+    static FMonoWaitForSceneLoaded WaitForSceneLoaded(const FString& RequestId);
+
+private:
+    TWeakPtr<FMonoTaskState> State;
+};
+
+struct XYFRAME_API FMonoTaskPromise
+{
+    TSharedRef<FMonoTaskState> State = MakeShared<FMonoTaskState>();
+
+    FMonoTaskPromise() = default;
+
+    // 成员函数协程的第一个参数是对象本身，按参数顺序取第一个UObject
+    template<typename... TArgs>
+    FMonoTaskPromise(TArgs&... Args)
+    {
+        (BindOwner(Args), ...);
+    }
+
+    FMonoTask get_return_object();
+    std::suspend_never initial_suspend() noexcept;
+    std::suspend_never final_suspend() noexcept;
+    void return_void() {}
+    void unhandled_exception() { checkNoEntry(); }
+
+private:
+    template<typename T>
+    void BindOwner(T& Arg)
+    {
+        if (State->bHasOwner)
+        {
+            return;
+        }
+
+        using FArgType = std::remove_cv_t<std::remove_pointer_t<std::remove_cvref_t<T>>>;
+        if constexpr (std::is_base_of_v<UObject, FArgType>)
+        {
+            if constexpr (std::is_pointer_v<std::remove_cvref_t<T>>)
+            {
+                SetOwner(Arg);
+            }
+            else
+            {
+                SetOwner(&Arg);
+            }
+        }
+    }
+
+    void SetOwner(const UObject* InOwner);
+};
+
+// ========== 等待对象 ==========
+
+struct XYFRAME_API FMonoWaitSeconds
+{
+    float Seconds;
+    ETimerDomain Domain;
+
+    bool await_ready() const { return Seconds <= 0.0f; }
+    bool await_suspend(std::coroutine_handle<FMonoTaskPromise> Handle);
+    void await_resume() const {}
+};
+
+struct XYFRAME_API FMonoWaitFrames
+{
+    int32 FrameCount;
+
+    bool await_ready() const { return FrameCount <= 0; }
+    bool await_suspend(std::coroutine_handle<FMonoTaskPromise> Handle);
+    void await_resume() const {}
+};
+
+struct XYFRAME_API FMonoWaitForResource
+{
+    FString ResourcePath;
+    UObject* Result = nullptr;
+
+    // 已缓存的资源直接返回，不挂起
+    bool await_ready();
+    bool await_suspend(std::coroutine_handle<FMonoTaskPromise> Handle);
+    UObject* await_resume() const { return Result; }
+};
+
+struct XYFRAME_API FMonoWaitForSceneLoaded
+{
+    FString RequestId;
+    bool bSuccess = false;
+
+    // 请求已结束或不存在时直接返回
+    bool await_ready();
+    bool await_suspend(std::coroutine_handle<FMonoTaskPromise> Handle);
+    bool await_resume() const { return bSuccess; }
+};
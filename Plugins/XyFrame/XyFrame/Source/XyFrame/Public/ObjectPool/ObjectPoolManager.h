@@ -9,7 +9,7 @@
 #include "TimerManager.h"
 #include "ObjectPoolManager.generated.h"
 
-// ؽӿ - ʹUEĽӿϵͳ
+// 对象池接口 - 使用UE的接口系统
 UINTERFACE(Blueprintable)
 class UObjectPoolInterface : public UInterface
 {
@@ -28,7 +28,7 @@ public:
     void OnDespawn();
 };
 
-// Ϣ
+// 对象池信息
 USTRUCT(BlueprintType)
 struct FObjectPoolInfo
 {
@@ -61,43 +61,43 @@ struct FObjectPoolInfo
     }
 };
 
-// 
+// 单个对象池
 UCLASS()
 class XYFRAME_API UObjectPool : public UObject
 {
     GENERATED_BODY()
 
 public:
-    // ʼ
+    // 初始化对象池
     void Initialize(TSubclassOf<AActor> InActorClass, int32 InCapacity = -1);
 
-    // Ӷɶ
+    // 从对象池生成对象
     AActor* Spawn(UWorld* World, const FVector& Location, const FRotator& Rotation,
         AActor* Owner = nullptr, APawn* Instigator = nullptr);
 
-    // ն󵽶
+    // 回收对象到对象池
     void Despawn(AActor* Actor, float DelayTime = 0.0f);
 
-    // նڲʹã
+    // 立即回收对象（内部使用）
     void DespawnImmediate(AActor* Actor);
 
-    // ʹõĶ
+    // 回收所有正在使用的对象
     void DespawnAll();
 
-    // Ԥض
+    // 预加载对象
     void Preload(UWorld* World, int32 Amount = 1);
 
-    // ȡϢ
+    // 获取对象池信息
     FObjectPoolInfo GetPoolInfo() const;
 
-    // 
+    // 设置容量
     void SetCapacity(int32 NewCapacity);
 
-    // 
+    // 清理对象池
     void ClearPool();
 
 private:
-    // ʵִлյĶʱص
+    // 实际执行回收的定时器回调
     UFUNCTION()
     void ExecuteDespawn(AActor* Actor);
 
@@ -116,7 +116,7 @@ private:
     friend class UObjectPoolManager;
 };
 
-// ع
+// 对象池管理器
 UCLASS(Blueprintable, BlueprintType)
 class XYFRAME_API UObjectPoolManager : public USingletonBase
 {
@@ -125,94 +125,94 @@ class XYFRAME_API UObjectPoolManager : public USingletonBase
     DECLARE_SINGLETON(UObjectPoolManager)
 
 public:
-    // ʼع
+    // 初始化对象池管理器
     UFUNCTION(BlueprintCallable, Category = "ObjectPool")
     void InitializeObjectPoolManager();
 
-    // дʼ
+    // 重写单例初始化方法
     virtual void InitializeSingleton() override;
     virtual void DestroyCurSingleton() override { DestroyInstance(); }
 
-    // ȡʵͼɵ÷
+    // 获取管理器实例的蓝图可调用方法
     UFUNCTION(BlueprintCallable, BlueprintPure, Category = "ObjectPool", meta = (DisplayName = "Get ObjectPool Manager"))
     static UObjectPoolManager* GetObjectPoolManager() { return GetInstance(); }
 
-    // 캯
+    // 构造函数
     UObjectPoolManager();
     virtual ~UObjectPoolManager() override;
 
-    // ========== Ҫӿ ==========
+    // ========== 主要接口 ==========
 
-    // Ӷɶ
+    // 从对象池生成对象
     UFUNCTION(BlueprintCallable, Category = "ObjectPool")
     AActor* Spawn(TSubclassOf<AActor> ActorClass, const FVector& Location, const FRotator& Rotation,
         AActor* Owner = nullptr, APawn* Instigator = nullptr);
 
-    // ն󵽶أ֧ӳ٣
+    // 回收对象到对象池（支持延迟）
     UFUNCTION(BlueprintCallable, Category = "ObjectPool")
     void Despawn(AActor* Actor, float DelayTime = 0.0f);
 
-    // ָ͵ж
+    // 回收指定类型的所有对象
     UFUNCTION(BlueprintCallable, Category = "ObjectPool")
     void DespawnAllByClass(TSubclassOf<AActor> ActorClass);
 
-    // ж
+    // 回收所有对象
     UFUNCTION(BlueprintCallable, Category = "ObjectPool")
     void DespawnAll();
 
-    // Ԥض
+    // 预加载对象
     UFUNCTION(BlueprintCallable, Category = "ObjectPool")
     void Preload(TSubclassOf<AActor> ActorClass, int32 Amount = 1);
 
-    // ö
+    // 设置对象池容量
     UFUNCTION(BlueprintCallable, Category = "ObjectPool")
     void SetCapacity(TSubclassOf<AActor> ActorClass, int32 Capacity = -1);
 
-    // ȡ
+    // 获取对象池容量
     UFUNCTION(BlueprintCallable, Category = "ObjectPool")
     int32 GetCapacity(TSubclassOf<AActor> ActorClass);
 
-    // ========== ѯ͵ ==========
+    // ========== 查询和调试 ==========
 
-    // ȡϢ
+    // 获取对象池信息
     UFUNCTION(BlueprintCallable, Category = "ObjectPool")
     FObjectPoolInfo GetPoolInfo(TSubclassOf<AActor> ActorClass);
 
-    // ȡжϢ
+    // 获取所有对象池信息
     UFUNCTION(BlueprintCallable, Category = "ObjectPool")
     TArray<FObjectPoolInfo> GetAllPoolInfos();
 
-    // ӡжϢ
+    // 打印所有对象池信息
     UFUNCTION(BlueprintCallable, Category = "ObjectPool")
     void PrintAllPools();
 
-    // Ƿɶع
+    // 检查对象是否由对象池管理
     UFUNCTION(BlueprintCallable, Category = "ObjectPool")
     bool IsManagedByPool(AActor* Actor);
 
-    // ȡĶ
+    // 获取管理的对象总数
     UFUNCTION(BlueprintCallable, Category = "ObjectPool")
     int32 GetTotalManagedCount() const;
 
 private:
-    // һ򴴽
+    // 查找或创建对象池
     UObjectPool* FindOrCreatePool(TSubclassOf<AActor> ActorClass);
 
-    // Ҷ
+    // 查找对象池
     UObjectPool* FindPool(TSubclassOf<AActor> ActorClass);
 
-    // ͨҶ
+    // 通过对象查找对象池
     UObjectPool* FindPoolByActor(AActor* Actor);
 
-    // 󵽶صӳ
+    // 对象到对象池的映射
     UPROPERTY()
     TMap<TSubclassOf<AActor>, UObjectPool*> PoolsMap;
 
-    // 󵽶صĿٲ
+    // 对象到对象池的快速查找
     UPROPERTY()
     TMap<AActor*, UObjectPool*> ActorToPoolMap;
 
-    // ظ֯
+    // 对象池父对象（用于组织）
     UPROPERTY()
     UObject* PoolsParent;
 
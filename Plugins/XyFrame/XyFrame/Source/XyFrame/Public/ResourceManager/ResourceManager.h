@@ -10,7 +10,7 @@
 #include "ResourceTableRow.h"
 #include "ResourceManager.generated.h"
 
-// Դ״̬
+// 资源加载状态
 UENUM(BlueprintType)
 enum class EResourceLoadState : uint8
 {
@@ -20,7 +20,7 @@ enum class EResourceLoadState : uint8
     Failed UMETA(DisplayName = "Failed")
 };
 
-// ԴϢṹ
+// 资源信息结构
 USTRUCT(BlueprintType)
 struct FResourceInfo
 {
@@ -48,7 +48,7 @@ struct FResourceInfo
     }
 };
 
-// 첽ID
+// 异步加载请求ID
 USTRUCT(BlueprintType)
 struct FAsyncLoadRequest
 {
@@ -76,15 +76,15 @@ struct FAsyncLoadRequest
     }
 };
 
-// Դί
+// 资源加载完成委托
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnResourceFinishLoadedSignature, const FString&, RequestId);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnResourcesFinishLoadedSignature, const FString&, RequestId);
 
-// µļ򻯻صί - ֱӴݼصԴ
+// 新的简化回调委托 - 直接传递加载的资源
 DECLARE_DYNAMIC_DELEGATE_OneParam(FOnResourceLoadedCallback, UObject*, LoadedResource);
 DECLARE_DYNAMIC_DELEGATE_OneParam(FOnResourcesLoadedCallback, const TArray<UObject*>&, LoadedResources);
 
-// ̬ίC++Աָ
+// 静态委托用于C++成员函数指针
 DECLARE_DELEGATE_OneParam(FOnResourceLoadedStaticDelegate, UObject*);
 DECLARE_DELEGATE_OneParam(FOnResourcesLoadedStaticDelegate, const TArray<UObject*>&);
 
@@ -93,116 +93,122 @@ class XYFRAME_API UResourceManager : public USingletonBase
 {
     GENERATED_BODY()
 
-    // 
+    // 声明单例
     DECLARE_SINGLETON(UResourceManager)
 
 public:
-    // ʼԴ
+    // 初始化资源管理器
     UFUNCTION(BlueprintCallable, Category = "Resource")
     void InitializeResourceManager();
 
-    // дʼ
+    // 重写初始化方法
     virtual void InitializeSingleton() override;
     virtual void DestroyCurSingleton() override { DestroyInstance(); };
 
-    // ȡʵͼɵ÷
+    // 获取实例的蓝图可调用方法
     UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Resource", meta = (DisplayName = "Get Resource Manager"))
     static UResourceManager* GetResourceManager() { return GetInstance(); }
 
-    // Դݱ
+    // 设置资源数据表
     UFUNCTION(BlueprintCallable, Category = "Resource|DataTable")
     void SetResourceDataTable(UDataTable* InResourceDataTable);
 
 
-    // ĬϹ캯
+    // 默认构造函数
     UResourceManager();
 
-    // 
+    // 析构函数
     virtual ~UResourceManager() override;
 
-    // ========== ͼɷί ==========
+    // ========== 蓝图可分配委托 ==========
 
-    // Դί
+    // 单个资源加载完成委托
     UPROPERTY(BlueprintAssignable, Category = "Resource")
     FOnResourceFinishLoadedSignature OnResourceFinishLoaded;
 
-    // Դί
+    // 多个资源加载完成委托
     UPROPERTY(BlueprintAssignable, Category = "Resource")
     FOnResourcesFinishLoadedSignature OnResourcesFinishLoaded;
 
-    // ========== Դ ==========
+    // ========== 基础资源操作 ==========
 
-    // ͬصԴ
+    // 同步加载单个资源
     UFUNCTION(BlueprintCallable, Category = "Resource")
     UObject* LoadResourceSync(const FString& ResourcePath);
 
-    // ͨԴIDԴͬ
+    // 通过资源ID加载资源（同步）
     UFUNCTION(BlueprintCallable, Category = "Resource|DataTable")
     UObject* LoadResourceByID(const FName& ResourceID);
 
-    // ָͬ͵ĵԴ
+    // 同步加载指定类型的单个资源
     UFUNCTION(BlueprintCallable, Category = "Resource")
     UObject* LoadResourceSyncByClass(const FString& ResourcePath, TSubclassOf<UObject> ResourceClass);
 
-    // ͬļԴ
+    // 同步加载文件夹下所有资源
     UFUNCTION(BlueprintCallable, Category = "Resource")
     TArray<UObject*> LoadResourcesInFolderSync(const FString& FolderPath);
 
-    // ͬļָ͵Դ
+    // 同步加载文件夹下指定类型的所有资源
     UFUNCTION(BlueprintCallable, Category = "Resource")
     TArray<UObject*> LoadResourcesInFolderSyncByClass(const FString& FolderPath, TSubclassOf<UObject> ResourceClass);
 
-    // ========== 첽ԴʹID ==========
+    // ========== 异步资源操作（使用请求ID） ==========
 
-    // 첽صԴ - ID
+    // 异步加载单个资源 - 返回请求ID
     UFUNCTION(BlueprintCallable, Category = "Resource")
     FString LoadResourceAsync(const FString& ResourcePath);
 
-    // 첽ָ͵ĵԴ - ID
+    // 异步加载指定类型的单个资源 - 返回请求ID
     UFUNCTION(BlueprintCallable, Category = "Resource")
     FString LoadResourceAsyncByClass(const FString& ResourcePath, TSubclassOf<UObject> ResourceClass);
 
-    // 첽ļԴ - ID
+    // 异步加载文件夹下所有资源 - 返回请求ID
     UFUNCTION(BlueprintCallable, Category = "Resource")
     FString LoadResourcesInFolderAsync(const FString& FolderPath);
 
-    // 첽ļָ͵Դ - ID
+    // 异步加载文件夹下指定类型的所有资源 - 返回请求ID
     UFUNCTION(BlueprintCallable, Category = "Resource")
     FString LoadResourcesInFolderAsyncByClass(const FString& FolderPath, TSubclassOf<UObject> ResourceClass);
 
-    // ========== 򻯵첽ԴֱӰ󶨻ص ==========
+    // ========== 简化的异步资源操作（直接绑定回调） ==========
 
-    // 첽صԴ - ֱӰ󶨻صͼ
+    // 异步加载单个资源 - 直接绑定回调（蓝图）
     UFUNCTION(BlueprintCallable, Category = "Resource", meta = (DisplayName = "Load Resource Async With Callback"))
     void LoadResourceAsyncWithCallback(const FString& ResourcePath, const FOnResourceLoadedCallback& Callback);
 
-    // 첽ָ͵ĵԴ - ֱӰ󶨻صͼ
+    // 异步加载指定类型的单个资源 - 直接绑定回调（蓝图）
     UFUNCTION(BlueprintCallable, Category = "Resource", meta = (DisplayName = "Load Resource Async By Class With Callback"))
     void LoadResourceAsyncByClassWithCallback(const FString& ResourcePath, TSubclassOf<UObject> ResourceClass, const FOnResourceLoadedCallback& Callback);
 
-    // ͨԴIDԴ첽- ID
+    // 通过资源ID加载资源（异步）- 返回请求ID
     UFUNCTION(BlueprintCallable, Category = "Resource|DataTable")
     FString LoadResourceByIDAsync(const FName& ResourceID);
 
-    // ͨԴIDԴ첽- ֱӻص
+    // 通过资源ID加载资源（异步）- 直接回调
     UFUNCTION(BlueprintCallable, Category = "Resource|DataTable")
     void LoadResourceByIDWithCallback(const FName& ResourceID, const FOnResourceLoadedCallback& Callback);
 
-    // ضԴ
+    // 按分类加载多个资源
     UFUNCTION(BlueprintCallable, Category = "Resource|DataTable")
     void LoadResourcesByCategory(EResourceCategory Category, const FOnResourcesLoadedCallback& Callback);
 
-    // 첽ļԴ - ֱӰ󶨻صͼ
+    // 异步加载文件夹下所有资源 - 直接绑定回调（蓝图）
     UFUNCTION(BlueprintCallable, Category = "Resource", meta = (DisplayName = "Load Resources In Folder Async With Callback"))
     void LoadResourcesInFolderAsyncWithCallback(const FString& FolderPath, const FOnResourcesLoadedCallback& Callback);
 
-    // 첽ļָ͵Դ - ֱӰ󶨻صͼ
+    // 异步加载文件夹下指定类型的所有资源 - 直接绑定回调（蓝图）
     UFUNCTION(BlueprintCallable, Category = "Resource", meta = (DisplayName = "Load Resources In Folder Async By Class With Callback"))
     void LoadResourcesInFolderAsyncByClassWithCallback(const FString& FolderPath, TSubclassOf<UObject> ResourceClass, const FOnResourcesLoadedCallback& Callback);
 
-    // ========== C++ģ巽 - ֱӴݳԱָ ==========
+    // 异步加载单个资源 - 原生委托，可绑定Lambda
+    void LoadResourceAsyncWithCallback(const FString& ResourcePath, const FOnResourceLoadedStaticDelegate& Callback)
+    {
+        InternalLoadResourceAsyncWithStaticCallback(ResourcePath, Callback);
+    }
+
+    // ========== C++模板方法 - 直接传递成员函数指针 ==========
 
-    // 첽صԴ - ֱӰ󶨳Աָ
+    // 异步加载单个资源 - 直接绑定成员函数指针
     template<typename T>
     void LoadResourceAsyncWithCallback(const FString& ResourcePath, T* Object, void(T::* Function)(UObject*))
     {
@@ -211,11 +217,11 @@ public:
         InternalLoadResourceAsyncWithStaticCallback(ResourcePath, StaticDelegate);
     }
 
-    // 첽صԴ - ޲γԱָ
+    // 异步加载单个资源 - 无参成员函数指针
     template<typename T>
     void LoadResourceAsyncWithCallback(const FString& ResourcePath, T* Object, void(T::* Function)())
     {
-        // ʹlambdaװ޲κԼصԴ
+        // 使用lambda包装无参函数，忽略加载的资源参数
         FOnResourceLoadedStaticDelegate StaticDelegate = FOnResourceLoadedStaticDelegate::CreateLambda([Object, Function](UObject* LoadedResource) {
             if (Object && Function)
             {
@@ -225,7 +231,7 @@ public:
         InternalLoadResourceAsyncWithStaticCallback(ResourcePath, StaticDelegate);
     }
 
-    // 첽ָ͵ĵԴ - ֱӰ󶨳Աָ루
+    // 异步加载指定类型的单个资源 - 直接绑定成员函数指针（带参数）
     template<typename T>
     void LoadResourceAsyncByClassWithCallback(const FString& ResourcePath, TSubclassOf<UObject> ResourceClass, T* Object, void(T::* Function)(UObject*))
     {
@@ -234,11 +240,11 @@ public:
         InternalLoadResourceAsyncByClassWithStaticCallback(ResourcePath, ResourceClass, StaticDelegate);
     }
 
-    // 첽ָ͵ĵԴ - ޲γԱָ
+    // 异步加载指定类型的单个资源 - 无参成员函数指针
     template<typename T>
     void LoadResourceAsyncByClassWithCallback(const FString& ResourcePath, TSubclassOf<UObject> ResourceClass, T* Object, void(T::* Function)())
     {
-        // ʹlambdaװ޲κԼصԴ
+        // 使用lambda包装无参函数，忽略加载的资源参数
         FOnResourceLoadedStaticDelegate StaticDelegate = FOnResourceLoadedStaticDelegate::CreateLambda([Object, Function](UObject* LoadedResource) {
             if (Object && Function)
             {
@@ -248,7 +254,7 @@ public:
         InternalLoadResourceAsyncByClassWithStaticCallback(ResourcePath, ResourceClass, StaticDelegate);
     }
 
-    // ͨԴIDԴ첽- Աָص
+    // 通过资源ID加载资源（异步）- 成员函数指针回调
     template<typename T>
     void LoadResourceByIDWithCallback(const FName& ResourceID, T* Object, void(T::* Function)(UObject*))
     {
@@ -269,7 +275,7 @@ public:
         }
     }
 
-    // 첽ļԴ - ֱӰ󶨳Աָ루
+    // 异步加载文件夹下所有资源 - 直接绑定成员函数指针（带参数）
     template<typename T>
     void LoadResourcesInFolderAsyncWithCallback(const FString& FolderPath, T* Object, void(T::* Function)(const TArray<UObject*>&))
     {
@@ -278,11 +284,11 @@ public:
         InternalLoadResourcesInFolderAsyncWithStaticCallback(FolderPath, StaticDelegate);
     }
 
-    // 첽ļԴ - ޲γԱָ
+    // 异步加载文件夹下所有资源 - 无参成员函数指针
     template<typename T>
     void LoadResourcesInFolderAsyncWithCallback(const FString& FolderPath, T* Object, void(T::* Function)())
     {
-        // ʹlambdaװ޲κԼصԴ
+        // 使用lambda包装无参函数，忽略加载的资源数组参数
         FOnResourcesLoadedStaticDelegate StaticDelegate = FOnResourcesLoadedStaticDelegate::CreateLambda([Object, Function](const TArray<UObject*>& LoadedResources) {
             if (Object && Function)
             {
@@ -292,7 +298,7 @@ public:
         InternalLoadResourcesInFolderAsyncWithStaticCallback(FolderPath, StaticDelegate);
     }
 
-    // 첽ļָ͵Դ - ֱӰ󶨳Աָ루
+    // 异步加载文件夹下指定类型的所有资源 - 直接绑定成员函数指针（带参数）
     template<typename T>
     void LoadResourcesInFolderAsyncByClassWithCallback(const FString& FolderPath, TSubclassOf<UObject> ResourceClass, T* Object, void(T::* Function)(const TArray<UObject*>&))
     {
@@ -301,11 +307,11 @@ public:
         InternalLoadResourcesInFolderAsyncByClassWithStaticCallback(FolderPath, ResourceClass, StaticDelegate);
     }
 
-    // 첽ļָ͵Դ - ޲γԱָ
+    // 异步加载文件夹下指定类型的所有资源 - 无参成员函数指针
     template<typename T>
     void LoadResourcesInFolderAsyncByClassWithCallback(const FString& FolderPath, TSubclassOf<UObject> ResourceClass, T* Object, void(T::* Function)())
     {
-        // ʹlambdaװ޲κԼصԴ
+        // 使用lambda包装无参函数，忽略加载的资源数组参数
         FOnResourcesLoadedStaticDelegate StaticDelegate = FOnResourcesLoadedStaticDelegate::CreateLambda([Object, Function](const TArray<UObject*>& LoadedResources) {
             if (Object && Function)
             {
@@ -315,181 +321,181 @@ public:
         InternalLoadResourcesInFolderAsyncByClassWithStaticCallback(FolderPath, ResourceClass, StaticDelegate);
     }
 
-    // ========== 첽 ==========
+    // ========== 异步请求管理 ==========
 
-    // ȡ첽״̬
+    // 获取异步请求状态
     UFUNCTION(BlueprintCallable, Category = "Resource")
     EResourceLoadState GetAsyncRequestState(const FString& RequestId) const;
 
-    // ȡ첽صԴ
+    // 获取异步请求加载的资源（单个）
     UFUNCTION(BlueprintCallable, Category = "Resource")
     UObject* GetAsyncRequestResource(const FString& RequestId) const;
 
-    // ȡ첽صԴ
+    // 获取异步请求加载的资源（多个）
     UFUNCTION(BlueprintCallable, Category = "Resource")
     TArray<UObject*> GetAsyncRequestResources(const FString& RequestId) const;
 
-    // ȡ첽
+    // 取消异步请求
     UFUNCTION(BlueprintCallable, Category = "Resource")
     void CancelAsyncRequest(const FString& RequestId);
 
-    // ========== Դ ==========
+    // ========== 资源缓存管理 ==========
 
-    // ԤбΪԤصԴ
+    // 预加载所有标记为预加载的资源
     UFUNCTION(BlueprintCallable, Category = "Resource|DataTable")
     void PreloadMarkedResources();
 
-    // Դӵ
+    // 将资源添加到缓存
     UFUNCTION(BlueprintCallable, Category = "Resource")
     void AddToCache(const FString& ResourcePath, UObject* Resource);
 
-    // ӻȡԴ
+    // 从缓存获取资源
     UFUNCTION(BlueprintCallable, Category = "Resource")
     UObject* GetFromCache(const FString& ResourcePath);
 
-    // ԴǷڻ
+    // 检查资源是否在缓存中
     UFUNCTION(BlueprintCallable, Category = "Resource")
     bool IsInCache(const FString& ResourcePath);
 
-    // ӻƳԴ
+    // 从缓存移除资源
     UFUNCTION(BlueprintCallable, Category = "Resource")
     void RemoveFromCache(const FString& ResourcePath);
 
-    // Դ
+    // 清空资源缓存
     UFUNCTION(BlueprintCallable, Category = "Resource")
     void ClearCache();
 
-    // ȡС
+    // 获取缓存大小
     UFUNCTION(BlueprintCallable, Category = "Resource")
     int32 GetCacheSize() const;
 
-    // ========== ԴϢѯ ==========
+    // ========== 资源信息查询 ==========
 
-    // ȡԴϢ
+    // 获取资源信息
     UFUNCTION(BlueprintCallable, Category = "Resource")
     FResourceInfo GetResourceInfo(const FString& ResourcePath);
 
-    // ȡԴϢ
+    // 获取资源信息
     UFUNCTION(BlueprintCallable, Category = "Resource|DataTable")
     bool GetResourceInfoByID(const FName& ResourceID, FResourceTableRow& OutInfo) const;
 
-    // ԴǷ
+    // 检查资源是否存在
     UFUNCTION(BlueprintCallable, Category = "Resource")
     bool DoesResourceExist(const FString& ResourcePath);
 
-    // ԴIDǷ
+    // 检查资源ID是否存在
     UFUNCTION(BlueprintCallable, Category = "Resource|DataTable")
     bool DoesResourceIDExist(const FName& ResourceID) const;
 
-    // ȡļԴ·
+    // 获取文件夹下所有资源路径
     UFUNCTION(BlueprintCallable, Category = "Resource")
     TArray<FString> GetResourcePathsInFolder(const FString& FolderPath);
 
-    // ȡļָ͵Դ·
+    // 获取文件夹下指定类型的所有资源路径
     UFUNCTION(BlueprintCallable, Category = "Resource")
     TArray<FString> GetResourcePathsInFolderByClass(const FString& FolderPath, TSubclassOf<UObject> ResourceClass);
 
-    // ȡµԴID
+    // 获取分类下的所有资源ID
     UFUNCTION(BlueprintCallable, Category = "Resource|DataTable")
     TArray<FName> GetResourceIDsByCategory(EResourceCategory Category) const;
 
-    // ȡԴ·
+    // 获取资源路径
     UFUNCTION(BlueprintCallable, Category = "Resource|DataTable")
     FString GetResourcePathByID(const FName& ResourceID) const;
 
-    // ========== Դжع ==========
+    // ========== 资源卸载管理 ==========
 
-    // жصԴ
+    // 卸载单个资源
     UFUNCTION(BlueprintCallable, Category = "Resource")
     void UnloadResource(const FString& ResourcePath);
 
-    // жļԴ
+    // 卸载文件夹下所有资源
     UFUNCTION(BlueprintCallable, Category = "Resource")
     void UnloadResourcesInFolder(const FString& FolderPath);
 
-    // ǿ
+    // 强制垃圾回收
     UFUNCTION(BlueprintCallable, Category = "Resource")
     void ForceGarbageCollection();
 
-    // ========== Թ ==========
+    // ========== 调试工具 ==========
 
-    // ӡϢ
+    // 打印缓存信息
     UFUNCTION(BlueprintCallable, Category = "Resource")
     void PrintCacheInfo();
 
-    // ӡļԴб
+    // 打印文件夹资源列表
     UFUNCTION(BlueprintCallable, Category = "Resource")
     void PrintFolderResources(const FString& FolderPath);
 
-    // ӡ첽״̬
+    // 打印所有异步请求状态
     UFUNCTION(BlueprintCallable, Category = "Resource")
     void PrintAsyncRequests();
 
 private:
-    // ʽع
+    // 流式加载管理器
     FStreamableManager StreamableManager;
 
-    // Դ
+    // 资源缓存
     TMap<FString, UObject*> ResourceCache;
 
-    // 첽ؾ
+    // 异步加载句柄
     TMap<FString, TSharedPtr<FStreamableHandle>> AsyncHandles;
 
-    // 첽Ϣ
+    // 异步请求信息
     TMap<FString, FAsyncLoadRequest> AsyncRequests;
 
-    // Դ
+    // 单个资源请求结果
     TMap<FString, UObject*> SingleResourceResults;
 
-    // Դ
+    // 多个资源请求结果
     TMap<FString, TArray<UObject*>> MultiResourceResults;
 
-    // 򻯻صӳ
+    // 简化回调映射
     TMap<FString, FOnResourceLoadedCallback> SingleResourceCallbacks;
     TMap<FString, FOnResourcesLoadedCallback> MultiResourceCallbacks;
 
-    // ̬صӳ
+    // 静态回调映射
     TMap<FString, FOnResourceLoadedStaticDelegate> SingleResourceStaticCallbacks;
     TMap<FString, FOnResourcesLoadedStaticDelegate> MultiResourceStaticCallbacks;
 
-    // ڲط
+    // 内部加载方法
     UObject* InternalLoadResourceSync(const FString& ResourcePath, TSubclassOf<UObject> ResourceClass = nullptr);
     TArray<UObject*> InternalLoadResourcesInFolderSync(const FString& FolderPath, TSubclassOf<UObject> ResourceClass = nullptr);
 
-    // Դݱ
+    // 资源数据表
     UPROPERTY()
     UDataTable* ResourceDataTable;
 
-    // ԴID·Ŀٲұ
+    // 资源ID到路径的快速查找表
     TMap<FName, FString> ResourceIDToPathMap;
 
-    // ൽԴIDӳ
+    // 分类到资源ID的映射
     TMap<EResourceCategory, TArray<FName>> CategoryToResourceIDsMap;
 
-    // ڲ첽ػص
+    // 内部异步加载回调
     void HandleSingleResourceLoaded(FString RequestId);
     void HandleFolderResourcesLoaded(FString RequestId);
 
-    // 򻯻ص
+    // 简化回调处理
     void HandleSingleResourceWithCallback(FString RequestId);
     void HandleFolderResourcesWithCallback(FString RequestId);
 
-    // ̬ص
+    // 静态回调处理
     void HandleSingleResourceWithStaticCallback(FString RequestId);
     void HandleFolderResourcesWithStaticCallback(FString RequestId);
 
-    // ڲ̬ص
+    // 内部静态回调方法
     void InternalLoadResourceAsyncWithStaticCallback(const FString& ResourcePath, const FOnResourceLoadedStaticDelegate& Callback);
     void InternalLoadResourceAsyncByClassWithStaticCallback(const FString& ResourcePath, TSubclassOf<UObject> ResourceClass, const FOnResourceLoadedStaticDelegate& Callback);
     void InternalLoadResourcesInFolderAsyncWithStaticCallback(const FString& FolderPath, const FOnResourcesLoadedStaticDelegate& Callback);
     void InternalLoadResourcesInFolderAsyncByClassWithStaticCallback(const FString& FolderPath, TSubclassOf<UObject> ResourceClass, const FOnResourcesLoadedStaticDelegate& Callback);
 
-    // ߷
+    // 工具方法
     FString SanitizeResourcePath(const FString& ResourcePath) const;
     bool IsValidResourceClass(TSubclassOf<UObject> ResourceClass) const;
     FString GenerateRequestId() const;
 
-    // ڲ
+    // 内部方法
     void BuildLookupTables();
     bool GetResourceTableRow(const FName& ResourceID, FResourceTableRow& OutRow) const;
 };
\ No newline at end of file
@@ -5,7 +5,7 @@
 #include "Engine/DataTable.h"
 #include "ResourceTableRow.generated.h"
 
-// Դö
+// 资源分类枚举
 UENUM(BlueprintType)
 enum class EResourceCategory : uint8
 {
@@ -18,42 +18,42 @@ enum class EResourceCategory : uint8
     Other UMETA(DisplayName = "OtherResource")
 };
 
-// Դнṹ
+// 资源表行结构
 USTRUCT(BlueprintType)
 struct FResourceTableRow : public FTableRowBase
 {
     GENERATED_BODY()
 
 public:
-    // ԴIDΨһʶ
+    // 资源ID（唯一标识）
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Resource")
     FName ResourceID;
 
-    // Դʾ
+    // 资源显示名称
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Resource")
     FText DisplayName;
 
-    // Դ
+    // 资源分类
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Resource")
     EResourceCategory Category;
 
-    // Դ·
+    // 资源路径
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Resource")
     FString ResourcePath;
 
-    // ԴͣѡͰȫ
+    // 资源类型（可选，用于类型安全）
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Resource")
     TSubclassOf<UObject> ResourceClass;
 
-    // Դ
+    // 资源描述
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Resource")
     FText Description;
 
-    // ǷԤ
+    // 是否预加载
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Resource")
     bool bPreload = false;
 
-    // ȼֵԽСȼԽߣ
+    // 加载优先级（数值越小优先级越高）
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Resource")
     int32 LoadPriority = 0;
 
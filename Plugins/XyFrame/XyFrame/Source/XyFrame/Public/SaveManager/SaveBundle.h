@@ -0,0 +1,77 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class IMappedFileHandle;
+class IMappedFileRegion;
+
+// 存档包分段类型
+enum class ESaveSectionType : uint8
+{
+    Metadata,
+    Player,
+    Settings,
+    Progress,
+    World
+};
+
+// 分段表条目：分段在文件中的位置与编码方式
+struct FSaveSectionEntry
+{
+    ESaveSectionType Type = ESaveSectionType::Metadata;
+    FString Name;
+    int64 Offset = 0;
+    int64 Size = 0;
+    int64 UncompressedSize = 0;
+    FName CompressionFormat;
+    // 存储数据（压缩后）的CRC32，版本2起写入
+    uint32 Crc = 0;
+
+    void Serialize(FArchive& Ar, int32 Version);
+};
+
+// 存档包写入：各分段独立编码，分段表写在文件末尾
+struct FSaveBundleWriter
+{
+    // CompressionFormat为NAME_None时不压缩
+    void AddSection(ESaveSectionType Type, const FString& Name, const TArray<uint8>& Body, FName CompressionFormat);
+
+    // 写入分段表并回填文件头，取出完整文件内容，由调用方负责落盘
+    void Finish(TArray<uint8>& OutData);
+
+private:
+    TArray<uint8> Data;
+    TArray<FSaveSectionEntry> Sections;
+};
+
+// 存档包读取：打开时只解析头和分段表，分段数据在请求时才从映射内存中解码
+class FSaveBundleReader
+{
+public:
+    ~FSaveBundleReader();
+
+    static TSharedPtr<FSaveBundleReader> Open(const FString& FilePath);
+
+    const FSaveSectionEntry* FindSection(ESaveSectionType Type, const FString& Name = FString()) const;
+    const TArray<FSaveSectionEntry>& GetSections() const { return Sections; }
+
+    // 取出分段的原始数据（必要时解压），返回的数据在Reader销毁前有效
+    bool ReadSection(const FSaveSectionEntry& Section, TArray<uint8>& Scratch, TArrayView<const uint8>& OutBody) const;
+
+    bool IsMemoryMapped() const { return MappedRegion.IsValid(); }
+    int64 GetFileSize() const { return FileView.Num(); }
+
+private:
+    bool ParseSectionTable();
+
+    // 不支持内存映射的平台退回整文件读取（区域必须先于句柄释放）
+    TUniquePtr<IMappedFileHandle> MappedHandle;
+    TUniquePtr<IMappedFileRegion> MappedRegion;
+    TArray<uint8> FileData;
+    TArrayView<const uint8> FileView;
+
+    TArray<FSaveSectionEntry> Sections;
+    int32 Version = 0;
+};
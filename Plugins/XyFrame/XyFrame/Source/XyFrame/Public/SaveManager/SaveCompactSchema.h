@@ -0,0 +1,33 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "SaveGameDataTypes.h"
+
+// 存档字符串表：写入时把重复的字符串键去重为整数索引
+struct FSaveStringTable
+{
+    // 返回字符串的索引，首次出现时追加到表中
+    int32 Intern(const FString& Str);
+
+    bool IsValidIndex(int32 Index) const { return Strings.IsValidIndex(Index); }
+    const FString& Get(int32 Index) const { return Strings[Index]; }
+    int32 Num() const { return Strings.Num(); }
+
+    void Serialize(FArchive& Ar);
+
+private:
+    TArray<FString> Strings;
+    TMap<FString, int32> Indices;
+};
+
+// 紧凑存档格式：字符串表写一次，各字段按“键索引数组 + 值数组”的结构数组形式存储
+struct FSaveCompactSchema
+{
+    static void WriteWorldData(FArchive& Ar, const FWorldSaveData& WorldData);
+    static bool ReadWorldData(FArchive& Ar, FWorldSaveData& OutWorldData);
+
+    static void WriteProgressData(FArchive& Ar, const FProgressData& ProgressData);
+    static bool ReadProgressData(FArchive& Ar, FProgressData& OutProgressData);
+};
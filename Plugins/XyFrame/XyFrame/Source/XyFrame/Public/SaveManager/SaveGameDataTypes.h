@@ -6,7 +6,7 @@
 #include "Engine/Engine.h"
 #include "SaveGameDataTypes.generated.h"
 
-// Ҵ浵ݽṹ
+// 玩家存档数据结构
 USTRUCT(BlueprintType)
 struct FPlayerSaveData
 {
@@ -46,7 +46,7 @@ public:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SaveGame|Player")
     TMap<FString, bool> UnlockedAbilities;
 
-    // 캯
+    // 构造函数
     FPlayerSaveData()
         : Health(100.0f)
         , MaxHealth(100.0f)
@@ -55,7 +55,7 @@ public:
     {
     }
 
-    // ݷ - Ƴ UFUNCTION
+    // 便捷方法 - 移除了 UFUNCTION
     bool IsAlive() const { return Health > 0.0f; }
 
     float GetHealthPercentage() const { return MaxHealth > 0 ? Health / MaxHealth : 0.0f; }
@@ -63,7 +63,7 @@ public:
     void AddExperience(int32 ExpAmount)
     {
         Experience += ExpAmount;
-        // 򵥵߼
+        // 简单的升级逻辑
         if (Experience >= Level * 100)
         {
             Level++;
@@ -133,7 +133,7 @@ public:
         return UnlockedAbilities.Contains(AbilityID) && UnlockedAbilities[AbilityID];
     }
 
-    // л֧
+    // 序列化支持
     bool Serialize(FArchive& Ar)
     {
         Ar << Location;
@@ -151,13 +151,29 @@ public:
     }
 };
 
-// 浵ݽṹ
+// 世界存档字段（脏标记和增量存档使用）
+UENUM(BlueprintType)
+enum class EWorldSaveField : uint8
+{
+    ActivatedTriggers,
+    MovedActors,
+    DestroyedActors,
+    ActorTransforms,
+    WorldStateData,
+    CompletedQuests,
+    QuestProgress,
+    DiscoveredLocations
+};
+
+// 世界存档数据结构
 USTRUCT(BlueprintType)
 struct FWorldSaveData
 {
     GENERATED_BODY()
 
 public:
+    static constexpr int32 FieldCount = 8;
+
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SaveGame|World")
     TMap<FString, bool> ActivatedTriggers;
 
@@ -182,10 +198,11 @@ public:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SaveGame|World")
     TMap<FString, bool> DiscoveredLocations;
 
-    // ݷ - Ƴ UFUNCTION
+    // 便捷方法 - 移除了 UFUNCTION
     void SetActorTransform(const FString& ActorID, const FTransform& Transform)
     {
         ActorTransforms.Add(ActorID, Transform);
+        MarkDirty(EWorldSaveField::ActorTransforms, ActorID);
     }
 
     FTransform GetActorTransform(const FString& ActorID, const FTransform& DefaultTransform = FTransform::Identity) const
@@ -196,6 +213,7 @@ public:
     void ActivateTrigger(const FString& TriggerID)
     {
         ActivatedTriggers.Add(TriggerID, true);
+        MarkDirty(EWorldSaveField::ActivatedTriggers, TriggerID);
     }
 
     bool IsTriggerActivated(const FString& TriggerID) const
@@ -206,6 +224,7 @@ public:
     void MarkActorDestroyed(const FString& ActorID)
     {
         DestroyedActors.Add(ActorID, true);
+        MarkDirty(EWorldSaveField::DestroyedActors, ActorID);
     }
 
     bool IsActorDestroyed(const FString& ActorID) const
@@ -216,6 +235,7 @@ public:
     void CompleteQuest(const FString& QuestID)
     {
         CompletedQuests.Add(QuestID, true);
+        MarkDirty(EWorldSaveField::CompletedQuests, QuestID);
     }
 
     bool IsQuestCompleted(const FString& QuestID) const
@@ -226,6 +246,7 @@ public:
     void SetQuestProgress(const FString& QuestID, int32 Progress)
     {
         QuestProgress.Add(QuestID, Progress);
+        MarkDirty(EWorldSaveField::QuestProgress, QuestID);
     }
 
     int32 GetQuestProgress(const FString& QuestID) const
@@ -236,6 +257,7 @@ public:
     void DiscoverLocation(const FString& LocationID)
     {
         DiscoveredLocations.Add(LocationID, true);
+        MarkDirty(EWorldSaveField::DiscoveredLocations, LocationID);
     }
 
     bool IsLocationDiscovered(const FString& LocationID) const
@@ -246,6 +268,7 @@ public:
     void SetWorldState(const FString& Key, const FString& Value)
     {
         WorldStateData.Add(Key, Value);
+        MarkDirty(EWorldSaveField::WorldStateData, Key);
     }
 
     FString GetWorldState(const FString& Key, const FString& DefaultValue = TEXT("")) const
@@ -253,7 +276,7 @@ public:
         return WorldStateData.Contains(Key) ? WorldStateData[Key] : DefaultValue;
     }
 
-    // л֧
+    // 序列化支持
     bool Serialize(FArchive& Ar)
     {
         Ar << ActivatedTriggers;
@@ -266,9 +289,64 @@ public:
         Ar << DiscoveredLocations;
         return true;
     }
+
+    // ========== 脏标记（不参与序列化） ==========
+    // 便捷方法会自动标记；直接修改Map（包括删除键）后需要调用MarkDirty，否则改动要等下次完整存档才会写入
+
+    void MarkDirty(EWorldSaveField Field, const FString& Key)
+    {
+        DirtyKeys[static_cast<int32>(Field)].Add(Key);
+    }
+
+    void MarkAllDirty()
+    {
+        bAllDirty = true;
+    }
+
+    void ClearDirty()
+    {
+        for (TSet<FString>& Keys : DirtyKeys)
+        {
+            Keys.Reset();
+        }
+        bAllDirty = false;
+    }
+
+    bool IsAllDirty() const
+    {
+        return bAllDirty;
+    }
+
+    bool HasDirty() const
+    {
+        if (bAllDirty)
+        {
+            return true;
+        }
+        for (const TSet<FString>& Keys : DirtyKeys)
+        {
+            if (Keys.Num() > 0)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    const TSet<FString>& GetDirtyKeys(EWorldSaveField Field) const
+    {
+        return DirtyKeys[static_cast<int32>(Field)];
+    }
+
+private:
+    // 自上次保存以来变化过的键（按字段）
+    TSet<FString> DirtyKeys[FieldCount];
+
+    // 新建或未跟踪来源的数据视为整体变脏，下次保存写完整存档
+    bool bAllDirty = true;
 };
 
-// ݽṹ
+// 设置数据结构
 USTRUCT(BlueprintType)
 struct FSettingsData
 {
@@ -314,7 +392,7 @@ public:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SaveGame|Settings")
     int32 DifficultyLevel = 1;
 
-    // ݷ - Ƴ UFUNCTION
+    // 便捷方法 - 移除了 UFUNCTION
     void SetVolumeLevels(float NewMaster, float NewMusic, float NewSFX, float NewVoice = 0.8f)
     {
         MasterVolume = FMath::Clamp(NewMaster, 0.0f, 1.0f);
@@ -343,7 +421,7 @@ public:
         DifficultyLevel = FMath::Clamp(Difficulty, 0, 2);
     }
 
-    // л֧
+    // 序列化支持
     bool Serialize(FArchive& Ar)
     {
         Ar << MasterVolume;
@@ -363,7 +441,7 @@ public:
     }
 };
 
-// ݽṹ
+// 进度数据结构
 USTRUCT(BlueprintType)
 struct FProgressData
 {
@@ -397,7 +475,7 @@ public:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SaveGame|Progress")
     TMap<FString, FDateTime> AchievementUnlockTimes;
 
-    // ݷ - Ƴ UFUNCTION
+    // 便捷方法 - 移除了 UFUNCTION
     void CompleteLevel(const FString& LevelName, int32 Score = 0, float CompletionTime = 0.0f)
     {
         if (!CompletedLevels.Contains(LevelName))
@@ -500,7 +578,7 @@ public:
         return Count;
     }
 
-    // л֧
+    // 序列化支持
     bool Serialize(FArchive& Ar)
     {
         Ar << CompletedLevels;
@@ -516,7 +594,7 @@ public:
     }
 };
 
-// Զ - ڴ洢͵Ϸ
+// 自定义数据容器 - 用于存储任意类型的游戏数据
 USTRUCT(BlueprintType)
 struct FCustomSaveData
 {
@@ -544,7 +622,7 @@ public:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SaveGame|Custom")
     TMap<FString, FTransform> TransformData;
 
-    // ݷ - Ƴ UFUNCTION
+    // 便捷方法 - 移除了 UFUNCTION
     void SetString(const FString& Key, const FString& Value)
     {
         StringData.Add(Key, Value);
@@ -637,7 +715,7 @@ public:
         TransformData.Empty();
     }
 
-    // л֧
+    // 序列化支持
     bool Serialize(FArchive& Ar)
     {
         Ar << StringData;
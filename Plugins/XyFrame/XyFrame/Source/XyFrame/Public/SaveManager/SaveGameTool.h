@@ -8,10 +8,15 @@
 #include "Kismet/GameplayStatics.h"
 #include "GameFramework/SaveGame.h"
 #include "Engine/Engine.h"
+#include "GenericPlatform/GenericPlatformFile.h"
+#include "Async/Future.h"
 #include "SaveGameDataTypes.h"
 #include "SaveGameTool.generated.h"
 
-// 浵
+class FSaveBundleReader;
+enum class ESaveSectionType : uint8;
+
+// 存档槽类型
 UENUM(BlueprintType)
 enum class ESaveSlotType : uint8
 {
@@ -22,7 +27,7 @@ enum class ESaveSlotType : uint8
     System       UMETA(DisplayName = "System Data")
 };
 
-// 浵״̬
+// 存档数据状态
 UENUM(BlueprintType)
 enum class ESaveDataState : uint8
 {
@@ -33,7 +38,16 @@ enum class ESaveDataState : uint8
     Saving       UMETA(DisplayName = "Saving")
 };
 
-// 浵Ԫ
+// 存档压缩方式
+UENUM(BlueprintType)
+enum class ESaveCompressionCodec : uint8
+{
+    None         UMETA(DisplayName = "None"),
+    Zlib         UMETA(DisplayName = "Zlib"),
+    Oodle        UMETA(DisplayName = "Oodle")
+};
+
+// 存档元数据
 USTRUCT(BlueprintType)
 struct FSaveGameMetadata
 {
@@ -69,17 +83,101 @@ struct FSaveGameMetadata
     UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "SaveGame")
     FString ThumbnailPath;
 
+    // 压缩信息（由存档容器头填写，不随元数据本身序列化）
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "SaveGame|Compression")
+    ESaveCompressionCodec CompressionCodec;
+
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "SaveGame|Compression")
+    int64 UncompressedSize;
+
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "SaveGame|Compression")
+    int64 CompressedSize;
+
+    // 压缩后大小 / 原始大小，1表示未压缩
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "SaveGame|Compression")
+    float CompressionRatio;
+
     FSaveGameMetadata()
         : PlayTimeSeconds(0.0f)
         , SlotType(ESaveSlotType::ManualSave)
         , SaveVersion(1)
         , PlayerLevel(1)
+        , CompressionCodec(ESaveCompressionCodec::None)
+        , UncompressedSize(0)
+        , CompressedSize(0)
+        , CompressionRatio(1.0f)
     {
         SaveDateTime = FDateTime::Now();
     }
+
+    // 序列化支持（元数据索引使用）
+    bool Serialize(FArchive& Ar)
+    {
+        uint8 SlotTypeValue = static_cast<uint8>(SlotType);
+        Ar << SaveSlotName;
+        Ar << SaveDateTime;
+        Ar << PlayTimeSeconds;
+        Ar << LevelName;
+        Ar << SlotTypeValue;
+        Ar << SaveVersion;
+        Ar << GameVersion;
+        Ar << PlayerName;
+        Ar << PlayerLevel;
+        Ar << ThumbnailPath;
+        SlotType = static_cast<ESaveSlotType>(SlotTypeValue);
+        return true;
+    }
+
+    // 压缩信息序列化（元数据索引使用）
+    void SerializeCompressionInfo(FArchive& Ar)
+    {
+        uint8 CodecValue = static_cast<uint8>(CompressionCodec);
+        Ar << CodecValue;
+        Ar << UncompressedSize;
+        Ar << CompressedSize;
+        Ar << CompressionRatio;
+        CompressionCodec = static_cast<ESaveCompressionCodec>(CodecValue);
+    }
 };
 
-// 浵
+// 批量操作中单个存档槽的信息
+USTRUCT(BlueprintType)
+struct FSaveSlotBulkInfo
+{
+    GENERATED_BODY()
+
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "SaveGame")
+    FString SlotName;
+
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "SaveGame")
+    int64 FileSize;
+
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "SaveGame")
+    FDateTime ModificationTime;
+
+    // 未请求校验时恒为true
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "SaveGame")
+    bool bValid;
+
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "SaveGame")
+    FSaveGameMetadata Metadata;
+
+    FSaveSlotBulkInfo()
+        : FileSize(0)
+        , bValid(true)
+    {
+    }
+};
+
+// 元数据索引条目，记录写入时的文件大小和修改时间用于判断是否过期
+struct FSaveSlotIndexEntry
+{
+    FSaveGameMetadata Metadata;
+    int64 FileSize = 0;
+    FDateTime FileTimestamp;
+};
+
+// 基础存档类
 UCLASS(Blueprintable, BlueprintType)
 class USaveGameBase : public USaveGame
 {
@@ -102,7 +200,7 @@ public:
     TMap<FString, bool> CustomBoolData;
 };
 
-// Ҵ浵
+// 玩家存档类
 UCLASS(Blueprintable)
 class UPlayerSaveGame : public USaveGameBase
 {
@@ -112,7 +210,7 @@ public:
     UPROPERTY(VisibleAnywhere, BlueprintReadWrite, Category = "Player")
     FPlayerSaveData PlayerData;
 
-    // ݷ
+    // 便捷方法
     UFUNCTION(BlueprintCallable, Category = "Player")
     void SetPlayerData(const FPlayerSaveData& NewData) { PlayerData = NewData; }
 
@@ -120,7 +218,7 @@ public:
     FPlayerSaveData GetPlayerData() const { return PlayerData; }
 };
 
-// 浵
+// 世界存档类
 UCLASS(Blueprintable)
 class UWorldSaveGame : public USaveGameBase
 {
@@ -137,7 +235,7 @@ public:
     FWorldSaveData GetWorldData() const { return WorldData; }
 };
 
-// ô浵
+// 设置存档类
 UCLASS(Blueprintable)
 class USettingsSaveGame : public USaveGameBase
 {
@@ -154,7 +252,7 @@ public:
     FSettingsData GetSettingsData() const { return SettingsData; }
 };
 
-// ȴ浵
+// 进度存档类
 UCLASS(Blueprintable)
 class UProgressSaveGame : public USaveGameBase
 {
@@ -171,20 +269,82 @@ public:
     FProgressData GetProgressData() const { return ProgressData; }
 };
 
-// 浵ί
+// 存档对象类型（写入容器头，加载时还原对应的存档类）
+enum class ESaveGameKind : uint8
+{
+    Base,
+    Player,
+    World,
+    Settings,
+    Progress
+};
+
+// 存档写入结果：Skipped表示同一槽已写入更新的快照，本次写入被丢弃；Busy表示不等待时该槽正在写盘
+enum class ESaveWriteResult : uint8
+{
+    Written,
+    Skipped,
+    Failed,
+    Busy
+};
+
+// 存档写盘的共享状态：后台任务持有引用，工具对象销毁后仍然有效
+struct FSaveWriteState
+{
+    // 全局锁只保护下面两张表，写盘持有各槽自己的锁，不同槽可以并行写入
+    FCriticalSection Lock;
+    TMap<FString, uint64> WrittenGenerations;
+    TMap<FString, TSharedPtr<FCriticalSection, ESPMode::ThreadSafe>> SlotLocks;
+};
+
+// 存档快照：游戏线程只拷贝数据，序列化和写盘在工作线程完成
+struct FSaveGameSnapshot
+{
+    FString SlotName;
+    int32 UserIndex = 0;
+    ESaveGameKind Kind = ESaveGameKind::Base;
+    ESaveCompressionCodec Codec = ESaveCompressionCodec::None;
+    FSaveGameMetadata Metadata;
+
+    TMap<FString, FString> CustomStringData;
+    TMap<FString, float> CustomFloatData;
+    TMap<FString, int32> CustomIntData;
+    TMap<FString, bool> CustomBoolData;
+
+    FPlayerSaveData PlayerData;
+    FWorldSaveData WorldData;
+    FSettingsData SettingsData;
+    FProgressData ProgressData;
+};
+
+// 存档容器头
+struct FSaveContainerHeader
+{
+    int32 Version = 0;
+    uint8 Kind = 0;
+    uint8 Codec = 0;
+    int64 UncompressedSize = 0;
+    uint32 PayloadCrc = 0;
+    // 校验和之前的头部字节数，版本5起头部一并参与校验
+    int64 HeaderSize = 0;
+    int64 PayloadOffset = 0;
+    int64 PayloadSize = 0;
+};
+
+// 存档完成委托
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnSaveGameComplete, const FString&, SlotName, bool, bSuccess);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FOnLoadGameComplete, const FString&, SlotName, USaveGameBase*, SaveGame, bool, bSuccess);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnDeleteSaveComplete, const FString&, SlotName, bool, bSuccess);
 
-// ͼصί
+// 蓝图回调委托
 DECLARE_DYNAMIC_DELEGATE_TwoParams(FOnSaveGameCallback, const FString&, SlotName, bool, bSuccess);
 DECLARE_DYNAMIC_DELEGATE_ThreeParams(FOnLoadGameCallback, const FString&, SlotName, USaveGameBase*, SaveGame, bool, bSuccess);
 
-// ̬ί - C++ص
+// 静态委托 - 用于C++回调
 DECLARE_DELEGATE_TwoParams(FOnSaveGameStaticDelegate, const FString&, bool);
 DECLARE_DELEGATE_ThreeParams(FOnLoadGameStaticDelegate, const FString&, USaveGameBase*, bool);
 
-// ؽṹ
+// 加载结果结构体
 USTRUCT(BlueprintType)
 struct FLoadResult
 {
@@ -205,67 +365,67 @@ class XYFRAME_API USaveGameTool : public USingletonBase
 {
     GENERATED_BODY()
 
-    // 
+    // 单例声明
     DECLARE_SINGLETON(USaveGameTool)
 
 public:
-    // 캯
+    // 构造函数和析构函数
     USaveGameTool();
     virtual ~USaveGameTool() override;
 
-    // ʼ浵
+    // 初始化存档管理器
     UFUNCTION(BlueprintCallable, Category = "SaveGame")
     void InitializeSaveTool();
 
-    // ʼ
+    // 单例初始化方法
     virtual void InitializeSingleton() override;
     virtual void DestroyCurSingleton() override { DestroyInstance(); }
 
-    // ȡĿɷʷ
+    // 获取单例的可访问方法
     UFUNCTION(BlueprintCallable, BlueprintPure, Category = "SaveGame", meta = (DisplayName = "Get Save Game Tool"))
     static USaveGameTool* GetSaveGameTool() { return GetInstance(); }
 
-    // ========== 浵 ==========
+    // ========== 基础存档操作 ==========
 
-    // ͬϷ
+    // 同步保存游戏
     UFUNCTION(BlueprintCallable, Category = "SaveGame|Sync")
     bool SaveGameSync(const FString& SlotName, USaveGameBase* SaveGameObject, int32 UserIndex = 0);
 
-    // ͬϷ
+    // 同步加载游戏
     UFUNCTION(BlueprintCallable, Category = "SaveGame|Sync")
     USaveGameBase* LoadGameSync(const FString& SlotName, int32 UserIndex = 0);
 
-    // ͬɾ浵
+    // 同步删除存档
     UFUNCTION(BlueprintCallable, Category = "SaveGame|Sync")
     bool DeleteGameSync(const FString& SlotName, int32 UserIndex = 0);
 
-    // ========== 첽浵 ==========
+    // ========== 异步存档操作 ==========
 
-    // 첽Ϸ
+    // 异步保存游戏
     UFUNCTION(BlueprintCallable, Category = "SaveGame|Async")
     void SaveGameAsync(const FString& SlotName, USaveGameBase* SaveGameObject, int32 UserIndex = 0);
 
-    // 첽Ϸ
+    // 异步加载游戏
     UFUNCTION(BlueprintCallable, Category = "SaveGame|Async")
     void LoadGameAsync(const FString& SlotName, int32 UserIndex = 0);
 
-    // 첽ɾ浵
+    // 异步删除存档
     UFUNCTION(BlueprintCallable, Category = "SaveGame|Async")
     void DeleteGameAsync(const FString& SlotName, int32 UserIndex = 0);
 
-    // ========== ص첽 ==========
+    // ========== 带回调的异步操作 ==========
 
-    // 첽Ϸͼص
+    // 异步保存游戏（蓝图回调）
     UFUNCTION(BlueprintCallable, Category = "SaveGame|Async")
     void SaveGameAsyncWithCallback(const FString& SlotName, USaveGameBase* SaveGameObject, const FOnSaveGameCallback& Callback, int32 UserIndex = 0);
 
-    // 첽Ϸͼص
+    // 异步加载游戏（蓝图回调）
     UFUNCTION(BlueprintCallable, Category = "SaveGame|Async")
     void LoadGameAsyncWithCallback(const FString& SlotName, const FOnLoadGameCallback& Callback, int32 UserIndex = 0);
 
-    // ========== C++̬ίлص ==========
+    // ========== C++静态委托回调方法 ==========
 
-    // 첽ϷC++̬ίУ
+    // 异步保存游戏（C++静态委托）
     template<typename T>
     void SaveGameAsyncWithCallback(const FString& SlotName, USaveGameBase* SaveGameObject, T* Object, void(T::* Function)(const FString&, bool), int32 UserIndex = 0)
     {
@@ -274,7 +434,7 @@ public:
         InternalSaveGameAsyncWithStaticCallback(SlotName, SaveGameObject, StaticDelegate, UserIndex);
     }
 
-    // 첽Ϸ޲C++̬ίУ
+    // 异步保存游戏（无参数C++静态委托）
     template<typename T>
     void SaveGameAsyncWithCallback(const FString& SlotName, USaveGameBase* SaveGameObject, T* Object, void(T::* Function)(), int32 UserIndex = 0)
     {
@@ -287,7 +447,7 @@ public:
         InternalSaveGameAsyncWithStaticCallback(SlotName, SaveGameObject, StaticDelegate, UserIndex);
     }
 
-    // 첽ϷC++̬ίУ
+    // 异步加载游戏（C++静态委托）
     template<typename T>
     void LoadGameAsyncWithCallback(const FString& SlotName, T* Object, void(T::* Function)(const FString&, USaveGameBase*, bool), int32 UserIndex = 0)
     {
@@ -296,7 +456,7 @@ public:
         InternalLoadGameAsyncWithStaticCallback(SlotName, StaticDelegate, UserIndex);
     }
 
-    // 첽Ϸ޲C++̬ίУ
+    // 异步加载游戏（无参数C++静态委托）
     template<typename T>
     void LoadGameAsyncWithCallback(const FString& SlotName, T* Object, void(T::* Function)(), int32 UserIndex = 0)
     {
@@ -309,23 +469,23 @@ public:
         InternalLoadGameAsyncWithStaticCallback(SlotName, StaticDelegate, UserIndex);
     }
 
-    // ========== ٴ浵 ==========
+    // ========== 快速存档功能 ==========
 
-    // ٱ
+    // 快速保存
     UFUNCTION(BlueprintCallable, Category = "SaveGame|Quick")
     void QuickSave();
 
-    // ټ
+    // 快速加载
     UFUNCTION(BlueprintCallable, Category = "SaveGame|Quick")
     bool QuickLoad();
 
-    // Զ
+    // 自动保存
     UFUNCTION(BlueprintCallable, Category = "SaveGame|Auto")
     void AutoSave();
 
-    // ========== ݴͻȡ ==========
+    // ========== 数据创建和获取 ==========
 
-    // յĴ浵
+    // 创建空的存档对象
     UFUNCTION(BlueprintCallable, Category = "SaveGame|Data")
     UPlayerSaveGame* CreatePlayerSaveGame();
 
@@ -338,7 +498,7 @@ public:
     UFUNCTION(BlueprintCallable, Category = "SaveGame|Data")
     UProgressSaveGame* CreateProgressSaveGame();
 
-    // ӽṹ崴浵
+    // 从结构体创建存档对象
     UFUNCTION(BlueprintCallable, Category = "SaveGame|Data")
     UPlayerSaveGame* CreatePlayerSaveGameFromData(const FPlayerSaveData& PlayerData);
 
@@ -351,7 +511,7 @@ public:
     UFUNCTION(BlueprintCallable, Category = "SaveGame|Data")
     UProgressSaveGame* CreateProgressSaveGameFromData(const FProgressData& ProgressData);
 
-    // Ӵ浵ȡṹ
+    // 从存档对象获取结构体数据
     UFUNCTION(BlueprintCallable, Category = "SaveGame|Data")
     FPlayerSaveData GetPlayerDataFromSaveGame(UPlayerSaveGame* SaveGame) const;
 
@@ -364,27 +524,27 @@ public:
     UFUNCTION(BlueprintCallable, Category = "SaveGame|Data")
     FProgressData GetProgressDataFromSaveGame(UProgressSaveGame* SaveGame) const;
 
-    // ========== ȫļطboolʾɹ ==========
+    // ========== 安全的加载方法（返回bool表示成功） ==========
 
-    // ȫݵṹ
+    // 安全加载玩家数据到结构体
     UFUNCTION(BlueprintCallable, Category = "SaveGame|Convenience")
     bool LoadPlayerDataStruct(FPlayerSaveData& OutData, const FString& SlotName = TEXT("PlayerData"));
 
-    // ȫݵṹ
+    // 安全加载世界数据到结构体
     UFUNCTION(BlueprintCallable, Category = "SaveGame|Convenience")
     bool LoadWorldDataStruct(FWorldSaveData& OutData, const FString& SlotName = TEXT("WorldData"));
 
-    // ȫݵṹ
+    // 安全加载设置数据到结构体
     UFUNCTION(BlueprintCallable, Category = "SaveGame|Convenience")
     bool LoadSettingsDataStruct(FSettingsData& OutData, const FString& SlotName = TEXT("GameSettings"));
 
-    // ȫؽݵṹ
+    // 安全加载进度数据到结构体
     UFUNCTION(BlueprintCallable, Category = "SaveGame|Convenience")
     bool LoadProgressDataStruct(FProgressData& OutData, const FString& SlotName = TEXT("ProgressData"));
 
-    // ========== ֱӽṹ屣 ==========
+    // ========== 直接结构体保存 ==========
 
-    // ֱʹýṹ屣
+    // 直接使用结构体保存数据
     UFUNCTION(BlueprintCallable, Category = "SaveGame|Convenience")
     bool SavePlayerDataStruct(const FPlayerSaveData& PlayerData, const FString& SlotName = TEXT("PlayerData"));
 
@@ -397,87 +557,192 @@ public:
     UFUNCTION(BlueprintCallable, Category = "SaveGame|Convenience")
     bool SaveProgressDataStruct(const FProgressData& ProgressData, const FString& SlotName = TEXT("ProgressData"));
 
-    // ========== ݱ淽 ==========
+    // ========== 便捷保存方法 ==========
 
-    // ݣPawnݣ
+    // 保存玩家数据（从Pawn创建数据）
     UFUNCTION(BlueprintCallable, Category = "SaveGame|Convenience")
     bool SavePlayerData(APawn* PlayerPawn, const FString& SlotName = TEXT("PlayerData"));
 
-    // ݵPawn
+    // 加载玩家数据到Pawn
     UFUNCTION(BlueprintCallable, Category = "SaveGame|Convenience")
     bool LoadPlayerData(APawn* PlayerPawn, const FString& SlotName = TEXT("PlayerData"));
 
-    // Pawn
+    // 从Pawn创建玩家数据
     UFUNCTION(BlueprintCallable, Category = "SaveGame|Convenience")
     bool CreatePlayerDataFromPawn(APawn* PlayerPawn, FPlayerSaveData& OutData);
 
-    // ========== ǰݹ ==========
+    // ========== 当前数据管理 ==========
 
-    // ȡǰãûػ򴴽Ĭã
+    // 获取当前设置（如果没有则加载或创建默认设置）
     UFUNCTION(BlueprintCallable, Category = "SaveGame|Data")
     USettingsSaveGame* GetCurrentSettings();
 
-    // õǰ
+    // 设置当前设置
     UFUNCTION(BlueprintCallable, Category = "SaveGame|Data")
     void SetCurrentSettings(USettingsSaveGame* NewSettings);
 
-    // ȡǰ
+    // 获取当前设置数据
     UFUNCTION(BlueprintCallable, Category = "SaveGame|Data")
     FSettingsData GetCurrentSettingsData() const;
 
-    // õǰ
+    // 设置当前设置数据
     UFUNCTION(BlueprintCallable, Category = "SaveGame|Data")
     void SetCurrentSettingsData(const FSettingsData& NewData);
 
-    // 浱ǰ
+    // 保存当前设置
     UFUNCTION(BlueprintCallable, Category = "SaveGame|Convenience")
     bool SaveCurrentSettings(const FString& SlotName = TEXT("GameSettings"));
 
-    // 
+    // 加载设置
     UFUNCTION(BlueprintCallable, Category = "SaveGame|Convenience")
     bool LoadSettings(const FString& SlotName = TEXT("GameSettings"));
 
-    // ========== 浵 ==========
+    // ========== 存档管理 ==========
 
-    // 浵Ƿ
+    // 检查存档是否存在
     UFUNCTION(BlueprintCallable, Category = "SaveGame|Management")
     bool DoesSaveGameExist(const FString& SlotName, int32 UserIndex = 0);
 
-    // ȡд浵
+    // 获取所有存档槽
     UFUNCTION(BlueprintCallable, Category = "SaveGame|Management")
     TArray<FString> GetAllSaveSlots() const;
 
-    // ȡ浵Ԫݣ浵
+    // 获取存档元数据（不加载完整存档）
     UFUNCTION(BlueprintCallable, Category = "SaveGame|Management")
     FSaveGameMetadata GetSaveMetadata(const FString& SlotName, int32 UserIndex = 0);
 
-    // ȡ浵Сֽڣ
+    // 获取所有存档的元数据（只读取元数据索引）
+    UFUNCTION(BlueprintCallable, Category = "SaveGame|Management")
+    TArray<FSaveGameMetadata> GetAllSaveMetadata();
+
+    // 重建元数据索引（会完整加载所有存档，仅用于修复）
+    UFUNCTION(BlueprintCallable, Category = "SaveGame|Management")
+    void RebuildSaveMetadataIndex();
+
+    // 获取存档大小（字节）
     UFUNCTION(BlueprintCallable, Category = "SaveGame|Management")
     int64 GetSaveGameSize(const FString& SlotName, int32 UserIndex = 0) const;
 
-    // ȡܴ浵С
+    // 获取总存档大小
     UFUNCTION(BlueprintCallable, Category = "SaveGame|Management")
     int64 GetTotalSaveSize() const;
 
-    // ɴ浵
+    // 清理旧存档
     UFUNCTION(BlueprintCallable, Category = "SaveGame|Management")
     void CleanupOldSaves(int32 MaxSaveCount = 10);
 
-    // ========== Թ ==========
+    // ========== 批量操作 ==========
+
+    // 一次目录遍历拿到所有存档的文件信息，并行完成校验和元数据读取
+    UFUNCTION(BlueprintCallable, Category = "SaveGame|Bulk")
+    TArray<FSaveSlotBulkInfo> GetAllSaveSlotInfo(bool bValidate = true);
+
+    // 并行导出所有有效存档（含世界增量日志与存档包）到指定目录，返回导出数量
+    UFUNCTION(BlueprintCallable, Category = "SaveGame|Bulk")
+    int32 ExportAllSaves(const FString& TargetDir);
+
+    // 并行导入目录中通过校验的存档与存档包，返回导入数量
+    UFUNCTION(BlueprintCallable, Category = "SaveGame|Bulk")
+    int32 ImportSaves(const FString& SourceDir, bool bOverwrite = false);
+
+    // ========== 存档压缩 ==========
+
+    // 设置之后写入存档使用的压缩方式（已有存档按各自的格式读取）
+    UFUNCTION(BlueprintCallable, Category = "SaveGame|Compression")
+    void SetSaveCompression(ESaveCompressionCodec Codec);
+
+    UFUNCTION(BlueprintCallable, BlueprintPure, Category = "SaveGame|Compression")
+    ESaveCompressionCodec GetSaveCompression() const { return SaveCompressionCodec; }
+
+    // ========== 增量世界存档 ==========
+
+    // 只把自上次保存以来变化的键追加到日志；基础存档不匹配、数据整体变脏或日志过大时写完整存档
+    UFUNCTION(BlueprintCallable, Category = "SaveGame|Incremental")
+    bool SaveWorldDataIncremental(UPARAM(ref) FWorldSaveData& WorldData, const FString& SlotName = TEXT("WorldData"));
+
+    // 立即写完整世界存档并重置日志
+    UFUNCTION(BlueprintCallable, Category = "SaveGame|Incremental")
+    bool CompactWorldSave(UPARAM(ref) FWorldSaveData& WorldData, const FString& SlotName = TEXT("WorldData"));
+
+    // 蓝图直接修改世界数据的Map后调用，标记变化（或被删除）的键
+    UFUNCTION(BlueprintCallable, Category = "SaveGame|Incremental")
+    void MarkWorldDataDirty(UPARAM(ref) FWorldSaveData& WorldData, EWorldSaveField Field, const FString& Key);
+
+    // 日志大小超过基础存档大小的该比例时自动压缩
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SaveGame|Incremental", meta = (ClampMin = "0.05"))
+    float WorldJournalCompactionRatio = 0.5f;
+
+    // ========== 分段存档包 ==========
 
-    // ӡд浵
+    // 把玩家、设置、进度和按关卡划分的世界数据写入同一个分段存档包，各分段独立编码
+    UFUNCTION(BlueprintCallable, Category = "SaveGame|Bundle")
+    bool SaveGameBundle(const FString& SlotName, const FPlayerSaveData& PlayerData, const FSettingsData& SettingsData,
+        const FProgressData& ProgressData, const TMap<FString, FWorldSaveData>& LevelWorldData);
+
+    // 打开存档包（内存映射，只解析分段表），之后各分段在读取时才解码
+    UFUNCTION(BlueprintCallable, Category = "SaveGame|Bundle")
+    bool OpenGameBundle(const FString& SlotName);
+
+    UFUNCTION(BlueprintCallable, Category = "SaveGame|Bundle")
+    void CloseGameBundle(const FString& SlotName);
+
+    UFUNCTION(BlueprintCallable, Category = "SaveGame|Bundle")
+    bool DeleteGameBundle(const FString& SlotName);
+
+    UFUNCTION(BlueprintCallable, Category = "SaveGame|Bundle")
+    bool DoesGameBundleExist(const FString& SlotName) const;
+
+    // 以下读取方法在存档包未打开时会自动打开
+    UFUNCTION(BlueprintCallable, Category = "SaveGame|Bundle")
+    bool LoadBundleMetadata(const FString& SlotName, FSaveGameMetadata& OutMetadata);
+
+    UFUNCTION(BlueprintCallable, Category = "SaveGame|Bundle")
+    bool LoadBundlePlayerData(const FString& SlotName, FPlayerSaveData& OutData);
+
+    UFUNCTION(BlueprintCallable, Category = "SaveGame|Bundle")
+    bool LoadBundleSettingsData(const FString& SlotName, FSettingsData& OutData);
+
+    UFUNCTION(BlueprintCallable, Category = "SaveGame|Bundle")
+    bool LoadBundleProgressData(const FString& SlotName, FProgressData& OutData);
+
+    // 只解码指定关卡的世界分段（关卡流送时按需调用）
+    UFUNCTION(BlueprintCallable, Category = "SaveGame|Bundle")
+    bool LoadBundleLevelWorldData(const FString& SlotName, const FString& LevelName, FWorldSaveData& OutData);
+
+    UFUNCTION(BlueprintCallable, Category = "SaveGame|Bundle")
+    TArray<FString> GetBundleLevelNames(const FString& SlotName);
+
+    // ========== 调试工具 ==========
+
+    // 打印所有存档
     UFUNCTION(BlueprintCallable, Category = "SaveGame|Debug")
     void PrintAllSaves();
 
-    // ֤浵
+    // 验证存档完整性（容器格式只检查文件头和校验和）
     UFUNCTION(BlueprintCallable, Category = "SaveGame|Debug")
     bool ValidateSaveGame(const FString& SlotName, int32 UserIndex = 0);
 
-    // ӡ浵ͳϢ
+    // 打印存档统计信息
     UFUNCTION(BlueprintCallable, Category = "SaveGame|Debug")
     void PrintSaveStatistics();
 
-    // ========== ¼ί ==========
+    // 对比完整加载与元数据索引读取存档列表的耗时
+    UFUNCTION(BlueprintCallable, Category = "SaveGame|Debug")
+    void BenchmarkSaveMetadataListing(int32 SlotCount = 100, int32 ActorsPerSlot = 10000);
+
+    // 对比各压缩方式在1k/10k/100k个Actor世界存档下的保存、加载耗时和文件大小
+    UFUNCTION(BlueprintCallable, Category = "SaveGame|Debug")
+    void BenchmarkSaveCompression();
+
+    // 对比旧的字符串键Map格式与紧凑格式（字符串表 + 结构数组）的世界数据大小和读写耗时
+    UFUNCTION(BlueprintCallable, Category = "SaveGame|Debug")
+    void BenchmarkWorldSaveSchema(int32 ActorCount = 10000, int32 Iterations = 5);
+
+    // 对比“继续游戏”时整体解码与存档包按需解码（玩家 + 当前关卡）的耗时
+    UFUNCTION(BlueprintCallable, Category = "SaveGame|Debug")
+    void BenchmarkBundleContinue(int32 LevelCount = 20, int32 ActorsPerLevel = 5000);
+
+    // ========== 事件委托 ==========
 
     UPROPERTY(BlueprintAssignable, Category = "SaveGame|Events")
     FOnSaveGameComplete OnSaveGameComplete;
@@ -489,38 +754,100 @@ public:
     FOnDeleteSaveComplete OnDeleteSaveComplete;
 
 private:
-    // ǰ
+    // 当前设置
     UPROPERTY()
     USettingsSaveGame* CurrentSettings;
 
-    // ǰݻ
+    // 当前设置数据缓存
     FSettingsData CurrentSettingsData;
 
-    // صӳ
+    // 回调映射
     TMap<FString, FOnSaveGameCallback> SaveCallbacks;
     TMap<FString, FOnLoadGameCallback> LoadCallbacks;
 
-    // ̬ίӳ
+    // 静态委托映射
     TMap<FString, FOnSaveGameStaticDelegate> SaveStaticCallbacks;
     TMap<FString, FOnLoadGameStaticDelegate> LoadStaticCallbacks;
 
-    // ڲʵַ
+    // 元数据索引（槽名 -> 元数据），首次使用时从磁盘加载
+    TMap<FString, FSaveSlotIndexEntry> MetadataIndex;
+    bool bMetadataIndexLoaded = false;
+
+    // 后台保存：每个槽的快照序号，写盘时丢弃比已写入版本更旧的快照
+    TMap<FString, uint64> SaveGenerations;
+    TSharedPtr<FSaveWriteState, ESPMode::ThreadSafe> SaveWriteState = MakeShared<FSaveWriteState, ESPMode::ThreadSafe>();
+    TArray<TFuture<void>> PendingSaveTasks;
+
+    // 写入存档使用的压缩方式
+    ESaveCompressionCodec SaveCompressionCodec = ESaveCompressionCodec::None;
+
+    // 已打开的存档包（槽名 -> 读取器）
+    TMap<FString, TSharedPtr<FSaveBundleReader>> OpenBundles;
+
+    // 内部实现方法
     FString GenerateBackupName(const FString& SlotName) const;
     bool InternalSaveGame(const FString& SlotName, USaveGameBase* SaveGameObject, int32 UserIndex);
     USaveGameBase* InternalLoadGame(const FString& SlotName, int32 UserIndex);
-    void UpdateSaveMetadata(USaveGameBase* SaveGame, const FString& SlotName, ESaveSlotType SlotType);
 
-    // ̬ίڲ
+    // 存档快照与容器格式
+    bool MakeSaveSnapshot(USaveGameBase* SaveGameObject, const FString& SlotName, int32 UserIndex, FSaveGameSnapshot& OutSnapshot) const;
+    USaveGameBase* CreateSaveGameFromSnapshot(const FSaveGameSnapshot& Snapshot);
+    static ESaveWriteResult WriteSaveData(FSaveWriteState& WriteState, const FString& SlotName, int32 UserIndex, const TArray<uint8>& SaveData, uint64 Generation, bool bDiscardBackup = false, bool bWait = true);
+    void QueueSaveWrite(const FString& SlotName, int32 UserIndex, TArray<uint8>&& SaveData, uint64 Generation, const FSaveGameMetadata& Metadata);
+    static bool WriteSaveFileAtomic(const FString& SlotName, int32 UserIndex, const TArray<uint8>& SaveData);
+    static bool WriteFileAtomic(const FString& FilePath, const TArray<uint8>& Data, const FString& BackupPath = FString());
+    static bool ReadSaveSlotData(const FString& SlotName, int32 UserIndex, TArray<uint8>& OutSaveData);
+    static FString GetSaveSlotPath(const FString& SlotName);
+    static FString GetSaveBackupPath(const FString& SlotName);
+    static FFileStatData GetSaveSlotStat(const FString& SlotName);
+    void WaitForPendingSaves();
+    static bool SerializeSnapshotBody(FArchive& Ar, FSaveGameSnapshot& Snapshot, int32 Version);
+    static void EncodeSaveSnapshot(FSaveGameSnapshot& Snapshot, TArray<uint8>& OutSaveData);
+    static bool DecodeSaveSnapshot(const TArray<uint8>& SaveData, FSaveGameSnapshot& OutSnapshot);
+    static bool IsSaveContainer(const TArray<uint8>& SaveData);
+    static bool ReadSaveContainerHeader(const TArray<uint8>& SaveData, FSaveContainerHeader& OutHeader);
+    static bool VerifySaveContainer(const TArray<uint8>& SaveData);
+    static bool VerifySaveContainerCrc(const TArray<uint8>& SaveData, const FSaveContainerHeader& Header);
+    static bool ExtractSaveContainerBody(const TArray<uint8>& SaveData, const FSaveContainerHeader& Header, TArray<uint8>& Scratch, TArrayView<const uint8>& OutBody);
+    static bool DecodeSaveMetadata(const TArray<uint8>& SaveData, FSaveGameMetadata& OutMetadata);
+    static TMap<FString, FFileStatData> EnumerateSaveFiles(const FString& Directory, TMap<FString, FFileStatData>* OutBundleStats = nullptr);
+    static FName GetCompressionFormatName(ESaveCompressionCodec Codec);
+    void UpdateSaveMetadata(USaveGameBase* SaveGame, const FString& SlotName, ESaveSlotType SlotType);
+    void FillSaveMetadata(FSaveGameMetadata& Metadata, const FString& SlotName, ESaveSlotType SlotType) const;
+
+    // 分段存档包
+    static FString GetBundlePath(const FString& SlotName);
+    FSaveBundleReader* FindOrOpenBundle(const FString& SlotName);
+    static bool ReadBundleSection(const FSaveBundleReader* Bundle, ESaveSectionType Type, const FString& Name, TFunctionRef<bool(FArchive&)> Decode);
+    static bool DecodeBundleMetadata(const FSaveBundleReader* Bundle, FSaveGameMetadata& OutMetadata);
+    static bool VerifyBundle(const FSaveBundleReader* Bundle);
+
+    // 元数据索引
+    static FString GetSaveGameDir();
+    FString GetMetadataIndexPath() const;
+    void LoadMetadataIndex();
+    bool SaveMetadataIndex();
+    void UpdateMetadataIndex(const FString& SlotName, const FSaveGameMetadata& Metadata, bool bWriteToDisk = true);
+    void RemoveFromMetadataIndex(const FString& SlotName);
+    bool GetIndexedMetadata(const FString& SlotName, const FFileStatData& StatData, FSaveGameMetadata& OutMetadata);
+
+    // 增量世界存档日志
+    static FString GetWorldJournalPath(const FString& SlotName);
+    static int64 GetWorldJournalSize(const FString& SlotName, int64 BaseTicks);
+    static bool ResetWorldJournal(const FString& SlotName, int64 BaseTicks);
+    static int32 ApplyWorldJournal(const FString& SlotName, int64 BaseTicks, FWorldSaveData& WorldData);
+
+    // 静态委托内部方法
     void InternalSaveGameAsyncWithStaticCallback(const FString& SlotName, USaveGameBase* SaveGameObject, const FOnSaveGameStaticDelegate& Callback, int32 UserIndex);
     void InternalLoadGameAsyncWithStaticCallback(const FString& SlotName, const FOnLoadGameStaticDelegate& Callback, int32 UserIndex);
 
-    // 첽ɴ
+    // 异步操作完成处理
     UFUNCTION()
     void HandleAsyncSaveComplete(const FString& SlotName, const int32 UserIndex, bool bSuccess);
 
     UFUNCTION()
     void HandleAsyncLoadComplete(const FString& SlotName, const int32 UserIndex, USaveGame* SaveGame);
 
-    // ȡ
+    // 获取世界
     UWorld* GetWorld() const override;
 };
\ No newline at end of file
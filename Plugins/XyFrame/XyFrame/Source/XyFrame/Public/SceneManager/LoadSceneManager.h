@@ -8,7 +8,10 @@
 #include "Engine/World.h"
 #include "LoadSceneManager.generated.h"
 
-// ģʽ
+struct FAssetData;
+class USceneWarmupManifest;
+
+// 场景加载模式
 UENUM(BlueprintType)
 enum class ESceneLoadMode : uint8
 {
@@ -16,7 +19,7 @@ enum class ESceneLoadMode : uint8
     Additive UMETA(DisplayName = "Additive")
 };
 
-// ״̬
+// 场景加载状态
 UENUM(BlueprintType)
 enum class ESceneLoadState : uint8
 {
@@ -26,7 +29,7 @@ enum class ESceneLoadState : uint8
     Failed UMETA(DisplayName = "Failed")
 };
 
-// Ϣ
+// 场景信息
 USTRUCT(BlueprintType)
 struct FSceneInfo
 {
@@ -51,7 +54,7 @@ struct FSceneInfo
     }
 };
 
-// 첽 - Ϊͻ
+// 异步加载请求 - 重命名为避免冲突
 USTRUCT(BlueprintType)
 struct FSceneAsyncLoadRequest
 {
@@ -69,7 +72,7 @@ struct FSceneAsyncLoadRequest
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Scene")
     float Progress;
 
-    // ֶڹLatentActionInfo
+    // 新增字段用于关联LatentActionInfo
     int32 LatentActionUUID;
 
     FSceneAsyncLoadRequest()
@@ -80,7 +83,7 @@ struct FSceneAsyncLoadRequest
     }
 };
 
-// ͹ؿϢ
+// 流送关卡信息
 USTRUCT(BlueprintType)
 struct FStreamingLevelInfo
 {
@@ -109,7 +112,7 @@ struct FStreamingLevelInfo
     }
 };
 
-// ͼļϢ
+// 地图文件信息
 USTRUCT(BlueprintType)
 struct FMapFileInfo
 {
@@ -133,12 +136,243 @@ struct FMapFileInfo
     }
 };
 
-// ί
+// 距离驱动的流送关卡配置
+USTRUCT(BlueprintType)
+struct FProximityStreamingLevelConfig
+{
+    GENERATED_BODY()
+
+    // 流送关卡名称（与 LoadStreamingLevel 使用的名称一致）
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Scene|Streaming")
+    FString LevelName;
+
+    // 关卡包围盒（世界空间）
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Scene|Streaming")
+    FBox Bounds;
+
+    // 进入此距离开始加载
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Scene|Streaming")
+    float LoadRadius;
+
+    // 超出此距离才卸载（应大于 LoadRadius，形成滞后区间）
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Scene|Streaming")
+    float UnloadRadius;
+
+    // 进入此距离设为可见（应不大于 LoadRadius）
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Scene|Streaming")
+    float VisibleRadius;
+
+    // 超出此距离隐藏（应大于 VisibleRadius，形成滞后区间）
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Scene|Streaming")
+    float HideRadius;
+
+    FProximityStreamingLevelConfig()
+        : Bounds(ForceInit)
+        , LoadRadius(5000.0f)
+        , UnloadRadius(6000.0f)
+        , VisibleRadius(4000.0f)
+        , HideRadius(4500.0f)
+    {
+    }
+};
+
+// 流送调度器设置
+USTRUCT(BlueprintType)
+struct FStreamingSchedulerSettings
+{
+    GENERATED_BODY()
+
+    // 调度更新间隔（秒）
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Scene|Streaming")
+    float UpdateInterval;
+
+    // 每次更新最多发起的加载/卸载/显隐操作数
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Scene|Streaming")
+    int32 MaxOperationsPerUpdate;
+
+    // 同时进行中的加载数上限
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Scene|Streaming")
+    int32 MaxConcurrentLoads;
+
+    FStreamingSchedulerSettings()
+        : UpdateInterval(0.1f)
+        , MaxOperationsPerUpdate(2)
+        , MaxConcurrentLoads(2)
+    {
+    }
+};
+
+// 分阶段显示的阶段
+// RegisterComponents 阶段由引擎 AddToWorld 分帧注册组件并调用 BeginPlay；
+// GameplayBegin 阶段不再调用 BeginPlay，只分帧开启被推迟的Actor Tick
+UENUM(BlueprintType)
+enum class ELevelVisibilityStage : uint8
+{
+    None UMETA(DisplayName = "None"),
+    Loading UMETA(DisplayName = "Loading"),
+    RegisterComponents UMETA(DisplayName = "Register Components"),
+    Collision UMETA(DisplayName = "Collision"),
+    GameplayBegin UMETA(DisplayName = "Gameplay Begin"),
+    Completed UMETA(DisplayName = "Completed")
+};
+
+// 关卡加入世界的时间预算
+// AddToWorld 相关的两项通过全局流送控制台变量生效，作用于整个世界而不是单个关卡：
+// 多个关卡同时处于注册阶段时取其中最严格的值，全部离开注册阶段后恢复原值
+USTRUCT(BlueprintType)
+struct FLevelVisibilityBudget
+{
+    GENERATED_BODY()
+
+    // 引擎 AddToWorld 每帧时间上限（毫秒，全局），对应 s.LevelStreamingActorsUpdateTimeLimit，组件注册与BeginPlay都受此限制
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Scene|Streaming")
+    float AddToWorldTimeLimitMs;
+
+    // 每批注册的组件数量（全局），对应 s.LevelStreamingComponentsRegistrationGranularity
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Scene|Streaming")
+    int32 ComponentRegistrationGranularity;
+
+    // 恢复碰撞/开启Tick阶段每帧时间上限（毫秒），按关卡各自生效
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Scene|Streaming")
+    float StageTimeLimitMs;
+
+    // 注册组件时先关闭Actor碰撞，之后分帧恢复
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Scene|Streaming")
+    bool bDeferCollision;
+
+    // BeginPlay 后不立即开始Tick，在 GameplayBegin 阶段分帧开启
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Scene|Streaming")
+    bool bDeferActorTick;
+
+    FLevelVisibilityBudget()
+        : AddToWorldTimeLimitMs(3.0f)
+        , ComponentRegistrationGranularity(10)
+        , StageTimeLimitMs(2.0f)
+        , bDeferCollision(true)
+        , bDeferActorTick(true)
+    {
+    }
+};
+
+// 单个阶段的耗时统计
+USTRUCT(BlueprintType)
+struct FLevelVisibilityStageTiming
+{
+    GENERATED_BODY()
+
+    // 阶段开始到结束的总时长（毫秒）
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Scene|Streaming")
+    float WallTimeMs;
+
+    // 本管理器在此阶段实际消耗的时间（毫秒），注册阶段由引擎执行不计入
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Scene|Streaming")
+    float WorkTimeMs;
+
+    // 单帧最大耗时（毫秒）
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Scene|Streaming")
+    float MaxSliceMs;
+
+    // 阶段跨越的帧数
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Scene|Streaming")
+    int32 Frames;
+
+    FLevelVisibilityStageTiming()
+        : WallTimeMs(0.0f)
+        , WorkTimeMs(0.0f)
+        , MaxSliceMs(0.0f)
+        , Frames(0)
+    {
+    }
+};
+
+// 分阶段显示统计
+USTRUCT(BlueprintType)
+struct FLevelVisibilityStats
+{
+    GENERATED_BODY()
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Scene|Streaming")
+    FString LevelName;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Scene|Streaming")
+    ELevelVisibilityStage Stage;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Scene|Streaming")
+    int32 ActorCount;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Scene|Streaming")
+    FLevelVisibilityStageTiming RegisterComponents;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Scene|Streaming")
+    FLevelVisibilityStageTiming Collision;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Scene|Streaming")
+    FLevelVisibilityStageTiming GameplayBegin;
+
+    FLevelVisibilityStats()
+        : Stage(ELevelVisibilityStage::None)
+        , ActorCount(0)
+    {
+    }
+};
+
+// 分阶段显示的运行时状态
+struct FStagedVisibilityState
+{
+    FLevelVisibilityBudget Budget;
+    FLevelVisibilityStats Stats;
+    TWeakObjectPtr<ULevelStreaming> StreamingLevel;
+    TArray<TWeakObjectPtr<AActor>> DeferredCollisionActors;
+    TArray<TWeakObjectPtr<AActor>> DeferredTickActors;
+    int32 NextActorIndex = 0;
+    double StageStartTime = 0.0;
+};
+
+// 距离流送关卡的运行时状态
+struct FProximityStreamingLevelState
+{
+    FProximityStreamingLevelConfig Config;
+    TWeakObjectPtr<ULevelStreaming> StreamingLevel;
+    float LastDistance = MAX_flt;
+    bool bWantsLoaded = false;
+    bool bWantsVisible = false;
+};
+
+// 场景预热的运行时状态
+struct FSceneWarmupState
+{
+    FString SceneName;
+    FString RequestId;
+    TWeakObjectPtr<USceneWarmupManifest> Manifest;
+    ESceneLoadMode Mode = ESceneLoadMode::Single;
+    bool bActivateAfterLoad = true;
+    // 单场景切换时对象池与UI依赖新世界，等待切换完成后再执行
+    bool bWaitingForTravel = false;
+    bool bWorldBoundStarted = false;
+    int32 ResourceCursor = 0;
+    int32 FolderCursor = 0;
+    int32 SoundCursor = 0;
+    int32 PoolCursor = 0;
+    int32 PoolSpawned = 0;
+    int32 UICursor = 0;
+    TArray<FString> PendingResourceRequests;
+    TArray<FName> PendingSounds;
+    int32 CompletedSteps = 0;
+    int32 TotalSteps = 0;
+    double StartTime = 0.0;
+};
+
+// 委托声明
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnSceneLoadProgress, const FString&, RequestId, float, Progress);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnSceneLoadComplete, const FString&, RequestId);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnSceneUnloadComplete, const FString&, RequestId);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnLevelVisibilityStaged, const FString&, LevelName);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnSceneWarmupComplete, const FString&, SceneName);
+
+// 异步请求结束（成功、失败或取消），C++可绑定Lambda
+DECLARE_MULTICAST_DELEGATE_TwoParams(FOnSceneRequestFinishedNative, const FString& /*RequestId*/, bool /*bSuccess*/);
 
-// 򻯵Ļصί
+// 简化的回调委托
 DECLARE_DYNAMIC_DELEGATE_OneParam(FOnSceneLoadedCallback, const FString&, SceneName);
 DECLARE_DYNAMIC_DELEGATE_OneParam(FOnSceneUnloadedCallback, const FString&, SceneName);
 
@@ -147,267 +381,374 @@ class XYFRAME_API ULoadSceneManager : public USingletonBase
 {
     GENERATED_BODY()
 
-    // 
+    // 单例声明
     DECLARE_SINGLETON(ULoadSceneManager)
 
 public:
-    // ʼ
+    // 初始化场景管理器
     UFUNCTION(BlueprintCallable, Category = "Scene")
     void InitializeSceneManager();
 
-    // дʼ
+    // 重写单例初始化方法
     virtual void InitializeSingleton() override;
     virtual void DestroyCurSingleton() override { DestroyInstance(); }
 
-    // ȡʵͼɵ÷
+    // 获取管理器实例的蓝图可调用方法
     UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Scene", meta = (DisplayName = "Get Scene Manager"))
     static ULoadSceneManager* GetSceneManager() { return GetInstance(); }
 
-    // 캯
+    // 构造函数
     ULoadSceneManager();
     virtual ~ULoadSceneManager() override;
 
-    // ========== ͬ ==========
+    // ========== 同步场景加载 ==========
 
-    // ͨͬس
+    // 通过索引同步加载场景
     UFUNCTION(BlueprintCallable, Category = "Scene|Sync")
     void LoadSceneByIndex(int32 SceneIndex, ESceneLoadMode Mode = ESceneLoadMode::Single);
 
-    // ͨͬس
+    // 通过名称同步加载场景
     UFUNCTION(BlueprintCallable, Category = "Scene|Sync")
     void LoadSceneByName(const FString& SceneName, ESceneLoadMode Mode = ESceneLoadMode::Single);
 
-    // ͨļ·ͬس
+    // 通过文件路径同步加载场景
     UFUNCTION(BlueprintCallable, Category = "Scene|Sync")
     void LoadSceneByPath(const FString& MapPath, ESceneLoadMode Mode = ESceneLoadMode::Single);
 
-    // ͨ TSoftObjectPtr ͬس
+    // 通过 TSoftObjectPtr 同步加载场景
     UFUNCTION(BlueprintCallable, Category = "Scene|Sync")
     void LoadSceneByAsset(const TSoftObjectPtr<UWorld>& MapAsset, ESceneLoadMode Mode = ESceneLoadMode::Single);
 
-    // ͨʲ·ͬس
+    // 通过完整资产路径同步加载场景
     UFUNCTION(BlueprintCallable, Category = "Scene|Sync")
     void LoadSceneByFullPath(const FString& FullMapPath, ESceneLoadMode Mode = ESceneLoadMode::Single);
 
-    // ¼صǰ
+    // 重新加载当前活动场景
     UFUNCTION(BlueprintCallable, Category = "Scene|Sync")
     void ReloadCurrentScene();
 
-    // һ
+    // 加载下一个场景
     UFUNCTION(BlueprintCallable, Category = "Scene|Sync")
     void LoadNextScene(bool bCyclical = false);
 
-    // һ
+    // 加载上一个场景
     UFUNCTION(BlueprintCallable, Category = "Scene|Sync")
     void LoadPreviousScene(bool bCyclical = false);
 
-    // ========== 첽 ==========
+    // ========== 异步场景加载 ==========
 
-    // ͨ첽س
+    // 通过索引异步加载场景
     UFUNCTION(BlueprintCallable, Category = "Scene|Async")
     FString LoadSceneAsyncByIndex(int32 SceneIndex, ESceneLoadMode Mode = ESceneLoadMode::Single, bool bActivateAfterLoad = true);
 
-    // ͨ첽س
+    // 通过名称异步加载场景
     UFUNCTION(BlueprintCallable, Category = "Scene|Async")
     FString LoadSceneAsyncByName(const FString& SceneName, ESceneLoadMode Mode = ESceneLoadMode::Single, bool bActivateAfterLoad = true);
 
-    // ͨļ·첽س
+    // 通过文件路径异步加载场景
     UFUNCTION(BlueprintCallable, Category = "Scene|Async")
     FString LoadSceneAsyncByPath(const FString& MapPath, ESceneLoadMode Mode = ESceneLoadMode::Single, bool bActivateAfterLoad = true);
 
-    // ͨ TSoftObjectPtr 첽س
+    // 通过 TSoftObjectPtr 异步加载场景
     UFUNCTION(BlueprintCallable, Category = "Scene|Async")
     FString LoadSceneAsyncByAsset(const TSoftObjectPtr<UWorld>& MapAsset, ESceneLoadMode Mode = ESceneLoadMode::Single, bool bActivateAfterLoad = true);
 
-    // ͨʲ·첽س
+    // 通过完整资产路径异步加载场景
     UFUNCTION(BlueprintCallable, Category = "Scene|Async")
     FString LoadSceneAsyncByFullPath(const FString& FullMapPath, ESceneLoadMode Mode = ESceneLoadMode::Single, bool bActivateAfterLoad = true);
 
-    // 첽¼صǰ
+    // 异步重新加载当前场景
     UFUNCTION(BlueprintCallable, Category = "Scene|Async")
     FString ReloadCurrentSceneAsync(bool bActivateAfterLoad = true);
 
-    // 첽һ
+    // 异步加载下一个场景
     UFUNCTION(BlueprintCallable, Category = "Scene|Async")
     FString LoadNextSceneAsync(bool bCyclical = false, bool bActivateAfterLoad = true);
 
-    // 첽һ
+    // 异步加载上一个场景
     UFUNCTION(BlueprintCallable, Category = "Scene|Async")
     FString LoadPreviousSceneAsync(bool bCyclical = false, bool bActivateAfterLoad = true);
 
-    // ========== 첽أص ==========
+    // ========== 异步场景加载（带回调） ==========
 
-// 첽سɻص
+// 异步加载场景带完成回调
     UFUNCTION(BlueprintCallable, Category = "Scene|Async")
     void LoadSceneAsyncWithCallback(int32 SceneIndex, ESceneLoadMode Mode, bool bActivateAfterLoad, const FOnSceneLoadedCallback& OnComplete);
 
-    // 첽س·ɻص
+    // 异步加载场景带路径和完成回调
     UFUNCTION(BlueprintCallable, Category = "Scene|Async")
     void LoadSceneAsyncByPathWithCallback(const FString& MapPath, ESceneLoadMode Mode, bool bActivateAfterLoad, const FOnSceneLoadedCallback& OnComplete);
 
-    // ͨ TSoftObjectPtr 첽سص
+    // 通过 TSoftObjectPtr 异步加载场景带回调
     UFUNCTION(BlueprintCallable, Category = "Scene|Async")
     void LoadSceneAsyncByAssetWithCallback(const TSoftObjectPtr<UWorld>& MapAsset, ESceneLoadMode Mode, bool bActivateAfterLoad, const FOnSceneLoadedCallback& OnComplete);
 
-    // ========== ж ==========
+    // ========== 场景卸载 ==========
 
-    // жسͨƣ
+    // 卸载场景（通过名称）
     UFUNCTION(BlueprintCallable, Category = "Scene|Unload")
     FString UnloadSceneAsync(const FString& SceneName);
 
-    // жиӳ
+    // 卸载所有附加场景
     UFUNCTION(BlueprintCallable, Category = "Scene|Unload")
     void UnloadAllAdditiveScenes();
 
-    // ========== ͼ͹ ==========
+    // ========== 地图流送管理 ==========
 
-    // ͹ؿ
+    // 加载流送关卡
     UFUNCTION(BlueprintCallable, Category = "Scene|Streaming")
     void LoadStreamingLevel(const FString& LevelName, bool bMakeVisibleAfterLoad = true, bool bShouldBlockOnLoad = false);
 
-    // ͨ·͹ؿ
+    // 通过路径加载流送关卡
     UFUNCTION(BlueprintCallable, Category = "Scene|Streaming")
     void LoadStreamingLevelByPath(const FString& LevelPath, bool bMakeVisibleAfterLoad = true, bool bShouldBlockOnLoad = false);
 
-    // ͨ TSoftObjectPtr ͹ؿ
+    // 通过 TSoftObjectPtr 加载流送关卡
     UFUNCTION(BlueprintCallable, Category = "Scene|Streaming")
     void LoadStreamingLevelByAsset(const TSoftObjectPtr<UWorld>& MapAsset, bool bMakeVisibleAfterLoad = true, bool bShouldBlockOnLoad = false);
 
-    // ж͹ؿ
+    // 卸载流送关卡
     UFUNCTION(BlueprintCallable, Category = "Scene|Streaming")
     void UnloadStreamingLevel(const FString& LevelName);
 
-    // ͹ؿɼ
+    // 设置流送关卡可见性
     UFUNCTION(BlueprintCallable, Category = "Scene|Streaming")
     void SetStreamingLevelVisible(const FString& LevelName, bool bVisible);
 
-    // ȡ͹ؿϢ
+    // 获取所有流送关卡信息
     UFUNCTION(BlueprintCallable, Category = "Scene|Streaming")
     TArray<FStreamingLevelInfo> GetAllStreamingLevelsInfo() const;
 
-    // ͹ؿǷѼ
+    // 检查流送关卡是否已加载
     UFUNCTION(BlueprintCallable, Category = "Scene|Streaming")
     bool IsStreamingLevelLoaded(const FString& LevelName) const;
 
-    // ͹ؿ
+    // 批量加载流送关卡
     UFUNCTION(BlueprintCallable, Category = "Scene|Streaming")
     void LoadStreamingLevels(const TArray<FString>& LevelNames, bool bMakeVisibleAfterLoad = true);
 
-    // ж͹ؿ
+    // 批量卸载流送关卡
     UFUNCTION(BlueprintCallable, Category = "Scene|Streaming")
     void UnloadStreamingLevels(const TArray<FString>& LevelNames);
 
-    // ========== ͼļ ==========
+    // ========== 距离流送调度 ==========
+
+    // 注册由距离驱动的流送关卡
+    UFUNCTION(BlueprintCallable, Category = "Scene|Streaming")
+    bool RegisterProximityStreamingLevel(const FProximityStreamingLevelConfig& Config);
+
+    // 注销距离流送关卡（不改变其当前加载状态）
+    UFUNCTION(BlueprintCallable, Category = "Scene|Streaming")
+    void UnregisterProximityStreamingLevel(const FString& LevelName);
+
+    // 清除所有距离流送关卡
+    UFUNCTION(BlueprintCallable, Category = "Scene|Streaming")
+    void ClearProximityStreamingLevels();
+
+    // 启动流送调度器
+    UFUNCTION(BlueprintCallable, Category = "Scene|Streaming")
+    void StartStreamingScheduler(const FStreamingSchedulerSettings& Settings);
+
+    // 停止流送调度器
+    UFUNCTION(BlueprintCallable, Category = "Scene|Streaming")
+    void StopStreamingScheduler();
+
+    // 调度器是否运行中
+    UFUNCTION(BlueprintCallable, Category = "Scene|Streaming")
+    bool IsStreamingSchedulerRunning() const { return bStreamingSchedulerRunning; }
+
+    // 立即执行一次调度
+    UFUNCTION(BlueprintCallable, Category = "Scene|Streaming")
+    void UpdateStreamingScheduler();
+
+    // ========== 分阶段显示 ==========
+
+    // 设置关卡加入世界的时间预算，设置后该关卡的显示走分阶段流程
+    UFUNCTION(BlueprintCallable, Category = "Scene|Streaming")
+    void SetLevelVisibilityBudget(const FString& LevelName, const FLevelVisibilityBudget& Budget);
+
+    // 移除关卡的时间预算
+    UFUNCTION(BlueprintCallable, Category = "Scene|Streaming")
+    void ClearLevelVisibilityBudget(const FString& LevelName);
+
+    // 关卡是否设置了时间预算
+    UFUNCTION(BlueprintCallable, Category = "Scene|Streaming")
+    bool HasLevelVisibilityBudget(const FString& LevelName) const;
+
+    // 分阶段加载并显示流送关卡：注册组件与BeginPlay（引擎分帧） -> 恢复碰撞 -> 开启Tick
+    UFUNCTION(BlueprintCallable, Category = "Scene|Streaming")
+    bool MakeStreamingLevelVisibleStaged(const FString& LevelName);
+
+    // 获取关卡当前所处阶段
+    UFUNCTION(BlueprintCallable, Category = "Scene|Streaming")
+    ELevelVisibilityStage GetLevelVisibilityStage(const FString& LevelName) const;
+
+    // 获取分阶段显示统计
+    UFUNCTION(BlueprintCallable, Category = "Scene|Streaming")
+    bool GetLevelVisibilityStats(const FString& LevelName, FLevelVisibilityStats& OutStats) const;
+
+    // ========== 场景预热 ==========
+
+    // 注册场景预热清单，异步加载该场景时在激活前分帧执行
+    UFUNCTION(BlueprintCallable, Category = "Scene|Warmup")
+    void RegisterSceneWarmupManifest(const FString& SceneName, USceneWarmupManifest* Manifest);
+
+    // 移除场景预热清单
+    UFUNCTION(BlueprintCallable, Category = "Scene|Warmup")
+    void UnregisterSceneWarmupManifest(const FString& SceneName);
 
-    // ȡпõĵͼļ
+    // 场景是否注册了预热清单
+    UFUNCTION(BlueprintCallable, Category = "Scene|Warmup")
+    bool HasSceneWarmupManifest(const FString& SceneName) const;
+
+    // 手动对当前世界执行场景预热（不加载关卡）
+    UFUNCTION(BlueprintCallable, Category = "Scene|Warmup")
+    bool WarmupScene(const FString& SceneName);
+
+    // 场景是否正在预热
+    UFUNCTION(BlueprintCallable, Category = "Scene|Warmup")
+    bool IsSceneWarmupInProgress(const FString& SceneName) const;
+
+    // 获取场景预热进度（0-1）
+    UFUNCTION(BlueprintCallable, Category = "Scene|Warmup")
+    float GetSceneWarmupProgress(const FString& SceneName) const;
+
+    // ========== 地图文件管理 ==========
+
+    // 获取所有可用的地图文件
     UFUNCTION(BlueprintCallable, Category = "Scene|Maps")
     TArray<FMapFileInfo> GetAllAvailableMaps() const;
 
-    // ָļвҵͼļ
+    // 在指定文件夹中查找地图文件
     UFUNCTION(BlueprintCallable, Category = "Scene|Maps")
     TArray<FMapFileInfo> FindMapsInFolder(const FString& FolderPath) const;
 
-    // ͼļǷ
+    // 检查地图文件是否存在
     UFUNCTION(BlueprintCallable, Category = "Scene|Maps")
     bool DoesMapFileExist(const FString& MapPath) const;
 
-    // ȡͼʾ
+    // 获取地图显示名称
     UFUNCTION(BlueprintCallable, Category = "Scene|Maps")
     FString GetMapDisplayName(const FString& MapPath) const;
 
-    // ========== Ϣѯ ==========
+    // 强制重新扫描地图目录并写入磁盘缓存
+    UFUNCTION(BlueprintCallable, Category = "Scene|Maps")
+    void RebuildMapCatalog();
+
+    // ========== 场景信息查询 ==========
 
-    // ȡǰ
+    // 获取当前活动场景名称
     UFUNCTION(BlueprintCallable, Category = "Scene|Query")
     FString GetCurrentSceneName() const;
 
-    // ȡǰ·
+    // 获取当前场景路径
     UFUNCTION(BlueprintCallable, Category = "Scene|Query")
     FString GetCurrentScenePath() const;
 
-    // ȡǰ
+    // 获取当前场景索引
     UFUNCTION(BlueprintCallable, Category = "Scene|Query")
     int32 GetCurrentSceneIndex() const;
 
-    // ȡ
+    // 获取场景总数
     UFUNCTION(BlueprintCallable, Category = "Scene|Query")
     int32 GetSceneCount() const;
 
-    // ȡϢ
+    // 获取场景信息
     UFUNCTION(BlueprintCallable, Category = "Scene|Query")
     FSceneInfo GetSceneInfo(int32 SceneIndex) const;
 
-    // 鳡ǷЧ
+    // 检查场景索引是否有效
     UFUNCTION(BlueprintCallable, Category = "Scene|Query")
     bool IsSceneIndexValid(int32 SceneIndex) const;
 
-    // 鳡Ƿ
+    // 检查场景名称是否存在
     UFUNCTION(BlueprintCallable, Category = "Scene|Query")
     bool DoesSceneExist(const FString& SceneName) const;
 
-    // ȡѼصĳ
+    // 获取所有已加载的场景
     UFUNCTION(BlueprintCallable, Category = "Scene|Query")
     TArray<FString> GetAllLoadedScenes() const;
 
-    // ȡеĸActor
+    // 获取场景中的根Actor
     UFUNCTION(BlueprintCallable, Category = "Scene|Query")
     TArray<AActor*> GetRootActorsInScene(const FString& SceneName) const;
 
-    // ȡѼسĸActor
+    // 获取所有已加载场景的根Actor
     UFUNCTION(BlueprintCallable, Category = "Scene|Query")
     TArray<AActor*> GetRootActorsInAllLoadedScenes() const;
 
-    // ========== 첽 ==========
+    // 将场景根Actor追加到调用方数组（复用其容量，不产生额外分配），返回追加数量
+    int32 AppendRootActorsInScene(const FString& SceneName, TArray<AActor*>& OutActors) const;
+
+    // 将所有已加载场景的根Actor追加到调用方数组，返回追加数量
+    int32 AppendRootActorsInAllLoadedScenes(TArray<AActor*>& OutActors) const;
+
+    // 遍历场景根Actor，不产生任何分配
+    void ForEachRootActorInScene(const FString& SceneName, TFunctionRef<void(AActor*)> Visitor) const;
 
-    // ȡ첽״̬
+    // ========== 异步请求管理 ==========
+
+    // 获取异步请求状态
     UFUNCTION(BlueprintCallable, Category = "Scene|Async")
     ESceneLoadState GetAsyncRequestState(const FString& RequestId) const;
 
-    // ȡ첽
+    // 获取异步请求进度
     UFUNCTION(BlueprintCallable, Category = "Scene|Async")
     float GetAsyncRequestProgress(const FString& RequestId) const;
 
-    // ȡ첽
+    // 取消异步请求
     UFUNCTION(BlueprintCallable, Category = "Scene|Async")
     void CancelAsyncRequest(const FString& RequestId);
 
-    // ========== Թ ==========
+    // ========== 调试工具 ==========
 
-    // ӡгϢ
+    // 打印所有场景信息
     UFUNCTION(BlueprintCallable, Category = "Scene|Debug")
     void PrintAllScenesInfo();
 
-    // ӡ͹ؿϢ
+    // 打印所有流送关卡信息
     UFUNCTION(BlueprintCallable, Category = "Scene|Debug")
     void PrintAllStreamingLevelsInfo();
 
-    // ӡ첽Ϣ
+    // 打印所有异步请求信息
     UFUNCTION(BlueprintCallable, Category = "Scene|Debug")
     void PrintAllAsyncRequests();
 
-    // ӡпõͼ
+    // 打印所有可用地图
     UFUNCTION(BlueprintCallable, Category = "Scene|Debug")
     void PrintAllAvailableMaps();
 
-    // ========== ͼʲ ==========
+    // 打印流送调度器状态
+    UFUNCTION(BlueprintCallable, Category = "Scene|Debug")
+    void PrintStreamingSchedulerInfo();
 
-// ȡпõĵͼʲ
+    // 打印分阶段显示统计
+    UFUNCTION(BlueprintCallable, Category = "Scene|Debug")
+    void PrintLevelVisibilityStats();
+
+    // 打印场景预热信息
+    UFUNCTION(BlueprintCallable, Category = "Scene|Debug")
+    void PrintSceneWarmupInfo();
+
+    // ========== 地图资产管理 ==========
+
+// 获取所有可用的地图资产
     UFUNCTION(BlueprintCallable, Category = "Scene|Maps")
     TArray<TSoftObjectPtr<UWorld>> GetAllAvailableMapAssets() const;
 
-    // ָļвҵͼʲ
+    // 在指定文件夹中查找地图资产
     UFUNCTION(BlueprintCallable, Category = "Scene|Maps")
     TArray<TSoftObjectPtr<UWorld>> FindMapAssetsInFolder(const FString& FolderPath) const;
 
-    // ͼʲǷЧ
+    // 检查地图资产是否有效
     UFUNCTION(BlueprintCallable, Category = "Scene|Maps")
     bool IsMapAssetValid(const TSoftObjectPtr<UWorld>& MapAsset) const;
 
-    // ȡͼʲʾ
+    // 获取地图资产的显示名称
     UFUNCTION(BlueprintCallable, Category = "Scene|Maps")
     FString GetMapAssetDisplayName(const TSoftObjectPtr<UWorld>& MapAsset) const;
 
-    // ========== ί ==========
+    // ========== 委托 ==========
 
     UPROPERTY(BlueprintAssignable, Category = "Scene|Events")
     FOnSceneLoadProgress OnSceneLoadProgress;
@@ -418,18 +759,26 @@ public:
     UPROPERTY(BlueprintAssignable, Category = "Scene|Events")
     FOnSceneUnloadComplete OnSceneUnloadComplete;
 
+    UPROPERTY(BlueprintAssignable, Category = "Scene|Events")
+    FOnLevelVisibilityStaged OnLevelVisibilityStaged;
+
+    UPROPERTY(BlueprintAssignable, Category = "Scene|Events")
+    FOnSceneWarmupComplete OnSceneWarmupComplete;
+
+    FOnSceneRequestFinishedNative OnSceneRequestFinishedNative;
+
 private:
-    // 첽ӳ - ʹĽṹ
+    // 异步加载请求映射 - 使用重命名的结构体
     TMap<FString, FSceneAsyncLoadRequest> AsyncRequests;
 
-    // Ϣ
+    // 场景信息缓存
     TMap<FString, FSceneInfo> SceneInfoCache;
 
-    // صӳ
+    // 回调映射
     TMap<FString, FOnSceneLoadedCallback> LoadCallbacks;
     TMap<FString, FOnSceneUnloadedCallback> UnloadCallbacks;
 
-    // ڲ
+    // 内部方法
     FString GenerateRequestId() const;
     bool IsValidSceneIndex(int32 SceneIndex) const;
     FString GetSceneNameFromIndex(int32 SceneIndex) const;
@@ -437,16 +786,16 @@ private:
     void UpdateAsyncRequestProgress(const FString& RequestId, float Progress);
     void CompleteAsyncRequest(const FString& RequestId, bool bSuccess);
 
-    // ·
+    // 路径处理
     FString SanitizeMapPath(const FString& MapPath) const;
     FString ExtractMapNameFromPath(const FString& MapPath) const;
     bool IsMapPath(const FString& Path) const;
 
-    // ͹ؿ
+    // 流送关卡管理
     ULevelStreaming* GetStreamingLevelByName(const FString& LevelName) const;
     ULevelStreaming* GetStreamingLevelByPath(const FString& LevelPath) const;
 
-    // Ļص
+    // 完整的回调函数声明
     UFUNCTION()
     void OnAsyncLoadComplete();
 
@@ -459,23 +808,101 @@ private:
     UFUNCTION()
     void OnStreamingLevelUnloaded();
 
-    // ͼļɨ
+    // 地图文件扫描
     void ScanForMapFiles();
     TArray<FMapFileInfo> AvailableMaps;
 
-    // ʱڽȸ
+    // 地图目录索引（名称/路径/文件夹 -> AvailableMaps 下标）
+    TMap<FString, int32> MapIndexByName;
+    TMap<FString, int32> MapIndexByPath;
+    TMap<FString, TArray<int32>> MapIndicesByFolder;
+
+    void RebuildMapIndices();
+    void IndexMapEntry(int32 MapIndex);
+    const FMapFileInfo* FindMapByPath(const FString& MapPath) const;
+    const FMapFileInfo* FindMapByName(const FString& MapName) const;
+    void CollectMapsInFolder(const FString& FolderPath, TArray<int32>& OutIndices) const;
+    FMapFileInfo MakeMapFileInfo(const FAssetData& AssetData) const;
+
+    // 资产注册表增量更新
+    void BindAssetRegistryEvents();
+    void UnbindAssetRegistryEvents();
+    void OnMapAssetAdded(const FAssetData& AssetData);
+    void OnMapAssetRemoved(const FAssetData& AssetData);
+    void OnMapAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath);
+    void OnAssetRegistryFilesLoaded();
+    bool IsWorldAsset(const FAssetData& AssetData) const;
+    FDelegateHandle AssetAddedHandle;
+    FDelegateHandle AssetRemovedHandle;
+    FDelegateHandle AssetRenamedHandle;
+    FDelegateHandle FilesLoadedHandle;
+
+    // 地图目录磁盘缓存
+    FString GetMapCatalogFilePath() const;
+    FString GetMapCatalogStamp() const;
+    bool LoadMapCatalogFromDisk();
+    bool SaveMapCatalogToDisk();
+
+    // 计时器用于进度更新
     void StartProgressTimer(const FString& RequestId);
     void StopProgressTimer(const FString& RequestId);
     void UpdateProgress(const FString& RequestId);
 
-    // ͨUUIDID
+    // 辅助方法：通过UUID查找请求ID
     FString FindRequestIdByUUID(int32 UUID) const;
 
     FString ExtractMapNameFromFullPath(const FString& FullPath) const;
 
-    // ʱ
+    // 计时器句柄
     TMap<FString, FTimerHandle> ProgressTimerHandles;
 
-    // ȡWorldĸ
+    // 距离流送调度
+    TMap<FString, FProximityStreamingLevelState> ProximityLevels;
+    FStreamingSchedulerSettings SchedulerSettings;
+    FTimerHandle StreamingSchedulerHandle;
+    bool bStreamingSchedulerRunning = false;
+
+    bool GetStreamingViewLocation(FVector& OutLocation) const;
+    void ApplyProximityLevelState(FProximityStreamingLevelState& State);
+    int32 GetInFlightLoadCount() const;
+
+    // 根Actor查询：只遍历目标关卡自身的Actor数组，按当前附加状态过滤
+    ULevel* GetSceneLevel(const FString& SceneName) const;
+    static void ForEachRootActorInLevel(ULevel* Level, TFunctionRef<void(AActor*)> Visitor);
+
+    // 分阶段显示
+    TMap<FString, FLevelVisibilityBudget> VisibilityBudgets;
+    TMap<FString, FStagedVisibilityState> StagedVisibilityLevels;
+    TMap<FString, FString> SavedStreamingCVars;
+    bool bStagedVisibilityTickScheduled = false;
+
+    UFUNCTION()
+    void UpdateStagedVisibility();
+    void ScheduleStagedVisibilityTick();
+    void PrepareStagedLevelActors(FStagedVisibilityState& State, ULevel* Level);
+    bool RunStagedActorSlice(FStagedVisibilityState& State, TArray<TWeakObjectPtr<AActor>>& Actors, bool bCollisionStage);
+    void EnterVisibilityStage(FStagedVisibilityState& State, ELevelVisibilityStage NewStage);
+    void ApplyAddToWorldBudget();
+    void RestoreStreamingCVars();
+    bool IsStagedVisibilityInProgress(const FString& LevelName) const;
+    void CancelStagedVisibility(const FString& LevelName);
+
+    // 场景预热
+    UPROPERTY()
+    TMap<FString, USceneWarmupManifest*> WarmupManifests;
+
+    TMap<FString, FSceneWarmupState> ActiveWarmups;
+    bool bSceneWarmupTickScheduled = false;
+    FDelegateHandle PostLoadMapHandle;
+
+    bool TryStartSceneWarmup(const FString& RequestId, const FString& SceneName, ESceneLoadMode Mode, bool bActivateAfterLoad);
+    void ScheduleSceneWarmupTick();
+    void UpdateSceneWarmups();
+    bool RunSceneWarmupSlice(FSceneWarmupState& State, double Deadline);
+    bool IsWarmupLevelLoaded(const FSceneWarmupState& State) const;
+    void FinishSceneWarmup(FSceneWarmupState& State);
+    void HandlePostLoadMap(UWorld* LoadedWorld);
+
+    // 获取World的辅助方法
     UWorld* GetWorld() const override;
 };
\ No newline at end of file
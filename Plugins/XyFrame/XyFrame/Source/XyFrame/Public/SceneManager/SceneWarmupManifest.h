@@ -0,0 +1,74 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataAsset.h"
+#include "GameFramework/Actor.h"
+#include "SceneWarmupManifest.generated.h"
+
+// 对象池预热条目
+USTRUCT(BlueprintType)
+struct FPoolWarmupEntry
+{
+    GENERATED_BODY()
+
+    // 池化的Actor类型
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Scene|Warmup")
+    TSubclassOf<AActor> ActorClass;
+
+    // 预生成数量
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Scene|Warmup")
+    int32 Count;
+
+    FPoolWarmupEntry()
+        : Count(0)
+    {
+    }
+};
+
+// 场景预热清单：切换到目标场景前需要提前准备的对象池、UI、音频和资源
+UCLASS(BlueprintType)
+class XYFRAME_API USceneWarmupManifest : public UDataAsset
+{
+    GENERATED_BODY()
+
+public:
+    USceneWarmupManifest();
+
+    // 对象池预生成
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Scene|Warmup")
+    TArray<FPoolWarmupEntry> PoolPreloads;
+
+    // 需要预创建的UI（UIManager中已注册的名称）
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Scene|Warmup")
+    TArray<FName> UINames;
+
+    // 需要预加载的音频（AudioManager数据表中的SoundID）
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Scene|Warmup")
+    TArray<FName> SoundIDs;
+
+    // 需要预加载的资源（ResourceManager数据表中的资源ID）
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Scene|Warmup")
+    TArray<FName> ResourceIDs;
+
+    // 需要整体预加载的资源文件夹
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Scene|Warmup")
+    TArray<FString> ResourceFolders;
+
+    // 每帧预热的时间预算（毫秒）
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Scene|Warmup", meta = (ClampMin = "0.1"))
+    float FrameBudgetMs;
+
+    // 单帧最多生成的池对象数量，避免单帧内连续生成过多Actor
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Scene|Warmup", meta = (ClampMin = "1"))
+    int32 MaxPoolSpawnsPerFrame;
+
+    // 获取预热步骤总数（每个资源、音频、UI、池对象各计一步）
+    UFUNCTION(BlueprintCallable, Category = "Scene|Warmup")
+    int32 GetTotalStepCount() const;
+
+    // 清单是否为空
+    UFUNCTION(BlueprintCallable, Category = "Scene|Warmup")
+    bool IsEmpty() const { return GetTotalStepCount() == 0; }
+};
@@ -4,11 +4,11 @@
 
 #include "CoreMinimal.h"
 #include "UObject/NoExportTypes.h"
-#include "SingletonManager.h"  // ֱӰͷļ
+#include "SingletonManager.h"  // 直接包含头文件
 #include "SingletonBase.generated.h"
 
 /**
- *  - е඼Ӧü̳
+ * 单例基类 - 所有单例类都应该继承这个类
  */
 UCLASS(Abstract)
 class XYFRAME_API USingletonBase : public UObject
@@ -18,39 +18,39 @@ class XYFRAME_API USingletonBase : public UObject
 public:
     virtual ~USingletonBase() {}
 
-    // 麯дԽгʼ
+    // 虚函数，用于子类重写以进行初始化
     virtual void InitializeSingleton() {}
 
-    // 麯дԽ
+    // 虚函数，用于子类重写以进行销毁
     UFUNCTION()
     virtual void DestroyCurSingleton() {}
 };
 
 /**
- * ǿĵģ - Զעᵽ
+ * 增强的单例模板 - 自动注册到管理器
  */
 template <typename T>
 class TSingleton
 {
 public:
-    // ȡʵ
+    // 获取单例实例
     static T* GetInstance()
     {
         if (!SingletonInstance || !IsValid(SingletonInstance))
         {
-            // ʵ
+            // 创建单例实例
             SingletonInstance = NewObject<T>();
             if (SingletonInstance)
             {
-                SingletonInstance->AddToRoot(); // ֹGC
+                SingletonInstance->AddToRoot(); // 防止GC
 
-                // Զעᵽ
+                // 自动注册到单例管理器
                 if (USingletonManager* Manager = USingletonManager::GetInstance())
                 {
                     Manager->RegisterSingleton(SingletonInstance);
                 }
 
-                // óʼ
+                // 调用初始化方法
                 SingletonInstance->InitializeSingleton();
 
                 UE_LOG(LogTemp, Log, TEXT("Singleton created and registered: %s"), *SingletonInstance->GetClass()->GetName());
@@ -59,12 +59,12 @@ public:
         return SingletonInstance;
     }
 
-    // ٵʵ
+    // 销毁单例实例
     static void DestroyInstance()
     {
         if (SingletonInstance && IsValid(SingletonInstance))
         {
-            // ӹע
+            // 从管理器注销
             if (USingletonManager* Manager = USingletonManager::GetInstance())
             {
                 Manager->UnregisterSingleton(SingletonInstance->GetClass());
@@ -78,7 +78,7 @@ public:
         }
     }
 
-    // 鵥Ƿ
+    // 检查单例是否存在
     static bool IsInstanceValid()
     {
         return SingletonInstance != nullptr && IsValid(SingletonInstance);
@@ -91,16 +91,16 @@ private:
     static T* SingletonInstance;
 };
 
-// ̬Ա
+// 静态成员定义
 template <typename T>
 T* TSingleton<T>::SingletonInstance = nullptr;
 
 /**
- *  - ͼɵ÷
+ * 单例声明宏 - 包含蓝图可调用方法
  */
 #define DECLARE_SINGLETON(ClassName) \
 public: \
-    /* C++̬ */ \
+    /* C++静态方法 */ \
     static ClassName* GetInstance() { return TSingleton<ClassName>::GetInstance(); } \
     static void DestroyInstance() { TSingleton<ClassName>::DestroyInstance(); } \
     static bool IsInstanceValid() { return TSingleton<ClassName>::IsInstanceValid(); } 
\ No newline at end of file
@@ -6,11 +6,11 @@
 #include "UObject/NoExportTypes.h"
 #include "SingletonManager.generated.h"
 
-// ǰ
+// 前向声明
 class USingletonBase;
 
 /**
- *  - ̳USingletonBase
+ * 单例管理器 - 不继承USingletonBase
  */
 UCLASS()
 class XYFRAME_API USingletonManager : public UObject
@@ -18,51 +18,51 @@ class XYFRAME_API USingletonManager : public UObject
     GENERATED_BODY()
 
 public:
-    // ȡʵͳģʽ
+    // 获取管理器实例（传统单例模式）
     UFUNCTION(BlueprintCallable, Category = "SingletonManager")
     static USingletonManager* GetInstance();
 
-    // ʼ
+    // 初始化管理器
     UFUNCTION(BlueprintCallable, Category = "SingletonManager")
     static void Initialize();
 
-    // رչ
+    // 关闭管理器
     UFUNCTION(BlueprintCallable, Category = "SingletonManager")
     static void Shutdown();
 
-    // עᵥ
+    // 注册单例
     UFUNCTION(BlueprintCallable, Category = "SingletonManager")
     void RegisterSingleton(UObject* Singleton);
 
-    // ע
+    // 注销单例
     UFUNCTION(BlueprintCallable, Category = "SingletonManager")
     void UnregisterSingleton(UClass* SingletonClass);
 
-    // ȡ
+    // 获取单例
     UFUNCTION(BlueprintCallable, Category = "SingletonManager")
     UObject* GetSingleton(UClass* SingletonClass) const;
 
-    // ָ͵ĵ
+    // 销毁指定类型的单例
     UFUNCTION(BlueprintCallable, Category = "SingletonManager")
     void DestroySingleton(UClass* SingletonClass);
 
-    // е
+    // 销毁所有单例
     UFUNCTION(BlueprintCallable, Category = "SingletonManager")
     void DestroyAllSingletons();
 
-    // ȡ
+    // 获取单例数量
     UFUNCTION(BlueprintCallable, Category = "SingletonManager")
     int32 GetSingletonCount() const;
 
-    // ӡеϢ
+    // 打印所有单例信息
     UFUNCTION(BlueprintCallable, Category = "SingletonManager")
     void PrintAllSingletons() const;
 
 private:
-    // 洢ʵ
+    // 存储单例实例
     UPROPERTY()
     TMap<UClass*, UObject*> SingletonInstances;
 
-    // ʵ
+    // 管理器实例
     static USingletonManager* ManagerInstance;
 };
\ No newline at end of file
@@ -7,7 +7,7 @@
 #include "MonoManager/MonoManager.h"
 #include "StateMachineBase.generated.h"
 
-// ״̬ӵ߽ӿ
+// 状态机拥有者接口
 UINTERFACE(Blueprintable)
 class UStateMachineOwner : public UInterface
 {
@@ -19,7 +19,7 @@ class IStateMachineOwner
     GENERATED_BODY()
 };
 
-// ״̬
+// 状态基类
 UCLASS(Abstract, Blueprintable)
 class XYFRAME_API UStateBase : public UObject
 {
@@ -28,36 +28,36 @@ class XYFRAME_API UStateBase : public UObject
 public:
     virtual ~UStateBase() = default;
 
-    // ʼڲ
+    // 初始化内部数据
     UFUNCTION(BlueprintCallable, Category = "StateMachine")
     virtual void InitializeInternal(class UStateMachineBase* InStateMachine)
     {
         StateMachine = InStateMachine;
     }
 
-    // ʼ״̬ - 򻯰汾ͼǩ
+    // 初始化状态 - 简化版本，避免蓝图复杂签名
     virtual void Initialize(TScriptInterface<IStateMachineOwner> InOwner)
     {
         Owner = InOwner;
     }
 
-    // ״̬
+    // 状态进入
     virtual void Enter() {}
 
-    // ״̬˳  
+    // 状态退出  
     virtual void Exit() {}
 
-    // ״̬
+    // 状态更新
     virtual void Update(float DeltaTime) {}
 
-    // ״̬ӳٸ
+    // 状态延迟更新
     virtual void LateUpdate(float DeltaTime) {}
 
-    // ״̶̬
+    // 状态固定更新
     virtual void FixedUpdate(float DeltaTime) {}
 
 protected:
-    // ת
+    // 条件转换检查
     UFUNCTION(BlueprintCallable, Category = "StateMachine")
     bool CheckTransition(TSubclassOf<UStateBase> NewStateClass, bool bReEnterCurrent = false);
 
@@ -68,7 +68,7 @@ protected:
     TScriptInterface<IStateMachineOwner> Owner;
 };
 
-// ״̬
+// 状态机基类
 UCLASS(Blueprintable, BlueprintType)
 class XYFRAME_API UStateMachineBase : public UObject
 {
@@ -78,36 +78,36 @@ public:
     UStateMachineBase();
     virtual ~UStateMachineBase();
 
-    // ʼ״̬
+    // 初始化状态机
     UFUNCTION(BlueprintCallable, Category = "StateMachine")
     virtual void Initialize(TScriptInterface<IStateMachineOwner> InOwner, bool bInEnableStateSharing = false);
 
-    // ʼ״̬ĳʼ
+    // 带初始状态的初始化
     UFUNCTION(BlueprintCallable, Category = "StateMachine")
     void InitializeWithState(TSubclassOf<UStateBase> InitialState, TScriptInterface<IStateMachineOwner> InOwner, bool bInEnableStateSharing = false);
 
-    // ı״̬
+    // 改变状态
     UFUNCTION(BlueprintCallable, Category = "StateMachine")
     bool ChangeState(TSubclassOf<UStateBase> NewStateClass, bool bReEnterCurrent = false);
 
-    // ȡǰ״̬
+    // 获取当前状态
     UFUNCTION(BlueprintCallable, BlueprintPure, Category = "StateMachine")
     UStateBase* GetCurrentState() const { return CurrentState; }
 
-    // ȡǰ״̬
+    // 获取当前状态类
     UFUNCTION(BlueprintCallable, BlueprintPure, Category = "StateMachine")
     TSubclassOf<UStateBase> GetCurrentStateClass() const { return CurrentStateClass; }
 
-    // ֹͣ״̬
+    // 停止状态机
     UFUNCTION(BlueprintCallable, Category = "StateMachine")
     virtual void Stop();
 
-    // ״̬
+    // 销毁状态机
     UFUNCTION(BlueprintCallable, Category = "StateMachine")
     virtual void Destroy();
 
 
-    // ״̬ݲ
+    // 状态共享数据操作
     UFUNCTION(BlueprintCallable, Category = "StateMachine")
     void SetSharedData(const FString& Key, UObject* Data);
 
@@ -117,11 +117,11 @@ public:
     UFUNCTION(BlueprintCallable, Category = "StateMachine")
     void RemoveSharedData(const FString& Key);
 
-    // Ƿ
+    // 检查是否正在运行
     UFUNCTION(BlueprintCallable, BlueprintPure, Category = "StateMachine")
     bool IsRunning() const { return bIsRunning; }
 
-    // ֶ״̬
+    // 手动更新状态机
     UFUNCTION(BlueprintCallable, Category = "StateMachine")
     void Update(float DeltaTime);
 
@@ -131,11 +131,18 @@ public:
     UFUNCTION(BlueprintCallable, Category = "StateMachine")
     void FixedUpdate(float DeltaTime);
 
-    // дGetWorld
+    // 交由MonoManager按帧阶段驱动三个更新，无需拥有者在Tick中手动调用
+    UFUNCTION(BlueprintCallable, Category = "StateMachine")
+    void RegisterPhaseUpdates(TEnumAsByte<ETickingGroup> TickGroup = TG_MAX);
+
+    UFUNCTION(BlueprintCallable, Category = "StateMachine")
+    void UnregisterPhaseUpdates();
+
+    // 重写GetWorld
     virtual UWorld* GetWorld() const override;
 
 protected:
-    // ڲ״̬
+    // 内部状态创建
     UStateBase* GetOrCreateState(TSubclassOf<UStateBase> StateClass);
 
 private:
@@ -156,9 +163,14 @@ private:
 
     bool bIsRunning;
     bool bEnableStateSharing;
+
+    // 阶段更新句柄
+    FMonoUpdateHandle UpdateHandle;
+    FMonoUpdateHandle LateUpdateHandle;
+    FMonoUpdateHandle FixedUpdateHandle;
 };
 
-// ״̬
+// 状态机管理器
 UCLASS(Blueprintable, BlueprintType)
 class XYFRAME_API UStateMachineManager : public USingletonBase
 {
@@ -176,15 +188,15 @@ public:
     UFUNCTION(BlueprintCallable, BlueprintPure, Category = "StateMachine", meta = (DisplayName = "Get StateMachine Manager"))
     static UStateMachineManager* GetStateMachineManager() { return GetInstance(); }
 
-    // ״̬
+    // 创建状态机
     UFUNCTION(BlueprintCallable, Category = "StateMachine")
     UStateMachineBase* CreateStateMachine(TScriptInterface<IStateMachineOwner> Owner, bool bEnableStateSharing = false);
 
-    // ״̬
+    // 销毁状态机
     UFUNCTION(BlueprintCallable, Category = "StateMachine")
     void DestroyStateMachine(UStateMachineBase* StateMachine);
 
-    // ȡԾ״̬
+    // 获取活跃状态机数量
     UFUNCTION(BlueprintCallable, Category = "StateMachine")
     int32 GetActiveStateMachineCount() const { return ActiveStateMachines.Num(); }
 
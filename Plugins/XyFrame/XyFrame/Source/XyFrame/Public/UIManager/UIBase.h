@@ -13,7 +13,7 @@
 #include "UITypes.h"
 #include "UIBase.generated.h"
 
-// ؼϢ
+// 控件信息
 USTRUCT(BlueprintType)
 struct FUIControlInfo
 {
@@ -35,7 +35,7 @@ struct FUIControlInfo
     }
 };
 
-// UIؼ¼
+// UI控件事件
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnButtonClicked, const FString&, ControlPath);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnCheckBoxChanged, const FString&, ControlPath, bool, IsChecked);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnSliderValueChanged, const FString&, ControlPath, float, Value);
@@ -46,10 +46,10 @@ class XYFRAME_API UUIBase : public UUserWidget
     GENERATED_BODY()
 
 public:
-    // 캯
+    // 构造函数
     UUIBase(const FObjectInitializer& ObjectInitializer);
 
-    // ==========  ==========
+    // ========== 生命周期 ==========
 
     virtual void NativeConstruct() override;
     virtual void NativeDestruct() override;
@@ -63,52 +63,56 @@ public:
     UFUNCTION(BlueprintCallable, Category = "UI")
     virtual void CloseUI();
 
-    // ==========  ==========
+    // ========== 数据设置 ==========
 
     UFUNCTION(BlueprintCallable, Category = "UI")
     virtual void SetData(UObject* Data);
 
-    // ========== ؼȡ ==========
+    // 从实例池取出复用前调用，恢复默认显示状态；持有数据的子类重写以清除上一次使用的状态
+    UFUNCTION(BlueprintCallable, Category = "UI")
+    virtual void ResetUI();
+
+    // ========== 控件获取 ==========
 
-    // ȡť
+    // 获取按钮
     UFUNCTION(BlueprintCallable, Category = "UI")
     UButton* GetButton(const FString& ControlPath) const;
 
-    // ȡı
+    // 获取文本
     UFUNCTION(BlueprintCallable, Category = "UI")
     UTextBlock* GetText(const FString& ControlPath) const;
 
-    // ȡͼƬ
+    // 获取图片
     UFUNCTION(BlueprintCallable, Category = "UI")
     UImage* GetImage(const FString& ControlPath) const;
 
-    // ȡ
+    // 获取滑动条
     UFUNCTION(BlueprintCallable, Category = "UI")
     USlider* GetSlider(const FString& ControlPath) const;
 
-    // ȡѡ
+    // 获取复选框
     UFUNCTION(BlueprintCallable, Category = "UI")
     UCheckBox* GetCheckBox(const FString& ControlPath) const;
 
-    // ȡ
+    // 获取进度条
     UFUNCTION(BlueprintCallable, Category = "UI")
     UProgressBar* GetProgressBar(const FString& ControlPath) const;
 
-    // ========== ؼ ==========
+    // ========== 控件设置 ==========
 
-    // ı
+    // 设置文本内容
     UFUNCTION(BlueprintCallable, Category = "UI")
     void SetText(const FString& ControlPath, const FString& Content);
 
-    // ͼƬ
+    // 设置图片
     UFUNCTION(BlueprintCallable, Category = "UI")
     void SetImage(const FString& ControlPath, UTexture2D* Texture);
 
-    // ý
+    // 设置进度
     UFUNCTION(BlueprintCallable, Category = "UI")
     void SetProgress(const FString& ControlPath, float Progress);
 
-    // ========== ؼ¼ ==========
+    // ========== 控件事件 ==========
 
     UPROPERTY(BlueprintAssignable, Category = "UI|Events")
     FOnButtonClicked OnButtonClicked;
@@ -120,20 +124,20 @@ public:
     FOnSliderValueChanged OnSliderValueChanged;
 
 protected:
-    // ؼֵ
+    // 控件字典
     UPROPERTY()
     TMap<FString, FUIControlInfo> ControlDictionary;
 
-    // ʼ־
+    // 初始化标志
     bool bIsInitialized;
 
-    // ؼ·ӳ
+    // 控件到路径的映射
     UPROPERTY()
     TMap<UWidget*, FString> WidgetPathMap;
 
-    // ========== ¼ ==========
+    // ========== 事件处理 ==========
 
-    // ؼ·¼
+    // 带控件路径的事件处理函数
     UFUNCTION()
     virtual void HandleButtonClick(const FString& ControlPath);
 
@@ -143,7 +147,7 @@ protected:
     UFUNCTION()
     virtual void HandleSliderValueChanged(const FString& ControlPath, float Value);
 
-    // ڲ¼
+    // 内部事件处理函数
     UFUNCTION()
     void HandleButtonClickInternal();
 
@@ -153,33 +157,33 @@ protected:
     UFUNCTION()
     void HandleSliderValueChangedInternal(float Value);
 
-    // ========== ʼ ==========
+    // ========== 初始化方法 ==========
 
-    // ʼؼ
+    // 初始化控件
     UFUNCTION(BlueprintCallable, Category = "UI")
     virtual void InitializeControls();
 
-    // ӿؼ
+    // 查找子控件
     void FindChildControls();
 
-    // עؼ¼
+    // 注册控件事件
     void RegisterControlEvents();
 
-    // ==========  ==========
+    // ========== 辅助方法 ==========
 
-    // ȡؼ·
+    // 获取控件路径
     FString GetControlPath(UWidget* Widget) const;
 
-    // ӿؼֵ
+    // 添加控件到字典
     void AddControlToDictionary(const FString& Path, UWidget* Widget, EUIControlType Type);
 
-    // ݿؼ·
+    // 根据控件查找路径
     FString FindControlPathByWidget(UWidget* Widget) const;
 
-    // ȡǰ¼Դؼ
+    // 获取当前事件源控件
     UWidget* GetCurrentEventSourceWidget() const;
 
 private:
-    // ڲʼ
+    // 内部初始化
     void InternalInitialize();
 };
\ No newline at end of file
@@ -5,10 +5,10 @@
 #include "CoreMinimal.h"
 #include "Engine/DataAsset.h"
 #include "Engine/DataTable.h"
-#include "UITypes.h"  // Ͷ
+#include "UITypes.h"  // 包含类型定义
 #include "UIConfigDataAsset.generated.h"
 
-// UIݽṹ
+// UI配置数据结构
 USTRUCT(BlueprintType)
 struct FUIConfigData : public FTableRowBase
 {
@@ -29,14 +29,19 @@ struct FUIConfigData : public FTableRowBase
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "UI")
     bool bPreload = false;
 
+    // 关闭后回收实例，下次显示时复用，适合频繁开关的界面
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "UI")
+    bool bPoolInstance = false;
+
     FUIConfigData()
         : DefaultLayer(EUIPanelLayer::Middle)
         , bPreload(false)
+        , bPoolInstance(false)
     {
     }
 };
 
-// UIʲ
+// UI配置数据资产
 UCLASS(BlueprintType)
 class XYFRAME_API UUIConfigDataAsset : public UDataAsset
 {
@@ -46,15 +51,15 @@ public:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "UI")
     UDataTable* UIConfigTable;
 
-    // ȡUI
+    // 获取UI配置
     UFUNCTION(BlueprintCallable, Category = "UI")
     bool GetUIConfig(FName UIName, FUIConfigData& OutConfig) const;
 
-    // ȡUI
+    // 获取所有UI配置
     UFUNCTION(BlueprintCallable, Category = "UI")
     TArray<FUIConfigData> GetAllUIConfigs() const;
 
-    // ȡҪԤصUI
+    // 获取需要预加载的UI
     UFUNCTION(BlueprintCallable, Category = "UI")
     TArray<FUIConfigData> GetPreloadUIConfigs() const;
 };
\ No newline at end of file
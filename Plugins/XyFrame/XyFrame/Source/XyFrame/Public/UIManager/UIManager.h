@@ -8,15 +8,19 @@
 #include "Blueprint/UserWidget.h"
 #include "Components/CanvasPanel.h"
 #include "Components/CanvasPanelSlot.h"
+#include "Engine/StreamableManager.h"
+#include "UObject/StrongObjectPtr.h"
 #include "UITypes.h"
 #include "UIManager.generated.h"
 
-// ǰ
+// 前向声明
 class UUIConfigDataAsset;
 class UUIBase;
-struct FUIConfigData;  // ǰ
+class UContentWidget;
+class UGameViewportClient;
+struct FUIConfigData;  // 添加这个前向声明
 
-// UIϢṹ
+// UI信息结构
 USTRUCT(BlueprintType)
 struct FUIInfo
 {
@@ -28,6 +32,10 @@ struct FUIInfo
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "UI")
     TSubclassOf<UUserWidget> WidgetClass;
 
+    // 配置中的类路径，首次显示时异步加载
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "UI")
+    TSoftClassPtr<UUserWidget> SoftWidgetClass;
+
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "UI")
     EUIPanelLayer Layer;
 
@@ -40,16 +48,41 @@ struct FUIInfo
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "UI")
     bool bIsPreloaded;
 
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "UI")
+    bool bPoolInstance;
+
     FUIInfo()
         : Layer(EUIPanelLayer::Middle)
         , State(EUIState::Hidden)
         , WidgetInstance(nullptr)
         , bIsPreloaded(false)
+        , bPoolInstance(false)
     {
     }
 };
 
-// UI¼
+// 同一类的空闲实例
+USTRUCT()
+struct FUIWidgetPool
+{
+    GENERATED_BODY()
+
+    UPROPERTY()
+    TArray<UUserWidget*> Widgets;
+};
+
+// 正在异步加载类的UI
+struct FPendingUILoad
+{
+    TSharedPtr<FStreamableHandle> Handle;
+    // 加载期间调用方可能不再引用数据，强引用保证显示时数据仍有效
+    TStrongObjectPtr<UObject> Data;
+    TWeakObjectPtr<UUserWidget> Placeholder;
+    bool bShowWhenLoaded = false;
+    bool bPreload = false;
+};
+
+// UI事件
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnUIShown, FName, UIName);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnUIHidden, FName, UIName);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnUIClosed, FName, UIName);
@@ -63,7 +96,7 @@ class XYFRAME_API UUIManager : public USingletonBase
     DECLARE_SINGLETON(UUIManager)
 
 public:
-    // ʼUI
+    // 初始化UI管理器
     UFUNCTION(BlueprintCallable, Category = "UI")
     void InitializeUIManager(UUIConfigDataAsset* ConfigDataAsset = nullptr);
 
@@ -76,103 +109,143 @@ public:
     UUIManager();
     virtual ~UUIManager() override;
 
-    // ========== UIڷ ==========
+    // ========== UI生命周期方法 ==========
 
-    // ʾUI
+    // 显示UI界面
     UFUNCTION(BlueprintCallable, Category = "UI")
     UUserWidget* ShowUI(TSubclassOf<UUserWidget> WidgetClass, EUIPanelLayer Layer = EUIPanelLayer::Middle, UObject* Data = nullptr, FName UIName = "");
 
-    // ʾUI
+    // 根据名称显示UI
     UFUNCTION(BlueprintCallable, Category = "UI")
     UUserWidget* ShowUIByName(FName UIName, UObject* Data = nullptr);
 
-    // UI
+    // 隐藏UI
     UFUNCTION(BlueprintCallable, Category = "UI")
     void HideUI(FName UIName);
 
-    // رUI
+    // 关闭UI
     UFUNCTION(BlueprintCallable, Category = "UI")
     void CloseUI(FName UIName);
 
-    // رUI
+    // 关闭所有UI
     UFUNCTION(BlueprintCallable, Category = "UI")
     void CloseAllUI();
 
-    // ========== ÷ ==========
+    // ========== 配置方法 ==========
 
-    // UI
+    // 加载UI配置
     UFUNCTION(BlueprintCallable, Category = "UI|Config")
     void LoadUIConfig(UUIConfigDataAsset* ConfigDataAsset);
 
-    // ¼UI
+    // 重新加载UI配置
     UFUNCTION(BlueprintCallable, Category = "UI|Config")
     void ReloadUIConfig();
 
-    // ԤUI
+    // 预加载UI
     UFUNCTION(BlueprintCallable, Category = "UI|Config")
     void PreloadUIs(const TArray<FName>& UINames);
 
-    // ԤбΪԤصUI
+    // 预加载所有标记为预加载的UI
     UFUNCTION(BlueprintCallable, Category = "UI|Config")
     void PreloadMarkedUIs();
 
-    // ========== UIϢѯ ==========
+    // ========== 异步加载与实例池 ==========
+
+    // 类加载期间显示的占位界面，为空时不显示
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "UI|Loading")
+    TSubclassOf<UUserWidget> LoadingPlaceholderClass;
+
+    // 每个类最多缓存的空闲实例数，0表示不缓存
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "UI|Pool", meta = (ClampMin = "0"))
+    int32 MaxPooledWidgetsPerClass;
+
+    // UI类是否正在异步加载
+    UFUNCTION(BlueprintCallable, BlueprintPure, Category = "UI|Loading")
+    bool IsUILoading(FName UIName) const;
+
+    // 释放所有缓存的空闲实例
+    UFUNCTION(BlueprintCallable, Category = "UI|Pool")
+    void ClearWidgetPools();
 
-    // ȡUIʵ
+    UFUNCTION(BlueprintCallable, BlueprintPure, Category = "UI|Pool")
+    int32 GetPooledWidgetCount() const;
+
+    // ========== UI信息查询 ==========
+
+    // 获取UI实例
     UFUNCTION(BlueprintCallable, Category = "UI")
     UUserWidget* GetUI(FName UIName) const;
 
-    // UIǷʾ
+    // 检查UI是否显示中
     UFUNCTION(BlueprintCallable, Category = "UI")
     bool IsUIVisible(FName UIName) const;
 
-    // UIǷ
+    // 检查UI是否存在
     UFUNCTION(BlueprintCallable, Category = "UI")
     bool DoesUIExist(FName UIName) const;
 
-    // ȡлԾUI
+    // 获取所有活跃的UI
     UFUNCTION(BlueprintCallable, Category = "UI")
     TArray<FName> GetAllActiveUIs() const;
 
-    // ȡעUI
+    // 获取所有注册的UI
     UFUNCTION(BlueprintCallable, Category = "UI")
     TArray<FName> GetAllRegisteredUIs() const;
 
-    // ========== 㼶 ==========
+    // ========== 层级方法 ==========
 
-    // UI㼶
+    // 设置UI层级
     UFUNCTION(BlueprintCallable, Category = "UI")
     void SetUILayer(FName UIName, EUIPanelLayer NewLayer);
 
-    // ȡUI㼶
+    // 获取UI层级
     UFUNCTION(BlueprintCallable, Category = "UI")
     EUIPanelLayer GetUILayer(FName UIName) const;
 
-    // ========== Ч ==========
+    // 设置图层缓存：Invalidation缓存布局与绘制元素，Retainer渲染到纹理并按RetainerPhaseCount帧重绘
+    UFUNCTION(BlueprintCallable, Category = "UI|Layer")
+    void SetLayerCaching(EUIPanelLayer Layer, EUILayerCaching Caching);
+
+    UFUNCTION(BlueprintCallable, BlueprintPure, Category = "UI|Layer")
+    EUILayerCaching GetLayerCaching(EUIPanelLayer Layer) const;
+
+    // 强制重绘缓存的图层
+    UFUNCTION(BlueprintCallable, Category = "UI|Layer")
+    void InvalidateLayer(EUIPanelLayer Layer);
+
+    // 未单独设置的图层使用的缓存方式
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "UI|Layer")
+    EUILayerCaching DefaultLayerCaching;
 
-    // Ч
+    // Retainer图层每隔多少帧重绘一次
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "UI|Layer", meta = (ClampMin = "1"))
+    int32 RetainerPhaseCount;
+
+    // ========== 动画和效果 ==========
+
+    // 淡入效果
     UFUNCTION(BlueprintCallable, Category = "UI")
     void FadeInUI(FName UIName, float Duration = 0.3f);
 
-    // Ч
+    // 淡出效果
     UFUNCTION(BlueprintCallable, Category = "UI")
     void FadeOutUI(FName UIName, float Duration = 0.3f);
 
-    // ========== Թ ==========
+    // ========== 调试功能 ==========
 
-    // ӡUIϢ
+    // 打印所有UI信息
     UFUNCTION(BlueprintCallable, Category = "UI|Debug")
     void PrintAllUIs();
 
-    // ӡ㼶Ϣ
+    // 打印层级信息
     UFUNCTION(BlueprintCallable, Category = "UI|Debug")
     void PrintLayerInfo();
 
-    // ӡϢ
+    // 打印配置信息
     UFUNCTION(BlueprintCallable, Category = "UI|Debug")
     void PrintConfigInfo();
 
-    // ========== ¼ ==========
+    // ========== 事件 ==========
 
     UPROPERTY(BlueprintAssignable, Category = "UI|Events")
     FOnUIShown OnUIShown;
@@ -187,40 +260,87 @@ public:
     FOnUIConfigLoaded OnUIConfigLoaded;
 
 private:
-    // UIע
+    // UI注册表
     UPROPERTY()
     TMap<FName, FUIInfo> UIRegistry;
 
-    // 㼶
+    // 层级面板
     UPROPERTY()
     TMap<EUIPanelLayer, UCanvasPanel*> LayerPanels;
 
-    // 
+    // 按类缓存的空闲实例
+    UPROPERTY()
+    TMap<TSubclassOf<UUserWidget>, FUIWidgetPool> WidgetPools;
+
+    // 异步加载中的UI
+    TMap<FName, FPendingUILoad> PendingUILoads;
+
+    // 配置数据
     UPROPERTY()
     UUIConfigDataAsset* UIConfigData;
 
-    // 
+    // 世界上下文
     UPROPERTY()
     UWorld* WorldContext;
 
-    // 
+    // 根画布
     UPROPERTY()
     UCanvasPanel* RootCanvas;
 
-    // ˽з
+    // 包裹图层面板的缓存容器
+    UPROPERTY()
+    TMap<EUIPanelLayer, UContentWidget*> LayerHosts;
+
+    TMap<EUIPanelLayer, EUILayerCaching> LayerCaching;
+
+    // 图层内最上层的ZOrder，显示时置顶
+    TMap<EUIPanelLayer, int32> LayerTopZOrder;
+
+    // 根画布挂在游戏视口上，切换地图后视口内容被清空需要重新挂接
+    TSharedPtr<SWidget> RootSlateWidget;
+    TWeakObjectPtr<UGameViewportClient> RootViewportClient;
+    TWeakObjectPtr<UWorld> RootViewportWorld;
+
+    // 切换地图时刷新世界上下文并重新挂接根画布
+    FDelegateHandle WorldCleanupHandle;
+    FDelegateHandle PostLoadMapHandle;
+
+    // 私有方法
     void CreateLayerPanels();
     UCanvasPanel* GetOrCreateLayerPanel(EUIPanelLayer Layer);
     void AddToLayer(UUserWidget* Widget, EUIPanelLayer Layer);
     void RemoveFromLayer(UUserWidget* Widget);
-
-    // ù
-    bool RegisterUIFromConfig(const FUIConfigData& Config);  // ޸ӷ
+    bool IsInLayer(UUserWidget* Widget, EUIPanelLayer Layer) const;
+    void BringToFront(UUserWidget* Widget, EUIPanelLayer Layer);
+    void AttachLayerPanel(EUIPanelLayer Layer);
+    void AttachRootToViewport();
+    void DetachRootFromViewport();
+    void BindWorldEvents();
+    void UnbindWorldEvents();
+    void HandleWorldCleanup(UWorld* World, bool bSessionEnded, bool bCleanupResources);
+    void HandlePostLoadMap(UWorld* LoadedWorld);
+
+    // 配置管理方法
+    bool RegisterUIFromConfig(const FUIConfigData& Config);  // 修复这里，添加返回类型
     void RegisterAllUIsFromConfig();
-    TSubclassOf<UUserWidget> LoadWidgetClass(const TSoftClassPtr<UUserWidget>& SoftClassPtr);
 
-    // 
+    // 懒加载：类已在内存中时直接取用，否则异步加载
+    bool ResolveWidgetClass(FUIInfo& UIInfo) const;
+    void RequestWidgetClassLoad(FName UIName, bool bShowWhenLoaded, UObject* Data = nullptr);
+    void HandleWidgetClassLoaded(FName UIName);
+    void CancelPendingShow(FName UIName);
+    void CancelAllPendingLoads();
+    void ShowLoadingPlaceholder(FPendingUILoad& Pending, EUIPanelLayer Layer);
+    void HideLoadingPlaceholder(FPendingUILoad& Pending);
+    void PreloadUIInstance(FUIInfo& UIInfo);
+
+    // 实例池
+    UUserWidget* AcquireWidget(TSubclassOf<UUserWidget> WidgetClass);
+    bool ReleaseWidgetToPool(UUserWidget* Widget);
+
+    // 动画处理
     void HandleFadeAnimation(FName UIName, float TargetAlpha, float Duration);
 
-    // ȡ
+    // 获取世界
     UWorld* GetWorld() const override;
 };
\ No newline at end of file
@@ -6,7 +6,7 @@
 #include "Engine/Engine.h"
 #include "UITypes.generated.h"
 
-// UIͼö
+// UI图层枚举
 UENUM(BlueprintType)
 enum class EUIPanelLayer : uint8
 {
@@ -18,7 +18,7 @@ enum class EUIPanelLayer : uint8
     ForeFront   UMETA(DisplayName = "ForeFront")
 };
 
-// UI״̬
+// UI状态
 UENUM(BlueprintType)
 enum class EUIState : uint8
 {
@@ -28,7 +28,16 @@ enum class EUIState : uint8
     Hiding      UMETA(DisplayName = "Hiding")
 };
 
-// ؼö
+// 图层缓存方式
+UENUM(BlueprintType)
+enum class EUILayerCaching : uint8
+{
+    None            UMETA(DisplayName = "None"),
+    Invalidation    UMETA(DisplayName = "Invalidation"),
+    Retainer        UMETA(DisplayName = "Retainer")
+};
+
+// 控件类型枚举
 UENUM(BlueprintType)
 enum class EUIControlType : uint8
 {
@@ -2,24 +2,24 @@
 
 #include "CoreMinimal.h"
 #include "GameFramework/Character.h"
-#include "GameFramework/CharacterMovementComponent.h" // ͷļ
+#include "GameFramework/CharacterMovementComponent.h" // 添加这个头文件
 #include "EventManager/MyEventManager.h"
 #include "ResourceManager/ResourceManager.h"
 #include "MonoManager/MonoManager.h"
 #include "XyCharacterBase.generated.h"
 
-// ɫ״̬ö
+// 角色状态枚举
 UENUM(BlueprintType)
 enum class EXyCharacterState : uint8
 {
-    Idle UMETA(DisplayName = ""),
-    Moving UMETA(DisplayName = "ƶ"),
-    Jumping UMETA(DisplayName = "Ծ"),
-    Attacking UMETA(DisplayName = ""),
-    Dead UMETA(DisplayName = "")
+    Idle UMETA(DisplayName = "闲置"),
+    Moving UMETA(DisplayName = "移动"),
+    Jumping UMETA(DisplayName = "跳跃"),
+    Attacking UMETA(DisplayName = "攻击"),
+    Dead UMETA(DisplayName = "死亡")
 };
 
-// ɫ
+// 角色数据
 USTRUCT(BlueprintType)
 struct FCharacterData
 {
@@ -63,98 +63,98 @@ protected:
     virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
     virtual void PossessedBy(AController* NewController) override;
     virtual void UnPossessed() override;
-    virtual void Tick(float DeltaTime) override; //  Tick 
+    virtual void Tick(float DeltaTime) override; // 添加 Tick 声明
 
 public:
-    // ==========  ==========
+    // ========== 基础功能 ==========
 
-    // ʼɫ
+    // 初始化角色
     UFUNCTION(BlueprintCallable, Category = "XyCharacter")
     virtual void InitializeCharacter(const FCharacterData& InData);
 
-    // ȡɫ
+    // 获取角色数据
     UFUNCTION(BlueprintCallable, BlueprintPure, Category = "XyCharacter")
     FCharacterData GetCharacterData() const { return CharacterData; }
 
-    // ȡǰ״̬
+    // 获取当前状态
     UFUNCTION(BlueprintCallable, BlueprintPure, Category = "XyCharacter")
     EXyCharacterState GetCharacterState() const { return CurrentState; }
 
-    // ========== ״̬ ==========
+    // ========== 状态管理 ==========
 
-    // ıɫ״̬
+    // 改变角色状态
     UFUNCTION(BlueprintCallable, Category = "XyCharacter")
     virtual bool ChangeState(EXyCharacterState NewState);
 
-    // ״̬
+    // 状态检查
     UFUNCTION(BlueprintCallable, BlueprintPure, Category = "XyCharacter")
     bool IsAlive() const { return CurrentState != EXyCharacterState::Dead && CharacterData.Health > 0; }
 
-    // ========== ֵϵͳ ==========
+    // ========== 生命值系统 ==========
 
-    // Ӧ˺
+    // 应用伤害
     UFUNCTION(BlueprintCallable, Category = "XyCharacter")
     virtual void ApplyDamage(float Damage, AActor* DamageCauser = nullptr);
 
-    // 
+    // 治疗
     UFUNCTION(BlueprintCallable, Category = "XyCharacter")
     virtual void ApplyHeal(float HealAmount);
 
-    // ȡֵٷֱ
+    // 获取生命值百分比
     UFUNCTION(BlueprintCallable, BlueprintPure, Category = "XyCharacter")
     float GetHealthPercent() const { return CharacterData.MaxHealth > 0 ? CharacterData.Health / CharacterData.MaxHealth : 0; }
 
-    // ========== Դ ==========
+    // ========== 资源管理 ==========
 
-    // 첽ؽɫԴ
+    // 异步加载角色资源
     UFUNCTION(BlueprintCallable, Category = "XyCharacter")
     virtual void LoadCharacterResources();
 
-    // жؽɫԴ
+    // 卸载角色资源
     UFUNCTION(BlueprintCallable, Category = "XyCharacter")
     virtual void UnloadCharacterResources();
 
-    // ========== ¼ϵͳ ==========
+    // ========== 事件系统 ==========
 
-    // ɫ¼
+    // 触发角色事件
     UFUNCTION(BlueprintCallable, Category = "XyCharacter")
     virtual void TriggerCharacterEvent(EGameEventType EventType, const FGameEventData& EventData);
 
-    // 򵥽ɫ¼
+    // 触发简单角色事件
     UFUNCTION(BlueprintCallable, Category = "XyCharacter")
     void TriggerSimpleCharacterEvent(EGameEventType EventType, const FString& TextParam = "", float ValueParam = 0.0f);
 
 protected:
-    // ========== ܱ麯 ==========
+    // ========== 受保护的虚函数 ==========
 
-    // ״̬
+    // 状态进入
     virtual void OnEnterState(EXyCharacterState NewState);
 
-    // ״̬˳
+    // 状态退出
     virtual void OnExitState(EXyCharacterState OldState);
 
-    // ״̬
+    // 状态更新
     virtual void OnUpdateState(float DeltaTime);
 
-    // Դɻص
+    // 资源加载完成回调
     UFUNCTION()
     virtual void OnCharacterResourcesLoaded(UObject* LoadedResource);
 
-    // 
+    // 死亡处理
     virtual void HandleDeath();
 
-    // 
+    // 重生处理
     virtual void HandleRespawn();
 
-    // ========== ܼ ==========
+    // ========== 框架集成 ==========
 
-    // ȡܹ
+    // 获取框架管理器
     UMyEventManager* GetEventManager() const { return UMyEventManager::GetEventManager(); }
     UResourceManager* GetResourceManager() const { return UResourceManager::GetResourceManager(); }
     UMonoManager* GetMonoManager() const { return UMonoManager::GetMonoManager(); }
 
 protected:
-    // ==========  ==========
+    // ========== 属性 ==========
 
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Character")
     FCharacterData CharacterData;
@@ -168,13 +168,13 @@ protected:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Character")
     FString CharacterAnimBlueprintPath;
 
-    // ԴID
+    // 资源加载请求ID
     FString ResourceLoadRequestId;
 
-    // ʱID
-    FString RespawnTimerId;
+    // 重生计时器句柄
+    FMonoTimerHandle RespawnTimerHandle;
 
 private:
-    // ڲ״̬
+    // 内部状态处理
     void InternalUpdateState(float DeltaTime);
 };
\ No newline at end of file
@@ -22,54 +22,54 @@ protected:
     virtual void SetupInputComponent() override;
 
 public:
-    // ========== ϵͳ ==========
+    // ========== 输入系统 ==========
 
-    // 
+    // 绑定输入
     UFUNCTION(BlueprintCallable, Category = "XyPlayerController")
     virtual void BindCharacterInputs();
 
-    // л״̬
+    // 切换输入启用状态
     UFUNCTION(BlueprintCallable, Category = "XyPlayerController")
     virtual void SetInputEnabled(bool bEnabled);
 
-    // ========== ɫ ==========
+    // ========== 角色控制 ==========
 
-    // ȡƵĽɫŻ汾
+    // 获取控制的角色（优化版本）
     UFUNCTION(BlueprintCallable, BlueprintPure, Category = "XyPlayerController")
     class AXyCharacterBase* GetXyCharacter() const;
 
-    // ɫ
+    // 重生角色
     UFUNCTION(BlueprintCallable, Category = "XyPlayerController")
     virtual void RespawnCharacter();
 
-    // ========== ¼ ==========
+    // ========== 事件处理 ==========
 
-    // ע¼
+    // 注册事件监听
     UFUNCTION(BlueprintCallable, Category = "XyPlayerController")
     virtual void RegisterEventListeners();
 
-    // Ƴ¼
+    // 移除事件监听
     UFUNCTION(BlueprintCallable, Category = "XyPlayerController")
     virtual void UnregisterEventListeners();
 
 protected:
-    // ========== 봦 ==========
+    // ========== 输入处理函数 ==========
 
-    // ƶ
+    // 移动输入
     UFUNCTION()
     virtual void HandleMoveForward(float Value);
 
     UFUNCTION()
     virtual void HandleMoveRight(float Value);
 
-    // ӽ
+    // 视角输入
     UFUNCTION()
     virtual void HandleLookUp(float Value);
 
     UFUNCTION()
     virtual void HandleTurn(float Value);
 
-    // 
+    // 动作输入
     UFUNCTION()
     virtual void HandleJump();
 
@@ -79,42 +79,42 @@ protected:
     UFUNCTION()
     virtual void HandleAttack();
 
-    // ========== ¼ص ==========
+    // ========== 事件回调 ==========
 
-    // ɫ¼ص
+    // 角色事件回调
     UFUNCTION()
     virtual void OnCharacterEvent(EGameEventType EventType, const FGameEventData& EventData);
 
-    // ɫ
+    // 处理角色死亡
     UFUNCTION()
     virtual void HandleCharacterDeath();
 
-    // ========== ܼ ==========
+    // ========== 框架集成 ==========
 
     UMyEventManager* GetEventManager() const { return UMyEventManager::GetEventManager(); }
     UMonoManager* GetMonoManager() const { return UMonoManager::GetMonoManager(); }
 
 protected:
-    // Ƿ
+    // 输入是否启用
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Controller")
     bool bInputEnabled;
 
-    // 
+    // 鼠标灵敏度
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Controller")
     float MouseSensitivity;
 
-    // 
+    // 控制器灵敏度
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Controller")
     float ControllerSensitivity;
 
 private:
-    // 
+    // 输入组件缓存
     UInputComponent* CachedInputComponent;
 
-    // ɫָƵ CastŻ
+    // 缓存角色指针避免频繁 Cast（性能优化）
     UPROPERTY()
     mutable class AXyCharacterBase* CachedXyCharacter;
 
-    // ЧԱ־
+    // 缓存有效性标志
     mutable bool bCachedCharacterValid;
 };
\ No newline at end of file
@@ -12,7 +12,7 @@
 #include "Engine/Engine.h"
 #include "XyBaseGameMode.generated.h"
 
-// ʼ״̬
+// 世界初始化状态
 UENUM(BlueprintType)
 enum class EWorldInitState : uint8
 {
@@ -22,7 +22,7 @@ enum class EWorldInitState : uint8
     Failed         UMETA(DisplayName = "Failed")
 };
 
-// 
+// 玩家生成配置
 USTRUCT(BlueprintType)
 struct FPlayerSpawnConfig
 {
@@ -50,7 +50,7 @@ struct FPlayerSpawnConfig
     }
 };
 
-// 
+// 世界配置
 USTRUCT(BlueprintType)
 struct FWorldConfig
 {
@@ -82,11 +82,11 @@ struct FWorldConfig
     }
 };
 
-// ʼί
+// 世界初始化完成委托
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnWorldInitialized, bool, bSuccess);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnWorldShutdown);
 
-// ͼصί
+// 蓝图回调委托
 DECLARE_DYNAMIC_DELEGATE_OneParam(FOnWorldInitCallback, bool, bSuccess);
 
 UCLASS(Abstract, Blueprintable, BlueprintType)
@@ -102,126 +102,126 @@ protected:
     virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 public:
-    // ========== ڹ ==========
+    // ========== 世界生命周期管理 ==========
 
-    // ʼ磨ڵ㣩
+    // 初始化世界（主入口点）
     UFUNCTION(BlueprintCallable, Category = "GameMode|World")
     virtual void InitializeWorld();
 
-    // 첽ʼ
+    // 异步初始化世界
     UFUNCTION(BlueprintCallable, Category = "GameMode|World")
     virtual void InitializeWorldAsync();
 
-    // ر
+    // 关闭世界
     UFUNCTION(BlueprintCallable, Category = "GameMode|World")
     virtual void ShutdownWorld();
 
-    // 
+    // 重启世界
     UFUNCTION(BlueprintCallable, Category = "GameMode|World")
     virtual void RestartWorld();
 
-    // ========== ҹ ==========
+    // ========== 玩家管理 ==========
 
-    // ǷӦңд
+    // 是否应该生成玩家（可重写）
     UFUNCTION(BlueprintNativeEvent, BlueprintCallable, Category = "GameMode|Player")
     bool ShouldSpawnPlayer() const;
     virtual bool ShouldSpawnPlayer_Implementation() const;
 
-    // ȡãд
+    // 获取玩家生成配置（可重写）
     UFUNCTION(BlueprintNativeEvent, BlueprintCallable, Category = "GameMode|Player")
     FPlayerSpawnConfig GetPlayerSpawnConfig() const;
     virtual FPlayerSpawnConfig GetPlayerSpawnConfig_Implementation() const;
 
-    // ңд
+    // 生成玩家（可重写）
     UFUNCTION(BlueprintNativeEvent, BlueprintCallable, Category = "GameMode|Player")
     APawn* SpawnPlayer(AController* NewPlayer);
     virtual APawn* SpawnPlayer_Implementation(AController* NewPlayer);
 
-    // Զλãд
+    // 自定义玩家生成位置（可重写）
     UFUNCTION(BlueprintNativeEvent, BlueprintCallable, Category = "GameMode|Player")
     FTransform GetPlayerSpawnTransform(AController* PlayerController);
     virtual FTransform GetPlayerSpawnTransform_Implementation(AController* PlayerController);
 
-    // ==========  ==========
+    // ========== 世界配置 ==========
 
-    // ȡãд
+    // 获取世界配置（可重写）
     UFUNCTION(BlueprintNativeEvent, BlueprintCallable, Category = "GameMode|Config")
     FWorldConfig GetWorldConfig() const;
     virtual FWorldConfig GetWorldConfig_Implementation() const;
 
-    // 
+    // 设置世界配置
     UFUNCTION(BlueprintCallable, Category = "GameMode|Config")
     void SetWorldConfig(const FWorldConfig& NewConfig);
 
-    // ========== ܼ ==========
+    // ========== 框架集成 ==========
 
-    // ȡԴ
+    // 获取资源管理器
     UFUNCTION(BlueprintCallable, BlueprintPure, Category = "GameMode|Framework")
     UResourceManager* GetResourceManager() const;
 
-    // ȡʱ
+    // 获取计时器管理器
     UFUNCTION(BlueprintCallable, BlueprintPure, Category = "GameMode|Framework")
     UMonoManager* GetMonoManager() const;
 
-    // ȡ浵
+    // 获取存档工具
     UFUNCTION(BlueprintCallable, BlueprintPure, Category = "GameMode|Framework")
     USaveGameTool* GetSaveGameTool() const;
 
-    // ========== ʼ裨д ==========
+    // ========== 初始化步骤（可重写） ==========
 
-    // ԤʼҪʼ֮ǰ
+    // 预初始化（在主要初始化之前）
     UFUNCTION(BlueprintNativeEvent, Category = "GameMode|Initialization")
     void PreInitializeWorld();
     virtual void PreInitializeWorld_Implementation();
 
-    // ʼϵͳ
+    // 初始化框架系统
     UFUNCTION(BlueprintNativeEvent, Category = "GameMode|Initialization")
     void InitializeFrameworkSystems();
     virtual void InitializeFrameworkSystems_Implementation();
 
-    // Դ
+    // 加载世界资源
     UFUNCTION(BlueprintNativeEvent, Category = "GameMode|Initialization")
     void LoadWorldResources();
     virtual void LoadWorldResources_Implementation();
 
-    // ʼ״̬
+    // 初始化世界状态
     UFUNCTION(BlueprintNativeEvent, Category = "GameMode|Initialization")
     void InitializeWorldState();
     virtual void InitializeWorldState_Implementation();
 
-    // ʼ
+    // 初始化玩家
     UFUNCTION(BlueprintNativeEvent, Category = "GameMode|Initialization")
     void InitializePlayers();
     virtual void InitializePlayers_Implementation();
 
-    // ʼҪʼ֮
+    // 后初始化（在主要初始化之后）
     UFUNCTION(BlueprintNativeEvent, Category = "GameMode|Initialization")
     void PostInitializeWorld();
     virtual void PostInitializeWorld_Implementation();
 
-    // ========== رղ裨д ==========
+    // ========== 关闭步骤（可重写） ==========
 
-    // Ԥر
+    // 预关闭
     UFUNCTION(BlueprintNativeEvent, Category = "GameMode|Shutdown")
     void PreShutdownWorld();
     virtual void PreShutdownWorld_Implementation();
 
-    // ״̬
+    // 保存世界状态
     UFUNCTION(BlueprintNativeEvent, Category = "GameMode|Shutdown")
     void SaveWorldState();
     virtual void SaveWorldState_Implementation();
 
-    // Դ
+    // 清理资源
     UFUNCTION(BlueprintNativeEvent, Category = "GameMode|Shutdown")
     void CleanupWorldResources();
     virtual void CleanupWorldResources_Implementation();
 
-    // ر
+    // 后关闭
     UFUNCTION(BlueprintNativeEvent, Category = "GameMode|Shutdown")
     void PostShutdownWorld();
     virtual void PostShutdownWorld_Implementation();
 
-    // ========== ¼ί ==========
+    // ========== 事件委托 ==========
 
     UPROPERTY(BlueprintAssignable, Category = "GameMode|Events")
     FOnWorldInitialized OnWorldInitialized;
@@ -229,12 +229,12 @@ public:
     UPROPERTY(BlueprintAssignable, Category = "GameMode|Events")
     FOnWorldShutdown OnWorldShutdown;
 
-    // ========== ص첽ʼ ==========
+    // ========== 带回调的异步初始化 ==========
 
     UFUNCTION(BlueprintCallable, Category = "GameMode|World")
     void InitializeWorldWithCallback(const FOnWorldInitCallback& Callback);
 
-    // ========== ״̬ѯ ==========
+    // ========== 状态查询 ==========
 
     UFUNCTION(BlueprintCallable, BlueprintPure, Category = "GameMode|World")
     EWorldInitState GetWorldInitState() const { return WorldInitState; }
@@ -246,36 +246,36 @@ public:
     bool IsWorldInitializing() const { return WorldInitState == EWorldInitState::Initializing; }
 
 protected:
-    // ========== ڲʵ ==========
+    // ========== 内部实现 ==========
 
-    // ڲʼɴ - ƳUFUNCTIONΪҪͼ
+    // 内部初始化完成处理 - 移除UFUNCTION，因为不需要蓝图调用
     void HandleWorldInitialized(bool bSuccess);
 
-    // 첽ʼʱص - ƳUFUNCTION
+    // 异步初始化计时器回调 - 移除UFUNCTION
     void ExecuteAsyncInitialization();
 
-    // Ĭ
+    // 生成默认玩家
     APawn* SpawnDefaultPlayer(AController* NewPlayer);
 
-    // ȡɵ
+    // 获取随机生成点
     FTransform GetRandomSpawnTransform() const;
 
 private:
-    // ʼ״̬
+    // 世界初始化状态
     UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "GameMode|State", meta = (AllowPrivateAccess = "true"))
     EWorldInitState WorldInitState;
 
-    // 
+    // 世界配置
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GameMode|Config", meta = (AllowPrivateAccess = "true"))
     FWorldConfig WorldConfiguration;
 
-    // 
+    // 玩家生成配置
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GameMode|Player", meta = (AllowPrivateAccess = "true"))
     FPlayerSpawnConfig PlayerSpawnConfiguration;
 
-    // ص洢
+    // 回调存储
     TArray<FOnWorldInitCallback> InitCallbacks;
 
-    // 첽ʼʱID
-    FString AsyncInitTimerId;
+    // 异步初始化计时器句柄
+    FMonoTimerHandle AsyncInitTimerHandle;
 };
\ No newline at end of file
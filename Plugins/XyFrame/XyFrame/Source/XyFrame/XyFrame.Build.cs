@@ -7,6 +7,8 @@ public class XyFrame : ModuleRules
 	public XyFrame(ReadOnlyTargetRules Target) : base(Target)
 	{
 		PCHUsage = ModuleRules.PCHUsageMode.UseExplicitOrSharedPCHs;
+		// 协程任务(MonoTask)依赖C++20
+		CppStandard = CppStandardVersion.Cpp20;
 		
 		PublicIncludePaths.AddRange(
 			new string[] {
@@ -29,7 +31,7 @@ public class XyFrame : ModuleRules
                 "CoreUObject",
                 "Engine",
                 "InputCore",
-                "UMG", //  UMG ģ
+                "UMG", // 必须添加 UMG 模块
                 "Slate",
                 "SlateCore"
             }
@@ -15,7 +15,7 @@ AOldManCharacter::AOldManCharacter()
 {
     PrimaryActorTick.bCanEverTick = true;
 
-    // ɱ
+    // 创建弹簧臂组件
     CameraBoom = CreateDefaultSubobject<USpringArmComponent>(TEXT("CameraBoom"));
     CameraBoom->SetupAttachment(RootComponent);
     CameraBoom->TargetArmLength = CameraDistance;
@@ -27,15 +27,15 @@ AOldManCharacter::AOldManCharacter()
     CameraBoom->CameraRotationLagSpeed = 10.0f;
     CameraBoom->bDoCollisionTest = true;
 
-    // 
+    // 创建跟随相机组件
     FollowCamera = CreateDefaultSubobject<UCameraComponent>(TEXT("FollowCamera"));
     FollowCamera->SetupAttachment(CameraBoom, USpringArmComponent::SocketName);
     FollowCamera->bUsePawnControlRotation = false;
 
-    // 
+    // 创建相机控制组件
     CameraComponent = CreateDefaultSubobject<UOldManCameraComponent>(TEXT("CameraComponent"));
 
-    // ȷɫԶƶֶ
+    // 确保角色不自动朝向移动方向，由我们手动控制
     bUseControllerRotationYaw = false;
     if (GetCharacterMovement())
     {
@@ -56,13 +56,13 @@ void AOldManCharacter::Tick(float DeltaTime)
 {
     Super::Tick(DeltaTime);
 
-    // ״̬
+    // 更新状态机
     if (StateMachine && StateMachine->IsRunning())
     {
         StateMachine->Update(DeltaTime);
     }
 
-    // λ
+    // 更新鼠标位置
     FVector2D CurrentMousePosition;
     if (GetOldManController()->GetMousePosition(CurrentMousePosition.X, CurrentMousePosition.Y))
     {
@@ -74,13 +74,13 @@ void AOldManCharacter::Tick(float DeltaTime)
         bHasValidLastPosition = true;
     }
 
-    // ϶(ʱ)
+    // 处理拖动(暂时放着)
     if (curOldManPullItem && CurrentMouseDelta.SizeSquared() > FMath::Square(MinMovementThreshold))
     {
         APlayerCameraManager* CameraManager = GetOldManController()->PlayerCameraManager;
         if (CameraManager)
         {
-            // 2DƶתΪ3Dӽƶ
+            // 将2D鼠标移动转换为3D视角移动方向
             FVector CameraForward = CameraManager->GetCameraRotation().Vector();
             FVector CameraRight = FRotationMatrix(CameraManager->GetCameraRotation()).GetScaledAxis(EAxis::Y);
             FVector CameraUp = FRotationMatrix(CameraManager->GetCameraRotation()).GetScaledAxis(EAxis::Z);
@@ -91,13 +91,13 @@ void AOldManCharacter::Tick(float DeltaTime)
 
             ViewMovementDirection.Normalize();
 
-            // ޸ģʹøƽǿȼ
+            // 修改：使用更平滑的强度计算
             float RawIntensity = CurrentMouseDelta.Size() * DragSensitivity;
 
-            // Ӧ÷Ӧ
+            // 应用非线性响应
             float MovementIntensity = FMath::Sign(RawIntensity) * FMath::Pow(FMath::Abs(RawIntensity), 0.8f);
 
-            // Ӧƶ
+            // 应用移动
             curOldManPullItem->HandleMouseData(ViewMovementDirection, MovementIntensity * 0.001f);
         }
 
@@ -112,7 +112,7 @@ void AOldManCharacter::OnMovementModeChanged(EMovementMode PrevMovementMode, uin
 
     EMovementMode NewMovementMode = GetCharacterMovement()->MovementMode;
 
-    // ״̬л״̬ʾأ
+    // 检测从下落状态切换到行走状态（表示落地）
     if (PrevMovementMode == MOVE_Falling && NewMovementMode == MOVE_Walking)
     {
         LastLandingTime = GetWorld()->GetTimeSeconds();
@@ -120,7 +120,7 @@ void AOldManCharacter::OnMovementModeChanged(EMovementMode PrevMovementMode, uin
 
         UE_LOG(LogTemp, Log, TEXT("Character landed successfully"));
     }
-    // ⿪ʼ
+    // 检测开始下落
     else if (NewMovementMode == MOVE_Falling)
     {
         bWasFalling = true;
@@ -182,7 +182,7 @@ void AOldManCharacter::UpdateCharacterRotation(float DeltaTime, const FVector& D
     FRotator CurrentRotation = GetActorRotation();
     FRotator TargetRotation = DesiredDirection.Rotation();
 
-    // ת죬СǶȵĶ
+    // 计算旋转差异，避免小角度的抖动
     float YawDifference = FMath::Abs(CurrentRotation.Yaw - TargetRotation.Yaw);
     if (YawDifference > 1.0f)
     {
@@ -196,7 +196,7 @@ void AOldManCharacter::UpdateCharacterRotation(float DeltaTime, const FVector& D
     }
 }
 
-// ========== ƺ ==========
+// ========== 相机控制函数 ==========
 
 void AOldManCharacter::SetCameraDistance(float Distance)
 {
@@ -253,18 +253,18 @@ bool AOldManCharacter::IsMoving() const
 
 bool AOldManCharacter::IsFalling() const
 {
-    // ʹøɿļⷽ
+    // 使用更可靠的检测方法
     if (!GetCharacterMovement())
         return false;
 
-    // ƶ˵䣬ûиأΪ
+    // 如果移动组件说在下落，并且没有刚落地，则认为在下落
     bool bMovementFalling = GetCharacterMovement()->IsFalling();
     float CurrentTime = GetWorld()->GetTimeSeconds();
 
-    // ֹʱȻtrue
+    // 防止刚落地时仍然返回true
     if (!bMovementFalling && (CurrentTime - LastLandingTime < 0.1f))
     {
-        return false; // أ
+        return false; // 刚落地，不算下落
     }
 
     return bMovementFalling;
@@ -272,7 +272,7 @@ bool AOldManCharacter::IsFalling() const
 
 bool AOldManCharacter::CanDoubleJump() const
 {
-    //жǷ
+    //判断是否进入过
     return !hasIntoDoubleJump;
 }
 
@@ -293,12 +293,12 @@ bool AOldManCharacter::IsActuallyGrounded() const
     if (!GetCharacterMovement())
         return false;
 
-    // ʹöжǷڵ
+    // 使用多种条件判断是否真的在地面
     bool bIsOnGround = GetCharacterMovement()->IsMovingOnGround();
     bool bIsFalling = GetCharacterMovement()->IsFalling();
     float CurrentTime = GetWorld()->GetTimeSeconds();
 
-    // ƶ˵ڵ棬¼Ϊڵ
+    // 如果移动组件说在地面，并且最近有落地事件，则认为真的在地面
     return bIsOnGround && !bIsFalling && (CurrentTime - LastLandingTime < 0.5f);
 }
 
@@ -334,12 +334,12 @@ void AOldManCharacter::PerformAttackDetection()
 {
     if (!CharacterAttributes) return;
 
-    // ߼
+    // 攻击检测逻辑
     FVector StartLocation = GetActorLocation();
     FVector ForwardVector = GetActorForwardVector();
     FVector EndLocation = StartLocation + ForwardVector * CharacterAttributes->AttackRange;
 
-    // μ
+    // 球形检测
     TArray<FHitResult> HitResults;
     FCollisionShape Sphere = FCollisionShape::MakeSphere(50.0f);
     FCollisionQueryParams Params;
@@ -362,7 +362,7 @@ void AOldManCharacter::PerformAttackDetection()
             AActor* HitActor = Hit.GetActor();
             if (HitActor && HitActor != this)
             {
-                // Ӧ˺򴥷¼
+                // 应用伤害或触发事件
                 OnAttackHit(HitActor);
                 UE_LOG(LogTemp, Log, TEXT("Hit actor: %s"), *HitActor->GetName());
             }
@@ -387,7 +387,7 @@ void AOldManCharacter::SetupCharacterMesh(USkeletalMesh* NewMesh, UClass* NewAni
 
 void AOldManCharacter::InitializeParam()
 {
-    // ʼ
+    // 初始化变量
     bIsRunning = false;
     hasIntoDoubleJump = false;
     LastAttackTime = 0.0f;
@@ -395,7 +395,7 @@ void AOldManCharacter::InitializeParam()
     bHasJumpInput = false;
     bHasAttackInput = false;
 
-    // ؼĽ
+    // 落地检测改进
     LastLandingTime = 0.0f;
     bWasFalling = false;
 }
@@ -426,7 +426,7 @@ void AOldManCharacter::SetPullItemState(bool bPulling)
     bHasPullItem = bPulling;
 }
 
-//ʹTagжϵǰǷп϶Ʒܿ
+//使用射线与Tag判断当前是否有可拖动物品能控制
 void AOldManCharacter::StartRightMousePull()
 {
     if (!GetOldManController() || !GetOldManController()->PlayerCameraManager) return;
@@ -445,7 +445,7 @@ void AOldManCharacter::StartRightMousePull()
 
     FVector TraceEnd = CameraLocation + CameraDirection * 10000.0f;
 
-    // Ի
+    // 调试绘制
     DrawDebugLine(GetWorld(), CameraLocation, TraceEnd, FColor::Cyan, false, 5.0f, 0, 2.0f);
 
     if (GetWorld()->LineTraceSingleByChannel(HitResult, CameraLocation, TraceEnd, ECC_Visibility, QueryParams))
@@ -457,7 +457,7 @@ void AOldManCharacter::StartRightMousePull()
             HitActor->StartDragging();
             curOldManPullItem = HitActor;
 
-            // е
+            // 绘制命中点
             DrawDebugSphere(GetWorld(), HitResult.Location, 15.0f, 12, FColor::Magenta, false, 5.0f, 0, 3.0f);
         }
     }
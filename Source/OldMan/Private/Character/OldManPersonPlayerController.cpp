@@ -4,7 +4,7 @@
 #include "EventManager/MyEventManager.h"
 #include "MonoManager/MonoManager.h"
 
-// Enhanced Input ͷļ
+// Enhanced Input 相关头文件
 #include "Components/InputComponent.h"
 #include "EnhancedInputComponent.h"
 #include "EnhancedInputSubsystems.h"
@@ -12,7 +12,7 @@
 
 AOldManPersonPlayerController::AOldManPersonPlayerController()
 {
-	// ʼ
+	// 初始化变量
 	CachedOldManCharacter = nullptr;
 	EnhancedInputComponent = nullptr;
 	CurrentCameraMode = TEXT("ThirdPerson");
@@ -22,12 +22,12 @@ void AOldManPersonPlayerController::BeginPlay()
 {
 	Super::BeginPlay();
 
-	// ģʽ
+	// 设置输入模式
 	FInputModeGameOnly InputMode;
 	SetInputMode(InputMode);
 	bShowMouseCursor = false;
 
-	// ע¼
+	// 注册事件监听
 	RegisterEventListeners();
 }
 
@@ -35,7 +35,7 @@ void AOldManPersonPlayerController::SetupInputComponent()
 {
 	Super::SetupInputComponent();
 
-	// ȡEnhanced Input
+	// 获取Enhanced Input组件
 	EnhancedInputComponent = Cast<UEnhancedInputComponent>(InputComponent);
 	if (!EnhancedInputComponent)
 	{
@@ -48,13 +48,13 @@ void AOldManPersonPlayerController::OnPossess(APawn* InPawn)
 {
 	Super::OnPossess(InPawn);
 
-	// ɫָ
+	// 缓存角色指针
 	CachedOldManCharacter = Cast<AOldManCharacter>(InPawn);
 }
 
 void AOldManPersonPlayerController::OnUnPossess()
 {
-	// ӳ
+	// 清除输入映射上下文
 	if (UEnhancedInputLocalPlayerSubsystem* Subsystem = ULocalPlayer::GetSubsystem<UEnhancedInputLocalPlayerSubsystem>(GetLocalPlayer()))
 	{
 		if (DefaultMappingContext)
@@ -63,7 +63,7 @@ void AOldManPersonPlayerController::OnUnPossess()
 		}
 	}
 
-	// 
+	// 清除缓存
 	CachedOldManCharacter = nullptr;
 	EnhancedInputComponent = nullptr;
 
@@ -84,13 +84,13 @@ void AOldManPersonPlayerController::BindCharacterInputs()
 		return;
 	}
 
-	// ӳĵϵͳ
+	// 添加输入映射上下文到本地玩家子系统
 	if (UEnhancedInputLocalPlayerSubsystem* Subsystem = ULocalPlayer::GetSubsystem<UEnhancedInputLocalPlayerSubsystem>(GetLocalPlayer()))
 	{
 		Subsystem->AddMappingContext(DefaultMappingContext, 0);
 	}
 
-	// ƶ붯
+	// 绑定移动输入动作
 	if (MoveAction)
 	{
 		EnhancedInputComponent->BindAction(MoveAction, ETriggerEvent::Triggered, this, &AOldManPersonPlayerController::HandleMove);
@@ -102,7 +102,7 @@ void AOldManPersonPlayerController::BindCharacterInputs()
 		EnhancedInputComponent->BindAction(LookAction, ETriggerEvent::Triggered, this, &AOldManPersonPlayerController::HandleLook);
 	}
 
-	// 󶨽ɫ
+	// 绑定角色动作输入
 	if (JumpAction)
 	{
 		EnhancedInputComponent->BindAction(JumpAction, ETriggerEvent::Started, this, &AOldManPersonPlayerController::HandleJumpStart);
@@ -128,7 +128,7 @@ void AOldManPersonPlayerController::BindCharacterInputs()
 
 	}
 
-	// 붯
+	// 绑定相机控制输入动作
 	if (ZoomInAction)
 	{
 		EnhancedInputComponent->BindAction(ZoomInAction, ETriggerEvent::Started, this, &AOldManPersonPlayerController::HandleZoomIn);
@@ -147,13 +147,13 @@ void AOldManPersonPlayerController::BindCharacterInputs()
 	UE_LOG(LogTemp, Log, TEXT("Enhanced Input bindings setup for OldMan character and camera"));
 }
 
-// ========== ƶ봦 ==========
+// ========== 移动输入处理函数 ==========
 void AOldManPersonPlayerController::HandleLook(const FInputActionValue& Value)
 {
 	if (!bInputEnabled)
 		return;
 
-	// ȡάֵ/ֱӽ룩
+	// 获取二维向量输入值（鼠标/手柄视角输入）
 	FVector2D LookAxisVector = Value.Get<FVector2D>();
 
 	if (LookAxisVector.IsNearlyZero())
@@ -163,7 +163,7 @@ void AOldManPersonPlayerController::HandleLook(const FInputActionValue& Value)
 	if (!CameraComp)
 		return;
 
-	// ӽתͨ
+	// 处理视角旋转，通过相机组件传递输入
 	float mouseSensitivity = CachedOldManCharacter ? CachedOldManCharacter->CharacterAttributes->MouseSensitivity : 1.0f;
 	CameraComp->SetCameraInput(LookAxisVector.Y * mouseSensitivity, LookAxisVector.X * mouseSensitivity);
 }
@@ -176,7 +176,7 @@ void AOldManPersonPlayerController::HandleMove(const FInputActionValue& Value)
 	FVector2D InputVal2D = Value.Get<FVector2D>();
 	FVector InputVal = FVector(InputVal2D.X, InputVal2D.Y, 0.0f);
 
-	// ƶ
+	// 设置移动输入
 	CachedOldManCharacter->SetMovementInput(InputVal);
 }
 
@@ -185,7 +185,7 @@ void AOldManPersonPlayerController::HandleMoveCancel(const FInputActionValue& Va
 	if (!bInputEnabled || !CachedOldManCharacter)
 		return;
 
-	// ƶ
+	// 清除移动输入
 	CachedOldManCharacter->SetMovementInput(FVector::ZeroVector);
 }
 
@@ -253,14 +253,14 @@ void AOldManPersonPlayerController::HandleStopRunning(const FInputActionValue& V
 	CachedOldManCharacter->SetRunning(false);
 }
 
-// ========== 봦 ==========
+// ========== 相机控制输入处理函数 ==========
 
 void AOldManPersonPlayerController::HandleZoomIn(const FInputActionValue& Value)
 {
 	if (!bInputEnabled)
 		return;
 
-	ZoomCamera(-50.0f); // С루
+	ZoomCamera(-50.0f); // 缩小距离（拉近）
 }
 
 void AOldManPersonPlayerController::HandleZoomOut(const FInputActionValue& Value)
@@ -268,7 +268,7 @@ void AOldManPersonPlayerController::HandleZoomOut(const FInputActionValue& Value
 	if (!bInputEnabled)
 		return;
 
-	ZoomCamera(50.0f); // 루Զ
+	ZoomCamera(50.0f); // 增大距离（拉远）
 }
 
 void AOldManPersonPlayerController::HandleCameraMode(const FInputActionValue& Value)
@@ -276,7 +276,7 @@ void AOldManPersonPlayerController::HandleCameraMode(const FInputActionValue& Va
 	if (!bInputEnabled)
 		return;
 
-	// лģʽ
+	// 切换相机模式
 	if (CurrentCameraMode == TEXT("ThirdPerson"))
 	{
 		SetCameraMode(TEXT("FirstPerson"));
@@ -291,7 +291,7 @@ void AOldManPersonPlayerController::HandleCameraMode(const FInputActionValue& Va
 	}
 }
 
-// ========== ƺ ==========
+// ========== 相机控制函数 ==========
 
 UOldManCameraComponent* AOldManPersonPlayerController::GetCameraComponent() const
 {
@@ -333,13 +333,13 @@ void AOldManPersonPlayerController::ZoomCamera(float Delta)
 	if (!CameraComp)
 		return;
 
-	// ȡǰ벢Ӧ
+	// 获取当前距离并应用增量
 	float CurrentDistance = CameraComp->CameraDistance;
 	float NewDistance = FMath::Clamp(CurrentDistance + Delta, 100.0f, 1000.0f);
 	CameraComp->SetCameraDistance(NewDistance);
 }
 
-// ========== ¼ ==========
+// ========== 事件处理 ==========
 
 void AOldManPersonPlayerController::RegisterEventListeners()
 {
@@ -348,7 +348,7 @@ void AOldManPersonPlayerController::RegisterEventListeners()
 	UMyEventManager* EventMgr = GetEventManager();
 	if (EventMgr)
 	{
-		// עɫ¼
+		// 注册角色事件监听
 		EventMgr->RegisterCppEvent<AOldManPersonPlayerController, EGameEventType, const FGameEventData&>(
 			FName("OldManCharacterEvents"),
 			this,
@@ -362,7 +362,7 @@ void AOldManPersonPlayerController::UnregisterEventListeners()
 	UMyEventManager* EventMgr = GetEventManager();
 	if (EventMgr)
 	{
-		// Ƴ¼
+		// 移除事件监听
 		EventMgr->RemoveCppEvent(FName("OldManCharacterEvents"));
 	}
 
@@ -377,23 +377,23 @@ void AOldManPersonPlayerController::OnCharacterEvent(EGameEventType EventType, c
 		HandleCharacterDeath();
 		break;
 	case EGameEventType::PlayerSpawned:
-		// ɫ
+		// 处理角色生成
 		UE_LOG(LogTemp, Log, TEXT("OldMan character spawned"));
 		break;
 	default:
-		// Զ¼
+		// 处理其他自定义事件
 		break;
 	}
 }
 
 void AOldManPersonPlayerController::HandleCharacterDeath()
 {
-	// ɫʱ
+	// 角色死亡时禁用输入
 	SetInputEnabled(false);
 
 	UE_LOG(LogTemp, Log, TEXT("OldMan character died, respawning in 3 seconds..."));
 
-	// ʱ
+	// 设置重生定时器
 	UMonoManager* MonoMgr = GetMonoManager();
 	if (MonoMgr)
 	{
@@ -403,13 +403,13 @@ void AOldManPersonPlayerController::HandleCharacterDeath()
 
 void AOldManPersonPlayerController::HandleCharacterRespawn()
 {
-	// 
+	// 启用输入
 	SetInputEnabled(true);
 
-	// ߼ɽɫ
+	// 这里可以添加重生逻辑，比如重新生成角色等
 	UE_LOG(LogTemp, Log, TEXT("Respawning OldMan character..."));
 
-	// ¼
+	// 触发重生事件
 	if (CachedOldManCharacter)
 	{
 		CachedOldManCharacter->TriggerSimpleCharacterEvent(EGameEventType::Custom, TEXT("CharacterRespawned"));
@@ -13,15 +13,15 @@ void UOldManAttackingState::Enter()
     if (AOldManCharacter* Character = GetOldManCharacter())
     {
         AttackStartTime = GetWorld()->GetTimeSeconds();
-        AttackDuration = 0.5f; // ʱ
+        AttackDuration = 0.5f; // 攻击动画持续时间
 
-        // Ź
+        // 播放攻击动画
         Character->PlayAttackAnimation();
 
-        // ִй
+        // 执行攻击检测
         PerformAttack(Character);
 
-        // 
+        // 清除攻击输入
         Character->bHasAttackInput = false;
     }
 }
@@ -45,7 +45,7 @@ void UOldManAttackingState::CheckStateTransitions()
         return;
     }
 
-    // ƶ״̬ת
+    // 攻击动画结束后根据移动状态转换
     float CurrentTime = GetWorld()->GetTimeSeconds();
     if (CurrentTime - AttackStartTime >= AttackDuration)
     {
@@ -72,7 +72,7 @@ void UOldManAttackingState::PerformAttack(AOldManCharacter* Character)
 {
     if (!Character) return;
 
-    // ִй
+    // 执行攻击检测
     Character->PerformAttackDetection();
 
     UE_LOG(LogTemp, Log, TEXT("Performing attack"));
@@ -18,29 +18,29 @@ void UOldManDeadState::Exit()
 
 void UOldManDeadState::Update(float DeltaTime)
 {
-    // ״̬Ҫ߼
+    // 死亡状态不需要更新逻辑
 }
 
 void UOldManDeadState::HandleDeath(AOldManCharacter* Character)
 {
     if (!Character) return;
 
-    // ƶ
+    // 禁用移动
     if (GetCharacterMovement())
     {
         GetCharacterMovement()->DisableMovement();
     }
 
-    // 
+    // 清除所有输入
     Character->MovementInputVector = FVector::ZeroVector;
     Character->bHasJumpInput = false;
     Character->bHasAttackInput = false;
     Character->bIsRunning = false;
 
-    // 
+    // 播放死亡动画
     Character->PlayDeathAnimation();
 
-    // ¼
+    // 触发死亡事件
     Character->TriggerSimpleCharacterEvent(EGameEventType::PlayerDied, TEXT("OldManDeath"));
 
     UE_LOG(LogTemp, Log, TEXT("Character has died"));
@@ -9,10 +9,10 @@ void UOldManDoubleJumpingState::Enter()
 
     if (AOldManCharacter* Character = GetOldManCharacter())
     {
-        // ö
+        // 禁用二段跳
         Character->hasIntoDoubleJump = true;
 
-        // Ӧöٶ
+        // 应用二段跳速度
         if (GetCharacterMovement() && Character->CharacterAttributes)
         {
             GetCharacterMovement()->JumpZVelocity = Character->CharacterAttributes->DoubleJumpVelocity;
@@ -22,7 +22,7 @@ void UOldManDoubleJumpingState::Enter()
 
         targetSpeed = Character->CharacterAttributes->MoveSpeedInDoubleJump;
 
-        // Ŷ
+        // 播放二段跳动画
         Character->PlayDoubleJumpAnimation();
     }
 }
@@ -36,7 +36,7 @@ void UOldManDoubleJumpingState::Update(float DeltaTime)
 {
     Super::Update(DeltaTime);
 
-    // ڿҲƶ
+    // 在空中也可以移动
     HandleMovementInAir(DeltaTime);
 
     CheckStateTransitions();
@@ -50,7 +50,7 @@ void UOldManDoubleJumpingState::CheckStateTransitions()
         return;
     }
 
-    // Ƿʼ
+    // 检查是否开始下落
     if (GetCharacterMovement() && GetCharacterMovement()->Velocity.Z <= 0)
     {
         CheckTransition(UOldManFallingState::StaticClass());
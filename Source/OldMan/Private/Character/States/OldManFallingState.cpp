@@ -23,7 +23,7 @@ void UOldManFallingState::Update(float DeltaTime)
 {
     Super::Update(DeltaTime);
 
-    // ڿҲƶ
+    // 在空中也可以移动
     HandleMovementInAir(DeltaTime);
 
     CheckStateTransitions();
@@ -40,14 +40,14 @@ void UOldManFallingState::CheckStateTransitions()
     AOldManCharacter* Character = GetOldManCharacter();
     if (!Character) return;
 
-    // ʹøɿؼ
+    // 使用更可靠的落地检测
     bool bIsActuallyGrounded = Character->IsActuallyGrounded();
     float TimeSinceLanding = Character->GetTimeSinceLastLanding();
 
     UE_LOG(LogTemp, VeryVerbose, TEXT("FallingState Check - IsGrounded: %d, TimeSinceLand: %.3f"),
         bIsActuallyGrounded, TimeSinceLanding);
 
-    // Ƿأʹøɵ
+    // 检查是否落地（使用更宽松的条件）
     if (!CheckFallingCondition() && (bIsActuallyGrounded || TimeSinceLanding < 0.3f))
     {
         UE_LOG(LogTemp, Log, TEXT("Transitioning from Falling to Land state"));
@@ -55,7 +55,7 @@ void UOldManFallingState::CheckStateTransitions()
         return;
     }
 
-    // 
+    // 检查二段跳输入
     if (HasJumpInput() && Character->CanDoubleJump())
     {
         CheckTransition(UOldManDoubleJumpingState::StaticClass());
@@ -13,7 +13,7 @@ void UOldManIdleState::Enter()
 
     if (AOldManCharacter* Character = GetOldManCharacter())
     {
-        // ƶٶȵٶ
+        // 重置移动速度到行走速度
         if (GetCharacterMovement() && Character->CharacterAttributes)
         {
             GetCharacterMovement()->MaxWalkSpeed = Character->CharacterAttributes->MoveSpeedInWalk;
@@ -21,7 +21,7 @@ void UOldManIdleState::Enter()
 
         targetSpeed = 0.0f;
 
-        // ͼ¼
+        // 调用蓝图动画事件
         Character->PlayMoveAnimation(0.0f, 0.0f);
     }
 }
@@ -68,7 +68,7 @@ void UOldManIdleState::CheckStateTransitions()
     {
         CheckTransition(UOldManWalkingState::StaticClass());
 
-        //ʱûܲ
+        //暂时没有跑步
         /*if (IsRunning())
         {
             CheckTransition(UOldManRunningState::StaticClass());
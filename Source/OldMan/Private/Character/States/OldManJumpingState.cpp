@@ -10,12 +10,12 @@ void UOldManJumpingState::Enter()
 
     if (AOldManCharacter* Character = GetOldManCharacter())
     {
-        // ӦԾٶ
+        // 应用跳跃速度
         if (GetCharacterMovement() && Character->CharacterAttributes)
         {
-            //Ծ
+            //重置跳跃输入
             ResetJumpInput(false);
-            // ö
+            // 重置二段跳
             Character->hasIntoDoubleJump = false;
 
             GetCharacterMovement()->JumpZVelocity = Character->CharacterAttributes->JumpVelocity;
@@ -24,7 +24,7 @@ void UOldManJumpingState::Enter()
 
         targetSpeed = Character->CharacterAttributes->MoveSpeedInJump;
 
-        // Ծ
+        // 播放跳跃动画
         Character->PlayJumpAnimation();
     }
 }
@@ -38,7 +38,7 @@ void UOldManJumpingState::Update(float DeltaTime)
 {
     Super::Update(DeltaTime);
 
-    // ڿҲƶ
+    // 在空中也可以移动
     HandleMovementInAir(DeltaTime);
 
     CheckStateTransitions();
@@ -53,14 +53,14 @@ void UOldManJumpingState::CheckStateTransitions()
         return;
     }
 
-    // Ƿʼ
+    // 检查是否开始下落
     if (GetCharacterMovement() && GetCharacterMovement()->Velocity.Z <= 0)
     {
         CheckTransition(UOldManFallingState::StaticClass());
         return;
     }
 
-    // 
+    // 检查二段跳输入
     if (HasJumpInput() && GetOldManCharacter()->CanDoubleJump())
     {
         CheckTransition(UOldManDoubleJumpingState::StaticClass());
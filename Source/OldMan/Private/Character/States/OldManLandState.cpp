@@ -13,12 +13,12 @@ void UOldManLandState::Enter()
     if (AOldManCharacter* Character = GetOldManCharacter())
     {
         LandStartTime = GetWorld()->GetTimeSeconds();
-        LandDuration = Character->CharacterAttributes->LandDuration; // ضʱ
+        LandDuration = Character->CharacterAttributes->LandDuration; // 落地动画持续时间
 
-        // ض
+        // 播放落地动画
         Character->PlayLandAnimation();
 
-        // ö
+        // 重置二段跳
         Character->hasIntoDoubleJump = false;
     }
 }
@@ -42,7 +42,7 @@ void UOldManLandState::CheckStateTransitions()
         return;
     }
 
-    // ضƶ״̬ת
+    // 落地动画结束后根据移动状态转换
     float CurrentTime = GetWorld()->GetTimeSeconds();
     if (CurrentTime - LandStartTime >= LandDuration)
     {
@@ -13,7 +13,7 @@ void UOldManRunningState::Enter()
 
     if (AOldManCharacter* Character = GetOldManCharacter())
     {
-        // ܲٶ
+        // 设置跑步速度
         if (GetCharacterMovement() && Character->CharacterAttributes)
         {
             GetCharacterMovement()->MaxWalkSpeed = Character->CharacterAttributes->MoveSpeedInWalk;
@@ -30,13 +30,13 @@ void UOldManRunningState::Update(float DeltaTime)
 {
     Super::Update(DeltaTime);
 
-    // ƶת
+    // 处理移动和旋转
     HandleMovement(DeltaTime);
 
-    // ¶
+    // 更新动画
     UpdateAnimation();
 
-    // ״̬ת
+    // 检查状态转换
     CheckStateTransitions();
 }
 
@@ -90,7 +90,7 @@ void UOldManRunningState::UpdateAnimation()
         float ForwardSpeed = FVector::DotProduct(Velocity, Forward);
         float RightSpeed = FVector::DotProduct(Velocity, Right);
 
-        // ܲ״̬ʹøĶ
+        // 跑步状态使用更快的动画混合
         Character->PlayMoveAnimation(ForwardSpeed * 1.5f, RightSpeed * 1.5f);
     }
 }
\ No newline at end of file
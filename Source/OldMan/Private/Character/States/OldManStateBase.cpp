@@ -14,7 +14,7 @@ void UOldManStateBase::Exit()
 {
     UE_LOG(LogTemp, Display, TEXT("%s : Exit"), *this->GetName());
 
-    // 
+    // 清除缓存
     CachedOldManCharacter = nullptr;
 
     OutPatchEvents();
@@ -34,7 +34,7 @@ void UOldManStateBase::HandleMovement(float DeltaTime)
             FVector MovementDirection = Character->GetMovementDirectionFromCamera();
             if (!MovementDirection.IsNearlyZero())
             {
-                //ȡzӰ
+                //取消z轴影响
                 FVector tempVector = GetCharacterMovement()->Velocity;
                 tempVector.Z = 0.0f;
                 float Speed = FMath::Lerp(tempVector.Size(), targetSpeed,
@@ -42,7 +42,7 @@ void UOldManStateBase::HandleMovement(float DeltaTime)
 
                 ApplyMovement(MovementDirection, Speed);
 
-                // ת
+                // 处理旋转
                 HandleRotation(DeltaTime);
             }
         }
@@ -58,7 +58,7 @@ void UOldManStateBase::HandleMovementInAir(float DeltaTime)
             FVector MovementDirection = Character->GetMovementDirectionFromCamera();
             if (!MovementDirection.IsNearlyZero())
             {
-                //ȡzӰ
+                //取消z轴影响
                 FVector tempVector = GetCharacterMovement()->Velocity;
                 tempVector.Z = 0.0f;
                 float Speed = FMath::Lerp(tempVector.Size(), targetSpeed,
@@ -66,13 +66,13 @@ void UOldManStateBase::HandleMovementInAir(float DeltaTime)
 
                 ApplyMovement(MovementDirection, Speed);
 
-                // ת
+                // 处理旋转
                 HandleRotation(DeltaTime);
             }
         }
-        else if (!HasMovementInput() && GetCharacterMovement())//ڿûƶ
+        else if (!HasMovementInput() && GetCharacterMovement())//在空中没有移动输入
         {
-            //洢xyֵ ֵ
+            //存储x，y值 插值运算
             int x = FMath::Lerp(GetCharacterMovement()->Velocity.X, 0, DeltaTime * Character->CharacterAttributes->SpeedChangeRateInAir);
             int y = FMath::Lerp(GetCharacterMovement()->Velocity.Y, 0, DeltaTime * Character->CharacterAttributes->SpeedChangeRateInAir);
 
@@ -129,10 +129,10 @@ bool UOldManStateBase::CheckFallingCondition()
     AOldManCharacter* Character = GetOldManCharacter();
     if (!Character) return false;
 
-    // ʹøɿļⷽ
+    // 使用更可靠的检测方法
     bool bIsFalling = Character->IsFalling();
 
-    // ־
+    // 调试日志
     if (bIsFalling)
     {
         UE_LOG(LogTemp, VeryVerbose, TEXT("Character is falling"));
@@ -170,7 +170,7 @@ void UOldManStateBase::ResetJumpInput(bool jumpInputActive)
 
 AOldManCharacter* UOldManStateBase::GetOldManCharacter()
 {
-    // ɫָ
+    // 缓存角色指针
     if (!CachedOldManCharacter)
     {
         CachedOldManCharacter = Cast<AOldManCharacter>(Owner.GetObject());
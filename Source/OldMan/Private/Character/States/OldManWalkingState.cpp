@@ -14,7 +14,7 @@ void UOldManWalkingState::Enter()
     if (AOldManCharacter* Character = GetOldManCharacter())
     {
         targetSpeed = Character->CharacterAttributes->MoveSpeedInWalk;
-        // ٶ
+        // 设置行走速度
         if (GetCharacterMovement() && Character->CharacterAttributes)
         {
             GetCharacterMovement()->MaxWalkSpeed = Character->CharacterAttributes->MoveSpeedInWalk;
@@ -31,13 +31,13 @@ void UOldManWalkingState::Update(float DeltaTime)
 {
     Super::Update(DeltaTime);
 
-    // ƶת
+    // 处理移动和旋转
     HandleMovement(DeltaTime);
 
-    // ¶
+    // 更新动画
     UpdateAnimation();
 
-    // ״̬ת
+    // 检查状态转换
     CheckStateTransitions();
 }
 
@@ -73,7 +73,7 @@ void UOldManWalkingState::CheckStateTransitions()
         return;
     }
 
-    //ʱûܲ
+    //暂时没有跑步
     //if (IsRunning())
     //{
     //    CheckTransition(UOldManRunningState::StaticClass());
@@ -85,7 +85,7 @@ void UOldManWalkingState::UpdateAnimation()
 {
     if (AOldManCharacter* Character = GetOldManCharacter())
     {
-        // ƶٶȺͷڶ
+        // 计算移动速度和方向用于动画混合
         FVector Velocity = Character->GetVelocity();
         FVector Forward = Character->GetActorForwardVector();
         FVector Right = Character->GetActorRightVector();
@@ -21,7 +21,7 @@ void AOldManGameMode::InitializeWorldState_Implementation()
 
     UE_LOG(LogTemp, Log, TEXT("Initializing my specific world state..."));
 
-    // ʼNPCϵͳ
+    // 初始化NPC、任务系统等
     // ...
 }
 
@@ -31,7 +31,7 @@ void AOldManGameMode::InitializePlayers_Implementation()
 
     UE_LOG(LogTemp, Log, TEXT("Initializing my specific players..."));
 
-    // Զҳʼ߼
+    // 自定义玩家初始化逻辑
     // ...
 }
 
@@ -39,7 +39,7 @@ FWorldConfig AOldManGameMode::GetWorldConfig_Implementation() const
 {
     FWorldConfig Config = Super::GetWorldConfig_Implementation();
 
-    // Զ
+    // 自定义配置
     Config.WorldName = "My Custom World";
     Config.WorldDescription = "This is my custom world implementation";
     Config.bLoadFromSave = true;
@@ -54,11 +54,11 @@ FPlayerSpawnConfig AOldManGameMode::GetPlayerSpawnConfig_Implementation() const
 {
     FPlayerSpawnConfig Config = Super::GetPlayerSpawnConfig_Implementation();
 
-    // Զ
+    // 自定义玩家生成配置
     Config.bShouldSpawnPlayer = true;
     Config.bUseRandomSpawn = true;
 
-    // ӿܵɵ
+    // 添加可能的生成点
     Config.PossibleSpawnPoints.Add(FTransform(FRotator(0, 0, 0), FVector(100, 200, 300)));
     Config.PossibleSpawnPoints.Add(FTransform(FRotator(0, 90, 0), FVector(-100, 150, 300)));
     Config.PossibleSpawnPoints.Add(FTransform(FRotator(0, 180, 0), FVector(50, -200, 300)));
@@ -72,8 +72,8 @@ void AOldManGameMode::OnMyWorldInitialized(bool bSuccess)
     {
         UE_LOG(LogTemp, Log, TEXT("My world initialized successfully!"));
 
-        // ʼɹִеĲ
-        // 翪ʼϷ߼ʾUI
+        // 世界初始化成功后执行的操作
+        // 比如开始游戏逻辑、显示UI等
     }
     else
     {
@@ -9,7 +9,7 @@
 #include "OldManCameraComponent.generated.h"
 
 /**
- *  - ϵͳ
+ * 老人相机组件 - 相机控制系统
  */
 UCLASS(ClassGroup = (Custom), meta = (BlueprintSpawnableComponent))
 class OLDMAN_API UOldManCameraComponent : public UActorComponent
@@ -23,11 +23,11 @@ protected:
     virtual void BeginPlay() override;
 
 public:
-    // ========== ʼ ==========
+    // ========== 相机初始化 ==========
     UFUNCTION(BlueprintCallable, Category = "Camera")
     void InitializeCameraComponents(USpringArmComponent* InCameraBoom, UCameraComponent* InFollowCamera);
 
-    // ==========  ==========
+    // ========== 相机控制 ==========
     UFUNCTION(BlueprintCallable, Category = "Camera")
     void SetCameraTarget(AActor* TargetActor);
 
@@ -46,7 +46,7 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Camera")
     void ShakeCamera(float Intensity, float Duration);
 
-    // ========== ģʽ ==========
+    // ========== 相机模式 ==========
     UFUNCTION(BlueprintCallable, Category = "Camera")
     void SetThirdPersonMode();
 
@@ -56,7 +56,7 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Camera")
     void SetFreeLookMode();
 
-    // ==========  ==========
+    // ========== 属性 ==========
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Camera")
     float CameraDistance = 300.0f;
 
@@ -82,47 +82,47 @@ public:
     float CameraRotationInterpSpeed = 10.0f;
 
 private:
-    // ɱ
+    // 弹簧臂组件引用
     UPROPERTY()
     USpringArmComponent* CameraBoom;
 
-    // 
+    // 跟随相机组件引用
     UPROPERTY()
     UCameraComponent* FollowCamera;
 
-    // Ŀɫ
+    // 目标角色
     UPROPERTY()
     AActor* TargetActor;
 
-    // ƽת
+    // 平滑相机旋转变量
     FRotator CurrentCameraRotation;
     FRotator DesiredCameraRotation;
 
-    // 봦 - Ϊֱöۼ
+    // 输入处理 - 改为直接设置而非累加
     float CurrentLookUpInput;
     float CurrentTurnInput;
 
-    // ƽ
+    // 输入平滑处理
     float SmoothedLookUpInput;
     float SmoothedTurnInput;
 
-    // ƽ
+    // 输入平滑参数
     UPROPERTY(EditAnywhere, Category = "Camera|Input")
     float InputSmoothingInterpSpeed = 12.0f;
 
-    // ر
+    // 震动相关变量
     bool bIsShaking;
     float ShakeIntensity;
     float ShakeDuration;
     float ShakeElapsed;
 
-    // ǰģʽ
+    // 当前相机模式
     FName CurrentCameraMode;
 
-    // ÿ֡
+    // 每帧更新
     virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
 
-    // º
+    // 更新函数
     void UpdateInputSmoothing(float DeltaTime);
     void UpdateCameraRotation(float DeltaTime);
     void UpdateCameraPosition(float DeltaTime);
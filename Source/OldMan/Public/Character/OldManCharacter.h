@@ -30,17 +30,17 @@ protected:
     virtual bool CanJumpInternal_Implementation() const override;
 
 private:
-    // Ľɫָ
+    // 缓存的角色控制器指针
     UPROPERTY()
     AOldManPersonPlayerController* OldManController;
 
-    // ȡɫ
+    // 获取角色控制器组件
     UFUNCTION(BlueprintCallable, Category = "Controller")
     AOldManPersonPlayerController* GetOldManController();
 
 #pragma region Control Param
 public:
-    // ==========  ==========
+    // ========== 相机组件 ==========
     UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Camera")
     USpringArmComponent* CameraBoom;
 
@@ -50,15 +50,15 @@ public:
     UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Camera")
     UOldManCameraComponent* CameraComponent;
 
-    // ========== ״̬ ==========
+    // ========== 状态机 ==========
     UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State Machine")
     UStateMachineBase* StateMachine;
 
-    // ========== ɫ ==========
+    // ========== 角色属性 ==========
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Attributes")
     UOldManCharacterAttributes* CharacterAttributes;
 
-    // ========== 뻺 ==========
+    // ========== 输入缓存 ==========
     UPROPERTY(BlueprintReadWrite, Category = "Input")
     FVector MovementInputVector;
 
@@ -68,7 +68,7 @@ public:
     UPROPERTY(BlueprintReadWrite, Category = "Input")
     bool bHasAttackInput;
 
-    // ========== ƶƽӿ ==========
+    // ========== 移动控制接口 ==========
     UFUNCTION(BlueprintCallable, Category = "Movement")
     void SetMovementInput(FVector inputDir);
 
@@ -81,7 +81,7 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Movement")
     void SetRunning(bool bRunning);
 
-    // ==========  ==========
+    // ========== 相机控制 ==========
     UFUNCTION(BlueprintCallable, Category = "Camera")
     void SetCameraDistance(float Distance);
 
@@ -100,7 +100,7 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Camera")
     void ShakeCamera(float Intensity, float Duration);
 
-    // ========== ״̬ѯ ==========
+    // ========== 状态查询 ==========
     UFUNCTION(BlueprintCallable, BlueprintPure, Category = "State")
     bool IsMoving() const;
 
@@ -116,7 +116,7 @@ public:
     UFUNCTION(BlueprintCallable, BlueprintPure, Category = "State")
     bool HasMovementInput() const;
 
-    // ========== ؼĽ ==========
+    // ========== 落地检测改进 ==========
     UFUNCTION(BlueprintCallable, Category = "Movement")
     bool IsActuallyGrounded() const;
 
@@ -126,7 +126,7 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Debug")
     void PrintMovementState() const;
 
-    // ========== ӿ ==========
+    // ========== 动画接口 ==========
     UFUNCTION(BlueprintImplementableEvent, Category = "Animation")
     void PlayMoveAnimation(float MovementSpeed, float Direction);
 
@@ -145,25 +145,25 @@ public:
     UFUNCTION(BlueprintImplementableEvent, Category = "Animation")
     void PlayLandAnimation();
 
-    // ========== ģ ==========
+    // ========== 模型设置 ==========
     UFUNCTION(BlueprintCallable, Category = "Character")
     void SetupCharacterMesh(USkeletalMesh* NewMesh, UClass* NewAnimClass);
 
-    // ========== սϵͳ ==========
+    // ========== 战斗系统 ==========
     UFUNCTION(BlueprintCallable, Category = "Combat")
     void PerformAttackDetection();
 
     UFUNCTION(BlueprintImplementableEvent, Category = "Combat")
     void OnAttackHit(AActor* HitActor);
 
-    // ==========  ==========
+    // ========== 相机属性 ==========
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Camera")
     float CameraDistance = 300.0f;
 
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Camera")
     FVector CameraOffset = FVector(0.0f, 0.0f, 75.0f);
 
-    // ========== ״̬ ==========
+    // ========== 状态变量 ==========
     UPROPERTY(BlueprintReadWrite, Category = "State")
     bool bIsRunning;
 
@@ -173,7 +173,7 @@ public:
     UPROPERTY(BlueprintReadWrite, Category = "State")
     float LastAttackTime;
 
-    // ========== ڲ ==========
+    // ========== 内部方法 ==========
     UFUNCTION(BlueprintCallable, Category = "Movement")
     void UpdateCharacterRotation(float DeltaTime, const FVector& DesiredDirection);
 
@@ -181,11 +181,11 @@ public:
     FVector GetMovementDirectionFromCamera() const;
 
 private:
-    // ؼĽ
+    // 落地检测改进
     float LastLandingTime;
     bool bWasFalling;
 
-    // ʼ
+    // 初始化函数
     void InitializeParam();
     void InitializeStateMachine();
     void InitializeCameraComponent();
@@ -193,13 +193,13 @@ private:
 
 #pragma region Item Param
 public:
-    //ʱ
+    //暂时放着
     FVector2D CurrentMouseDelta;
-    // ϶
+    // 拖动灵敏度
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Drag")
     float DragSensitivity = 0.001f;
 
-    // Сƶֵ
+    // 最小移动阈值
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Drag")
     float MinMovementThreshold = 0.01f;
 
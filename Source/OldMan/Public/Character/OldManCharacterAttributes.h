@@ -12,7 +12,7 @@ class OLDMAN_API UOldManCharacterAttributes : public UDataAsset
 	GENERATED_BODY()
 
 public:
-    // ƶ
+    // 移动属性
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Movement")
     float MoveSpeedInWalk = 600.0f;
 
@@ -25,7 +25,7 @@ public:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Movement")
     float MoveSpeedInAir = 600.0f;
 
-    //ʱûܲ
+    //暂时没有跑步
     //UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Movement")
     //float RunSpeed = 900.0f;
 
@@ -50,7 +50,7 @@ public:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Movement")
     float RotationRate = 10.0f;
 
-    // 
+    // 相机属性
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Camera")
     float CameraBoomLength = 300.0f;
 
@@ -60,18 +60,18 @@ public:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Camera")
     FRotator CameraRotationRate = FRotator(0.0f, 0.0f, 0.0f);
 
-    // 
+    // 鼠标灵敏度
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Camera", meta = (AllowPrivateAccess = "true"))
     float MouseSensitivity = 1.0f;
 
-    // 
+    // 动画混合属性
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Animation")
     float MovementBlendInterpSpeed = 12.0f;
 
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Animation")
     float RotationBlendInterpSpeed = 8.0f;
 
-    // 
+    // 攻击属性
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Combat")
     float AttackDamage = 10.0f;
 
@@ -7,13 +7,13 @@
 #include "InputActionValue.h"
 #include "OldManPersonPlayerController.generated.h"
 
-// ǰ
+// 前向声明
 class UInputMappingContext;
 class UInputAction;
 class UOldManCameraComponent;
 
 /**
- * ˽ɫҿ - 3CṹеController
+ * 老人角色玩家控制器 - 3C结构中的Controller部分
  */
 UCLASS()
 class OLDMAN_API AOldManPersonPlayerController : public AXyPlayerControllerBase
@@ -31,18 +31,18 @@ protected:
 
 	// ========== Enhanced Input System ==========
 
-	// ӳ
+	// 输入映射上下文
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Input")
 	UInputMappingContext* DefaultMappingContext;
 
-	// 붯 - ƶ
+	// 输入动作 - 移动
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Input")
 	UInputAction* MoveAction;
 
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Input")
 	UInputAction* LookAction;
 
-	// 붯 - ɫ
+	// 输入动作 - 角色动作
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Input")
 	UInputAction* JumpAction;
 
@@ -55,7 +55,7 @@ protected:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Input")
 	UInputAction* RightMouseAction;
 
-	// 붯 - 
+	// 输入动作 - 相机控制
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Input")
 	UInputAction* ZoomInAction;
 
@@ -65,12 +65,12 @@ protected:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Input")
 	UInputAction* CameraModeAction;
 
-	// 봦 - ƶ
+	// 输入处理函数 - 移动
 	void HandleMove(const FInputActionValue& Value);
 	void HandleMoveCancel(const FInputActionValue& Value);
 	void HandleLook(const FInputActionValue& Value);
 
-	// 봦 - ɫ
+	// 输入处理函数 - 角色动作
 	void HandleJumpStart(const FInputActionValue& Value);
 	void HandleJumpStop(const FInputActionValue& Value);
 	void HandleStartRunning(const FInputActionValue& Value);
@@ -80,48 +80,48 @@ protected:
 	void HandleRightMouseStart(const FInputActionValue& Value);
 	void HandleRightMouseStop(const FInputActionValue& Value);
 
-	// 봦 - 
+	// 输入处理函数 - 相机控制
 	void HandleZoomIn(const FInputActionValue& Value);
 	void HandleZoomOut(const FInputActionValue& Value);
 	void HandleCameraMode(const FInputActionValue& Value);
 
-	// Enhanced Input
+	// 绑定Enhanced Input
 	virtual void BindCharacterInputs() override;
 
-	// ==========  ==========
+	// ========== 相机控制 ==========
 
-	// ȡɫ
+	// 获取角色相机组件
 	UFUNCTION(BlueprintCallable, Category = "Camera")
 	UOldManCameraComponent* GetCameraComponent() const;
 
-	// ģʽ
+	// 设置相机模式
 	UFUNCTION(BlueprintCallable, Category = "Camera")
 	void SetCameraMode(FName NewMode);
 
-	// 
+	// 相机缩放
 	UFUNCTION(BlueprintCallable, Category = "Camera")
 	void ZoomCamera(float Delta);
 
-	// ========== ¼ ==========
+	// ========== 事件处理 ==========
 	virtual void RegisterEventListeners() override;
 	virtual void UnregisterEventListeners() override;
 
-	// д¼
+	// 重写父类事件处理函数
 	virtual void OnCharacterEvent(EGameEventType EventType, const FGameEventData& EventData) override;
 	virtual void HandleCharacterDeath() override;
 
-	// ɫ
+	// 处理角色重生
 	void HandleCharacterRespawn();
 
 private:
-	// Ľɫָ
+	// 缓存的角色指针
 	UPROPERTY()
 	class AOldManCharacter* CachedOldManCharacter;
 
-	// Enhanced Input
+	// Enhanced Input组件
 	UPROPERTY()
 	class UEnhancedInputComponent* EnhancedInputComponent;
 
-	// ǰģʽ
+	// 当前相机模式
 	FName CurrentCameraMode;
 };
\ No newline at end of file
@@ -6,8 +6,8 @@
 #include "OldManAttackingState.generated.h"
 
 /**
- * ״̬ - ɫйʱ״̬
- * תվߡܲ
+ * 攻击状态 - 角色进行攻击时的状态
+ * 可以转换到：站立、行走、跑步、死亡
  */
 UCLASS()
 class OLDMAN_API UOldManAttackingState : public UOldManStateBase
@@ -6,8 +6,8 @@
 #include "OldManDeadState.generated.h"
 
 /**
- * ״̬ - ɫʱ״̬
- * ״̬ת״̬
+ * 死亡状态 - 角色死亡时的状态
+ * 这是最终状态，不能转换到其他状态
  */
 UCLASS()
 class OLDMAN_API UOldManDeadState : public UOldManStateBase
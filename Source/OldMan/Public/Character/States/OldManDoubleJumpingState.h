@@ -6,8 +6,8 @@
 #include "OldManDoubleJumpingState.generated.h"
 
 /**
- * ״̬ - ɫڿнеڶԾʱ״̬
- * ת䡢
+ * 二段跳状态 - 角色在空中进行第二次跳跃时的状态
+ * 可以转换到：下落、死亡
  */
 UCLASS()
 class OLDMAN_API UOldManDoubleJumpingState : public UOldManStateBase
@@ -6,8 +6,8 @@
 #include "OldManFallingState.generated.h"
 
 /**
- * ״̬ - ɫڿʱ״̬
- * תء
+ * 下落状态 - 角色在空中下落时的状态
+ * 可以转换到：落地、二段跳、死亡
  */
 UCLASS()
 class OLDMAN_API UOldManFallingState : public UOldManStateBase
@@ -6,8 +6,8 @@
 #include "OldManIdleState.generated.h"
 
 /**
- * վ״̬ - ɫֹʱ״̬
- * תߡܲԾ
+ * 站立状态 - 角色静止时的状态
+ * 可以转换到：行走、跑步、跳跃、攻击、死亡
  */
 UCLASS()
 class OLDMAN_API UOldManIdleState : public UOldManStateBase
@@ -20,6 +20,6 @@ public:
 	virtual void Update(float DeltaTime) override;
 
 private:
-	// ״̬ת
+	// 检查状态转换条件
 	void CheckStateTransitions();
 };
\ No newline at end of file
@@ -6,8 +6,8 @@
 #include "OldManJumpingState.generated.h"
 
 /**
- * Ծ״̬ - ɫһԾʱ״̬
- * ת䡢
+ * 跳跃状态 - 角色第一次跳跃时的状态
+ * 可以转换到：下落、二段跳、死亡
  */
 UCLASS()
 class OLDMAN_API UOldManJumpingState : public UOldManStateBase
@@ -6,8 +6,8 @@
 #include "OldManLandState.generated.h"
 
 /**
- * ״̬ - ɫӿʱĶ״̬
- * תվߡܲ
+ * 落地状态 - 角色从空中落地时的短暂状态
+ * 可以转换到：站立、行走、跑步、死亡
  */
 UCLASS()
 class OLDMAN_API UOldManLandState : public UOldManStateBase
@@ -6,8 +6,8 @@
 #include "OldManRunningState.generated.h"
 
 /**
- * ܲ״̬ - ɫƶʱ״̬
- * תվߡԾ
+ * 跑步状态 - 角色快速移动时的状态
+ * 可以转换到：站立、行走、跳跃、攻击、死亡
  */
 UCLASS()
 class OLDMAN_API UOldManRunningState : public UOldManStateBase
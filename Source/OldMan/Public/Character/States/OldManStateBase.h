@@ -15,45 +15,45 @@ public:
     virtual void Update(float DeltaTime) override;
 
 protected:
-    // Ľɫָ
+    // 缓存的角色指针
     UPROPERTY()
     class AOldManCharacter* CachedOldManCharacter;
 
-    // ƶط
+    // 移动相关方法
     virtual void HandleMovement(float DeltaTime);
     void HandleRotation(float DeltaTime);
     void ApplyMovement(const FVector& Direction, float Speed);
     void Jump();
     void HandleMovementInAir(float DeltaTime);
 
-    //ط
+    //交互相关方法
     void HandlePullItem();
     void HandleInterectItem();
 
 
-    // ״̬鷽
+    // 状态检查方法
     bool CheckDeathCondition();
     bool CheckFallingCondition();
     bool CheckJumpCondition();
     bool CheckAttackCondition();
     bool CheckPullItemCondition();
 
-    // 
+    // 辅助方法
     class AOldManCharacter* GetOldManCharacter();
     class UCharacterMovementComponent* GetCharacterMovement();
 
-    // ״̬
+    // 输入状态
     bool HasMovementInput();
     bool HasJumpInput();
     bool HasAttackInput();
     bool IsRunning();
     void ResetJumpInput(bool jumpInputActive);
 
-    // ¼
+    // 事件管理
     void InPatchEvents();
     void OutPatchEvents();
 
-    //ʱ
+    //临时数据
     UPROPERTY()
     float targetSpeed;
 
@@ -6,8 +6,8 @@
 #include "OldManWalkingState.generated.h"
 
 /**
- * ״̬ - ɫƶʱ״̬
- * תվܲԾ
+ * 行走状态 - 角色正常移动时的状态
+ * 可以转换到：站立、跑步、跳跃、攻击、死亡
  */
 UCLASS()
 class OLDMAN_API UOldManWalkingState : public UOldManStateBase
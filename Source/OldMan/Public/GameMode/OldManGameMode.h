@@ -16,16 +16,16 @@ public:
 	AOldManGameMode();
 
 protected:
-    // дʼ
+    // 重写初始化方法
     virtual void LoadWorldResources_Implementation() override;
     virtual void InitializeWorldState_Implementation() override;
     virtual void InitializePlayers_Implementation() override;
 
-    // д÷
+    // 重写配置方法
     virtual FWorldConfig GetWorldConfig_Implementation() const override;
     virtual FPlayerSpawnConfig GetPlayerSpawnConfig_Implementation() const override;
 
-    // ¼
+    // 事件处理
     UFUNCTION()
     void OnMyWorldInitialized(bool bSuccess);
 
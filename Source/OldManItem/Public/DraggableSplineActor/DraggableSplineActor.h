@@ -32,7 +32,7 @@ protected:
     UPROPERTY(BlueprintReadWrite, Category = "Drag")
     float CurrentSplinePosition;
 
-    // ϶Ʋ
+    // 新增：拖动控制参数
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Drag")
     float DragSensitivity = 0.01f;
 
@@ -42,7 +42,7 @@ protected:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Drag")
     float DeadZone = 0.1f;
 
-    // Կӻ
+    // 调试可视化
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Debug")
     bool bShowDebugVisualization = true;
 
@@ -52,7 +52,7 @@ protected:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Debug")
     float DebugArrowSize = 50.0f;
 
-    // ༭Ԥ
+    // 编辑器预览功能
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Editor Preview",
         meta = (ClampMin = "0.0", ClampMax = "1.0", UIMin = "0.0", UIMax = "1.0"))
     float EditorPreviewPosition = 0.0f;
@@ -60,11 +60,11 @@ protected:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Editor Preview")
     bool bEnableEditorPreview = false;
 
-    // 洢ʼλúתã
+    // 存储初始位置和旋转（用于重置）
     FVector InitialMeshLocation;
     FRotator InitialMeshRotation;
 
-    // ƽƶֵ
+    // 新增：平滑移动插值
     FVector TargetLocation;
     FRotator TargetRotation;
     float MovementAlpha;
@@ -85,14 +85,14 @@ public:
     UFUNCTION(BlueprintCallable)
     FVector GetCurrentTangent() const;
 
-    // Կӻ
+    // 调试可视化函数
     UFUNCTION(BlueprintCallable)
     void SetDebugVisualization(bool bEnable) { bShowDebugVisualization = bEnable; }
 
     UFUNCTION(BlueprintCallable)
     void ToggleDebugVisualization() { bShowDebugVisualization = !bShowDebugVisualization; }
 
-    // ༭Ԥ
+    // 编辑器预览函数
     UFUNCTION(CallInEditor, BlueprintCallable, Category = "Editor Preview")
     void UpdateEditorPreview();
 
@@ -103,15 +103,15 @@ public:
     void ResetEditorPreview();
 
 protected:
-    // ƵԿӻ
+    // 绘制调试可视化
     void DrawDebugVisualization(const FVector& ViewDirection, float ProjectedMovement);
 
-    // ༭Ԥ
+    // 编辑器预览函数
     void UpdatePreviewPosition();
 
-    // λúת
+    // 设置网格体位置和旋转
     void SetMeshPositionAndRotation(const FVector& Location, const FRotator& Rotation);
 
-    // һƶ
+    // 新增：计算归一化移动量
     float CalculateNormalizedMovement(const FVector& ViewDirection, float Intensity);
 };
\ No newline at end of file